@@ -112,6 +112,7 @@ set(BS_BANSHEECORE_INC_PROFILING
 	"Include/BsProfilerGPU.h"
 	"Include/BsProfilingManager.h"
 	"Include/BsRenderStats.h"
+	"Include/BsProfilerTimeline.h"
 )
 
 set(BS_BANSHEECORE_INC_RENDERAPI
@@ -150,6 +151,7 @@ set(BS_BANSHEECORE_INC_RENDERAPI
 	"Include/BsDepthStencilState.h"
 	"Include/BsBlendState.h"
 	"Include/BsRenderAPI.h"
+	"Include/BsRenderCommandBuffer.h"
 	"Include/BsRenderAPIManager.h"
 	"Include/BsRenderAPIFactory.h"
 	"Include/BsRenderAPICapabilities.h"
@@ -202,6 +204,7 @@ set(BS_BANSHEECORE_INC_RESOURCES
 	"Include/BsShaderInclude.h"
 	"Include/BsResourceListenerManager.h"
 	"Include/BsIResourceListener.h"
+	"Include/BsResourcePackage.h"
 )
 
 set(BS_BANSHEECORE_SRC_UTILITY
@@ -220,12 +223,15 @@ set(BS_BANSHEECORE_INC_TEXT
 	"Include/BsFontImportOptions.h"
 	"Include/BsFontDesc.h"
 	"Include/BsFont.h"
+	"Include/BsGlyphCache.h"
+	"Include/BsGlyphRasterizer.h"
 )
 
 set(BS_BANSHEECORE_SRC_PROFILING
 	"Source/BsProfilerCPU.cpp"
 	"Source/BsProfilerGPU.cpp"
 	"Source/BsProfilingManager.cpp"
+	"Source/BsProfilerTimeline.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_COMPONENTS
@@ -358,6 +364,7 @@ set(BS_BANSHEECORE_SRC_RESOURCES
 	"Source/BsShaderInclude.cpp"
 	"Source/BsResourceListenerManager.cpp"
 	"Source/BsIResourceListener.cpp"
+	"Source/BsResourcePackage.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_MATERIAL
@@ -388,6 +395,7 @@ set(BS_BANSHEECORE_SRC_TEXT
 	"Source/BsFontImportOptions.cpp"
 	"Source/BsFontManager.cpp"
 	"Source/BsTextData.cpp"
+	"Source/BsGlyphCache.cpp"
 )
 
 set(BS_BANSHEECORE_SRC_RENDERAPI
@@ -422,6 +430,7 @@ set(BS_BANSHEECORE_SRC_RENDERAPI
 	"Source/BsVertexDeclaration.cpp"
 	"Source/BsVideoModeInfo.cpp"
 	"Source/BsRenderAPI.cpp"
+	"Source/BsRenderCommandBuffer.cpp"
 	"Source/BsRenderAPIManager.cpp"
 	"Source/BsRenderAPICapabilities.cpp"
 	"Source/BsViewport.cpp"
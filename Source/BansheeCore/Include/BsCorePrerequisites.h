@@ -211,6 +211,7 @@ namespace BansheeEngine
 	class Shader;
 	class Material;
     class RenderAPICore;
+	class RenderCommandBuffer;
     class RenderAPICapabilities;
     class RenderTarget;
 	class RenderTargetCore;
@@ -261,6 +262,11 @@ namespace BansheeEngine
 	class GpuProgramImportOptions;
 	class MeshImportOptions;
 	struct FontBitmap;
+	struct FontSource;
+	class GlyphCache;
+	class GlyphReferences;
+	class GlyphRasterizer;
+	class GlyphRasterizerFactory;
 	class GameObject;
 	class GpuResourceData;
 	struct RenderOperation;
@@ -347,6 +353,8 @@ namespace BansheeEngine
 	class Resource;
 	class Resources;
 	class ResourceManifest;
+	class ResourcePackage;
+	class SavedResourceData;
 	class Texture;
 	class Mesh;
 	class MeshBase;
@@ -485,6 +493,7 @@ namespace BansheeEngine
 		TID_CCharacterController = 1108,
 		TID_FPhysicsMesh = 1109,
 		TID_ShaderImportOptions = 1110,
+		TID_FontSource = 1111,
 	};
 }
 
@@ -20,6 +20,7 @@ namespace BansheeEngine
 	static StringID RBS_PerCamera = "PerCamera";
 	static StringID RBS_PerFrame = "PerFrame";
 	static StringID RBS_PerObject = "PerObject";
+	static StringID RBS_PerInstance = "PerInstance";
 
 	/**
 	 * Available parameter semantics that allow the renderer to identify the use of a GPU parameter specified in a shader.
@@ -15,13 +15,36 @@ namespace BansheeEngine
 	/**	Contains textures and data about every character for a bitmap font of a specific size. */
 	struct BS_CORE_EXPORT FontBitmap : public IReflectable
 	{
-		/**	Returns a character description for the character with the specified Unicode key. */
+		/**	
+		 * Returns a character description for the character with the specified Unicode key. If the character isn't part
+		 * of the font description it is rendered using the glyph cache, if the bitmap has one. Missing glyph is returned
+		 * if the character cannot be found or rendered.
+		 */
 		const CHAR_DESC& getCharDesc(UINT32 charId) const;
 
+		/** Returns the number of texture pages, including the pages of the glyph cache. */
+		UINT32 getNumTexturePages() const;
+
+		/** Returns the texture for the page with the specified index, as referenced by CHAR_DESC::page. */
+		HTexture getTexturePage(UINT32 page) const;
+
+		/** 
+		 * Prevents characters in the provided text from being evicted from the glyph cache for as long as the returned
+		 * object is alive. Should be held by anything that keeps generated text geometry around over multiple frames. 
+		 * Returns null if the bitmap has no glyph cache.
+		 */
+		SPtr<GlyphReferences> referenceGlyphs(const WString& text) const;
+
 		UINT32 size; /**< Font size for which the data is contained. */
 		FONT_DESC fontDesc; /**< Font description containing per-character and general font data. */
 		Vector<HTexture> texturePages; /**< Textures in which the character's pixels are stored. */
 
+		/** 
+		 * Renders characters not present in @p fontDesc on first use. Null if the font has no source to render
+		 * characters from. Not serialized.
+		 */
+		SPtr<GlyphCache> glyphCache;
+
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
 		/************************************************************************/
@@ -31,6 +54,24 @@ namespace BansheeEngine
 		virtual RTTITypeBase* getRTTI() const override;
 	};
 
+	/** Font file data and settings used for rendering characters that weren't rendered when the font was imported. */
+	struct BS_CORE_EXPORT FontSource : public IReflectable
+	{
+		FontSource();
+
+		Vector<UINT8> fontData; /**< Contents of the TrueType or OpenType font file. */
+		UINT32 dpi; /**< Dots per inch resolution to use when rendering the characters. */
+		FontRenderMode renderMode; /**< Determines how are characters rendered. */
+
+		/************************************************************************/
+		/* 								SERIALIZATION                      		*/
+		/************************************************************************/
+	public:
+		friend class FontSourceRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const override;
+	};
+
 	// TODO - When saved on disk font currently stores a copy of the texture pages. This should be acceptable
 	// if you import a new TrueType or OpenType font since the texture will be generated on the spot
 	// but if you use a bitmap texture to initialize the font manually, then you will potentially have duplicate textures.
@@ -53,9 +94,18 @@ namespace BansheeEngine
 		/**	Finds the available font bitmap size closest to the provided size. */
 		INT32 getClosestSize(UINT32 size) const;
 
+		/** Returns the source used for rendering characters not present in font bitmaps, or null if the font has none. */
+		SPtr<const FontSource> getSource() const { return mSource; }
+
 		/**	Creates a new font from the provided per-size font data. */
 		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/**	
+		 * Creates a new font from the provided per-size font data. Characters not present in the font data are rendered on
+		 * first use from the provided font source.
+		 */
+		static HFont create(const Vector<SPtr<FontBitmap>>& fontInitData, const SPtr<FontSource>& source);
+
 	public: // ***** INTERNAL ******
 		using Resource::initialize;
 
@@ -64,15 +114,19 @@ namespace BansheeEngine
 		 */
 
 		/**
-		 * Initializes the font with specified per-size font data.
+		 * Initializes the font with specified per-size font data, and an optional source for rendering characters not
+		 * present in the font data.
 		 *
 		 * @note	Internal method. Factory methods will call this automatically for you.
 		 */
-		void initialize(const Vector<SPtr<FontBitmap>>& fontData);
+		void initialize(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source);
 
 		/** Creates a new font as a pointer instead of a resource handle. */
 		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData);
 
+		/** Creates a new font as a pointer instead of a resource handle. */
+		static SPtr<Font> _createPtr(const Vector<SPtr<FontBitmap>>& fontInitData, const SPtr<FontSource>& source);
+
 		/** @} */
 
 	protected:
@@ -88,6 +142,7 @@ namespace BansheeEngine
 
 	private:
 		Map<UINT32, SPtr<FontBitmap>> mFontDataPerSize;
+		SPtr<FontSource> mSource;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
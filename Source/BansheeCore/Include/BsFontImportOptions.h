@@ -12,15 +12,6 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/**	Determines how is a font rendered into the bitmap texture. */
-	enum class FontRenderMode
-	{
-		Smooth, /*< Render antialiased fonts without hinting (slightly more blurry). */
-		Raster, /*< Render non-antialiased fonts without hinting (slightly more blurry). */
-		HintedSmooth, /*< Render antialiased fonts with hinting. */
-		HintedRaster /*< Render non-antialiased fonts with hinting. */
-	};
-
 	/**	Import options that allow you to control how is a font imported. */
 	class BS_CORE_EXPORT FontImportOptions : public ImportOptions
 	{
@@ -30,7 +21,11 @@ namespace BansheeEngine
 		/**	Sets font sizes that are to be imported. Sizes are in points. */
 		void setFontSizes(const Vector<UINT32>& fontSizes) { mFontSizes = fontSizes; }
 
-		/**	Adds an index range of characters to import.  */
+		/**	
+		 * Adds an index range of characters to import. Every character in the range that the font contains is rasterized
+		 * into the font's texture pages at import time, for every imported size. For large character sets (e.g. CJK)
+		 * prefer importing only the most used characters and enabling setDynamic().
+		 */
 		void addCharIndexRange(UINT32 from, UINT32 to);
 
 		/**	Clears all character indexes, so no character are imported. */
@@ -48,6 +43,12 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		void setItalic(bool italic) { mItalic = italic; }
 
+		/**	
+		 * Determines whether characters outside of the imported character ranges should be rendered at runtime, on first
+		 * use. When enabled the font file is stored with the font resource.
+		 */
+		void setDynamic(bool dynamic) { mDynamic = dynamic; }
+
 		/**	Gets the sizes that are to be imported. Ranges are defined as unicode numbers. */
 		Vector<UINT32> getFontSizes() const { return mFontSizes; }
 
@@ -66,6 +67,9 @@ namespace BansheeEngine
 		/**	Sets whether the italic font style should be used when rendering. */
 		bool getItalic() const { return mItalic; }
 
+		/**	Checks whether characters outside of the imported character ranges should be rendered at runtime. */
+		bool getDynamic() const { return mDynamic; }
+
 	private:
 		Vector<UINT32> mFontSizes;
 		Vector<std::pair<UINT32, UINT32>> mCharIndexRanges;
@@ -73,6 +77,7 @@ namespace BansheeEngine
 		FontRenderMode mRenderMode;
 		bool mBold;
 		bool mItalic;
+		bool mDynamic;
 
 		/************************************************************************/
 		/* 								SERIALIZATION                      		*/
@@ -11,19 +11,49 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
-	/**	Handles creation of fonts. */
+	/**	Handles creation of fonts, and keeps track of glyph caches used for rendering characters on demand. */
 	class BS_CORE_EXPORT FontManager : public Module<FontManager>
 	{
 	public:
 		/**	Creates a new font from the provided populated font data structure. */
 		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData) const;
 
+		/**
+		 * Creates a new font from the provided populated font data structure. Characters missing from the font data will
+		 * be rendered on first use from the provided font source.
+		 */
+		SPtr<Font> create(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source) const;
+
 		/**
 		 * Creates an empty font.
 		 *
 		 * @note	Internal method. Used by factory methods.
 		 */
 		SPtr<Font> _createEmpty() const;
+
+		/**
+		 * Registers a factory that is used for rendering characters on demand. Normally called by the plugin responsible
+		 * for importing fonts.
+		 */
+		void _setGlyphRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory);
+
+		/** Returns the factory registered with _setGlyphRasterizerFactory(), or null if none is registered. */
+		SPtr<GlyphRasterizerFactory> getGlyphRasterizerFactory() const;
+
+		/** Creates a new glyph cache and registers it so its atlas textures get updated every frame. */
+		SPtr<GlyphCache> _createGlyphCache(const SPtr<FontSource>& source, UINT32 size, UINT32 firstPage);
+
+		/** Uploads glyphs rendered during the current frame to the GPU. Should be called once per frame. */
+		void _update();
+
+	protected:
+		/** @copydoc Module::onShutDown */
+		void onShutDown() override;
+
+	private:
+		SPtr<GlyphRasterizerFactory> mRasterizerFactory;
+		Vector<std::weak_ptr<GlyphCache>> mGlyphCaches;
+		mutable Mutex mMutex;
 	};
 
 	/** @} */
@@ -55,11 +55,63 @@ namespace BansheeEngine
 		}
 	};
 
+	class BS_CORE_EXPORT FontSourceRTTI : public RTTIType<FontSource, IReflectable, FontSourceRTTI>
+	{
+	private:
+		ManagedDataBlock getFontData(FontSource* obj)
+		{
+			return ManagedDataBlock(obj->fontData.data(), (UINT32)obj->fontData.size());
+		}
+
+		void setFontData(FontSource* obj, ManagedDataBlock value)
+		{
+			// Do nothing as the data was already assigned when it was allocated
+		}
+
+		static UINT8* allocateFontData(FontSource* obj, UINT32 numBytes)
+		{
+			obj->fontData.resize(numBytes);
+			return obj->fontData.data();
+		}
+
+		UINT32& getDPI(FontSource* obj) { return obj->dpi; }
+		void setDPI(FontSource* obj, UINT32& value) { obj->dpi = value; }
+
+		FontRenderMode& getRenderMode(FontSource* obj) { return obj->renderMode; }
+		void setRenderMode(FontSource* obj, FontRenderMode& value) { obj->renderMode = value; }
+
+	public:
+		FontSourceRTTI()
+		{
+			addDataBlockField("fontData", 0, &FontSourceRTTI::getFontData, &FontSourceRTTI::setFontData, 0, 
+				&FontSourceRTTI::allocateFontData);
+			addPlainField("dpi", 1, &FontSourceRTTI::getDPI, &FontSourceRTTI::setDPI);
+			addPlainField("renderMode", 2, &FontSourceRTTI::getRenderMode, &FontSourceRTTI::setRenderMode);
+		}
+
+		const String& getRTTIName() override
+		{
+			static String name = "FontSource";
+			return name;
+		}
+
+		UINT32 getRTTIId() override
+		{
+			return TID_FontSource;
+		}
+
+		SPtr<IReflectable> newRTTIObject() override
+		{
+			return bs_shared_ptr_new<FontSource>();
+		}
+	};
+
 	class BS_CORE_EXPORT FontRTTI : public RTTIType<Font, Resource, FontRTTI>
 	{
 		struct FontInitData
 		{
 			Vector<SPtr<FontBitmap>> fontDataPerSize;
+			SPtr<FontSource> source;
 		};
 
 	private:
@@ -95,10 +147,19 @@ namespace BansheeEngine
 			initData->fontDataPerSize.resize(size);
 		}
 
+		SPtr<FontSource> getSource(Font* obj) { return obj->mSource; }
+		void setSource(Font* obj, SPtr<FontSource> value)
+		{
+			FontInitData* initData = any_cast<FontInitData*>(obj->mRTTIData);
+
+			initData->source = value;
+		}
+
 	public:
 		FontRTTI()
 		{
 			addReflectableArrayField("mBitmaps", 0, &FontRTTI::getBitmap, &FontRTTI::getNumBitmaps, &FontRTTI::setBitmap, &FontRTTI::setNumBitmaps);
+			addReflectablePtrField("mSource", 1, &FontRTTI::getSource, &FontRTTI::setSource);
 		}
 
 		const String& getRTTIName() override
@@ -131,7 +192,7 @@ namespace BansheeEngine
 			Font* font = static_cast<Font*>(obj);
 			FontInitData* initData = any_cast<FontInitData*>(font->mRTTIData);
 
-			font->initialize(initData->fontDataPerSize);
+			font->initialize(initData->fontDataPerSize, initData->source);
 
 			bs_delete(initData);
 		}
@@ -0,0 +1,188 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsFontDesc.h"
+#include "BsGlyphRasterizer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Renders characters of a single font size on first use and packs them into a set of dynamic atlas textures owned by
+	 * the cache. Used for characters that weren't baked into the font at import time, so fonts with large character sets
+	 * (e.g. CJK) only pay for the characters actually displayed.
+	 *
+	 * Glyphs are packed into horizontal shelves. When the atlas is full the least recently used glyph that isn't
+	 * referenced (see GlyphReferences) and wasn't used during the current frame is evicted to make room. Atlas changes
+	 * are uploaded to the GPU once per frame, from FontManager::_update().
+	 *
+	 * @note
+	 * Character descriptors returned by the cache remain valid for the lifetime of the cache, but once a glyph is evicted
+	 * its texture coordinates may point to a different glyph. Users that keep generated geometry around over multiple
+	 * frames must hold a GlyphReferences object for their characters.
+	 * @note
+	 * Kerning pairs are not provided for glyphs rendered by the cache.
+	 * @note
+	 * Thread safe.
+	 */
+	class BS_CORE_EXPORT GlyphCache
+	{
+		/** Range of unused pixels in a shelf. */
+		struct FreeSpan
+		{
+			UINT32 x;
+			UINT32 width;
+		};
+
+		/** A horizontal strip of an atlas page, holding glyphs no taller than the strip. */
+		struct Shelf
+		{
+			UINT32 y;
+			UINT32 height;
+			Vector<FreeSpan> freeSpans; /**< Sorted by position. */
+		};
+
+		/** A single atlas texture along with its CPU copy and packing information. */
+		struct Page
+		{
+			HTexture texture;
+			SPtr<PixelData> pixels;
+			Vector<Shelf> shelves; /**< Sorted by position. */
+			UINT32 shelfEnd; /**< Y coordinate at which the next shelf will be opened. */
+			bool dirty;
+		};
+
+		/** Area of an atlas page occupied by a single glyph. Includes padding. */
+		struct Region
+		{
+			UINT32 page;
+			UINT32 shelf;
+			UINT32 x;
+			UINT32 width;
+		};
+
+		/** Information about a single character requested from the cache. */
+		struct Glyph
+		{
+			CHAR_DESC desc;
+			Region region;
+			UINT32 refCount;
+			UINT64 lastUsedFrame;
+			UINT64 failedFrame; /**< Last frame during which the glyph couldn't be made resident. */
+			List<UINT32>::iterator lruEntry;
+			bool resident; /**< True if the glyph currently occupies space in the atlas. */
+			bool missing; /**< True if the font has no glyph for the character. */
+		};
+
+	public:
+		/** Width and height of a single atlas page, in pixels. */
+		static const UINT32 PAGE_SIZE = 512;
+
+		/** Maximum number of atlas pages the cache will allocate. */
+		static const UINT32 MAX_PAGES = 4;
+
+		/** Empty space left between glyphs, in pixels, to avoid bleeding when sampling. */
+		static const UINT32 PADDING = 1;
+
+		/**
+		 * Creates a new cache.
+		 *
+		 * @param[in]	source		Font file and render settings to render glyphs with.
+		 * @param[in]	size		Font size in points.
+		 * @param[in]	firstPage	Index assigned to the first atlas page of the cache in character descriptors. Should be
+		 *							the number of texture pages baked into the font bitmap the cache belongs to.
+		 */
+		GlyphCache(const SPtr<FontSource>& source, UINT32 size, UINT32 firstPage);
+		~GlyphCache();
+
+		/**
+		 * Returns the descriptor for the character with the specified Unicode key, rendering it into the atlas if it isn't
+		 * already there. Returns null if the font has no glyph for the character, or if there is no room for it in the
+		 * atlas.
+		 */
+		const CHAR_DESC* getCharDesc(UINT32 charId);
+
+		/** Returns the number of atlas pages currently allocated by the cache. */
+		UINT32 getNumTexturePages() const;
+
+		/** Returns the atlas texture with the specified index, relative to the first page of the cache. */
+		HTexture getTexturePage(UINT32 page) const;
+
+		/** Returns the number of characters currently occupying space in the atlas. */
+		UINT32 getNumResidentGlyphs() const;
+
+		/** @name Internal
+		 *  @{
+		 */
+
+		/**
+		 * Prevents the specified characters from being evicted until a matching call to _removeReferences(). Characters
+		 * not known to the cache are ignored and removed from @p charIds.
+		 */
+		void _addReferences(Vector<UINT32>& charIds);
+
+		/** Releases references added by _addReferences(). */
+		void _removeReferences(const Vector<UINT32>& charIds);
+
+		/** Uploads any modified atlas pages to the GPU. */
+		void _flush();
+
+		/** Releases the rasterizer. No new glyphs will be rendered after this is called. */
+		void _releaseRasterizer();
+
+		/** @} */
+	private:
+		/** Renders the glyph into the atlas, evicting other glyphs if needed. Returns false on failure. */
+		bool makeResident(Glyph& glyph);
+
+		/** Finds space in the atlas for an area of the specified size. Returns false if there is none. */
+		bool allocate(UINT32 width, UINT32 height, Region& region);
+
+		/** Returns space previously allocated with allocate() back to the atlas. */
+		void deallocate(const Region& region);
+
+		/**
+		 * Evicts the least recently used glyph not used during the current frame. Returns false if there are no glyphs
+		 * that can be evicted.
+		 */
+		bool evictOne();
+
+		/** Copies the glyph pixels into the CPU copy of its atlas page, and fills out its character descriptor. */
+		void writeGlyph(const RASTERIZED_GLYPH& rasterized, Glyph& glyph);
+
+		SPtr<FontSource> mSource;
+		SPtr<GlyphRasterizer> mRasterizer;
+		UINT32 mSize;
+		UINT32 mFirstPage;
+		bool mRasterizerFailed;
+
+		Vector<Page> mPages;
+		Map<UINT32, Glyph> mGlyphs;
+		List<UINT32> mLRU; // Least recently used first. Contains only resident glyphs with no references.
+		UINT32 mNumResident;
+		mutable Mutex mMutex;
+	};
+
+	/**
+	 * Keeps a set of characters in a GlyphCache from being evicted, for as long as the object is alive.
+	 *
+	 * @see		FontBitmap::referenceGlyphs
+	 */
+	class BS_CORE_EXPORT GlyphReferences
+	{
+	public:
+		GlyphReferences(const SPtr<GlyphCache>& cache, Vector<UINT32> charIds);
+		~GlyphReferences();
+
+	private:
+		SPtr<GlyphCache> mCache;
+		Vector<UINT32> mCharIds;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,52 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Text-Internal
+	 *  @{
+	 */
+
+	/**	Bitmap and metrics of a single glyph rendered at runtime. */
+	struct RASTERIZED_GLYPH
+	{
+		UINT32 width, height; /**< Width/height of the glyph bitmap in pixels. */
+		INT32 xOffset, yOffset; /**< Offset for the visible portion of the character in pixels. */
+		INT32 xAdvance, yAdvance; /**< Determines how much to advance the pen after writing this character, in pixels. */
+		Vector<UINT8> pixels; /**< Single channel, 8 bits per pixel, tightly packed. */
+	};
+
+	/**
+	 * Renders glyphs of a single font face at a single size. Used by GlyphCache for rendering characters that weren't
+	 * baked into the font at import time.
+	 */
+	class BS_CORE_EXPORT GlyphRasterizer
+	{
+	public:
+		virtual ~GlyphRasterizer() { }
+
+		/**
+		 * Renders the glyph for the character with the specified Unicode key. Returns false if the font has no glyph for
+		 * the character, or if the glyph couldn't be rendered.
+		 */
+		virtual bool rasterize(UINT32 charId, RASTERIZED_GLYPH& output) = 0;
+	};
+
+	/** Creates glyph rasterizers. Registered with the FontManager by the plugin that is able to parse font files. */
+	class BS_CORE_EXPORT GlyphRasterizerFactory
+	{
+	public:
+		virtual ~GlyphRasterizerFactory() { }
+
+		/**
+		 * Creates a rasterizer for the font file contained in @p source, at the specified size in points. Returns null if
+		 * the font file cannot be parsed.
+		 */
+		virtual SPtr<GlyphRasterizer> create(const SPtr<FontSource>& source, UINT32 size) = 0;
+	};
+
+	/** @} */
+}
@@ -96,6 +96,9 @@ namespace BansheeEngine
 		/** @copydoc IResourceListener::markListenerResourcesDirty */
 		virtual void _markResourcesDirty() { }
 
+		/** Called whenever a sampler state assigned to one of the parameters changes. */
+		virtual void _notifySamplerStatesChanged() { }
+
 	protected:
 		/**	Gets a descriptor for a data parameter with the specified name. */
 		GpuParamDataDesc* getParamDesc(const String& name) const;
@@ -242,9 +245,18 @@ namespace BansheeEngine
 		/** @copydoc GpuParamsBase::GpuParamsBase */
 		static SPtr<GpuParamsCore> create(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices);
 
+		/** 
+		 * Triggered whenever sampler states of a set of parameters change, either when assigned directly on the core
+		 * thread, or when a different sampler state is received from the sim thread.
+		 */
+		static Event<void(const GpuParamsCore*)> onSamplerStatesChanged;
+
 	protected:
 		friend class GpuParams;
 
+		/** @copydoc GpuParamsBase::_notifySamplerStatesChanged */
+		void _notifySamplerStatesChanged() override;
+
 		/** @copydoc GpuParamsBase::GpuParamsBase */
 		GpuParamsCore(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices);
 
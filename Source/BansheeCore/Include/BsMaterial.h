@@ -131,6 +131,9 @@ namespace BansheeEngine
 		MaterialBase() { }
 		virtual ~MaterialBase() { }
 
+		/** Index returned by TMaterial::getDataParamIdx() when a parameter cannot be found. */
+		static const UINT32 INVALID_PARAM_IDX;
+
 	protected:
 		/** Retrieves a list of all shader GPU parameters, and the GPU program variable names they map to. */
 		const Map<String, String>& getValidParamNames() const { return mValidParams; }
@@ -187,49 +190,49 @@ namespace BansheeEngine
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setFloat(const String& name, float value, UINT32 arrayIdx = 0)	{ return getParamFloat(name).set(value, arrayIdx); }
+		void setFloat(const String& name, float value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a color to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setColor(const String& name, const Color& value, UINT32 arrayIdx = 0) { return getParamColor(name).set(value, arrayIdx); }
+		void setColor(const String& name, const Color& value, UINT32 arrayIdx = 0) { setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 2D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec2(const String& name, const Vector2& value, UINT32 arrayIdx = 0)	{ return getParamVec2(name).set(value, arrayIdx); }
+		void setVec2(const String& name, const Vector2& value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec3(const String& name, const Vector3& value, UINT32 arrayIdx = 0)	{ return getParamVec3(name).set(value, arrayIdx); }
+		void setVec3(const String& name, const Vector3& value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4D vector to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setVec4(const String& name, const Vector4& value, UINT32 arrayIdx = 0)	{ return getParamVec4(name).set(value, arrayIdx); }
+		void setVec4(const String& name, const Vector4& value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 3x3 matrix to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setMat3(const String& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ return getParamMat3(name).set(value, arrayIdx); }
+		void setMat3(const String& name, const Matrix3& value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a 4x4 matrix to the shader parameter with the specified name. 
 		 *
 		 * Optionally if the parameter is an array you may provide an array index to assign the value to.
 		 */
-		void setMat4(const String& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ return getParamMat4(name).set(value, arrayIdx); }
+		void setMat4(const String& name, const Matrix4& value, UINT32 arrayIdx = 0)	{ setDataParam(getDataParamIdx(name), value, arrayIdx); }
 
 		/**   
 		 * Assigns a structure to the shader parameter with the specified name.
@@ -257,49 +260,49 @@ namespace BansheeEngine
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		float getFloat(const String& name, UINT32 arrayIdx = 0) const { return getParamFloat(name).get(arrayIdx); }
+		float getFloat(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<float>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a color assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Color getColor(const String& name, UINT32 arrayIdx = 0) const { return getParamColor(name).get(arrayIdx); }
+		Color getColor(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Color>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a 2D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector2 getVec2(const String& name, UINT32 arrayIdx = 0) const { return getParamVec2(name).get(arrayIdx); }
+		Vector2 getVec2(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Vector2>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a 3D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector3 getVec3(const String& name, UINT32 arrayIdx = 0) const { return getParamVec3(name).get(arrayIdx); }
+		Vector3 getVec3(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Vector3>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a 4D vector assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Vector4 getVec4(const String& name, UINT32 arrayIdx = 0) const { return getParamVec4(name).get(arrayIdx); }
+		Vector4 getVec4(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Vector4>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a 3x3 matrix assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Matrix3 getMat3(const String& name, UINT32 arrayIdx = 0) const { return getParamMat3(name).get(arrayIdx); }
+		Matrix3 getMat3(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Matrix3>(getDataParamIdx(name), arrayIdx); }
 
 		/**
 		 * Returns a 4x4 matrix assigned with the parameter with the specified name.
 		 *
 		 * Optionally if the parameter is an array you may provide an array index you which to retrieve.
 		 */
-		Matrix4 getMat4(const String& name, UINT32 arrayIdx = 0) const { return getParamMat4(name).get(arrayIdx); }
+		Matrix4 getMat4(const String& name, UINT32 arrayIdx = 0) const { return getDataParam<Matrix4>(getDataParamIdx(name), arrayIdx); }
 
 		/** Returns a texture assigned with the parameter with the specified name. */
 		TextureType getTexture(const String& name) const { return getParamTexture(name).get(); }
@@ -322,6 +325,38 @@ namespace BansheeEngine
 			return data;
 		}
 
+		/**
+		 * Resolves the name of a data parameter (any non-object parameter, excluding structures) into an index that can
+		 * be used with setDataParam() and getDataParam(). Logs a warning and returns INVALID_PARAM_IDX if the shader
+		 * has no data parameter with the provided name.
+		 *
+		 * @note	
+		 * Expected behavior is that you would resolve the index when initially constructing the material, and then use
+		 * it throughout material lifetime to assign and retrieve parameter values without any name lookups.
+		 * @note
+		 * If material shader changes the index will be invalidated.
+		 */
+		UINT32 getDataParamIdx(const String& name) const;
+
+		/**
+		 * Assigns a value to the data parameter at the specified index, as returned by getDataParamIdx(). The value is
+		 * written directly into the CPU copy of the parameter buffers, which are uploaded to the GPU at most once before
+		 * they are next used for rendering, regardless of how many parameters were changed.
+		 *
+		 * Logs a warning if the type of the value doesn't match the parameter type, or the array index is out of range.
+		 * Color and 4D vector values may be assigned to each other's parameters. Does nothing if the index is 
+		 * INVALID_PARAM_IDX.
+		 */
+		template <typename T>
+		void setDataParam(UINT32 paramIdx, const T& value, UINT32 arrayIdx = 0);
+
+		/**
+		 * Returns the value of the data parameter at the specified index, as returned by getDataParamIdx(). Returns a
+		 * default constructed value if the index is invalid, or if the parameter is not of the requested type.
+		 */
+		template <typename T>
+		T getDataParam(UINT32 paramIdx, UINT32 arrayIdx = 0) const;
+
 		/**
 		 * Returns a float GPU parameter. This parameter may be used for more efficiently getting/setting GPU parameter 
 		 * values than calling Material::get* / Material::set* methods. 
@@ -653,9 +688,27 @@ namespace BansheeEngine
 		/** Throw an exception if no shader is set, or no acceptable technique was found. */
 		void throwIfNotInitialized() const;
 
+		/**
+		 * Resolves all data parameters in the shader to the GPU parameters that reference them, so they can later be
+		 * accessed by index. Must be called whenever the shader, technique or GPU parameters change.
+		 */
+		void initDataParams();
+
+		/** Data parameter from the shader, along with all the GPU parameters that reference it. */
+		struct DataParamInfo
+		{
+			GpuParamDataType type;
+			UINT32 arraySize;
+			UINT32 cachedParamIdx;
+			Vector<std::pair<GpuParamsType, GpuParamDataDesc*>> gpuParams;
+		};
+
 		Vector<SPtr<PassParamsType>> mParametersPerPass;
 		ShaderType mShader;
 		SPtr<TechniqueType> mBestTechnique;
+
+		Vector<DataParamInfo> mDataParams;
+		UnorderedMap<String, UINT32> mDataParamLookup;
 	};
 
 	/** @} */
@@ -676,6 +729,12 @@ namespace BansheeEngine
 		/** Creates a new material with the specified shader. */
 		static SPtr<MaterialCore> create(const SPtr<ShaderCore>& shader);
 
+		/** 
+		 * Triggered whenever the set of GPU parameters used by a material is replaced, for example when its shader
+		 * changes. Any information cached from the previous parameters should be rebuilt.
+		 */
+		static Event<void(const MaterialCore*)> onParametersChanged;
+
 	private:
 		friend class Material;
 
@@ -6,6 +6,7 @@
 #include "BsCoreObject.h"
 #include "BsDrawOps.h"
 #include "BsIndexBuffer.h"
+#include "BsRangeAlloc.h"
 
 namespace BansheeEngine
 {
@@ -20,37 +21,28 @@ namespace BansheeEngine
 	 */
 	class BS_CORE_EXPORT MeshHeapCore : public CoreObjectCore
 	{
-		/**	Signifies how is a data chunk used. */
-		enum class UseFlags
-		{
-			Used, /**< Data chunk is used by both CPU and GPU. */
-			CPUFree, /**< Data chunk was released by CPU but not GPU. */
-			GPUFree, /**< Data chunk was released by GPU but not CPU. */
-			Free /**< Data chunk was released by both CPU and GPU. */
-		};
-
-		/**	Represents a continuous chunk of memory. */
-		struct ChunkData
-		{
-			UINT32 start, size;
-		};
-
 		/**	Represents an allocated piece of data representing a mesh. */
 		struct AllocatedData
 		{
-			UINT32 vertChunkIdx;
-			UINT32 idxChunkIdx;
+			UINT32 vertBlock;
+			UINT32 idxBlock;
 
-			UseFlags useFlags;
-			UINT32 eventQueryIdx;
+			UINT32 lastUsedFence;
 			SPtr<TransientMeshCore> mesh;
 		};
 
-		/**	Data about a GPU query. */
-		struct QueryData
+		/**	Event query marking the point in the GPU command stream after which a set of meshes is no longer used. */
+		struct FenceData
 		{
 			SPtr<EventQuery> query;
-			UINT32 queryId;
+			UINT32 id;
+		};
+
+		/**	Mesh that was deallocated while the GPU might still be using it. */
+		struct DeferredFree
+		{
+			UINT32 meshId;
+			UINT32 fenceId;
 		};
 
 	public:
@@ -84,14 +76,14 @@ namespace BansheeEngine
 		/** Resizes the index buffer so they max contain the provided number of indices. */
 		void growIndexBuffer(UINT32 numIndices);
 
+		/** Releases the vertex and index ranges used by the mesh with the provided ID. */
+		void freeMeshData(UINT32 meshId);
+
 		/**
-		 * Creates a new event query or returns an existing one from the pool if available. Returned value is an index 
-		 * into event query array.
+		 * Queues an event query after all the GPU commands issued so far. Meshes used after this call are associated with
+		 * the next fence.
 		 */
-		UINT32 createEventQuery();
-
-		/** Frees the event query with the specified index and returns it to the pool so it may be reused later. */
-		void freeEventQuery(UINT32 idx);
+		void issueFence();
 
 		/**	Gets internal vertex data for all the meshes. */
 		SPtr<VertexData> getVertexData() const;
@@ -116,18 +108,10 @@ namespace BansheeEngine
 		void notifyUsedOnGPU(UINT32 meshId);
 
 		/**
-		 * Called by an GPU event query when GPU processes the query. Normally signals the heap that the GPU is done with 
-		 * the mesh.
+		 * Called by an GPU event query when GPU processes the query. Signals the heap that the GPU is done with all meshes
+		 * used before the fence with the provided ID was issued, and releases the meshes deallocated in the meantime.
 		 */
-		static void queryTriggered(SPtr<MeshHeapCore> thisPtr, UINT32 meshId, UINT32 queryId);
-
-		/**
-		 * Attempts to reorganize the vertex and index buffer chunks in order to in order to make free memory contigous.
-		 *
-		 * @note	
-		 * This will not actually copy any data from index/vertex buffers, and will only modify the chunk descriptors.
-		 */
-		void mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx);
+		static void fenceTriggered(SPtr<MeshHeapCore> thisPtr, UINT32 fenceId);
 
 	private:
 		UINT32 mNumVertices;
@@ -139,24 +123,20 @@ namespace BansheeEngine
 		SPtr<VertexData> mVertexData;
 		SPtr<IndexBufferCore> mIndexBuffer;
 
-		Map<UINT32, AllocatedData> mMeshAllocData;
+		UnorderedMap<UINT32, AllocatedData> mMeshAllocData;
 
 		SPtr<VertexDataDesc> mVertexDesc;
 		IndexType mIndexType;
 
-		Vector<ChunkData> mVertChunks;
-		Vector<ChunkData> mIdxChunks;
-
-		Stack<UINT32> mEmptyVertChunks;
-		Stack<UINT32> mEmptyIdxChunks;
-
-		List<UINT32> mFreeVertChunks;
-		List<UINT32> mFreeIdxChunks;
+		RangeAlloc mVertAlloc;
+		RangeAlloc mIdxAlloc;
 
-		Vector<QueryData> mEventQueries; 
-		Stack<UINT32> mFreeEventQueries;
+		Queue<FenceData> mActiveFences;
+		Stack<SPtr<EventQuery>> mFreeEventQueries;
+		Queue<DeferredFree> mDeferredFrees;
 
-		UINT32 mNextQueryId;
+		UINT32 mNextFenceId;
+		UINT32 mCompletedFenceId;
 
 		static const float GrowPercent;
 	};
@@ -44,6 +44,13 @@ namespace BansheeEngine
 		const SPtr<GpuParamBlockBufferCore>& getBuffer() const { return mBuffer; }											\
 		const GpuParamBlockDesc& getDesc() const { return mBlockDesc; }														\
 																															\
+		/** Changes the buffer the entries of this block are written to and read from. */									\
+		void setBuffer(const SPtr<GpuParamBlockBufferCore>& buffer)															\
+		{																													\
+			mBuffer = buffer;																								\
+			mParams->setParamBlockBuffer(#Name, mBuffer);																	\
+		}																													\
+																															\
 	private:																												\
 		struct META_FirstEntry {};																							\
 		static void META_GetPrevEntries(Vector<GpuParamDataDesc>& params, META_FirstEntry id) { }							\
@@ -5,6 +5,7 @@
 #include "BsCorePrerequisites.h"
 #include "BsModule.h"
 #include "BsFrameAlloc.h"
+#include "BsProfilerTimeline.h"
 
 namespace BansheeEngine
 {
@@ -206,14 +207,22 @@ namespace BansheeEngine
 
 			/**
 			 * Starts profiling on the thread. New primary profiling block is created with the given name.
+			 *
+			 * @param[in]	_name			Name of the primary profiling block.
+			 * @param[in]	recordTimeline	If true a timeline event will be recorded for the start of the primary block.
 			 */
-			void begin(const char* _name);
+			void begin(const char* _name, bool recordTimeline);
 
 			/**
 			 * Ends profiling on the thread. You should end all samples before calling this, but if you don't they will be 
 			 * terminated automatically.
+			 *
+			 * @param[in]	recordTimeline	If true timeline events will be recorded for all blocks that get terminated.
 			 */
-			void end();
+			void end(bool recordTimeline);
+
+			/** Records a timeline event for the start or the end of a profiling block with the provided name. */
+			void recordTimelineEvent(const char* _name, bool isBegin);
 
 			/**
 			 * 	Deletes all internal profiling data and makes the object ready for another iteration. Should be called 
@@ -235,6 +244,10 @@ namespace BansheeEngine
 			FrameAlloc frameAlloc;
 			ActiveBlock activeBlock;
 			Stack<ActiveBlock, StdFrameAlloc<ActiveBlock>>* activeBlocks;
+
+			ProfilerString name;
+			ProfilerVector<ProfilerTimelineEvent> timelineEvents;
+			SpinLock timelineLock;
 		};
 
 	public:
@@ -304,6 +317,21 @@ namespace BansheeEngine
 		 */
 		CPUProfilerReport generateReport();
 
+		/**
+		 * Starts recording timestamped begin/end events for every sample on every profiled thread. Events keep being
+		 * recorded until endTimelineCapture() is called. Any events from a previous capture are discarded.
+		 */
+		void beginTimelineCapture();
+
+		/**
+		 * Stops the timeline capture started with beginTimelineCapture() and returns all events recorded since it was 
+		 * started.
+		 */
+		ProfilerTimeline endTimelineCapture();
+
+		/** Checks is a timeline capture currently in progress. */
+		bool isCapturingTimeline() const { return mIsCapturingTimeline; }
+
 	private:
 		/**
 		 * Calculates overhead that the timing and sampling methods themselves introduce so we might get more accurate 
@@ -322,6 +350,9 @@ namespace BansheeEngine
 
 		ProfilerVector<ThreadInfo*> mActiveThreads;
 		Mutex mThreadSync;
+
+		std::atomic<bool> mIsCapturingTimeline;
+		double mTimelineStartTimeMs;
 	};
 
 	/** Profiling entry containing information about a single CPU profiling block containing timing information. */
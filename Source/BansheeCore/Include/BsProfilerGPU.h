@@ -38,6 +38,9 @@ namespace BansheeEngine
 		UINT32 numGpuParamBufferBinds; /**< How many times was an GPU parameter buffer bound. */
 		UINT32 numGpuProgramBinds; /**< How many times was a GPU program bound. */
 
+		UINT32 numStateCacheHits; /**< How many binds were skipped because the state or object was already bound. */
+		UINT32 numStateCacheMisses; /**< How many binds were forwarded to the render API. */
+
 		UINT32 numResourceWrites; /**< How many times were GPU resources written to. */
 		UINT32 numResourceReads; /**< How many times were GPU resources read from. */
 
@@ -0,0 +1,80 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Profiling
+	 *  @{
+	 */
+
+	/** Formats a profiler timeline can be saved in. */
+	enum class ProfilerTimelineFormat
+	{
+		ChromeTrace, /**< JSON trace event format, readable by chrome://tracing and the Perfetto UI. */
+		Perfetto /**< Perfetto protobuf trace format. */
+	};
+
+	/** Single timestamped event recorded during a timeline capture. */
+	struct ProfilerTimelineEvent
+	{
+		ProfilerTimelineEvent(const char* _name, double _timeMs, bool _isBegin)
+			:name(_name), timeMs(_timeMs), isBegin(_isBegin)
+		{ }
+
+		ProfilerString name;
+		double timeMs; /**< Time at which the event occurred, as reported by PlatformUtility::queryPerformanceTimerMs(). */
+		bool isBegin; /**< True if the event marks the start of a profiling block, false if it marks its end. */
+	};
+
+	/** Contains all timeline events recorded on a single thread. */
+	struct ProfilerTimelineThread
+	{
+		ProfilerString name;
+		ProfilerVector<ProfilerTimelineEvent> events;
+	};
+
+	/**
+	 * Contains timestamped begin/end events of all profiling blocks, for all profiled threads, recorded during a timeline
+	 * capture. Unlike CPUProfilerReport the events are not aggregated, which allows individual frames to be inspected
+	 * in external trace viewers.
+	 */
+	class BS_CORE_EXPORT ProfilerTimeline
+	{
+	public:
+		ProfilerTimeline();
+
+		/** Returns a list of all threads that recorded at least one event during the capture. */
+		const ProfilerVector<ProfilerTimelineThread>& getThreads() const { return mThreads; }
+
+		/** Returns the time at which the capture was started, in milliseconds. */
+		double getStartTimeMs() const { return mStartTimeMs; }
+
+		/**
+		 * Saves the timeline to a file.
+		 *
+		 * @param[in]	path	Path of the file to write to. Any existing file will be overwritten.
+		 * @param[in]	format	Format to encode the timeline in.
+		 */
+		void save(const Path& path, ProfilerTimelineFormat format) const;
+
+		/** Writes the timeline to the provided stream in the Chrome trace event (JSON) format. */
+		void writeChromeTrace(const SPtr<DataStream>& stream) const;
+
+		/** Writes the timeline to the provided stream in the Perfetto protobuf format. */
+		void writePerfetto(const SPtr<DataStream>& stream) const;
+
+	private:
+		friend class ProfilerCPU;
+
+		/** Converts time reported by the profiler into nanoseconds relative to the capture start. */
+		UINT64 toRelativeNs(double timeMs) const;
+
+		ProfilerVector<ProfilerTimelineThread> mThreads;
+		double mStartTimeMs;
+	};
+
+	/** @} */
+}
@@ -60,6 +60,25 @@ namespace BansheeEngine
 		 */
 		const ProfilerReport& getReport(ProfiledThread thread, UINT32 idx = 0) const;
 
+		/**
+		 * Records a timeline of all profiling samples on all profiled threads (sim, core and any worker threads that
+		 * issue samples) for the specified number of frames, and saves it to a file once done. Capture starts on the
+		 * next frame.
+		 *
+		 * @param[in]	numFrames	Number of frames to capture.
+		 * @param[in]	outputPath	Path of the file to write the timeline to.
+		 * @param[in]	format		Format to save the timeline in.
+		 *
+		 * @note	
+		 * Useful for diagnosing individual frame spikes, which get lost in the aggregated data provided by getReport().
+		 * Any capture that is already in progress will be discarded.
+		 */
+		void captureTimeline(UINT32 numFrames, const Path& outputPath, 
+			ProfilerTimelineFormat format = ProfilerTimelineFormat::ChromeTrace);
+
+		/** Checks is a timeline capture requested through captureTimeline() still in progress. */
+		bool isCapturingTimeline() const { return mTimelineFramesLeft > 0; }
+
 	private:
 		static const UINT32 NUM_SAVED_FRAMES;
 		ProfilerReport* mSavedSimReports;
@@ -69,6 +88,11 @@ namespace BansheeEngine
 		UINT32 mNextCoreReportIdx;
 
 		mutable Mutex mSync;
+
+		UINT32 mTimelineFramesLeft;
+		bool mTimelineStartPending;
+		Path mTimelinePath;
+		ProfilerTimelineFormat mTimelineFormat;
 	};
 
 	/** Easy way to access ProfilingManager. */
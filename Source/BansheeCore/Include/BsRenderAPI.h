@@ -339,6 +339,15 @@ namespace BansheeEngine
 		 */
 		virtual const String& getShadingLanguageName() const = 0;
 
+		/**
+		 * Returns the name of another render API whose techniques should be used for shaders that have no technique
+		 * supported by this render API, or StringID::NONE if there is no fallback. Used by render APIs that don't have
+		 * shaders written specifically for them.
+		 *
+		 * @note	Thread safe.
+		 */
+		virtual const StringID& getTechniqueFallbackName() const { return StringID::NONE; }
+
 		/**
 		 * Sets a sampler state for the specified texture unit.
 		 *
@@ -348,7 +357,7 @@ namespace BansheeEngine
 		 *
 		 * @see		SamplerState
 		 */
-		virtual void setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) = 0;
+		void setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState);
 
 		/**
 		 * Sets a blend state used for all active render targets.
@@ -357,7 +366,7 @@ namespace BansheeEngine
 		 *
 		 * @see		BlendState
 		 */
-		virtual void setBlendState(const SPtr<BlendStateCore>& blendState) = 0;
+		void setBlendState(const SPtr<BlendStateCore>& blendState);
 
 		/**
 		 * Sets a state that controls various rasterizer options. 
@@ -366,7 +375,7 @@ namespace BansheeEngine
 		 *
 		 * @see		RasterizerState
 		 */
-		virtual void setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState) = 0;
+		void setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState);
 
 		/**
 		 * Sets a state that controls depth & stencil buffer options.
@@ -376,7 +385,7 @@ namespace BansheeEngine
 		 *
 		 * @see		DepthStencilState
 		 */
-		virtual void setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) = 0;
+		void setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue);
 
 		/**
 		 * Binds a texture to the pipeline for the specified GPU program type at the specified slot. If the slot matches 
@@ -387,7 +396,7 @@ namespace BansheeEngine
 		 * @param[in]	enabled			True to bind the texture at the specified unit, false to unbind.
 		 * @param[in]	texPtr			Texture to bind.
 		 */
-		virtual void setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) = 0;
+		void setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr);
 
 		/**	
 		 * Removes a texture at the specified texture unit.
@@ -406,8 +415,8 @@ namespace BansheeEngine
 		 * @param[in]	texPtr			Texture to bind.
 		 * @param[in]	surface			Determines which surface of the texture to bind.
 		 */
-		virtual void setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled,
-			const SPtr<TextureCore>& texPtr, const TextureSurface& surface) = 0;
+		void setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr, 
+			const TextureSurface& surface);
 
 		/**
 		 * Signals that rendering for a specific viewport has started. Any draw calls need to be called between beginFrame()
@@ -433,7 +442,7 @@ namespace BansheeEngine
 		 * @param[in]	buffers		A list of buffers to bind to the pipeline.
 		 * @param[in]	numBuffers	Number of buffers in the @p buffers list.
 		 */
-		virtual void setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) = 0;
+		void setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers);
 
 		/**
 		 * Sets an index buffer to use when drawing. Indices in an index buffer reference vertices in the vertex buffer, 
@@ -441,7 +450,7 @@ namespace BansheeEngine
 		 *
 		 * @param[in]	buffer	Index buffer to bind, null to unbine.
 		 */
-		virtual void setIndexBuffer(const SPtr<IndexBufferCore>& buffer) = 0;
+		void setIndexBuffer(const SPtr<IndexBufferCore>& buffer);
 
 		/**
 		 * Sets the vertex declaration to use when drawing. Vertex declaration is used to decode contents of a single 
@@ -449,14 +458,14 @@ namespace BansheeEngine
 		 *
 		 * @param[in]	vertexDeclaration	Vertex declaration to bind.
 		 */
-		virtual void setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration) = 0;
+		void setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration);
 
 		/** 
 		 * Sets the draw operation that determines how to interpret the elements of the index or vertex buffers. 
 		 *
 		 * @param[in]	op	Draw operation to enable.
 		 */
-		virtual void setDrawOperation(DrawOperationType op) = 0;
+		void setDrawOperation(DrawOperationType op);
 
 		/**
 		 * Draw an object based on currently bound GPU programs, vertex declaration and vertex buffers. Draws directly from
@@ -515,7 +524,7 @@ namespace BansheeEngine
 		 *
 		 * @note	You need to bind at least a vertex and a fragment program in order to draw something.
 		 */
-		virtual void bindGpuProgram(const SPtr<GpuProgramCore>& prg);
+		void bindGpuProgram(const SPtr<GpuProgramCore>& prg);
 
 		/**
 		 * Binds constant(uniform) GPU program parameters. Caller must ensure these match the previously bound GPU program.
@@ -539,7 +548,7 @@ namespace BansheeEngine
 		 *
 		 * @param[in]	gptype	GPU program slot to unbind the program from.
 		 */
-		virtual void unbindGpuProgram(GpuProgramType gptype);
+		void unbindGpuProgram(GpuProgramType gptype);
 
 		/**	Query if a GPU program of a given type is currently bound. */
 		virtual bool isGpuProgramBound(GpuProgramType gptype);
@@ -609,7 +618,23 @@ namespace BansheeEngine
 		 *										(if any was provided). This allows the depth buffer to be bound for depth 
 		 *										testing, as well as reading in a shader, at the same time.
 		 */
-        virtual void setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil = false) = 0;
+		void setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil = false);
+
+		/**
+		 * Forgets all states and objects remembered as bound to the pipeline, ensuring the next bind of each reaches the
+		 * render API even if the same object is provided again.
+		 *
+		 * Binding methods (states, GPU programs, textures, samplers, buffers, vertex declaration and draw operation) skip
+		 * the call if the provided object is already bound. Call this whenever the pipeline state is modified without
+		 * going through this interface, e.g. after a device reset or context switch.
+		 */
+		void invalidateStateCache();
+
+		/**
+		 * Executes all commands recorded in the provided buffer, in the order they were recorded. Commands are executed
+		 * the same as if they were issued directly on this object.
+		 */
+		void executeCommands(const RenderCommandBuffer& commands);
 
 		/**
 		 * Returns information about available output devices and their video modes.
@@ -689,6 +714,61 @@ namespace BansheeEngine
 		/** @copydoc setClipPlanes */
 		virtual void setClipPlanesImpl(const PlaneList& clipPlanes) = 0;
 
+		/** @copydoc setSamplerState */
+		virtual void setSamplerStateImpl(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) = 0;
+
+		/** @copydoc setBlendState */
+		virtual void setBlendStateImpl(const SPtr<BlendStateCore>& blendState) = 0;
+
+		/** @copydoc setRasterizerState */
+		virtual void setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState) = 0;
+
+		/** @copydoc setDepthStencilState */
+		virtual void setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) = 0;
+
+		/** @copydoc setTexture */
+		virtual void setTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) = 0;
+
+		/** @copydoc setLoadStoreTexture */
+		virtual void setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled,
+			const SPtr<TextureCore>& texPtr, const TextureSurface& surface) = 0;
+
+		/** @copydoc setVertexBuffers */
+		virtual void setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) = 0;
+
+		/** @copydoc setIndexBuffer */
+		virtual void setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer) = 0;
+
+		/** @copydoc setVertexDeclaration */
+		virtual void setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration) = 0;
+
+		/** @copydoc setDrawOperation */
+		virtual void setDrawOperationImpl(DrawOperationType op) = 0;
+
+		/** @copydoc bindGpuProgram */
+		virtual void bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg) = 0;
+
+		/** @copydoc unbindGpuProgram */
+		virtual void unbindGpuProgramImpl(GpuProgramType gptype) = 0;
+
+		/** @copydoc setRenderTarget */
+		virtual void setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil) = 0;
+
+		/** 
+		 * Forgets textures and load-store textures remembered as bound. Render APIs may implicitly unbind a texture when
+		 * it is bound for writing, so those bindings can't be trusted after a render target change.
+		 */
+		void invalidateTextureStateCache();
+
+		/**
+		 * Forgets sampler states remembered as bound. Render APIs that apply sampler state to the currently bound texture
+		 * or program, rather than to the texture unit itself, must call this whenever either of those changes.
+		 *
+		 * @param[in]	gptype	Program type whose samplers to forget.
+		 * @param[in]	texUnit	Texture unit whose sampler to forget, or -1 to forget samplers on all units.
+		 */
+		void invalidateSamplerStateCache(GpuProgramType gptype, INT32 texUnit = -1);
+
 		/************************************************************************/
 		/* 								INTERNAL DATA					       	*/
 		/************************************************************************/
@@ -713,6 +793,53 @@ namespace BansheeEngine
 
 		RenderAPICapabilities* mCurrentCapabilities;
 		SPtr<VideoModeInfo> mVideoModeInfo;
+
+	private:
+		static const UINT32 NUM_GPU_PROGRAM_TYPES = GPT_COMPUTE_PROGRAM + 1;
+
+		/** Value last provided to one of the binding methods. Considered unknown until set. */
+		template<class T>
+		struct CachedBinding
+		{
+			CachedBinding()
+				:value(), isValid(false)
+			{ }
+
+			/** Checks if the provided value is known to be bound already. */
+			bool matches(const T& other) const { return isValid && value == other; }
+
+			void set(const T& other) { value = other; isValid = true; }
+			void invalidate() { value = T(); isValid = false; }
+
+			T value;
+			bool isValid;
+		};
+
+		/** Load-store texture last bound to a slot, along with the bound surface. */
+		struct CachedLoadStoreTexture
+		{
+			CachedLoadStoreTexture()
+				:isValid(false)
+			{ }
+
+			SPtr<TextureCore> texture;
+			TextureSurface surface;
+			bool isValid;
+		};
+
+		CachedBinding<SPtr<BlendStateCore>> mCachedBlendState;
+		CachedBinding<SPtr<RasterizerStateCore>> mCachedRasterizerState;
+		CachedBinding<SPtr<DepthStencilStateCore>> mCachedDepthStencilState;
+		UINT32 mCachedStencilRefValue;
+		CachedBinding<SPtr<VertexDeclarationCore>> mCachedVertexDeclaration;
+		CachedBinding<SPtr<IndexBufferCore>> mCachedIndexBuffer;
+		CachedBinding<DrawOperationType> mCachedDrawOp;
+		Vector<CachedBinding<SPtr<VertexBufferCore>>> mCachedVertexBuffers;
+
+		CachedBinding<SPtr<GpuProgramCore>> mCachedPrograms[NUM_GPU_PROGRAM_TYPES];
+		Vector<CachedBinding<SPtr<SamplerStateCore>>> mCachedSamplers[NUM_GPU_PROGRAM_TYPES];
+		Vector<CachedBinding<SPtr<TextureCore>>> mCachedTextures[NUM_GPU_PROGRAM_TYPES];
+		Vector<CachedLoadStoreTexture> mCachedLoadStoreTextures[NUM_GPU_PROGRAM_TYPES];
 	};
 
 	/** @} */
@@ -63,6 +63,7 @@ namespace BansheeEngine
 		RSC_HWRENDER_TO_VERTEX_BUFFER	= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 27), /**< Supports rendering to vertex buffers. */
 		RSC_TESSELLATION_PROGRAM		= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 28), /**< Supports hardware tessellation programs. */
 		RSC_COMPUTE_PROGRAM				= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 29), /**< Supports hardware compute programs. */
+		RSC_INSTANCING					= BS_CAPS_VALUE(CAPS_CATEGORY_COMMON, 30), /**< Supports drawing multiple instances of a mesh using a single draw call. */
 
 		// ***** DirectX 9 specific caps *****
 		RSC_PERSTAGECONSTANT = BS_CAPS_VALUE(CAPS_CATEGORY_D3D9, 0), /**< Are per stage constants supported. */
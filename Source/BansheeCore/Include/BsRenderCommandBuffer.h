@@ -0,0 +1,202 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+#include "BsGpuProgram.h"
+#include "BsDrawOps.h"
+#include "BsColor.h"
+#include "BsRect2.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderAPI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Records render API commands (state and resource binds, clears and draws) so they can be executed at a later time
+	 * through RenderAPICore::executeCommands().
+	 *
+	 * Unlike RenderAPICore, commands can be recorded from any thread. This allows multiple threads to prepare rendering
+	 * work in parallel, each recording into its own buffer, after which the core thread executes the buffers in the
+	 * order they need to be submitted in. Recording only stores references to the provided objects, so any changes made
+	 * to those objects before the buffer is executed will be reflected in the executed commands.
+	 *
+	 * @note	A single buffer must not be recorded into from multiple threads at once.
+	 */
+	class BS_CORE_EXPORT RenderCommandBuffer
+	{
+	public:
+		/** @copydoc RenderAPICore::setSamplerState */
+		void setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState);
+
+		/** @copydoc RenderAPICore::setBlendState */
+		void setBlendState(const SPtr<BlendStateCore>& blendState);
+
+		/** @copydoc RenderAPICore::setRasterizerState */
+		void setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState);
+
+		/** @copydoc RenderAPICore::setDepthStencilState */
+		void setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue);
+
+		/** @copydoc RenderAPICore::setTexture */
+		void setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr);
+
+		/** @copydoc RenderAPICore::setLoadStoreTexture */
+		void setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr,
+			const TextureSurface& surface);
+
+		/** @copydoc RenderAPICore::setViewport */
+		void setViewport(const Rect2& area);
+
+		/** @copydoc RenderAPICore::setScissorRect */
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom);
+
+		/** @copydoc RenderAPICore::setVertexBuffers */
+		void setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers);
+
+		/** @copydoc RenderAPICore::setIndexBuffer */
+		void setIndexBuffer(const SPtr<IndexBufferCore>& buffer);
+
+		/** @copydoc RenderAPICore::setVertexDeclaration */
+		void setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration);
+
+		/** @copydoc RenderAPICore::setDrawOperation */
+		void setDrawOperation(DrawOperationType op);
+
+		/** @copydoc RenderAPICore::bindGpuProgram */
+		void bindGpuProgram(const SPtr<GpuProgramCore>& prg);
+
+		/** @copydoc RenderAPICore::unbindGpuProgram */
+		void unbindGpuProgram(GpuProgramType gptype);
+
+		/** @copydoc RenderAPICore::setConstantBuffers */
+		void setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& params);
+
+		/** @copydoc RenderAPICore::setRenderTarget */
+		void setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil = false);
+
+		/** @copydoc RenderAPICore::clearRenderTarget */
+		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF);
+
+		/** @copydoc RenderAPICore::clearViewport */
+		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF);
+
+		/** @copydoc RenderAPICore::draw */
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0);
+
+		/** @copydoc RenderAPICore::drawIndexed */
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount = 0);
+
+		/** @copydoc RenderAPICore::dispatchCompute */
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1);
+
+		/**
+		 * Assigns a parameter block buffer to the provided GPU parameters when the commands are executed. Use this instead
+		 * of GpuParamsCore::setParamBlockBuffer() when the parameters are shared with commands recorded elsewhere, so the
+		 * assignment is ordered with the rest of the executed commands.
+		 */
+		void setParamBlockBuffer(const SPtr<GpuParamsCore>& params, UINT32 slot,
+			const SPtr<GpuParamBlockBufferCore>& buffer);
+
+		/** Calls MeshCoreBase::_notifyUsedOnGPU() on the provided mesh when the commands are executed. */
+		void notifyMeshUsed(const SPtr<MeshCoreBase>& mesh);
+
+		/** Removes all recorded commands. Internal buffers are kept so they can be reused for subsequent recording. */
+		void clear();
+
+		/** Returns the number of recorded commands. */
+		UINT32 getNumCommands() const { return (UINT32)mCommands.size(); }
+
+	private:
+		friend class RenderAPICore;
+
+		/** Types of commands that can be recorded. */
+		enum CommandType
+		{
+			CT_SetSamplerState,
+			CT_SetBlendState,
+			CT_SetRasterizerState,
+			CT_SetDepthStencilState,
+			CT_SetTexture,
+			CT_SetLoadStoreTexture,
+			CT_SetViewport,
+			CT_SetScissorRect,
+			CT_SetVertexBuffers,
+			CT_SetIndexBuffer,
+			CT_SetVertexDeclaration,
+			CT_SetDrawOperation,
+			CT_BindGpuProgram,
+			CT_UnbindGpuProgram,
+			CT_SetConstantBuffers,
+			CT_SetRenderTarget,
+			CT_ClearRenderTarget,
+			CT_ClearViewport,
+			CT_Draw,
+			CT_DrawIndexed,
+			CT_DispatchCompute,
+			CT_SetParamBlockBuffer,
+			CT_NotifyMeshUsed
+		};
+
+		/**
+		 * A single recorded command. Arguments are stored in the shared argument arrays of the buffer, starting at the
+		 * specified indices.
+		 */
+		struct Command
+		{
+			CommandType type;
+			UINT32 firstArg;
+			UINT32 firstObject;
+		};
+
+		/** Storage for a single plain command argument. */
+		union Arg
+		{
+			UINT32 u;
+			float f;
+		};
+
+		/** Starts a new command of the specified type. Arguments added afterwards belong to this command. */
+		void beginCommand(CommandType type);
+
+		/** Appends an integer argument to the last started command. */
+		void addArg(UINT32 value);
+
+		/** Appends a floating point argument to the last started command. */
+		void addArg(float value);
+
+		/** Appends an object argument to the last started command. */
+		void addObject(const SPtr<CoreObjectCore>& object);
+
+		/** Returns an integer argument of the provided command. */
+		UINT32 getArgUInt(const Command& command, UINT32 idx) const { return mArgs[command.firstArg + idx].u; }
+
+		/** Returns a floating point argument of the provided command. */
+		float getArgFloat(const Command& command, UINT32 idx) const { return mArgs[command.firstArg + idx].f; }
+
+		/** Returns an object argument of the provided command, cast to the requested type. */
+		template<class T>
+		SPtr<T> getObject(const Command& command, UINT32 idx) const
+		{
+			return std::static_pointer_cast<T>(mObjects[command.firstObject + idx]);
+		}
+
+		/**
+		 * Executes all the recorded commands, in order, on the provided render API.
+		 *
+		 * @note	Core thread only.
+		 */
+		void execute(RenderAPICore& rapi) const;
+
+		Vector<Command> mCommands;
+		Vector<Arg> mArgs;
+		Vector<SPtr<CoreObjectCore>> mObjects;
+	};
+
+	/** @} */
+}
@@ -30,7 +30,8 @@ namespace BansheeEngine
 		: numDrawCalls(0), numComputeCalls(0), numRenderTargetChanges(0), numPresents(0), numClears(0),
 		  numVertices(0), numPrimitives(0), numBlendStateChanges(0), numRasterizerStateChanges(0), 
 		  numDepthStencilStateChanges(0), numTextureBinds(0), numSamplerBinds(0), numVertexBufferBinds(0), 
-		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0)
+		  numIndexBufferBinds(0), numGpuParamBufferBinds(0), numGpuProgramBinds(0), numStateCacheHits(0),
+		  numStateCacheMisses(0)
 		{ }
 
 		UINT64 numDrawCalls;
@@ -53,6 +54,9 @@ namespace BansheeEngine
 		UINT64 numGpuParamBufferBinds;
 		UINT64 numGpuProgramBinds; 
 
+		UINT64 numStateCacheHits;
+		UINT64 numStateCacheMisses;
+
 		UINT64 numResourceWrites;
 		UINT64 numResourceReads;
 
@@ -128,6 +132,14 @@ namespace BansheeEngine
 		/** Increments GPU program change counter indicating how many times was a GPU program bound to the pipeline. */
 		void incNumGpuProgramBinds() { mData.numGpuProgramBinds++; }
 
+		/** 
+		 * Increments the counter of pipeline binds that were skipped because the same state or object was already bound.
+		 */
+		void incNumStateCacheHits() { mData.numStateCacheHits++; }
+
+		/** Increments the counter of pipeline binds that were forwarded to the render API because the state changed. */
+		void incNumStateCacheMisses() { mData.numStateCacheMisses++; }
+
 		/**
 		 * Increments created GPU resource counter. 
 		 *
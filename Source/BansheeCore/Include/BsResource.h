@@ -31,6 +31,12 @@ namespace BansheeEngine
 		/**	Returns whether or not this resource is allowed to be asynchronously loaded. */
 		virtual bool allowAsyncLoading() const { return true; }
 
+		/** 
+		 * Returns the approximate amount of memory the resource data occupies, in bytes. Zero if the resource doesn't 
+		 * report its size. 
+		 */
+		UINT32 getSize() const { return mSize; }
+
 	protected:
 		friend class Resources;
 		friend class ResourceHandleBase;
@@ -102,8 +102,15 @@ namespace BansheeEngine
 	private:
 		friend class Resources;
 
+		/** 
+		 * Wakes up threads blocked in blockUntilLoaded() so they can check for new load work they need to perform
+		 * themselves. 
+		 */
+		static void notifyLoadProgress();
+
 		static Signal mResourceCreatedCondition;
 		static Mutex mResourceCreatedMutex;
+		static UINT64 mLoadProgress;
 
 	protected:
 		inline void throwIfNotLoaded() const;
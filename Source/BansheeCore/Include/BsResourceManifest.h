@@ -55,6 +55,9 @@ namespace BansheeEngine
 		/**	Checks if the provided path exists in the manifest. */
 		bool filePathExists(const Path& filePath) const;
 
+		/** Returns all resources registered in the manifest, mapped from their UUIDs to their file paths. */
+		const UnorderedMap<String, Path>& getUUIDToFilePathMap() const { return mUUIDToFilePath; }
+
 		/**
 		 * Saves the resource manifest to the specified location.
 		 *
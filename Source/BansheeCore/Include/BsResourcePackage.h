@@ -0,0 +1,104 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Resources-Internal
+	 *  @{
+	 */
+
+	/** Information about a single resource file stored in a ResourcePackage. */
+	struct ResourcePackageEntry
+	{
+		static const UINT32 MAX_UUID_LENGTH = 44;
+
+		UINT64 uuidHash; /**< Hash of the resource UUID, as calculated by ResourcePackage::hashUUID(). */
+		UINT64 offset; /**< Offset of the resource data from the start of the package, in bytes. */
+		UINT64 size; /**< Size of the resource data as stored in the package, in bytes. */
+		UINT64 uncompressedSize; /**< Size of the resource file after decompression, in bytes. */
+		UINT32 flags; /**< Combination of ResourcePackage::EntryFlags. */
+		char uuid[MAX_UUID_LENGTH]; /**< Null terminated resource UUID. */
+	};
+
+	/**
+	 * Archive containing many resource files in a single file, indexed by resource UUID. Used for shipping resources with
+	 * a game build, so loading resources doesn't require the file system to open each resource file separately.
+	 *
+	 * Packages are memory mapped when opened, and resource data is paged in on demand as resources get loaded. Register
+	 * an opened package with Resources::registerResourcePackage() so resources stored in it are read from the package 
+	 * instead of their individual files.
+	 *
+	 * @note	Thread safe once opened.
+	 */
+	class BS_CORE_EXPORT ResourcePackage
+	{
+		struct ConstructPrivately {};
+	public:
+		/** Flags that can be set on individual entries in the package. */
+		enum EntryFlags
+		{
+			EF_Compressed = 1 << 0 /**< Entry data is LZ4 block compressed. */
+		};
+
+		explicit ResourcePackage(const ConstructPrivately& dummy);
+
+		/** Returns the path of the file the package was opened from. */
+		const Path& getPath() const { return mPath; }
+
+		/** Returns the number of resources in the package. */
+		UINT32 getNumEntries() const { return mNumEntries; }
+
+		/** Checks does the package contain the resource with the specified UUID. */
+		bool contains(const String& uuid) const;
+
+		/**
+		 * Returns the contents of the resource file with the specified UUID, or null if the package doesn't contain the 
+		 * resource. Uncompressed entries are accessed directly from the mapped package memory, without copying.
+		 */
+		SPtr<MemoryDataStream> read(const String& uuid) const;
+
+		/**
+		 * Opens a package file previously created with create(). Returns null if the file cannot be opened or isn't a
+		 * valid package.
+		 */
+		static SPtr<ResourcePackage> open(const Path& path);
+
+		/**
+		 * Creates a new package containing the provided resource files.
+		 *
+		 * @param[in]	path		Path to save the package at. Any existing file will be overwritten.
+		 * @param[in]	resources	Map from resource UUIDs to paths of the resource files to store in the package.
+		 * @param[in]	compress	If true, resources will be stored compressed, unless compression doesn't reduce their
+		 *							size.
+		 * @return					True if the package was successfully written.
+		 */
+		static bool create(const Path& path, const UnorderedMap<String, Path>& resources, bool compress);
+
+		/** 
+		 * Creates a new package containing all resources registered in the provided manifest. 
+		 *
+		 * @see	create(const Path&, const UnorderedMap<String, Path>&, bool)
+		 */
+		static bool create(const Path& path, const SPtr<ResourceManifest>& manifest, bool compress);
+
+		/** 
+		 * Calculates the hash of a resource UUID used for indexing the package. Unlike std::hash, the value is stable 
+		 * between platforms and application runs.
+		 */
+		static UINT64 hashUUID(const String& uuid);
+
+	private:
+		/** Finds an entry for the resource with the specified UUID, or returns null if one cannot be found. */
+		const ResourcePackageEntry* findEntry(const String& uuid) const;
+
+		Path mPath;
+		SPtr<MemoryDataStream> mData;
+		const ResourcePackageEntry* mEntries;
+		UINT32 mNumEntries;
+	};
+
+	/** @} */
+}
@@ -40,11 +40,76 @@ namespace BansheeEngine
 
 			LoadedResourceData resData;
 			SPtr<Resource> loadedData;
-			UINT32 remainingDependencies;
+			std::atomic<UINT32> remainingDependencies;
 			Vector<HResource> dependencies;
 			bool notifyImmediately;
 		};
 
+		/** Resource file queued for reading by the asynchronous loader. */
+		struct PendingRead
+		{
+			PendingRead(const Path& filePath, const HResource& resource, bool loadDependencies)
+				:filePath(filePath), resource(resource), loadDependencies(loadDependencies)
+			{ }
+
+			Path filePath;
+			HResource resource;
+			bool loadDependencies;
+		};
+
+		/** Resource file that was read by the asynchronous loader but must be deserialized on the main thread. */
+		struct PendingDecode
+		{
+			PendingDecode(const Path& filePath, const SPtr<MemoryDataStream>& data, const HResource& resource)
+				:filePath(filePath), data(data), resource(resource)
+			{ }
+
+			Path filePath;
+			SPtr<MemoryDataStream> data;
+			HResource resource;
+		};
+
+		/** 
+		 * Portion of the resource tables, selected by resource UUID. Each shard has its own locks so loads of unrelated
+		 * resources don't contend with each other.
+		 *
+		 * @note	
+		 * When both locks are required the in-progress lock must be acquired first. Never hold in-progress locks from
+		 * more than one shard at once.
+		 */
+		struct ResourceShard
+		{
+			Mutex inProgressMutex;
+			Mutex loadedMutex;
+
+			UnorderedMap<String, WeakResourceHandle<Resource>> handles;
+			UnorderedMap<String, LoadedResourceData> loadedResources;
+			UnorderedMap<String, ResourceLoadData*> inProgressResources; // Resources that are being asynchronously loaded
+			UnorderedMap<String, Vector<ResourceLoadData*>> dependantLoads; // Allows dependency to be notified when a dependant is loaded
+		};
+
+		static const UINT32 NUM_SHARDS = 32;
+
+		/** Information about a loaded resource counted against the memory budget of its type. */
+		struct ResidentResource
+		{
+			UINT32 typeId;
+			UINT64 size;
+			List<String>::iterator lruEntry;
+		};
+
+		/** Memory budget and usage for a single resource type. */
+		struct ResourceTypeBudget
+		{
+			ResourceTypeBudget()
+				:budget(0), residentSize(0)
+			{ }
+
+			UINT64 budget;
+			UINT64 residentSize;
+			List<String> lru; // UUIDs of resident resources, least recently used first
+		};
+
 	public:
 		Resources();
 		~Resources();
@@ -141,6 +206,37 @@ namespace BansheeEngine
 		 */
 		HResource loadFromUUID(const String& uuid, bool async = false, bool loadDependencies = true, bool keepInternalReference = true);
 
+		/**
+		 * Sets the maximum number of resource files that may be read from disk in parallel by asynchronous loads. Any
+		 * additional reads are queued until a slot frees up. Deserialization of already read files is not limited by
+		 * this value.
+		 */
+		void setMaxConcurrentReads(UINT32 count);
+
+		/** Returns the maximum number of resource files that may be read in parallel. */
+		UINT32 getMaxConcurrentReads() const { return mMaxConcurrentReads; }
+
+		/**
+		 * Sets a memory budget for all loaded resources of a specific type. When the total size of resources of that type
+		 * exceeds the budget, resources that are referenced only by internal references held by the resource system (see
+		 * @p keepInternalReference parameter of load()) are unloaded, least recently used first. Unloaded resources can 
+		 * be transparently loaded again by passing their weak handle to load().
+		 *
+		 * Only resources loaded from disk are counted against the budget, and only if they report their size through 
+		 * Resource::getSize(). Resources are considered used when they are loaded, requested through load(), or when a
+		 * budget check finds them referenced outside of the resource system.
+		 *
+		 * @param[in]	typeId	RTTI type ID of the resource type (for example TID_Texture).
+		 * @param[in]	budget	Budget in bytes. Zero means resources of this type are never unloaded due to the budget.
+		 */
+		void setMemoryBudget(UINT32 typeId, UINT64 budget);
+
+		/** Returns the memory budget set by setMemoryBudget(), or zero if the type has no budget. */
+		UINT64 getMemoryBudget(UINT32 typeId) const;
+
+		/** Returns the total size of all loaded resources of the specified type counted against its memory budget. */
+		UINT64 getResidentSize(UINT32 typeId) const;
+
 		/**
 		 * Releases an internal reference to the resource held by the resources system. This allows the resource to be 
 		 * unloaded when it goes out of scope, if the resource was loaded with @p keepInternalReference parameter.
@@ -229,6 +325,19 @@ namespace BansheeEngine
 		/**	Unregisters a resource manifest previously registered with registerResourceManifest(). */
 		void unregisterResourceManifest(const SPtr<ResourceManifest>& manifest);
 
+		/**
+		 * Registers a resource package. Any resources stored in the package will be read from it instead of from their
+		 * individual files. Packages registered later take priority over earlier ones.
+		 *
+		 * @note	
+		 * Resources are still looked up by UUID, so manifests mapping the resource paths to UUIDs must be registered if 
+		 * resources are to be loaded by path.
+		 */
+		void registerResourcePackage(const SPtr<ResourcePackage>& package);
+
+		/** Unregisters a resource package previously registered with registerResourcePackage(). */
+		void unregisterResourcePackage(const SPtr<ResourcePackage>& package);
+
 		/**
 		 * Allows you to retrieve resource manifest containing UUID <-> file path mapping that is used when resolving 
 		 * resource references.
@@ -284,6 +393,12 @@ namespace BansheeEngine
 		/** Returns an existing handle for the specified UUID if one exists, or creates a new one. */
 		HResource _getResourceHandle(const String& uuid);
 
+		/** 
+		 * Finishes asynchronous loads of resources that don't support being deserialized outside of the main thread, and 
+		 * unloads resources exceeding their memory budget. Must be called once per frame from the main thread.
+		 */
+		void _update();
+
 		/** @} */
 	private:
 		friend class ResourceHandleBase;
@@ -297,14 +412,91 @@ namespace BansheeEngine
 		 */
 		HResource loadInternal(const String& UUID, const Path& filePath, bool synchronous, bool loadDependencies, bool incrementRef);
 
-		/** Performs actually reading and deserializing of the resource file. Called from various worker threads. */
-		SPtr<Resource> loadFromDiskAndDeserialize(const Path& filePath);
+		/** 
+		 * Reads the entire resource file into memory. If the resource is stored in a registered resource package it is
+		 * read from the package, otherwise from its individual file. Returns null if the file cannot be read. Called from
+		 * various worker threads.
+		 */
+		SPtr<MemoryDataStream> readResourceData(const String& uuid, const Path& filePath);
+
+		/** Reads only the saved resource data header of a resource file. */
+		SPtr<SavedResourceData> readHeader(const String& uuid, const Path& filePath);
+
+		/** Checks if the resource is stored in a registered resource package, or in a file at the provided path. */
+		bool resourceExists(const String& uuid, const Path& filePath) const;
+
+		/** Returns the most recently registered resource package containing the resource, or null if none do. */
+		SPtr<ResourcePackage> findPackage(const String& uuid) const;
+
+		/** Decodes the saved resource data header from the start of a resource file read by readResourceData(). */
+		SPtr<SavedResourceData> deserializeHeader(const SPtr<MemoryDataStream>& data);
+
+		/** 
+		 * Decodes the resource object from a resource file read by readResourceData(). Must be called after 
+		 * deserializeHeader().
+		 */
+		SPtr<Resource> deserializeResource(const SPtr<MemoryDataStream>& data, const Path& filePath);
+
+		/**
+		 * Registers the provided dependencies with the in-progress load of @p resource, and starts loading them. 
+		 *
+		 * @param[in]	resource		Resource whose dependencies to load. Must have an in-progress load entry, or be
+		 *								fully loaded.
+		 * @param[in]	dependencies	UUIDs of the dependencies.
+		 * @param[in]	synchronous		If true the dependencies will be loaded before this method returns.
+		 * @param[in]	skipRegistered	If true, dependencies that are already registered with the load will be skipped.
+		 */
+		void startDependencyLoads(const HResource& resource, const Vector<String>& dependencies, bool synchronous, 
+			bool skipRegistered);
+
+		/** Queues a resource file for reading on a worker thread. */
+		void queueRead(const Path& filePath, const HResource& resource, bool loadDependencies);
+
+		/** Starts worker tasks for as many queued reads as the concurrent read limit allows. */
+		void startQueuedReads();
+
+		/** 
+		 * Makes sure the asynchronous load of the resource with the specified UUID, and any of its dependencies, are not
+		 * waiting in a queue. Queued work is stolen and performed on the calling thread.
+		 */
+		void boostLoad(const String& uuid, UnorderedSet<String>& visited);
 
 		/**	Triggered when individual resource has finished loading. */
 		void loadComplete(HResource& resource);
 
-		/**	Callback triggered when the task manager is ready to process the loading task. */
-		void loadCallback(const Path& filePath, HResource& resource);
+		/**
+		 * Callback triggered when the task manager is ready to read the resource file. Loads the resource dependencies and
+		 * schedules deserialization of the resource.
+		 *
+		 * @param[in]	filePath			Path of the resource file to read.
+		 * @param[in]	resource			Handle to the resource being loaded.
+		 * @param[in]	loadDependencies	True if resource dependencies should be loaded.
+		 * @param[in]	boosted				True if the read was stolen from the queue by a thread waiting on the resource,
+		 *									in which case the remainder of the load is also performed on the calling 
+		 *									thread.
+		 */
+		void readCallback(const Path& filePath, const HResource& resource, bool loadDependencies, bool boosted);
+
+		/**	Callback triggered when the task manager is ready to deserialize a resource file read by readCallback(). */
+		void decodeCallback(const Path& filePath, const SPtr<MemoryDataStream>& data, const HResource& resource);
+
+		/** Starts counting a newly loaded resource against the memory budget of its type. */
+		void addResident(const String& uuid, const SPtr<Resource>& resource);
+
+		/** Stops counting a resource against the memory budget of its type. */
+		void removeResident(const String& uuid);
+
+		/** Marks the resource as most recently used. */
+		void touchResident(const String& uuid);
+
+		/** Unloads least recently used resources of types exceeding their memory budget. */
+		void enforceMemoryBudgets();
+
+		/** Checks if the loaded resource is referenced only by internal references held by the resource system. */
+		bool isReferencedOnlyInternally(const String& uuid);
+
+		/** Returns the shard the resource with the specified UUID belongs to. */
+		ResourceShard& getShard(const String& uuid) { return mShards[std::hash<String>()(uuid) % NUM_SHARDS]; }
 
 		/**	Destroys a resource, freeing its memory. */
 		void destroy(ResourceHandleBase& resource);
@@ -312,14 +504,20 @@ namespace BansheeEngine
 	private:
 		Vector<SPtr<ResourceManifest>> mResourceManifests;
 		SPtr<ResourceManifest> mDefaultResourceManifest;
+		Vector<SPtr<ResourcePackage>> mResourcePackages;
+		mutable Mutex mManifestMutex; // Guards manifests and packages
+
+		ResourceShard mShards[NUM_SHARDS];
 
-		Mutex mInProgressResourcesMutex;
-		Mutex mLoadedResourceMutex;
+		Mutex mLoadQueueMutex;
+		List<PendingRead> mPendingReads;
+		Vector<PendingDecode> mMainThreadDecodes;
+		UINT32 mNumActiveReads;
+		UINT32 mMaxConcurrentReads;
 
-		UnorderedMap<String, WeakResourceHandle<Resource>> mHandles;
-		UnorderedMap<String, LoadedResourceData> mLoadedResources;
-		UnorderedMap<String, ResourceLoadData*> mInProgressResources; // Resources that are being asynchronously loaded
-		UnorderedMap<String, Vector<ResourceLoadData*>> mDependantLoads; // Allows dependency to be notified when a dependant is loaded
+		mutable Mutex mBudgetMutex; // Must never be acquired while holding shard locks
+		UnorderedMap<String, ResidentResource> mResidentResources;
+		UnorderedMap<UINT32, ResourceTypeBudget> mTypeBudgets;
 	};
 
 	/** Provides easier access to Resources manager. */
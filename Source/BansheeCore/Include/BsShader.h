@@ -248,8 +248,9 @@ namespace BansheeEngine
 		UINT32 getNumTechniques() const { return (UINT32)mTechniques.size(); }
 
 		/**
-		 * Gets the best supported technique based on current render and other systems. Returns null if not a single 
-		 * technique is supported.
+		 * Gets the best supported technique based on current render and other systems. If no technique is supported by
+		 * the current render API, a technique for its fallback render API is returned instead, if any. Returns null if 
+		 * not a single technique is supported.
 		 */
 		SPtr<TechniqueType> getBestTechnique() const;
 
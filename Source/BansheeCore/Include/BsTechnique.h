@@ -30,6 +30,14 @@ namespace BansheeEngine
 		/**	Checks if this technique is supported based on current render and other systems. */
 		bool isSupported() const;
 
+		/**
+		 * Checks if this technique is written for the render API the current render API falls back to, for shaders with
+		 * no technique it supports directly.
+		 *
+		 * @see		RenderAPICore::getTechniqueFallbackName
+		 */
+		bool isSupportedAsFallback() const;
+
 	protected:
 		StringID mRenderAPI;
 		StringID mRenderer;
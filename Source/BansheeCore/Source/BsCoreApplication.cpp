@@ -222,9 +222,15 @@ namespace BansheeEngine
 
 			postUpdate();
 
+			// Finish async loads of resources that must be deserialized on the main thread
+			gResources()._update();
+
 			// Send out resource events in case any were loaded/destroyed/modified
 			ResourceListenerManager::instance().update();
 
+			// Upload characters rendered on demand during this frame
+			FontManager::instance()._update();
+
 			gCoreSceneManager()._updateCoreObjectTransforms();
 			PROFILE_CALL(RendererManager::instance().getActive()->renderAll(), "Render");
 
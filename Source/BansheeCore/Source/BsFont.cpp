@@ -3,6 +3,7 @@
 #include "BsFont.h"
 #include "BsFontRTTI.h"
 #include "BsFontManager.h"
+#include "BsGlyphCache.h"
 #include "BsResources.h"
 
 namespace BansheeEngine
@@ -15,9 +16,59 @@ namespace BansheeEngine
 			return fontDesc.characters.at(charId);
 		}
 
+		if(glyphCache != nullptr)
+		{
+			const CHAR_DESC* charDesc = glyphCache->getCharDesc(charId);
+			if (charDesc != nullptr)
+				return *charDesc;
+		}
+
 		return fontDesc.missingGlyph;
 	}
 
+	UINT32 FontBitmap::getNumTexturePages() const
+	{
+		UINT32 numPages = (UINT32)texturePages.size();
+		if (glyphCache != nullptr)
+			numPages += glyphCache->getNumTexturePages();
+
+		return numPages;
+	}
+
+	HTexture FontBitmap::getTexturePage(UINT32 page) const
+	{
+		if (page < (UINT32)texturePages.size())
+			return texturePages[page];
+
+		if (glyphCache != nullptr)
+			return glyphCache->getTexturePage(page - (UINT32)texturePages.size());
+
+		return HTexture();
+	}
+
+	SPtr<GlyphReferences> FontBitmap::referenceGlyphs(const WString& text) const
+	{
+		if (glyphCache == nullptr)
+			return nullptr;
+
+		// Only characters not baked into the font can be evicted
+		Vector<UINT32> charIds;
+		for (auto& entry : text)
+		{
+			UINT32 charId = (UINT32)entry;
+			if (fontDesc.characters.find(charId) == fontDesc.characters.end())
+				charIds.push_back(charId);
+		}
+
+		if (charIds.empty())
+			return nullptr;
+
+		std::sort(charIds.begin(), charIds.end());
+		charIds.erase(std::unique(charIds.begin(), charIds.end()), charIds.end());
+
+		return bs_shared_ptr_new<GlyphReferences>(glyphCache, std::move(charIds));
+	}
+
 	RTTITypeBase* FontBitmap::getRTTIStatic()
 	{
 		return FontBitmapRTTI::instance();
@@ -28,6 +79,20 @@ namespace BansheeEngine
 		return FontBitmap::getRTTIStatic();
 	}
 
+	FontSource::FontSource()
+		:dpi(96), renderMode(FontRenderMode::HintedSmooth)
+	{ }
+
+	RTTITypeBase* FontSource::getRTTIStatic()
+	{
+		return FontSourceRTTI::instance();
+	}
+
+	RTTITypeBase* FontSource::getRTTI() const
+	{
+		return FontSource::getRTTIStatic();
+	}
+
 	Font::Font()
 		:Resource(false)
 	{ }
@@ -35,11 +100,23 @@ namespace BansheeEngine
 	Font::~Font()
 	{ }
 
-	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData)
+	void Font::initialize(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source)
 	{
 		for(auto iter = fontData.begin(); iter != fontData.end(); ++iter)
 			mFontDataPerSize[(*iter)->size] = *iter;
 
+		mSource = source;
+		if(mSource != nullptr)
+		{
+			// Dynamic pages follow the pages baked into the bitmap
+			for (auto& entry : mFontDataPerSize)
+			{
+				SPtr<FontBitmap>& bitmap = entry.second;
+				bitmap->glyphCache = FontManager::instance()._createGlyphCache(mSource, bitmap->size, 
+					(UINT32)bitmap->texturePages.size());
+			}
+		}
+
 		Resource::initialize();
 	}
 
@@ -116,11 +193,23 @@ namespace BansheeEngine
 		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
 	}
 
+	HFont Font::create(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source)
+	{
+		SPtr<Font> newFont = _createPtr(fontData, source);
+
+		return static_resource_cast<Font>(gResources()._createResourceHandle(newFont));
+	}
+
 	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData)
 	{
 		return FontManager::instance().create(fontData);
 	}
 
+	SPtr<Font> Font::_createPtr(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source)
+	{
+		return FontManager::instance().create(fontData, source);
+	}
+
 	RTTITypeBase* Font::getRTTIStatic()
 	{
 		return FontRTTI::instance();
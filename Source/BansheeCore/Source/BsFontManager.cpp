@@ -2,14 +2,20 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontManager.h"
 #include "BsFont.h"
+#include "BsGlyphCache.h"
 
 namespace BansheeEngine
 {
 	SPtr<Font> FontManager::create(const Vector<SPtr<FontBitmap>>& fontData) const
+	{
+		return create(fontData, nullptr);
+	}
+
+	SPtr<Font> FontManager::create(const Vector<SPtr<FontBitmap>>& fontData, const SPtr<FontSource>& source) const
 	{
 		SPtr<Font> newFont = bs_core_ptr<Font>(new (bs_alloc<Font>()) Font());
 		newFont->_setThisPtr(newFont);
-		newFont->initialize(fontData);
+		newFont->initialize(fontData, source);
 
 		return newFont;
 	}
@@ -21,4 +27,66 @@ namespace BansheeEngine
 
 		return newFont;
 	}
+
+	void FontManager::_setGlyphRasterizerFactory(const SPtr<GlyphRasterizerFactory>& factory)
+	{
+		Lock lock(mMutex);
+
+		mRasterizerFactory = factory;
+	}
+
+	SPtr<GlyphRasterizerFactory> FontManager::getGlyphRasterizerFactory() const
+	{
+		Lock lock(mMutex);
+
+		return mRasterizerFactory;
+	}
+
+	SPtr<GlyphCache> FontManager::_createGlyphCache(const SPtr<FontSource>& source, UINT32 size, UINT32 firstPage)
+	{
+		SPtr<GlyphCache> glyphCache = bs_shared_ptr_new<GlyphCache>(source, size, firstPage);
+
+		Lock lock(mMutex);
+		mGlyphCaches.push_back(glyphCache);
+
+		return glyphCache;
+	}
+
+	void FontManager::_update()
+	{
+		Vector<SPtr<GlyphCache>> glyphCaches;
+		{
+			Lock lock(mMutex);
+
+			for (auto iter = mGlyphCaches.begin(); iter != mGlyphCaches.end();)
+			{
+				SPtr<GlyphCache> glyphCache = iter->lock();
+				if (glyphCache == nullptr)
+				{
+					iter = mGlyphCaches.erase(iter);
+					continue;
+				}
+
+				glyphCaches.push_back(glyphCache);
+				++iter;
+			}
+		}
+
+		for (auto& glyphCache : glyphCaches)
+			glyphCache->_flush();
+	}
+
+	void FontManager::onShutDown()
+	{
+		// Rasterizers are implemented by a plugin, so make sure none of them outlive the manager, even if fonts do
+		for (auto& entry : mGlyphCaches)
+		{
+			SPtr<GlyphCache> glyphCache = entry.lock();
+			if (glyphCache != nullptr)
+				glyphCache->_releaseRasterizer();
+		}
+
+		mGlyphCaches.clear();
+		mRasterizerFactory = nullptr;
+	}
 }
\ No newline at end of file
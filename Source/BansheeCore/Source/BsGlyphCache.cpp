@@ -0,0 +1,467 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGlyphCache.h"
+#include "BsFontManager.h"
+#include "BsTexture.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsCoreThread.h"
+#include "BsCoreThreadAccessor.h"
+#include "BsTime.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	GlyphCache::GlyphCache(const SPtr<FontSource>& source, UINT32 size, UINT32 firstPage)
+		:mSource(source), mSize(size), mFirstPage(firstPage), mRasterizerFailed(false), mNumResident(0)
+	{
+		// Pages are never removed, so make sure references to them are never invalidated
+		mPages.reserve(MAX_PAGES);
+	}
+
+	GlyphCache::~GlyphCache()
+	{ }
+
+	const CHAR_DESC* GlyphCache::getCharDesc(UINT32 charId)
+	{
+		Lock lock(mMutex);
+
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		auto iterFind = mGlyphs.find(charId);
+		if (iterFind == mGlyphs.end())
+		{
+			Glyph newGlyph;
+			newGlyph.desc.charId = charId;
+			newGlyph.region.width = 0;
+			newGlyph.refCount = 0;
+			newGlyph.lastUsedFrame = frameIdx;
+			newGlyph.failedFrame = (UINT64)-1;
+			newGlyph.lruEntry = mLRU.end();
+			newGlyph.resident = false;
+			newGlyph.missing = false;
+
+			iterFind = mGlyphs.insert(std::make_pair(charId, newGlyph)).first;
+		}
+
+		Glyph& glyph = iterFind->second;
+		if (glyph.missing)
+			return nullptr;
+
+		glyph.lastUsedFrame = frameIdx;
+		if (glyph.resident)
+		{
+			if (glyph.lruEntry != mLRU.end())
+				mLRU.splice(mLRU.end(), mLRU, glyph.lruEntry);
+
+			return &glyph.desc;
+		}
+
+		// Don't retry a failed glyph during the same frame, so text laid out this frame sees consistent results
+		if (glyph.failedFrame == frameIdx)
+			return nullptr;
+
+		if (!makeResident(glyph))
+		{
+			glyph.failedFrame = frameIdx;
+			return nullptr;
+		}
+
+		return &glyph.desc;
+	}
+
+	UINT32 GlyphCache::getNumTexturePages() const
+	{
+		Lock lock(mMutex);
+
+		return (UINT32)mPages.size();
+	}
+
+	HTexture GlyphCache::getTexturePage(UINT32 page) const
+	{
+		Lock lock(mMutex);
+
+		if (page >= (UINT32)mPages.size())
+			return HTexture();
+
+		return mPages[page].texture;
+	}
+
+	UINT32 GlyphCache::getNumResidentGlyphs() const
+	{
+		Lock lock(mMutex);
+
+		return mNumResident;
+	}
+
+	void GlyphCache::_addReferences(Vector<UINT32>& charIds)
+	{
+		Lock lock(mMutex);
+
+		UINT32 numReferenced = 0;
+		for (auto& charId : charIds)
+		{
+			auto iterFind = mGlyphs.find(charId);
+			if (iterFind == mGlyphs.end() || iterFind->second.missing)
+				continue;
+
+			Glyph& glyph = iterFind->second;
+			if (glyph.refCount == 0 && glyph.lruEntry != mLRU.end())
+			{
+				mLRU.erase(glyph.lruEntry);
+				glyph.lruEntry = mLRU.end();
+			}
+
+			glyph.refCount++;
+			charIds[numReferenced++] = charId;
+		}
+
+		charIds.resize(numReferenced);
+	}
+
+	void GlyphCache::_removeReferences(const Vector<UINT32>& charIds)
+	{
+		Lock lock(mMutex);
+
+		for (auto& charId : charIds)
+		{
+			auto iterFind = mGlyphs.find(charId);
+			if (iterFind == mGlyphs.end())
+				continue;
+
+			Glyph& glyph = iterFind->second;
+			assert(glyph.refCount > 0);
+
+			glyph.refCount--;
+			if (glyph.refCount == 0 && glyph.resident && glyph.region.width > 0)
+				glyph.lruEntry = mLRU.insert(mLRU.end(), charId);
+		}
+	}
+
+	void GlyphCache::_flush()
+	{
+		Lock lock(mMutex);
+
+		for (auto& page : mPages)
+		{
+			if (!page.dirty)
+				continue;
+
+			// Texture keeps the data locked until the core thread writes it, so every upload needs its own copy
+			const TextureProperties& texProps = page.texture->getProperties();
+			SPtr<PixelData> data = texProps.allocateSubresourceBuffer(0);
+
+			if (data->getFormat() != page.pixels->getFormat())
+				PixelUtil::bulkPixelConversion(*page.pixels, *data);
+			else
+				memcpy(data->getData(), page.pixels->getData(), page.pixels->getConsecutiveSize());
+
+			page.texture->writeSubresource(gCoreAccessor(), 0, data, true);
+			page.dirty = false;
+		}
+	}
+
+	void GlyphCache::_releaseRasterizer()
+	{
+		Lock lock(mMutex);
+
+		mRasterizer = nullptr;
+		mRasterizerFailed = true;
+	}
+
+	bool GlyphCache::makeResident(Glyph& glyph)
+	{
+		if (mRasterizer == nullptr)
+		{
+			if (mRasterizerFailed)
+				return false;
+
+			// Factory might not be registered yet if the font was loaded before the importer plugin, try again later
+			SPtr<GlyphRasterizerFactory> factory;
+			if (FontManager::isStarted())
+				factory = FontManager::instance().getGlyphRasterizerFactory();
+
+			if (factory == nullptr)
+				return false;
+
+			mRasterizer = factory->create(mSource, mSize);
+			if (mRasterizer == nullptr)
+			{
+				LOGWRN("Unable to create a glyph rasterizer for font size " + toString(mSize) + ". Characters not "
+					"baked into the font will be rendered using the missing glyph.");
+
+				mRasterizerFailed = true;
+				return false;
+			}
+		}
+
+		RASTERIZED_GLYPH rasterized;
+		if (!mRasterizer->rasterize(glyph.desc.charId, rasterized))
+		{
+			glyph.missing = true;
+			return false;
+		}
+
+		// Glyphs without any visible pixels (e.g. various spaces) don't need atlas space and are never evicted. Their
+		// quads are degenerate, so they can be assigned to any existing page.
+		if (rasterized.width == 0 || rasterized.height == 0)
+		{
+			glyph.region.width = 0;
+			glyph.desc.page = 0;
+			glyph.desc.uvX = 0.0f;
+			glyph.desc.uvY = 0.0f;
+			glyph.desc.uvWidth = 0.0f;
+			glyph.desc.uvHeight = 0.0f;
+			glyph.desc.width = 0;
+			glyph.desc.height = 0;
+			glyph.desc.xOffset = rasterized.xOffset;
+			glyph.desc.yOffset = rasterized.yOffset;
+			glyph.desc.xAdvance = rasterized.xAdvance;
+			glyph.desc.yAdvance = rasterized.yAdvance;
+			glyph.resident = true;
+
+			return true;
+		}
+
+		UINT32 allocWidth = rasterized.width + PADDING;
+		UINT32 allocHeight = rasterized.height + PADDING;
+		if (allocWidth > PAGE_SIZE || allocHeight > PAGE_SIZE)
+		{
+			LOGWRN("Character " + toString(glyph.desc.charId) + " is too large to fit in the glyph atlas.");
+
+			glyph.missing = true;
+			return false;
+		}
+
+		while (!allocate(allocWidth, allocHeight, glyph.region))
+		{
+			if (!evictOne())
+				return false;
+		}
+
+		writeGlyph(rasterized, glyph);
+
+		glyph.resident = true;
+		mNumResident++;
+
+		if (glyph.refCount == 0)
+			glyph.lruEntry = mLRU.insert(mLRU.end(), glyph.desc.charId);
+
+		return true;
+	}
+
+	bool GlyphCache::allocate(UINT32 width, UINT32 height, Region& region)
+	{
+		// Find an existing shelf with enough free space, wasting the least amount of vertical space
+		UINT32 bestPage = (UINT32)-1;
+		UINT32 bestShelf = 0;
+		UINT32 bestSpan = 0;
+		UINT32 bestWaste = std::numeric_limits<UINT32>::max();
+
+		for (UINT32 pageIdx = 0; pageIdx < (UINT32)mPages.size(); pageIdx++)
+		{
+			const Page& page = mPages[pageIdx];
+			for (UINT32 shelfIdx = 0; shelfIdx < (UINT32)page.shelves.size(); shelfIdx++)
+			{
+				const Shelf& shelf = page.shelves[shelfIdx];
+				if (shelf.height < height || (shelf.height - height) >= bestWaste)
+					continue;
+
+				for (UINT32 spanIdx = 0; spanIdx < (UINT32)shelf.freeSpans.size(); spanIdx++)
+				{
+					if (shelf.freeSpans[spanIdx].width < width)
+						continue;
+
+					bestPage = pageIdx;
+					bestShelf = shelfIdx;
+					bestSpan = spanIdx;
+					bestWaste = shelf.height - height;
+					break;
+				}
+			}
+		}
+
+		// Prefer opening a new shelf over placing the glyph in a much taller one
+		if (bestPage == (UINT32)-1 || bestWaste > height / 2)
+		{
+			UINT32 newShelfPage = (UINT32)-1;
+			for (UINT32 pageIdx = 0; pageIdx < (UINT32)mPages.size(); pageIdx++)
+			{
+				if ((mPages[pageIdx].shelfEnd + height) <= PAGE_SIZE)
+				{
+					newShelfPage = pageIdx;
+					break;
+				}
+			}
+
+			if (newShelfPage == (UINT32)-1 && mPages.size() < MAX_PAGES)
+			{
+				Page newPage;
+				newPage.texture = Texture::create(TEX_TYPE_2D, PAGE_SIZE, PAGE_SIZE, 0, PF_R8G8, TU_DYNAMIC);
+				newPage.texture->setName(L"FontDynamicPage" + toWString((UINT32)mPages.size()));
+
+				// TODO - I don't actually need a 2 channel texture
+				newPage.pixels = bs_shared_ptr_new<PixelData>(PAGE_SIZE, PAGE_SIZE, 1, PF_R8G8);
+				newPage.pixels->allocateInternalBuffer();
+				memset(newPage.pixels->getData(), 0, newPage.pixels->getConsecutiveSize());
+
+				newPage.shelfEnd = 0;
+				newPage.dirty = true;
+
+				newShelfPage = (UINT32)mPages.size();
+				mPages.push_back(newPage);
+			}
+
+			if (newShelfPage != (UINT32)-1)
+			{
+				Page& page = mPages[newShelfPage];
+
+				Shelf newShelf;
+				newShelf.y = page.shelfEnd;
+				newShelf.height = height;
+				newShelf.freeSpans.push_back({ 0, PAGE_SIZE });
+
+				page.shelves.push_back(newShelf);
+				page.shelfEnd += height;
+
+				bestPage = newShelfPage;
+				bestShelf = (UINT32)page.shelves.size() - 1;
+				bestSpan = 0;
+			}
+		}
+
+		if (bestPage == (UINT32)-1)
+			return false;
+
+		FreeSpan& span = mPages[bestPage].shelves[bestShelf].freeSpans[bestSpan];
+
+		region.page = bestPage;
+		region.shelf = bestShelf;
+		region.x = span.x;
+		region.width = width;
+
+		span.x += width;
+		span.width -= width;
+
+		if (span.width == 0)
+		{
+			Vector<FreeSpan>& spans = mPages[bestPage].shelves[bestShelf].freeSpans;
+			spans.erase(spans.begin() + bestSpan);
+		}
+
+		return true;
+	}
+
+	void GlyphCache::deallocate(const Region& region)
+	{
+		Page& page = mPages[region.page];
+		Vector<FreeSpan>& spans = page.shelves[region.shelf].freeSpans;
+
+		auto iterInsert = std::lower_bound(spans.begin(), spans.end(), region.x,
+			[](const FreeSpan& span, UINT32 x) { return span.x < x; });
+
+		UINT32 spanIdx = (UINT32)(iterInsert - spans.begin());
+		spans.insert(iterInsert, { region.x, region.width });
+
+		// Merge with neighbors
+		if ((spanIdx + 1) < (UINT32)spans.size() && (spans[spanIdx].x + spans[spanIdx].width) == spans[spanIdx + 1].x)
+		{
+			spans[spanIdx].width += spans[spanIdx + 1].width;
+			spans.erase(spans.begin() + spanIdx + 1);
+		}
+
+		if (spanIdx > 0 && (spans[spanIdx - 1].x + spans[spanIdx - 1].width) == spans[spanIdx].x)
+		{
+			spans[spanIdx - 1].width += spans[spanIdx].width;
+			spans.erase(spans.begin() + spanIdx);
+		}
+
+		// Reclaim empty shelves at the end of the page, so the space can be used for shelves of different height
+		while (!page.shelves.empty())
+		{
+			const Shelf& lastShelf = page.shelves.back();
+			if (lastShelf.freeSpans.size() != 1 || lastShelf.freeSpans[0].width != PAGE_SIZE)
+				break;
+
+			page.shelfEnd = lastShelf.y;
+			page.shelves.pop_back();
+		}
+	}
+
+	bool GlyphCache::evictOne()
+	{
+		// Glyphs used this frame might be referenced by text that is still being laid out
+		UINT64 frameIdx = gTime().getFrameIdx();
+
+		auto iterFind = std::find_if(mLRU.begin(), mLRU.end(),
+			[&](UINT32 charId) { return mGlyphs[charId].lastUsedFrame != frameIdx; });
+
+		if (iterFind == mLRU.end())
+			return false;
+
+		Glyph& glyph = mGlyphs[*iterFind];
+		mLRU.erase(iterFind);
+		glyph.lruEntry = mLRU.end();
+
+		deallocate(glyph.region);
+		glyph.resident = false;
+		mNumResident--;
+
+		return true;
+	}
+
+	void GlyphCache::writeGlyph(const RASTERIZED_GLYPH& rasterized, Glyph& glyph)
+	{
+		const Region& region = glyph.region;
+		Page& page = mPages[region.page];
+		const Shelf& shelf = page.shelves[region.shelf];
+
+		UINT32 rowPitch = PAGE_SIZE * 2;
+		UINT8* dstData = page.pixels->getData() + shelf.y * rowPitch + region.x * 2;
+
+		// Clear the entire region as it might contain parts of previously evicted glyphs
+		for (UINT32 row = 0; row < shelf.height; row++)
+			memset(dstData + row * rowPitch, 0, region.width * 2);
+
+		const UINT8* srcData = rasterized.pixels.data();
+		for (UINT32 row = 0; row < rasterized.height; row++)
+		{
+			UINT8* dstRow = dstData + row * rowPitch;
+			for (UINT32 column = 0; column < rasterized.width; column++)
+			{
+				dstRow[column * 2 + 0] = srcData[column];
+				dstRow[column * 2 + 1] = srcData[column];
+			}
+
+			srcData += rasterized.width;
+		}
+
+		page.dirty = true;
+
+		float invPageSize = 1.0f / PAGE_SIZE;
+
+		CHAR_DESC& desc = glyph.desc;
+		desc.page = mFirstPage + region.page;
+		desc.uvX = region.x * invPageSize;
+		desc.uvY = shelf.y * invPageSize;
+		desc.uvWidth = rasterized.width * invPageSize;
+		desc.uvHeight = rasterized.height * invPageSize;
+		desc.width = rasterized.width;
+		desc.height = rasterized.height;
+		desc.xOffset = rasterized.xOffset;
+		desc.yOffset = rasterized.yOffset;
+		desc.xAdvance = rasterized.xAdvance;
+		desc.yAdvance = rasterized.yAdvance;
+	}
+
+	GlyphReferences::GlyphReferences(const SPtr<GlyphCache>& cache, Vector<UINT32> charIds)
+		:mCache(cache), mCharIds(std::move(charIds))
+	{
+		mCache->_addReferences(mCharIds);
+	}
+
+	GlyphReferences::~GlyphReferences()
+	{
+		mCache->_removeReferences(mCharIds);
+	}
+}
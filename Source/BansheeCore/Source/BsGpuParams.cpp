@@ -353,7 +353,11 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 				toString(mNumSamplerStates - 1) + ". Requested: " + toString(slot));
 		}
 
-		mSamplerStates[slot] = sampler;
+		if (mSamplerStates[slot] != sampler)
+		{
+			mSamplerStates[slot] = sampler;
+			_notifySamplerStatesChanged();
+		}
 
 		_markResourcesDirty();
 		_markCoreDirty();
@@ -400,6 +404,8 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 	template BS_CORE_EXPORT void TGpuParams<true>::getParam<Matrix4x2>(const String&, TGpuDataParam<Matrix4x2, true>&) const;
 	template BS_CORE_EXPORT void TGpuParams<true>::getParam<Matrix4x3>(const String&, TGpuDataParam<Matrix4x3, true>&) const;
 
+	Event<void(const GpuParamsCore*)> GpuParamsCore::onSamplerStatesChanged;
+
 	GpuParamsCore::GpuParamsCore(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices)
 		: TGpuParams(paramDesc, transposeMatrices)
 	{
@@ -471,11 +477,22 @@ UINT32 GpuParamsBase::getDataParamSize(const String& name) const
 			loadStoreTextures[i].~SPtr<TextureCore>();
 		}
 
+		bool samplersChanged = false;
 		for (UINT32 i = 0; i < mNumSamplerStates; i++)
 		{
+			samplersChanged |= mSamplerStates[i] != samplers[i];
+
 			mSamplerStates[i] = samplers[i];
 			samplers[i].~SPtr<SamplerStateCore>();
 		}
+
+		if (samplersChanged)
+			_notifySamplerStatesChanged();
+	}
+
+	void GpuParamsCore::_notifySamplerStatesChanged()
+	{
+		onSamplerStatesChanged(this);
 	}
 
 	SPtr<GpuParamsCore> GpuParamsCore::create(const SPtr<GpuParamDesc>& paramDesc, bool transposeMatrices)
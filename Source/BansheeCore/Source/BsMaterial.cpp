@@ -39,6 +39,7 @@ namespace BansheeEngine
 
 	const UINT32 PassParameters::NUM_PARAMS = 6;
 	const UINT32 PassParametersCore::NUM_PARAMS = 6;
+	const UINT32 MaterialBase::INVALID_PARAM_IDX = (UINT32)-1;
 	
 	SPtr<PassParametersCore> convertParamsToCore(const SPtr<PassParameters>& passParams)
 	{
@@ -88,6 +89,19 @@ namespace BansheeEngine
 		return equal;
 	}
 
+	/** 
+	 * Checks can a value of the provided type be assigned to a parameter of the provided type. Colors and 4D vectors
+	 * share the same layout and are allowed to be used interchangeably.
+	 */
+	bool isDataTypeCompatible(GpuParamDataType paramType, GpuParamDataType valueType)
+	{
+		if (paramType == valueType)
+			return true;
+
+		return (paramType == GPDT_COLOR && valueType == GPDT_FLOAT4) || 
+			(paramType == GPDT_FLOAT4 && valueType == GPDT_COLOR);
+	}
+
 	Map<String, const GpuParamDataDesc*> determineValidDataParameters(const Vector<SPtr<GpuParamDesc>>& paramDescs)
 	{
 		Map<String, const GpuParamDataDesc*> foundDataParams;
@@ -662,6 +676,8 @@ namespace BansheeEngine
 	{
 		mBestTechnique = nullptr;
 		mParametersPerPass.clear();
+		mDataParams.clear();
+		mDataParamLookup.clear();
 
 		if (isShaderValid(mShader))
 		{
@@ -766,6 +782,8 @@ namespace BansheeEngine
 				}
 			}
 
+			initDataParams();
+
 			// Assign default parameters
 			initDefaultParameters();
 		}
@@ -916,32 +934,145 @@ namespace BansheeEngine
 
 		SPtr<Vector<TGpuDataParam<T, Core>>> gpuParams;
 
-		auto iterFind = mValidParams.find(name);
-		if (iterFind != mValidParams.end())
+		auto iterFind = mDataParamLookup.find(name);
+		if (iterFind != mDataParamLookup.end())
 		{
-			const String& gpuVarName = iterFind->second;
-			gpuParams = bs_shared_ptr_new<Vector<TGpuDataParam<T, Core>>>();
+			const DataParamInfo& paramInfo = mDataParams[iterFind->second];
+			if (!paramInfo.gpuParams.empty())
+			{
+				gpuParams = bs_shared_ptr_new<Vector<TGpuDataParam<T, Core>>>();
+				gpuParams->reserve(paramInfo.gpuParams.size());
 
-			for (auto iter = mParametersPerPass.begin(); iter != mParametersPerPass.end(); ++iter)
+				for (auto& entry : paramInfo.gpuParams)
+					gpuParams->push_back(TGpuDataParam<T, Core>(entry.second, entry.first));
+			}
+		}
+
+		output = createDataParam(name, gpuParams);
+	}
+
+	template <bool Core>
+	UINT32 TMaterial<Core>::getDataParamIdx(const String& name) const
+	{
+		throwIfNotInitialized();
+
+		auto iterFind = mDataParamLookup.find(name);
+		if (iterFind == mDataParamLookup.end())
+		{
+			LOGWRN("Material doesn't have a data parameter named " + name + ".");
+			return INVALID_PARAM_IDX;
+		}
+
+		return iterFind->second;
+	}
+
+	template <bool Core>
+	template <typename T>
+	void TMaterial<Core>::setDataParam(UINT32 paramIdx, const T& value, UINT32 arrayIdx)
+	{
+		if (paramIdx >= (UINT32)mDataParams.size())
+			return;
+
+		const DataParamInfo& paramInfo = mDataParams[paramIdx];
+		if (!isDataTypeCompatible(paramInfo.type, (GpuParamDataType)TGpuDataParamInfo<T>::TypeId))
+		{
+			LOGWRN("Parameter is not of the requested type.");
+			return;
+		}
+
+		if (arrayIdx >= paramInfo.arraySize)
+		{
+			LOGWRN("Array index out of range. Provided index was " + toString(arrayIdx) +
+				" but array length is " + toString(paramInfo.arraySize));
+			return;
+		}
+
+		if (paramInfo.cachedParamIdx != INVALID_PARAM_IDX)
+			getCachedParams()->setDataParam(paramInfo.cachedParamIdx, arrayIdx, value);
+
+		for (auto& entry : paramInfo.gpuParams)
+			TGpuDataParam<T, Core>(entry.second, entry.first).set(value, arrayIdx);
+	}
+
+	template <bool Core>
+	template <typename T>
+	T TMaterial<Core>::getDataParam(UINT32 paramIdx, UINT32 arrayIdx) const
+	{
+		T output = T();
+		if (paramIdx >= (UINT32)mDataParams.size())
+			return output;
+
+		const DataParamInfo& paramInfo = mDataParams[paramIdx];
+		if (!isDataTypeCompatible(paramInfo.type, (GpuParamDataType)TGpuDataParamInfo<T>::TypeId) || 
+			arrayIdx >= paramInfo.arraySize)
+			return output;
+
+		if (paramInfo.cachedParamIdx != INVALID_PARAM_IDX)
+			getCachedParams()->getDataParam(paramInfo.cachedParamIdx, arrayIdx, output);
+		else if (!paramInfo.gpuParams.empty()) // All GPU parameters should have the same value
+		{
+			const auto& entry = paramInfo.gpuParams[0];
+			output = TGpuDataParam<T, Core>(entry.second, entry.first).get(arrayIdx);
+		}
+
+		return output;
+	}
+
+	template <bool Core>
+	void TMaterial<Core>::initDataParams()
+	{
+		mDataParams.clear();
+		mDataParamLookup.clear();
+
+		if (!isShaderValid(mShader))
+			return;
+
+		SPtr<MaterialParams> cachedParams = getCachedParams();
+
+		const Map<String, SHADER_DATA_PARAM_DESC>& dataParams = mShader->getDataParams();
+		for (auto& entry : dataParams)
+		{
+			const SHADER_DATA_PARAM_DESC& paramDesc = entry.second;
+			if (paramDesc.type == GPDT_STRUCT)
+				continue;
+
+			DataParamInfo paramInfo;
+			paramInfo.type = paramDesc.type;
+			paramInfo.arraySize = paramDesc.arraySize;
+			paramInfo.cachedParamIdx = INVALID_PARAM_IDX;
+
+			if (cachedParams != nullptr)
 			{
-				SPtr<PassParamsType> params = *iter;
+				const MaterialParams::ParamData* data = nullptr;
+				auto result = cachedParams->getParamData(entry.first, MaterialParams::ParamType::Data, paramDesc.type, 0,
+					&data);
 
-				for (UINT32 i = 0; i < PassParamsType::NUM_PARAMS; i++)
+				if (result == MaterialParams::GetParamResult::Success)
+					paramInfo.cachedParamIdx = data->index;
+			}
+
+			auto iterFind = mValidParams.find(entry.first);
+			if (iterFind != mValidParams.end())
+			{
+				const String& gpuVarName = iterFind->second;
+				for (auto& passParams : mParametersPerPass)
 				{
-					GpuParamsType& paramPtr = params->getParamByIdx(i);
-					if (paramPtr)
+					for (UINT32 i = 0; i < PassParamsType::NUM_PARAMS; i++)
 					{
-						if (paramPtr->hasParam(gpuVarName))
-						{
-							gpuParams->push_back(TGpuDataParam<T, Core>());
-							paramPtr->template getParam<T>(gpuVarName, gpuParams->back());
-						}
+						GpuParamsType& gpuParams = passParams->getParamByIdx(i);
+						if (gpuParams == nullptr)
+							continue;
+
+						GpuParamDataDesc* gpuParamDesc = gpuParams->getParamDesc(gpuVarName);
+						if (gpuParamDesc != nullptr)
+							paramInfo.gpuParams.push_back(std::make_pair(gpuParams, gpuParamDesc));
 					}
 				}
 			}
-		}
 
-		output = createDataParam(name, gpuParams);
+			mDataParamLookup[entry.first] = (UINT32)mDataParams.size();
+			mDataParams.push_back(paramInfo);
+		}
 	}
 
 	template<bool Core>
@@ -999,6 +1130,84 @@ namespace BansheeEngine
 	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x2, true>&) const;
 	template BS_CORE_EXPORT void TMaterial<true>::getParam(const String&, TMaterialDataParam<Matrix4x3, true>&) const;
 
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const float&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const int&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Color&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector2I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector3I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Vector4I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix2x3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix2x4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix3x2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix3x4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix4x2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<false>::setDataParam(UINT32, const Matrix4x3&, UINT32);
+
+	template BS_CORE_EXPORT float TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT int TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Color TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector2 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector3 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector4 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector2I TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector3I TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector4I TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2x3 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2x4 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3x2 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3x4 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4x2 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4x3 TMaterial<false>::getDataParam(UINT32, UINT32) const;
+
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const float&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const int&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Color&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector2I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector3I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Vector4I&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix2x3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix2x4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix3&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix3x2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix3x4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix4&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix4x2&, UINT32);
+	template BS_CORE_EXPORT void TMaterial<true>::setDataParam(UINT32, const Matrix4x3&, UINT32);
+
+	template BS_CORE_EXPORT float TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT int TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Color TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector2 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector3 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector4 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector2I TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector3I TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Vector4I TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2x3 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix2x4 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3x2 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix3x4 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4x2 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+	template BS_CORE_EXPORT Matrix4x3 TMaterial<true>::getDataParam(UINT32, UINT32) const;
+
+	Event<void(const MaterialCore*)> MaterialCore::onParametersChanged;
+
 	MaterialCore::MaterialCore(const SPtr<ShaderCore>& shader)
 	{
 		setShader(shader);
@@ -1017,6 +1226,8 @@ namespace BansheeEngine
 		mParametersPerPass.resize(numPassParams);
 		for (UINT32 i = 0; i < numPassParams; i++)
 			mParametersPerPass[i] = passParams[i];
+
+		initDataParams();
 	}
 
 	void MaterialCore::setShader(const SPtr<ShaderCore>& shader)
@@ -1026,6 +1237,7 @@ namespace BansheeEngine
 		initBestTechnique();
 
 		_markCoreDirty();
+		onParametersChanged(this);
 	}
 
 	void MaterialCore::syncToCore(const CoreSyncData& data)
@@ -1061,6 +1273,9 @@ namespace BansheeEngine
 		mBestTechnique = *technique;
 		technique->~SPtr<TechniqueCore>();
 		dataPtr += sizeof(SPtr<TechniqueCore>);
+
+		initDataParams();
+		onParametersChanged(this);
 	}
 
 	SPtr<MaterialCore> MaterialCore::create(const SPtr<ShaderCore>& shader)
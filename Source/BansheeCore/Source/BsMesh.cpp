@@ -427,6 +427,16 @@ namespace BansheeEngine
 
 		MeshBase::initialize();
 
+		if (mVertexDesc != nullptr)
+		{
+			UINT32 indexSize = mIndexType == IT_32BIT ? sizeof(UINT32) : sizeof(UINT16);
+			mSize = mProperties.getNumVertices() * mVertexDesc->getVertexStride() + mProperties.getNumIndices() * indexSize;
+
+			// CPU cached meshes keep a copy of the data in system memory as well
+			if ((mUsage & MU_CPUCACHED) != 0)
+				mSize *= 2;
+		}
+
 		if ((mUsage & MU_CPUCACHED) != 0 && mCPUData == nullptr)
 			createCPUBuffer();
 	}
@@ -18,7 +18,7 @@ namespace BansheeEngine
 	MeshHeapCore::MeshHeapCore(UINT32 numVertices, UINT32 numIndices,
 		const SPtr<VertexDataDesc>& vertexDesc, IndexType indexType)
 		: mNumVertices(numVertices), mNumIndices(numIndices), mCPUIndexData(nullptr), mVertexDesc(vertexDesc)
-		, mIndexType(indexType), mNextQueryId(0)
+		, mIndexType(indexType), mNextFenceId(1), mCompletedFenceId(0)
 	{
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
@@ -53,154 +53,37 @@ namespace BansheeEngine
 
 	void MeshHeapCore::alloc(SPtr<TransientMeshCore> mesh, const SPtr<MeshData>& meshData)
 	{
-		// Find free vertex chunk and grow if needed
-		UINT32 smallestVertFit = 0;
-		UINT32 smallestVertFitIdx = 0;
+		UINT32 numVertices = meshData->getNumVertices();
+		UINT32 numIndices = meshData->getNumIndices();
 
-		while (smallestVertFit == 0)
+		// Find free vertex and index ranges, and grow if needed
+		UINT32 vertBlock = mVertAlloc.alloc(numVertices);
+		while (vertBlock == RangeAlloc::INVALID_BLOCK)
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeVertChunks)
-			{
-				ChunkData& chunk = mVertChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumVertices() && (chunk.size < smallestVertFit || smallestVertFit == 0))
-				{
-					smallestVertFit = chunk.size;
-					smallestVertFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestVertFit > 0)
-				break;
-
-			UINT32 newNumVertices = mNumVertices;
-			while (newNumVertices < (mNumVertices + meshData->getNumVertices()))
-			{
-				newNumVertices = Math::roundToInt(newNumVertices * GrowPercent);
-			}
+			UINT32 newNumVertices = std::max((UINT32)Math::roundToInt(mNumVertices * GrowPercent), 
+				mNumVertices + std::max(numVertices, 1U));
 
 			growVertexBuffer(newNumVertices);
+			vertBlock = mVertAlloc.alloc(numVertices);
 		}
 
-		// Find free index chunk and grow if needed
-		UINT32 smallestIdxFit = 0;
-		UINT32 smallestIdxFitIdx = 0;
-
-		while (smallestIdxFit == 0)
+		UINT32 idxBlock = mIdxAlloc.alloc(numIndices);
+		while (idxBlock == RangeAlloc::INVALID_BLOCK)
 		{
-			UINT32 curIdx = 0;
-			for (auto& chunkIdx : mFreeIdxChunks)
-			{
-				ChunkData& chunk = mIdxChunks[chunkIdx];
-
-				if (chunk.size >= meshData->getNumIndices() && (chunk.size < smallestIdxFit || smallestIdxFit == 0))
-				{
-					smallestIdxFit = chunk.size;
-					smallestIdxFitIdx = curIdx;
-				}
-
-				curIdx++;
-			}
-
-			if (smallestIdxFit > 0)
-				break;
-
-			UINT32 newNumIndices = mNumIndices;
-			while (newNumIndices < (mNumIndices + meshData->getNumIndices()))
-			{
-				newNumIndices = Math::roundToInt(newNumIndices * GrowPercent);
-			}
+			UINT32 newNumIndices = std::max((UINT32)Math::roundToInt(mNumIndices * GrowPercent),
+				mNumIndices + std::max(numIndices, 1U));
 
 			growIndexBuffer(newNumIndices);
+			idxBlock = mIdxAlloc.alloc(numIndices);
 		}
 
-		UINT32 freeVertChunkIdx = 0;
-		UINT32 freeIdxChunkIdx = 0;
-
-		auto freeVertIter = mFreeVertChunks.begin();
-		freeVertChunkIdx = (*freeVertIter);
-		for (UINT32 i = 0; i < smallestVertFitIdx; i++)
-		{
-			freeVertIter++;
-			freeVertChunkIdx = (*freeVertIter);
-		}
-
-		mFreeVertChunks.erase(freeVertIter);
-
-		auto freeIdxIter = mFreeIdxChunks.begin();
-		freeIdxChunkIdx = (*freeIdxIter);
-		for (UINT32 i = 0; i < smallestIdxFitIdx; i++)
-		{
-			freeIdxIter++;
-			freeIdxChunkIdx = (*freeIdxIter);
-		}
-
-		mFreeIdxChunks.erase(freeIdxIter);
-
-		ChunkData& vertChunk = mVertChunks[freeVertChunkIdx];
-		ChunkData& idxChunk = mIdxChunks[freeIdxChunkIdx];
-
-		UINT32 vertChunkStart = vertChunk.start;
-		UINT32 idxChunkStart = idxChunk.start;
-
-		UINT32 remainingNumVerts = vertChunk.size - meshData->getNumVertices();
-		UINT32 remainingNumIdx = idxChunk.size - meshData->getNumIndices();
-
-		vertChunk.size = meshData->getNumVertices();
-		idxChunk.size = meshData->getNumIndices();
-
-		if (remainingNumVerts > 0)
-		{
-			if (!mEmptyVertChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyVertChunks.top();
-				ChunkData& emptyChunk = mVertChunks[emptyChunkIdx];
-				mEmptyVertChunks.pop();
-
-				emptyChunk.start = vertChunkStart + meshData->getNumVertices();
-				emptyChunk.size = remainingNumVerts;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumVerts;
-				newChunk.start = vertChunkStart + meshData->getNumVertices();
-
-				mVertChunks.push_back(newChunk);
-				mFreeVertChunks.push_back((UINT32)(mVertChunks.size() - 1));
-			}
-		}
-
-		if (remainingNumIdx > 0)
-		{
-			if (!mEmptyIdxChunks.empty())
-			{
-				UINT32 emptyChunkIdx = mEmptyIdxChunks.top();
-				ChunkData& emptyChunk = mIdxChunks[emptyChunkIdx];
-				mEmptyIdxChunks.pop();
-
-				emptyChunk.start = idxChunkStart + meshData->getNumIndices();
-				emptyChunk.size = remainingNumIdx;
-			}
-			else
-			{
-				ChunkData newChunk;
-				newChunk.size = remainingNumIdx;
-				newChunk.start = idxChunkStart + meshData->getNumIndices();
-
-				mIdxChunks.push_back(newChunk);
-				mFreeIdxChunks.push_back((UINT32)(mIdxChunks.size() - 1));
-			}
-		}
+		UINT32 vertStart = mVertAlloc.getOffset(vertBlock);
+		UINT32 idxStart = mIdxAlloc.getOffset(idxBlock);
 
 		AllocatedData newAllocData;
-		newAllocData.vertChunkIdx = freeVertChunkIdx;
-		newAllocData.idxChunkIdx = freeIdxChunkIdx;
-		newAllocData.useFlags = UseFlags::GPUFree;
-		newAllocData.eventQueryIdx = createEventQuery();
+		newAllocData.vertBlock = vertBlock;
+		newAllocData.idxBlock = idxBlock;
+		newAllocData.lastUsedFence = 0;
 		newAllocData.mesh = mesh;
 
 		mMeshAllocData[mesh->getMeshHeapId()] = newAllocData;
@@ -225,8 +108,8 @@ namespace BansheeEngine
 
 			SPtr<VertexBufferCore> vertexBuffer = mVertexData->getBuffer(i);
 
-			UINT8* vertDest = mCPUVertexData[i] + vertChunkStart * vertSize;
-			memcpy(vertDest, meshData->getStreamData(i), meshData->getNumVertices() * vertSize);
+			UINT8* vertDest = mCPUVertexData[i] + vertStart * vertSize;
+			memcpy(vertDest, meshData->getStreamData(i), numVertices * vertSize);
 
 			if (RenderAPICore::instance().getAPIInfo().getVertexColorFlipRequired())
 			{
@@ -237,7 +120,7 @@ namespace BansheeEngine
 						continue;
 
 					UINT8* colorData = vertDest + mVertexDesc->getElementOffsetFromStream(VES_COLOR, semanticIdx, i);
-					for (UINT32 j = 0; j < meshData->getNumVertices(); j++)
+					for (UINT32 j = 0; j < numVertices; j++)
 					{
 						UINT32* curColor = (UINT32*)colorData;
 
@@ -248,7 +131,7 @@ namespace BansheeEngine
 				}
 			}
 
-			vertexBuffer->writeData(vertChunkStart * vertSize, meshData->getNumVertices() * vertSize, vertDest, BufferWriteType::NoOverwrite);
+			vertexBuffer->writeData(vertStart * vertSize, numVertices * vertSize, vertDest, BufferWriteType::NoOverwrite);
 		}
 
 		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
@@ -262,42 +145,60 @@ namespace BansheeEngine
 				toString(idxSize) + ". Got: " + toString(meshData->getIndexElementSize()));
 		}
 
-		UINT8* idxDest = mCPUIndexData + idxChunkStart * idxSize;
-		memcpy(idxDest, meshData->getIndexData(), meshData->getNumIndices() * idxSize);
-		mIndexBuffer->writeData(idxChunkStart * idxSize, meshData->getNumIndices() * idxSize, idxDest, BufferWriteType::NoOverwrite);
+		UINT8* idxDest = mCPUIndexData + idxStart * idxSize;
+		memcpy(idxDest, meshData->getIndexData(), numIndices * idxSize);
+		mIndexBuffer->writeData(idxStart * idxSize, numIndices * idxSize, idxDest, BufferWriteType::NoOverwrite);
 	}
 
 	void MeshHeapCore::dealloc(SPtr<TransientMeshCore> mesh)
 	{
-		auto findIter = mMeshAllocData.find(mesh->getMeshHeapId());
+		UINT32 meshId = mesh->getMeshHeapId();
+
+		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		AllocatedData& allocData = findIter->second;
-		if (allocData.useFlags == UseFlags::GPUFree)
+		// Free right away if the GPU is already done with the mesh
+		UINT32 lastUsedFence = findIter->second.lastUsedFence;
+		if (lastUsedFence <= mCompletedFenceId)
 		{
-			allocData.useFlags = UseFlags::Free;
-			freeEventQuery(allocData.eventQueryIdx);
+			freeMeshData(meshId);
+			return;
+		}
 
-			mFreeVertChunks.push_back(allocData.vertChunkIdx);
-			mFreeIdxChunks.push_back(allocData.idxChunkIdx);
+		// Otherwise wait until the latest fence completes. Commands using the mesh may not have been followed by a fence
+		// yet, in which case issue one now.
+		if (lastUsedFence == mNextFenceId)
+			issueFence();
 
-			mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
+		DeferredFree deferredFree;
+		deferredFree.meshId = meshId;
+		deferredFree.fenceId = mNextFenceId - 1;
 
-			mMeshAllocData.erase(findIter);
-		}
-		else if (allocData.useFlags == UseFlags::Used)
-			allocData.useFlags = UseFlags::CPUFree;
+		mDeferredFrees.push(deferredFree);
+	}
+
+	void MeshHeapCore::freeMeshData(UINT32 meshId)
+	{
+		auto findIter = mMeshAllocData.find(meshId);
+		assert(findIter != mMeshAllocData.end());
+
+		mVertAlloc.free(findIter->second.vertBlock);
+		mIdxAlloc.free(findIter->second.idxBlock);
+
+		mMeshAllocData.erase(findIter);
 	}
 
 	void MeshHeapCore::growVertexBuffer(UINT32 numVertices)
 	{
+		UINT32 oldNumVertices = mNumVertices;
+
 		mNumVertices = numVertices;
 		mVertexData = SPtr<VertexData>(bs_new<VertexData>());
 
 		mVertexData->vertexCount = mNumVertices;
 		mVertexData->vertexDeclaration = HardwareBufferCoreManager::instance().createVertexDeclaration(mVertexDesc);
 
-		// Create buffers and copy data
+		// Create buffers and copy data. Existing data keeps its offsets, as new space is only appended to the end.
 		for (UINT32 i = 0; i <= mVertexDesc->getMaxStreamIdx(); i++)
 		{
 			if (!mVertexDesc->hasStream(i))
@@ -309,166 +210,69 @@ namespace BansheeEngine
 
 			mVertexData->setBuffer(i, vertexBuffer);
 
-			// Copy all data to the new buffer
 			UINT8* oldBuffer = mCPUVertexData[i];
 			UINT8* buffer = (UINT8*)bs_alloc(vertSize * numVertices);
 
-			UINT32 destOffset = 0;
 			if (oldBuffer != nullptr)
 			{
-				for (auto& allocData : mMeshAllocData)
-				{
-					ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-					UINT8* oldData = oldBuffer + oldChunk.start * vertSize;
-					memcpy(buffer + destOffset * vertSize, oldData, oldChunk.size * vertSize);
-
-					destOffset += oldChunk.size;
-				}
+				memcpy(buffer, oldBuffer, oldNumVertices * vertSize);
+				vertexBuffer->writeData(0, oldNumVertices * vertSize, buffer, BufferWriteType::NoOverwrite);
 
 				bs_free(oldBuffer);
 			}
 
-			if (destOffset > 0)
-				vertexBuffer->writeData(0, destOffset * vertSize, buffer, BufferWriteType::NoOverwrite);
-
 			mCPUVertexData[i] = buffer;
 		}
 
-		// Reorder chunks
-		UINT32 destOffset = 0;
-		Vector<ChunkData> newVertChunks;
-		List<UINT32> freeVertChunks;
-
-		for (auto& allocData : mMeshAllocData)
-		{
-			ChunkData& oldChunk = mVertChunks[allocData.second.vertChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.vertChunkIdx = (UINT32)newVertChunks.size();
-			newVertChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
-		}
-
-		// Add free chunk
-		if (destOffset != mNumVertices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumVertices - destOffset;
-
-			newVertChunks.push_back(newChunk);
-			freeVertChunks.push_back((UINT32)(newVertChunks.size() - 1));
-		}
-
-		mVertChunks = newVertChunks;
-		mFreeVertChunks = freeVertChunks;
-
-		while (!mEmptyVertChunks.empty())
-			mEmptyVertChunks.pop();
+		mVertAlloc.grow(mNumVertices);
 	}
 
 	void MeshHeapCore::growIndexBuffer(UINT32 numIndices)
 	{
-		mNumIndices = numIndices;
+		UINT32 oldNumIndices = mNumIndices;
 
+		mNumIndices = numIndices;
 		mIndexBuffer = HardwareBufferCoreManager::instance().createIndexBuffer(mIndexType, mNumIndices, GBU_DYNAMIC);
 		const IndexBufferProperties& ibProps = mIndexBuffer->getProperties();
 
-		// Copy all data to the new buffer
+		// Copy all data to the new buffer. Existing data keeps its offsets, as new space is only appended to the end.
 		UINT32 idxSize = ibProps.getIndexSize();
 
 		UINT8* oldBuffer = mCPUIndexData;
 		UINT8* buffer = (UINT8*)bs_alloc(idxSize * numIndices);
 
-		UINT32 destOffset = 0;
 		if (oldBuffer != nullptr)
 		{
-			for (auto& allocData : mMeshAllocData)
-			{
-				ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-				UINT8* oldData = oldBuffer + oldChunk.start * idxSize;
-				memcpy(buffer + destOffset * idxSize, oldData, oldChunk.size * idxSize);
-
-				destOffset += oldChunk.size;
-			}
+			memcpy(buffer, oldBuffer, oldNumIndices * idxSize);
+			mIndexBuffer->writeData(0, oldNumIndices * idxSize, buffer, BufferWriteType::NoOverwrite);
 
 			bs_free(oldBuffer);
 		}
 
-		if (destOffset > 0)
-			mIndexBuffer->writeData(0, destOffset * idxSize, buffer, BufferWriteType::NoOverwrite);
-
 		mCPUIndexData = buffer;
 
-		// Reorder chunks
-		destOffset = 0;
-		Vector<ChunkData> newIdxChunks;
-		List<UINT32> freeIdxChunks;
-
-		for (auto& allocData : mMeshAllocData)
-		{
-			ChunkData& oldChunk = mIdxChunks[allocData.second.idxChunkIdx];
-
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = oldChunk.size;
-
-			allocData.second.idxChunkIdx = (UINT32)newIdxChunks.size();
-			newIdxChunks.push_back(newChunk);
-
-			destOffset += oldChunk.size;
-		}
-
-		// Add free chunk
-		if (destOffset != mNumIndices)
-		{
-			ChunkData newChunk;
-			newChunk.start = destOffset;
-			newChunk.size = mNumIndices - destOffset;
-
-			newIdxChunks.push_back(newChunk);
-			freeIdxChunks.push_back((UINT32)(newIdxChunks.size() - 1));
-		}
-
-		mIdxChunks = newIdxChunks;
-		mFreeIdxChunks = freeIdxChunks;
-
-		while (!mEmptyIdxChunks.empty())
-			mEmptyIdxChunks.pop();
+		mIdxAlloc.grow(mNumIndices);
 	}
 
-	UINT32 MeshHeapCore::createEventQuery()
+	void MeshHeapCore::issueFence()
 	{
-		UINT32 idx = 0;
-		if (mFreeEventQueries.size() > 0)
+		FenceData fence;
+		if (!mFreeEventQueries.empty())
 		{
-			idx = mFreeEventQueries.top();
+			fence.query = mFreeEventQueries.top();
 			mFreeEventQueries.pop();
 		}
 		else
-		{
-			QueryData newQuery;
-			newQuery.query = EventQuery::create();
-			newQuery.queryId = 0;
+			fence.query = EventQuery::create();
 
-			mEventQueries.push_back(newQuery);
-			idx = (UINT32)(mEventQueries.size() - 1);
-		}
+		fence.id = mNextFenceId++;
 
-		return idx;
-	}
+		SPtr<MeshHeapCore> thisPtr = std::static_pointer_cast<MeshHeapCore>(getThisPtr());
 
-	void MeshHeapCore::freeEventQuery(UINT32 idx)
-	{
-		mEventQueries[idx].query->onTriggered.clear();
-		mEventQueries[idx].queryId = 0;
-		mFreeEventQueries.push(idx);
+		fence.query->onTriggered.connect(std::bind(&MeshHeapCore::fenceTriggered, thisPtr, fence.id));
+		fence.query->begin();
+
+		mActiveFences.push(fence);
 	}
 
 	SPtr<VertexData> MeshHeapCore::getVertexData() const
@@ -491,8 +295,7 @@ namespace BansheeEngine
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.vertChunkIdx;
-		return mVertChunks[chunkIdx].start;
+		return mVertAlloc.getOffset(findIter->second.vertBlock);
 	}
 
 	UINT32 MeshHeapCore::getIndexOffset(UINT32 meshId) const
@@ -500,8 +303,7 @@ namespace BansheeEngine
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		UINT32 chunkIdx = findIter->second.idxChunkIdx;
-		return mIdxChunks[chunkIdx].start;
+		return mIdxAlloc.getOffset(findIter->second.idxBlock);
 	}
 
 	void MeshHeapCore::notifyUsedOnGPU(UINT32 meshId)
@@ -509,127 +311,36 @@ namespace BansheeEngine
 		auto findIter = mMeshAllocData.find(meshId);
 		assert(findIter != mMeshAllocData.end());
 
-		AllocatedData& allocData = findIter->second;
-		assert(allocData.useFlags != UseFlags::Free);
-
-		if (allocData.useFlags == UseFlags::GPUFree)
-			allocData.useFlags = UseFlags::Used;
-
-		SPtr<MeshHeapCore> thisPtr = std::static_pointer_cast<MeshHeapCore>(getThisPtr());
-
-		QueryData& queryData = mEventQueries[allocData.eventQueryIdx];
-		queryData.queryId = mNextQueryId++;
-		queryData.query->onTriggered.clear();
-		queryData.query->onTriggered.connect(std::bind(&MeshHeapCore::queryTriggered, thisPtr, meshId, queryData.queryId));
-		queryData.query->begin();
+		// The fence is only issued once a mesh used after the previous fence gets deallocated, so all the uses in between
+		// share a single query
+		findIter->second.lastUsedFence = mNextFenceId;
 	}
 
 	// Note: Need to use a shared ptr here to ensure MeshHeap doesn't get deallocated sometime during this callback
-	void MeshHeapCore::queryTriggered(SPtr<MeshHeapCore> thisPtr, UINT32 meshId, UINT32 queryId)
+	void MeshHeapCore::fenceTriggered(SPtr<MeshHeapCore> thisPtr, UINT32 fenceId)
 	{
-		auto findIter = thisPtr->mMeshAllocData.find(meshId);
-		assert(findIter != thisPtr->mMeshAllocData.end());
+		thisPtr->mCompletedFenceId = std::max(thisPtr->mCompletedFenceId, fenceId);
 
-		AllocatedData& allocData = findIter->second;
-
-		// If query ids don't match then it means there either a more recent query or
-		// the buffer was discarded and we are not interested in query result
-		QueryData& queryData = thisPtr->mEventQueries[allocData.eventQueryIdx];
-		if (queryId == queryData.queryId)
+		// Fences complete in the order they were issued, so everything up to this fence is done
+		while (!thisPtr->mActiveFences.empty())
 		{
-			assert(allocData.useFlags != UseFlags::Free && allocData.useFlags != UseFlags::GPUFree);
-
-			if (allocData.useFlags == UseFlags::CPUFree)
-			{
-				allocData.useFlags = UseFlags::Free;
-				thisPtr->freeEventQuery(allocData.eventQueryIdx);
-
-				thisPtr->mFreeVertChunks.push_back(allocData.vertChunkIdx);
-				thisPtr->mFreeIdxChunks.push_back(allocData.idxChunkIdx);
-
-				thisPtr->mergeWithNearbyChunks(allocData.vertChunkIdx, allocData.idxChunkIdx);
-
-				thisPtr->mMeshAllocData.erase(findIter);
-			}
-			else
-				allocData.useFlags = UseFlags::GPUFree;
-		}
-
-		queryData.query->onTriggered.clear();
-	}
-
-	void MeshHeapCore::mergeWithNearbyChunks(UINT32 chunkVertIdx, UINT32 chunkIdxIdx)
-	{
-		// Merge vertex chunks
-		ChunkData& vertChunk = mVertChunks[chunkVertIdx];
-		for (auto& freeChunkIdx : mFreeVertChunks)
-		{
-			if (chunkVertIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mVertChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
-				continue;
-
-			bool merged = false;
-			if (curChunk.start == (vertChunk.start + vertChunk.size))
-			{
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
-			else if ((curChunk.start + curChunk.size) == vertChunk.start)
-			{
-				vertChunk.start = curChunk.start;
-				vertChunk.size += curChunk.size;
-
-				merged = true;
-			}
+			FenceData& fence = thisPtr->mActiveFences.front();
+			if (fence.id > thisPtr->mCompletedFenceId)
+				break;
 
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyVertChunks.push(freeChunkIdx);
-			}
+			fence.query->onTriggered.clear();
+			thisPtr->mFreeEventQueries.push(fence.query);
+			thisPtr->mActiveFences.pop();
 		}
 
-		// Merge index chunks
-		ChunkData& idxChunk = mIdxChunks[chunkIdxIdx];
-		for (auto& freeChunkIdx : mFreeIdxChunks)
+		while (!thisPtr->mDeferredFrees.empty())
 		{
-			if (chunkIdxIdx == freeChunkIdx)
-				continue;
-
-			ChunkData& curChunk = mIdxChunks[freeChunkIdx];
-			if (curChunk.size == 0) // Already merged
-				continue;
-
-			bool merged = false;
-			if (curChunk.start == (idxChunk.start + idxChunk.size))
-			{
-				idxChunk.size += curChunk.size;
-
-				merged = true;
-			}
-			else if ((curChunk.start + curChunk.size) == idxChunk.start)
-			{
-				idxChunk.start = curChunk.start;
-				idxChunk.size += curChunk.size;
-
-				merged = true;
-			}
+			const DeferredFree& deferredFree = thisPtr->mDeferredFrees.front();
+			if (deferredFree.fenceId > thisPtr->mCompletedFenceId)
+				break;
 
-			if (merged)
-			{
-				// We can't remove the chunk since that would break the indexing scheme, so 
-				// mark it as empty and set size to 0. It will be reused when needed.
-				curChunk.start = 0;
-				curChunk.size = 0;
-				mEmptyIdxChunks.push(freeChunkIdx);
-			}
+			thisPtr->freeMeshData(deferredFree.meshId);
+			thisPtr->mDeferredFrees.pop();
 		}
 	}
 
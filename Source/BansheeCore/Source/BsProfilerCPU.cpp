@@ -156,7 +156,7 @@ namespace BansheeEngine
 
 	}
 
-	void ProfilerCPU::ThreadInfo::begin(const char* _name)
+	void ProfilerCPU::ThreadInfo::begin(const char* _name, bool recordTimeline)
 	{
 		if(isActive)
 		{
@@ -172,18 +172,27 @@ namespace BansheeEngine
 			activeBlocks = frameAlloc.alloc<Stack<ActiveBlock, StdFrameAlloc<ActiveBlock>>>(&frameAlloc);
 
 		activeBlocks->push(activeBlock);
+
+		if (name != _name)
+			name = _name;
+
+		if (recordTimeline)
+			recordTimelineEvent(rootBlock->name, true);
 		
 		rootBlock->basic.beginSample();
 		isActive = true;
 	}
 
-	void ProfilerCPU::ThreadInfo::end()
+	void ProfilerCPU::ThreadInfo::end(bool recordTimeline)
 	{
 		if(activeBlock.type == ActiveSamplingType::Basic)
 			activeBlock.block->basic.endSample();
 		else
 			activeBlock.block->precise.endSample();
 
+		if (recordTimeline)
+			recordTimelineEvent(activeBlock.block->name, false);
+
 		activeBlocks->pop();
 
 		if(!isActive)
@@ -201,6 +210,9 @@ namespace BansheeEngine
 				else
 					curBlock.block->precise.endSample();
 
+				if (recordTimeline)
+					recordTimelineEvent(curBlock.block->name, false);
+
 				activeBlocks->pop();
 			}
 		}
@@ -212,10 +224,18 @@ namespace BansheeEngine
 		activeBlocks = nullptr;
 	}
 
+	void ProfilerCPU::ThreadInfo::recordTimelineEvent(const char* _name, bool isBegin)
+	{
+		double time = PlatformUtility::queryPerformanceTimerMs();
+
+		ScopedSpinLock lock(timelineLock);
+		timelineEvents.push_back(ProfilerTimelineEvent(_name, time, isBegin));
+	}
+
 	void ProfilerCPU::ThreadInfo::reset()
 	{
 		if(isActive)
-			end();
+			end(false);
 
 		if(rootBlock != nullptr)
 			releaseBlock(rootBlock);
@@ -266,7 +286,8 @@ namespace BansheeEngine
 
 	ProfilerCPU::ProfilerCPU()
 		: mBasicTimerOverhead(0.0), mPreciseTimerOverhead(0), mBasicSamplingOverheadMs(0.0), mPreciseSamplingOverheadMs(0.0)
-		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0)
+		, mBasicSamplingOverheadCycles(0), mPreciseSamplingOverheadCycles(0), mIsCapturingTimeline(false)
+		, mTimelineStartTimeMs(0.0)
 	{
 		// TODO - We only estimate overhead on program start. It might be better to estimate it each time beginThread is called,
 		// and keep separate values per thread.
@@ -298,13 +319,13 @@ namespace BansheeEngine
 			}
 		}
 
-		thread->begin(name);
+		thread->begin(name, mIsCapturingTimeline);
 	}
 
 	void ProfilerCPU::endThread()
 	{
 		// I don't do a nullcheck where on purpose, so endSample can be called ASAP
-		ThreadInfo::activeThread->end();
+		ThreadInfo::activeThread->end(mIsCapturingTimeline);
 	}
 
 	void ProfilerCPU::beginSample(const char* name)
@@ -335,6 +356,9 @@ namespace BansheeEngine
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Basic, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		if (mIsCapturingTimeline)
+			thread->recordTimelineEvent(block->name, true);
+
 		block->basic.beginSample();
 	}
 
@@ -366,6 +390,9 @@ namespace BansheeEngine
 
 		block->basic.endSample();
 
+		if (mIsCapturingTimeline)
+			thread->recordTimelineEvent(block->name, false);
+
 		thread->activeBlocks->pop();
 
 		if (!thread->activeBlocks->empty())
@@ -402,6 +429,9 @@ namespace BansheeEngine
 		thread->activeBlock = ActiveBlock(ActiveSamplingType::Precise, block);
 		thread->activeBlocks->push(thread->activeBlock);
 
+		if (mIsCapturingTimeline)
+			thread->recordTimelineEvent(block->name, true);
+
 		block->precise.beginSample();
 	}
 
@@ -433,6 +463,9 @@ namespace BansheeEngine
 
 		block->precise.endSample();
 
+		if (mIsCapturingTimeline)
+			thread->recordTimelineEvent(block->name, false);
+
 		thread->activeBlocks->pop();
 
 		if (!thread->activeBlocks->empty())
@@ -449,6 +482,47 @@ namespace BansheeEngine
 			thread->reset();
 	}
 
+	void ProfilerCPU::beginTimelineCapture()
+	{
+		Lock lock(mThreadSync);
+
+		for (auto& thread : mActiveThreads)
+		{
+			ScopedSpinLock timelineLock(thread->timelineLock);
+			thread->timelineEvents.clear();
+		}
+
+		mTimelineStartTimeMs = PlatformUtility::queryPerformanceTimerMs();
+		mIsCapturingTimeline = true;
+	}
+
+	ProfilerTimeline ProfilerCPU::endTimelineCapture()
+	{
+		ProfilerTimeline timeline;
+		if (!mIsCapturingTimeline)
+			return timeline;
+
+		mIsCapturingTimeline = false;
+		timeline.mStartTimeMs = mTimelineStartTimeMs;
+
+		Lock lock(mThreadSync);
+
+		for (auto& thread : mActiveThreads)
+		{
+			ScopedSpinLock timelineLock(thread->timelineLock);
+			if (thread->timelineEvents.empty())
+				continue;
+
+			timeline.mThreads.push_back(ProfilerTimelineThread());
+			ProfilerTimelineThread& threadData = timeline.mThreads.back();
+
+			threadData.name = thread->name;
+			threadData.events.swap(thread->timelineEvents);
+		}
+
+		return timeline;
+	}
+
 	CPUProfilerReport ProfilerCPU::generateReport()
 	{
 		CPUProfilerReport report;
@@ -458,7 +532,7 @@ namespace BansheeEngine
 			return report;
 
 		if(thread->isActive)
-			thread->end();
+			thread->end(mIsCapturingTimeline);
 
 		// We need to separate out basic and precise data and form two separate hierarchies
 		if(thread->rootBlock == nullptr)
@@ -157,6 +157,9 @@ namespace BansheeEngine
 		reportSample.numGpuParamBufferBinds = (UINT32)(sample.endStats.numGpuParamBufferBinds - sample.startStats.numGpuParamBufferBinds);
 		reportSample.numGpuProgramBinds = (UINT32)(sample.endStats.numGpuProgramBinds - sample.startStats.numGpuProgramBinds);
 
+		reportSample.numStateCacheHits = (UINT32)(sample.endStats.numStateCacheHits - sample.startStats.numStateCacheHits);
+		reportSample.numStateCacheMisses = (UINT32)(sample.endStats.numStateCacheMisses - sample.startStats.numStateCacheMisses);
+
 		reportSample.numResourceWrites = (UINT32)(sample.endStats.numResourceWrites - sample.startStats.numResourceWrites);
 		reportSample.numResourceReads = (UINT32)(sample.endStats.numResourceReads - sample.startStats.numResourceReads);
 
@@ -0,0 +1,248 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsProfilerTimeline.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Protobuf wire types used by the Perfetto writer. */
+	enum ProtoWireType
+	{
+		PWT_Varint = 0,
+		PWT_LengthDelimited = 2
+	};
+
+	/** Field numbers of the subset of the Perfetto trace proto the writer uses. */
+	enum PerfettoField
+	{
+		PF_Trace_Packet = 1,
+
+		PF_TracePacket_Timestamp = 8,
+		PF_TracePacket_TrustedSequenceId = 10,
+		PF_TracePacket_TrackEvent = 11,
+		PF_TracePacket_SequenceFlags = 13,
+		PF_TracePacket_TrackDescriptor = 60,
+
+		PF_TrackDescriptor_Uuid = 1,
+		PF_TrackDescriptor_Thread = 4,
+
+		PF_ThreadDescriptor_Pid = 1,
+		PF_ThreadDescriptor_Tid = 2,
+		PF_ThreadDescriptor_ThreadName = 5,
+
+		PF_TrackEvent_Type = 9,
+		PF_TrackEvent_TrackUuid = 11,
+		PF_TrackEvent_Name = 23
+	};
+
+	/** Values of the Perfetto TrackEvent::Type enum. */
+	enum PerfettoTrackEventType
+	{
+		PTET_SliceBegin = 1,
+		PTET_SliceEnd = 2
+	};
+
+	/** Process ID reported for all threads in the exported traces. */
+	static const UINT32 TRACE_PID = 1;
+
+	/** Perfetto flag signaling that the incremental state of a packet sequence has been cleared. */
+	static const UINT32 PERFETTO_SEQ_INCREMENTAL_STATE_CLEARED = 1;
+
+	/** Identifier of the only packet sequence written by the Perfetto writer. */
+	static const UINT32 PERFETTO_SEQUENCE_ID = 1;
+
+	static void protoWriteVarint(ProfilerVector<UINT8>& buffer, UINT64 value)
+	{
+		while (value >= 0x80)
+		{
+			buffer.push_back((UINT8)(value | 0x80));
+			value >>= 7;
+		}
+
+		buffer.push_back((UINT8)value);
+	}
+
+	static void protoWriteVarintField(ProfilerVector<UINT8>& buffer, UINT32 field, UINT64 value)
+	{
+		protoWriteVarint(buffer, (field << 3) | PWT_Varint);
+		protoWriteVarint(buffer, value);
+	}
+
+	static void protoWriteBytesField(ProfilerVector<UINT8>& buffer, UINT32 field, const UINT8* data, UINT32 size)
+	{
+		protoWriteVarint(buffer, (field << 3) | PWT_LengthDelimited);
+		protoWriteVarint(buffer, size);
+		buffer.insert(buffer.end(), data, data + size);
+	}
+
+	static void protoWriteStringField(ProfilerVector<UINT8>& buffer, UINT32 field, const ProfilerString& value)
+	{
+		protoWriteBytesField(buffer, field, (const UINT8*)value.data(), (UINT32)value.size());
+	}
+
+	static void protoWriteMessageField(ProfilerVector<UINT8>& buffer, UINT32 field, const ProfilerVector<UINT8>& message)
+	{
+		protoWriteBytesField(buffer, field, message.data(), (UINT32)message.size());
+	}
+
+	static void jsonWriteEscaped(StringStream& output, const ProfilerString& value)
+	{
+		for (auto& entry : value)
+		{
+			switch (entry)
+			{
+			case '"':
+				output << "\\\"";
+				break;
+			case '\\':
+				output << "\\\\";
+				break;
+			case '\n':
+				output << "\\n";
+				break;
+			case '\r':
+				output << "\\r";
+				break;
+			case '\t':
+				output << "\\t";
+				break;
+			default:
+				if ((UINT8)entry < 0x20)
+					output << ' ';
+				else
+					output << entry;
+				break;
+			}
+		}
+	}
+
+	ProfilerTimeline::ProfilerTimeline()
+		:mStartTimeMs(0.0)
+	{ }
+
+	void ProfilerTimeline::save(const Path& path, ProfilerTimelineFormat format) const
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGERR("Unable to save profiler timeline. Cannot open file: " + path.toString());
+			return;
+		}
+
+		if (format == ProfilerTimelineFormat::Perfetto)
+			writePerfetto(stream);
+		else
+			writeChromeTrace(stream);
+
+		stream->close();
+	}
+
+	void ProfilerTimeline::writeChromeTrace(const SPtr<DataStream>& stream) const
+	{
+		StringStream output;
+		output << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+
+		bool first = true;
+		for (UINT32 i = 0; i < (UINT32)mThreads.size(); i++)
+		{
+			const ProfilerTimelineThread& thread = mThreads[i];
+			UINT32 tid = i + 1;
+
+			if (!first)
+				output << ",";
+
+			output << "\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << TRACE_PID << ",\"tid\":" << tid;
+			output << ",\"args\":{\"name\":\"";
+			jsonWriteEscaped(output, thread.name);
+			output << "\"}}";
+
+			first = false;
+
+			for (auto& event : thread.events)
+			{
+				// Chrome trace timestamps are in microseconds
+				UINT64 timeNs = toRelativeNs(event.timeMs);
+
+				output << ",\n{\"name\":\"";
+				jsonWriteEscaped(output, event.name);
+				output << "\",\"ph\":\"" << (event.isBegin ? "B" : "E") << "\",\"pid\":" << TRACE_PID << ",\"tid\":" << tid;
+				output << ",\"ts\":" << (timeNs / 1000) << "." << std::setw(3) << std::setfill('0') << (timeNs % 1000) << "}";
+			}
+
+			// Flush per thread so we don't keep the entire trace text in memory
+			String text = output.str();
+			stream->write(text.data(), text.size());
+			output.str("");
+		}
+
+		output << "\n]}\n";
+
+		String text = output.str();
+		stream->write(text.data(), text.size());
+	}
+
+	void ProfilerTimeline::writePerfetto(const SPtr<DataStream>& stream) const
+	{
+		ProfilerVector<UINT8> packet;
+		ProfilerVector<UINT8> message;
+		ProfilerVector<UINT8> subMessage;
+		ProfilerVector<UINT8> output;
+
+		auto flushPacket = [&]()
+		{
+			output.clear();
+			protoWriteMessageField(output, PF_Trace_Packet, packet);
+			stream->write(output.data(), output.size());
+
+			packet.clear();
+		};
+
+		for (UINT32 i = 0; i < (UINT32)mThreads.size(); i++)
+		{
+			const ProfilerTimelineThread& thread = mThreads[i];
+			UINT64 trackUuid = i + 1;
+
+			// Track descriptor, declaring the thread the following events belong to
+			subMessage.clear();
+			protoWriteVarintField(subMessage, PF_ThreadDescriptor_Pid, TRACE_PID);
+			protoWriteVarintField(subMessage, PF_ThreadDescriptor_Tid, i + 1);
+			protoWriteStringField(subMessage, PF_ThreadDescriptor_ThreadName, thread.name);
+
+			message.clear();
+			protoWriteVarintField(message, PF_TrackDescriptor_Uuid, trackUuid);
+			protoWriteMessageField(message, PF_TrackDescriptor_Thread, subMessage);
+
+			protoWriteVarintField(packet, PF_TracePacket_TrustedSequenceId, PERFETTO_SEQUENCE_ID);
+			if (i == 0)
+				protoWriteVarintField(packet, PF_TracePacket_SequenceFlags, PERFETTO_SEQ_INCREMENTAL_STATE_CLEARED);
+
+			protoWriteMessageField(packet, PF_TracePacket_TrackDescriptor, message);
+			flushPacket();
+
+			// Slice begin/end events
+			for (auto& event : thread.events)
+			{
+				message.clear();
+				protoWriteVarintField(message, PF_TrackEvent_Type, event.isBegin ? PTET_SliceBegin : PTET_SliceEnd);
+				protoWriteVarintField(message, PF_TrackEvent_TrackUuid, trackUuid);
+
+				if (event.isBegin)
+					protoWriteStringField(message, PF_TrackEvent_Name, event.name);
+
+				protoWriteVarintField(packet, PF_TracePacket_Timestamp, toRelativeNs(event.timeMs));
+				protoWriteVarintField(packet, PF_TracePacket_TrustedSequenceId, PERFETTO_SEQUENCE_ID);
+				protoWriteMessageField(packet, PF_TracePacket_TrackEvent, message);
+				flushPacket();
+			}
+		}
+	}
+
+	UINT64 ProfilerTimeline::toRelativeNs(double timeMs) const
+	{
+		double relativeMs = std::max(0.0, timeMs - mStartTimeMs);
+
+		return (UINT64)(relativeMs * 1000000.0);
+	}
+}
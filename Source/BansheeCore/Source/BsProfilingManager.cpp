@@ -9,7 +9,8 @@ namespace BansheeEngine
 
 	ProfilingManager::ProfilingManager()
 		:mSavedSimReports(nullptr), mNextSimReportIdx(0),
-		mSavedCoreReports(nullptr), mNextCoreReportIdx(0)
+		mSavedCoreReports(nullptr), mNextCoreReportIdx(0), mTimelineFramesLeft(0), mTimelineStartPending(false)
+		, mTimelineFormat(ProfilerTimelineFormat::ChromeTrace)
 	{
 		mSavedSimReports = bs_newN<ProfilerReport, ProfilerAlloc>(NUM_SAVED_FRAMES);
 		mSavedCoreReports = bs_newN<ProfilerReport, ProfilerAlloc>(NUM_SAVED_FRAMES);
@@ -32,6 +33,22 @@ namespace BansheeEngine
 		gProfilerCPU().reset();
 
 		mNextSimReportIdx = (mNextSimReportIdx + 1) % NUM_SAVED_FRAMES;
+
+		if (mTimelineStartPending)
+		{
+			gProfilerCPU().beginTimelineCapture();
+			mTimelineStartPending = false;
+		}
+		else if (mTimelineFramesLeft > 0)
+		{
+			mTimelineFramesLeft--;
+
+			if (mTimelineFramesLeft == 0)
+			{
+				ProfilerTimeline timeline = gProfilerCPU().endTimelineCapture();
+				timeline.save(mTimelinePath, mTimelineFormat);
+			}
+		}
 #endif
 	}
 
@@ -69,6 +86,20 @@ namespace BansheeEngine
 		}
 	}
 
+	void ProfilingManager::captureTimeline(UINT32 numFrames, const Path& outputPath, ProfilerTimelineFormat format)
+	{
+		if (numFrames == 0)
+			return;
+
+		if (gProfilerCPU().isCapturingTimeline())
+			gProfilerCPU().endTimelineCapture();
+
+		mTimelineFramesLeft = numFrames;
+		mTimelineStartPending = true;
+		mTimelinePath = outputPath;
+		mTimelineFormat = format;
+	}
+
 	ProfilingManager& gProfiler()
 	{
 		return ProfilingManager::instance();
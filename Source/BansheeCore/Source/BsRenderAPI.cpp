@@ -15,6 +15,7 @@
 #include "BsRasterizerState.h"
 #include "BsGpuParamDesc.h"
 #include "BsShader.h"
+#include "BsRenderCommandBuffer.h"
 
 using namespace std::placeholders;
 
@@ -211,6 +212,7 @@ namespace BansheeEngine
 		, mComputeProgramBound(false)
 		, mClipPlanesDirty(true)
 		, mCurrentCapabilities(nullptr)
+		, mCachedStencilRefValue(0)
     {
     }
 
@@ -249,10 +251,14 @@ namespace BansheeEngine
 		mDomainProgramBound = false;
 		mHullProgramBound = false;
 		mComputeProgramBound = false;
+
+		invalidateStateCache();
 	}
 
 	void RenderAPICore::destroy()
 	{
+		// Release cached references before the resource managers are shut down
+		gCoreAccessor().queueCommand(std::bind(&RenderAPICore::invalidateStateCache, this));
 		gCoreAccessor().queueCommand(std::bind(&RenderAPICore::destroyCore, this));
 		gCoreThread().submitAccessors(true);
 	}
@@ -274,6 +280,274 @@ namespace BansheeEngine
 		return mDriverVersion; 
 	}
 
+	void RenderAPICore::setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		Vector<CachedBinding<SPtr<SamplerStateCore>>>& cachedSamplers = mCachedSamplers[gptype];
+		if (texUnit >= cachedSamplers.size())
+			cachedSamplers.resize(texUnit + 1);
+
+		CachedBinding<SPtr<SamplerStateCore>>& cached = cachedSamplers[texUnit];
+		if (cached.matches(samplerState))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		cached.set(samplerState);
+
+		setSamplerStateImpl(gptype, texUnit, samplerState);
+	}
+
+	void RenderAPICore::setBlendState(const SPtr<BlendStateCore>& blendState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedBlendState.matches(blendState))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedBlendState.set(blendState);
+
+		setBlendStateImpl(blendState);
+	}
+
+	void RenderAPICore::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedRasterizerState.matches(rasterizerState))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedRasterizerState.set(rasterizerState);
+
+		setRasterizerStateImpl(rasterizerState);
+	}
+
+	void RenderAPICore::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedDepthStencilState.matches(depthStencilState) && mCachedStencilRefValue == stencilRefValue)
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedDepthStencilState.set(depthStencilState);
+		mCachedStencilRefValue = stencilRefValue;
+
+		setDepthStencilStateImpl(depthStencilState, stencilRefValue);
+	}
+
+	void RenderAPICore::setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		Vector<CachedBinding<SPtr<TextureCore>>>& cachedTextures = mCachedTextures[gptype];
+		if (texUnit >= cachedTextures.size())
+			cachedTextures.resize(texUnit + 1);
+
+		// Disabled units are remembered as null, regardless of the texture provided
+		SPtr<TextureCore> boundTexture = enabled ? texPtr : nullptr;
+
+		CachedBinding<SPtr<TextureCore>>& cached = cachedTextures[texUnit];
+		if (cached.matches(boundTexture))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		cached.set(boundTexture);
+
+		setTextureImpl(gptype, texUnit, enabled, texPtr);
+	}
+
+	void RenderAPICore::setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, 
+		const SPtr<TextureCore>& texPtr, const TextureSurface& surface)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		Vector<CachedLoadStoreTexture>& cachedTextures = mCachedLoadStoreTextures[gptype];
+		if (texUnit >= cachedTextures.size())
+			cachedTextures.resize(texUnit + 1);
+
+		SPtr<TextureCore> boundTexture = enabled ? texPtr : nullptr;
+
+		CachedLoadStoreTexture& cached = cachedTextures[texUnit];
+		if (cached.isValid && cached.texture == boundTexture)
+		{
+			bool sameSurface = boundTexture == nullptr || 
+				(cached.surface.mipLevel == surface.mipLevel && cached.surface.numMipLevels == surface.numMipLevels &&
+				cached.surface.arraySlice == surface.arraySlice && cached.surface.numArraySlices == surface.numArraySlices);
+
+			if (sameSurface)
+			{
+				BS_INC_RENDER_STAT(NumStateCacheHits);
+				return;
+			}
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+
+		// Binding a texture for writing may implicitly unbind it as a regular texture
+		if (boundTexture != nullptr)
+		{
+			for (UINT32 i = 0; i < NUM_GPU_PROGRAM_TYPES; i++)
+				mCachedTextures[i].clear();
+		}
+
+		cached.texture = boundTexture;
+		cached.surface = surface;
+		cached.isValid = true;
+
+		setLoadStoreTextureImpl(gptype, texUnit, enabled, texPtr, surface);
+	}
+
+	void RenderAPICore::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if ((index + numBuffers) > mCachedVertexBuffers.size())
+			mCachedVertexBuffers.resize(index + numBuffers);
+
+		bool allBound = true;
+		for (UINT32 i = 0; i < numBuffers; i++)
+		{
+			if (!mCachedVertexBuffers[index + i].matches(buffers[i]))
+			{
+				allBound = false;
+				break;
+			}
+		}
+
+		if (allBound)
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		for (UINT32 i = 0; i < numBuffers; i++)
+			mCachedVertexBuffers[index + i].set(buffers[i]);
+
+		setVertexBuffersImpl(index, buffers, numBuffers);
+	}
+
+	void RenderAPICore::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedIndexBuffer.matches(buffer))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedIndexBuffer.set(buffer);
+
+		setIndexBufferImpl(buffer);
+	}
+
+	void RenderAPICore::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedVertexDeclaration.matches(vertexDeclaration))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedVertexDeclaration.set(vertexDeclaration);
+
+		setVertexDeclarationImpl(vertexDeclaration);
+	}
+
+	void RenderAPICore::setDrawOperation(DrawOperationType op)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (mCachedDrawOp.matches(op))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		mCachedDrawOp.set(op);
+
+		setDrawOperationImpl(op);
+	}
+
+	void RenderAPICore::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		invalidateTextureStateCache();
+		setRenderTargetImpl(target, readOnlyDepthStencil);
+	}
+
+	void RenderAPICore::executeCommands(const RenderCommandBuffer& commands)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		commands.execute(*this);
+	}
+
+	void RenderAPICore::invalidateStateCache()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mCachedBlendState.invalidate();
+		mCachedRasterizerState.invalidate();
+		mCachedDepthStencilState.invalidate();
+		mCachedStencilRefValue = 0;
+		mCachedVertexDeclaration.invalidate();
+		mCachedIndexBuffer.invalidate();
+		mCachedDrawOp.invalidate();
+		mCachedVertexBuffers.clear();
+
+		for (UINT32 i = 0; i < NUM_GPU_PROGRAM_TYPES; i++)
+		{
+			mCachedPrograms[i].invalidate();
+			mCachedSamplers[i].clear();
+		}
+
+		invalidateTextureStateCache();
+	}
+
+	void RenderAPICore::invalidateTextureStateCache()
+	{
+		for (UINT32 i = 0; i < NUM_GPU_PROGRAM_TYPES; i++)
+		{
+			mCachedTextures[i].clear();
+			mCachedLoadStoreTextures[i].clear();
+		}
+	}
+
+	void RenderAPICore::invalidateSamplerStateCache(GpuProgramType gptype, INT32 texUnit)
+	{
+		Vector<CachedBinding<SPtr<SamplerStateCore>>>& cachedSamplers = mCachedSamplers[gptype];
+		if (texUnit < 0)
+			cachedSamplers.clear();
+		else if ((UINT32)texUnit < cachedSamplers.size())
+			cachedSamplers[texUnit].invalidate();
+	}
+
     void RenderAPICore::disableTextureUnit(GpuProgramType gptype, UINT16 texUnit)
     {
 		THROW_IF_NOT_CORE_THREAD;
@@ -315,7 +589,19 @@ namespace BansheeEngine
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
-		switch(prg->getProperties().getType())
+		GpuProgramType gptype = prg->getProperties().getType();
+
+		CachedBinding<SPtr<GpuProgramCore>>& cached = mCachedPrograms[gptype];
+		if (cached.matches(prg))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		cached.set(prg);
+
+		switch(gptype)
 		{
 		case GPT_VERTEX_PROGRAM:
 			if (!mVertexProgramBound && !mClipPlanes.empty())
@@ -339,12 +625,24 @@ namespace BansheeEngine
 			mComputeProgramBound = true;
 			break;
 		}
+
+		bindGpuProgramImpl(prg);
 	}
 
 	void RenderAPICore::unbindGpuProgram(GpuProgramType gptype)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		CachedBinding<SPtr<GpuProgramCore>>& cached = mCachedPrograms[gptype];
+		if (cached.matches(nullptr))
+		{
+			BS_INC_RENDER_STAT(NumStateCacheHits);
+			return;
+		}
+
+		BS_INC_RENDER_STAT(NumStateCacheMisses);
+		cached.set(nullptr);
+
 		switch(gptype)
 		{
 		case GPT_VERTEX_PROGRAM:
@@ -369,6 +667,8 @@ namespace BansheeEngine
 			mComputeProgramBound = false;
 			break;
 		}
+
+		unbindGpuProgramImpl(gptype);
 	}
 
 	bool RenderAPICore::isGpuProgramBound(GpuProgramType gptype)
@@ -0,0 +1,361 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderCommandBuffer.h"
+#include "BsRenderAPI.h"
+#include "BsSamplerState.h"
+#include "BsBlendState.h"
+#include "BsRasterizerState.h"
+#include "BsDepthStencilState.h"
+#include "BsTexture.h"
+#include "BsRenderTarget.h"
+#include "BsVertexBuffer.h"
+#include "BsIndexBuffer.h"
+#include "BsVertexDeclaration.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamBlockBuffer.h"
+#include "BsMeshBase.h"
+
+namespace BansheeEngine
+{
+	void RenderCommandBuffer::setSamplerState(GpuProgramType gptype, UINT16 texUnit,
+		const SPtr<SamplerStateCore>& samplerState)
+	{
+		beginCommand(CT_SetSamplerState);
+		addArg((UINT32)gptype);
+		addArg((UINT32)texUnit);
+		addObject(samplerState);
+	}
+
+	void RenderCommandBuffer::setBlendState(const SPtr<BlendStateCore>& blendState)
+	{
+		beginCommand(CT_SetBlendState);
+		addObject(blendState);
+	}
+
+	void RenderCommandBuffer::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	{
+		beginCommand(CT_SetRasterizerState);
+		addObject(rasterizerState);
+	}
+
+	void RenderCommandBuffer::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState,
+		UINT32 stencilRefValue)
+	{
+		beginCommand(CT_SetDepthStencilState);
+		addArg(stencilRefValue);
+		addObject(depthStencilState);
+	}
+
+	void RenderCommandBuffer::setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled,
+		const SPtr<TextureCore>& texPtr)
+	{
+		beginCommand(CT_SetTexture);
+		addArg((UINT32)gptype);
+		addArg((UINT32)texUnit);
+		addArg((UINT32)enabled);
+		addObject(texPtr);
+	}
+
+	void RenderCommandBuffer::setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled,
+		const SPtr<TextureCore>& texPtr, const TextureSurface& surface)
+	{
+		beginCommand(CT_SetLoadStoreTexture);
+		addArg((UINT32)gptype);
+		addArg((UINT32)texUnit);
+		addArg((UINT32)enabled);
+		addArg(surface.mipLevel);
+		addArg(surface.numMipLevels);
+		addArg(surface.arraySlice);
+		addArg(surface.numArraySlices);
+		addObject(texPtr);
+	}
+
+	void RenderCommandBuffer::setViewport(const Rect2& area)
+	{
+		beginCommand(CT_SetViewport);
+		addArg(area.x);
+		addArg(area.y);
+		addArg(area.width);
+		addArg(area.height);
+	}
+
+	void RenderCommandBuffer::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
+	{
+		beginCommand(CT_SetScissorRect);
+		addArg(left);
+		addArg(top);
+		addArg(right);
+		addArg(bottom);
+	}
+
+	void RenderCommandBuffer::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	{
+		beginCommand(CT_SetVertexBuffers);
+		addArg(index);
+		addArg(numBuffers);
+
+		for (UINT32 i = 0; i < numBuffers; i++)
+			addObject(buffers[i]);
+	}
+
+	void RenderCommandBuffer::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	{
+		beginCommand(CT_SetIndexBuffer);
+		addObject(buffer);
+	}
+
+	void RenderCommandBuffer::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	{
+		beginCommand(CT_SetVertexDeclaration);
+		addObject(vertexDeclaration);
+	}
+
+	void RenderCommandBuffer::setDrawOperation(DrawOperationType op)
+	{
+		beginCommand(CT_SetDrawOperation);
+		addArg((UINT32)op);
+	}
+
+	void RenderCommandBuffer::bindGpuProgram(const SPtr<GpuProgramCore>& prg)
+	{
+		beginCommand(CT_BindGpuProgram);
+		addObject(prg);
+	}
+
+	void RenderCommandBuffer::unbindGpuProgram(GpuProgramType gptype)
+	{
+		beginCommand(CT_UnbindGpuProgram);
+		addArg((UINT32)gptype);
+	}
+
+	void RenderCommandBuffer::setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& params)
+	{
+		beginCommand(CT_SetConstantBuffers);
+		addArg((UINT32)gptype);
+		addObject(params);
+	}
+
+	void RenderCommandBuffer::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	{
+		beginCommand(CT_SetRenderTarget);
+		addArg((UINT32)readOnlyDepthStencil);
+		addObject(target);
+	}
+
+	void RenderCommandBuffer::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask)
+	{
+		beginCommand(CT_ClearRenderTarget);
+		addArg(buffers);
+		addArg(color.r);
+		addArg(color.g);
+		addArg(color.b);
+		addArg(color.a);
+		addArg(depth);
+		addArg((UINT32)stencil);
+		addArg((UINT32)targetMask);
+	}
+
+	void RenderCommandBuffer::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil,
+		UINT8 targetMask)
+	{
+		beginCommand(CT_ClearViewport);
+		addArg(buffers);
+		addArg(color.r);
+		addArg(color.g);
+		addArg(color.b);
+		addArg(color.a);
+		addArg(depth);
+		addArg((UINT32)stencil);
+		addArg((UINT32)targetMask);
+	}
+
+	void RenderCommandBuffer::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		beginCommand(CT_Draw);
+		addArg(vertexOffset);
+		addArg(vertexCount);
+		addArg(instanceCount);
+	}
+
+	void RenderCommandBuffer::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset,
+		UINT32 vertexCount, UINT32 instanceCount)
+	{
+		beginCommand(CT_DrawIndexed);
+		addArg(startIndex);
+		addArg(indexCount);
+		addArg(vertexOffset);
+		addArg(vertexCount);
+		addArg(instanceCount);
+	}
+
+	void RenderCommandBuffer::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
+	{
+		beginCommand(CT_DispatchCompute);
+		addArg(numGroupsX);
+		addArg(numGroupsY);
+		addArg(numGroupsZ);
+	}
+
+	void RenderCommandBuffer::setParamBlockBuffer(const SPtr<GpuParamsCore>& params, UINT32 slot,
+		const SPtr<GpuParamBlockBufferCore>& buffer)
+	{
+		beginCommand(CT_SetParamBlockBuffer);
+		addArg(slot);
+		addObject(params);
+		addObject(buffer);
+	}
+
+	void RenderCommandBuffer::notifyMeshUsed(const SPtr<MeshCoreBase>& mesh)
+	{
+		beginCommand(CT_NotifyMeshUsed);
+		addObject(mesh);
+	}
+
+	void RenderCommandBuffer::clear()
+	{
+		mCommands.clear();
+		mArgs.clear();
+		mObjects.clear();
+	}
+
+	void RenderCommandBuffer::beginCommand(CommandType type)
+	{
+		Command command;
+		command.type = type;
+		command.firstArg = (UINT32)mArgs.size();
+		command.firstObject = (UINT32)mObjects.size();
+
+		mCommands.push_back(command);
+	}
+
+	void RenderCommandBuffer::addArg(UINT32 value)
+	{
+		Arg arg;
+		arg.u = value;
+
+		mArgs.push_back(arg);
+	}
+
+	void RenderCommandBuffer::addArg(float value)
+	{
+		Arg arg;
+		arg.f = value;
+
+		mArgs.push_back(arg);
+	}
+
+	void RenderCommandBuffer::addObject(const SPtr<CoreObjectCore>& object)
+	{
+		mObjects.push_back(object);
+	}
+
+	void RenderCommandBuffer::execute(RenderAPICore& rapi) const
+	{
+		for (auto& command : mCommands)
+		{
+			switch (command.type)
+			{
+			case CT_SetSamplerState:
+				rapi.setSamplerState((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getObject<SamplerStateCore>(command, 0));
+				break;
+			case CT_SetBlendState:
+				rapi.setBlendState(getObject<BlendStateCore>(command, 0));
+				break;
+			case CT_SetRasterizerState:
+				rapi.setRasterizerState(getObject<RasterizerStateCore>(command, 0));
+				break;
+			case CT_SetDepthStencilState:
+				rapi.setDepthStencilState(getObject<DepthStencilStateCore>(command, 0), getArgUInt(command, 0));
+				break;
+			case CT_SetTexture:
+				rapi.setTexture((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getArgUInt(command, 2) != 0, getObject<TextureCore>(command, 0));
+				break;
+			case CT_SetLoadStoreTexture:
+			{
+				TextureSurface surface(getArgUInt(command, 3), getArgUInt(command, 4), getArgUInt(command, 5),
+					getArgUInt(command, 6));
+
+				rapi.setLoadStoreTexture((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getArgUInt(command, 2) != 0, getObject<TextureCore>(command, 0), surface);
+			}
+				break;
+			case CT_SetViewport:
+				rapi.setViewport(Rect2(getArgFloat(command, 0), getArgFloat(command, 1), getArgFloat(command, 2),
+					getArgFloat(command, 3)));
+				break;
+			case CT_SetScissorRect:
+				rapi.setScissorRect(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2),
+					getArgUInt(command, 3));
+				break;
+			case CT_SetVertexBuffers:
+			{
+				SPtr<VertexBufferCore> buffers[MAX_BOUND_VERTEX_BUFFERS];
+
+				UINT32 numBuffers = std::min(getArgUInt(command, 1), (UINT32)MAX_BOUND_VERTEX_BUFFERS);
+				for (UINT32 i = 0; i < numBuffers; i++)
+					buffers[i] = getObject<VertexBufferCore>(command, i);
+
+				rapi.setVertexBuffers(getArgUInt(command, 0), buffers, numBuffers);
+			}
+				break;
+			case CT_SetIndexBuffer:
+				rapi.setIndexBuffer(getObject<IndexBufferCore>(command, 0));
+				break;
+			case CT_SetVertexDeclaration:
+				rapi.setVertexDeclaration(getObject<VertexDeclarationCore>(command, 0));
+				break;
+			case CT_SetDrawOperation:
+				rapi.setDrawOperation((DrawOperationType)getArgUInt(command, 0));
+				break;
+			case CT_BindGpuProgram:
+				rapi.bindGpuProgram(getObject<GpuProgramCore>(command, 0));
+				break;
+			case CT_UnbindGpuProgram:
+				rapi.unbindGpuProgram((GpuProgramType)getArgUInt(command, 0));
+				break;
+			case CT_SetConstantBuffers:
+				rapi.setConstantBuffers((GpuProgramType)getArgUInt(command, 0), getObject<GpuParamsCore>(command, 0));
+				break;
+			case CT_SetRenderTarget:
+				rapi.setRenderTarget(getObject<RenderTargetCore>(command, 0), getArgUInt(command, 0) != 0);
+				break;
+			case CT_ClearRenderTarget:
+			case CT_ClearViewport:
+			{
+				UINT32 buffers = getArgUInt(command, 0);
+				Color color(getArgFloat(command, 1), getArgFloat(command, 2), getArgFloat(command, 3),
+					getArgFloat(command, 4));
+				float depth = getArgFloat(command, 5);
+				UINT16 stencil = (UINT16)getArgUInt(command, 6);
+				UINT8 targetMask = (UINT8)getArgUInt(command, 7);
+
+				if (command.type == CT_ClearRenderTarget)
+					rapi.clearRenderTarget(buffers, color, depth, stencil, targetMask);
+				else
+					rapi.clearViewport(buffers, color, depth, stencil, targetMask);
+			}
+				break;
+			case CT_Draw:
+				rapi.draw(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2));
+				break;
+			case CT_DrawIndexed:
+				rapi.drawIndexed(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2),
+					getArgUInt(command, 3), getArgUInt(command, 4));
+				break;
+			case CT_DispatchCompute:
+				rapi.dispatchCompute(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2));
+				break;
+			case CT_SetParamBlockBuffer:
+				getObject<GpuParamsCore>(command, 0)->setParamBlockBuffer(getArgUInt(command, 0),
+					getObject<GpuParamBlockBufferCore>(command, 1));
+				break;
+			case CT_NotifyMeshUsed:
+				getObject<MeshCoreBase>(command, 0)->_notifyUsedOnGPU();
+				break;
+			}
+		}
+	}
+}
@@ -11,6 +11,7 @@ namespace BansheeEngine
 {
 	Signal ResourceHandleBase::mResourceCreatedCondition;
 	Mutex ResourceHandleBase::mResourceCreatedMutex;
+	UINT64 ResourceHandleBase::mLoadProgress = 0;
 
 	ResourceHandleBase::ResourceHandleBase()
 	{
@@ -42,7 +43,20 @@ namespace BansheeEngine
 			Lock lock(mResourceCreatedMutex);
 			while (!mData->mIsCreated)
 			{
-				mResourceCreatedCondition.wait(lock);
+				// Perform any parts of the load still waiting in a queue on this thread. This includes decoding resources
+				// that don't support async loading, which would otherwise only happen in Resources::_update() and never
+				// complete if this is the main thread. Work can get queued after this (e.g. when a worker finishes reading
+				// the file), in which case the wait is woken up so it can be boosted again.
+				UINT64 loadProgress = mLoadProgress;
+				lock.unlock();
+				{
+					UnorderedSet<String> visited;
+					gResources().boostLoad(mData->mUUID, visited);
+				}
+				lock.lock();
+
+				while (!mData->mIsCreated && loadProgress == mLoadProgress)
+					mResourceCreatedCondition.wait(lock);
 			}
 
 			// Send out ResourceListener events right away, as whatever called this method
@@ -96,6 +110,16 @@ namespace BansheeEngine
 		}
 	}
 
+	void ResourceHandleBase::notifyLoadProgress()
+	{
+		{
+			Lock lock(mResourceCreatedMutex);
+			mLoadProgress++;
+		}
+
+		mResourceCreatedCondition.notify_all();
+	}
+
 	void ResourceHandleBase::addInternalRef()
 	{
 		mData->mRefCount++;
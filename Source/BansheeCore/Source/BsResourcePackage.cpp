@@ -0,0 +1,545 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsResourcePackage.h"
+#include "BsResourceManifest.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Identifier at the start and the end of every package file ("BSPK"). */
+	static const UINT32 PACKAGE_MAGIC = 0x4B505342;
+
+	/** Version of the package file format. Increment when the layout changes. */
+	static const UINT32 PACKAGE_VERSION = 1;
+
+	/** Alignment of the table of contents and of each entry's data, in bytes. */
+	static const UINT32 PACKAGE_ALIGNMENT = 16;
+
+	/** Written at the start of the package file. */
+	struct PackageHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT32 reserved[2];
+	};
+
+	/**
+	 * Written at the end of the package file, after the table of contents. Stored at the end so the package can be
+	 * written in a single pass.
+	 */
+	struct PackageFooter
+	{
+		UINT64 tocOffset;
+		UINT32 numEntries;
+		UINT32 magic;
+	};
+
+	/** Minimum length of a match in the LZ4 block format. */
+	static const UINT32 LZ4_MIN_MATCH = 4;
+
+	/** Number of bytes at the end of an LZ4 block that must be encoded as literals. */
+	static const UINT32 LZ4_LAST_LITERALS = 5;
+
+	/** Last match must start at least this many bytes before the end of the LZ4 block. */
+	static const UINT32 LZ4_MF_LIMIT = 12;
+
+	/** Maximum offset of a match in the LZ4 block format. */
+	static const UINT32 LZ4_MAX_DISTANCE = 65535;
+
+	/** Number of bits used for indexing the hash table of the LZ4 compressor. */
+	static const UINT32 LZ4_HASH_BITS = 16;
+
+	static UINT32 lz4Read32(const UINT8* data)
+	{
+		UINT32 value;
+		memcpy(&value, data, sizeof(value));
+
+		return value;
+	}
+
+	static UINT32 lz4Hash(UINT32 sequence)
+	{
+		return (sequence * 2654435761U) >> (32 - LZ4_HASH_BITS);
+	}
+
+	/** Writes a length value that didn't fit into the sequence token. Returns false if the output buffer is too small. */
+	static bool lz4WriteLength(UINT8* dst, UINT32 dstSize, UINT32& dstPos, UINT32 length)
+	{
+		while (length >= 255)
+		{
+			if (dstPos >= dstSize)
+				return false;
+
+			dst[dstPos++] = 255;
+			length -= 255;
+		}
+
+		if (dstPos >= dstSize)
+			return false;
+
+		dst[dstPos++] = (UINT8)length;
+		return true;
+	}
+
+	/**
+	 * Writes a single LZ4 sequence, consisting of literals followed by an optional match (@p matchLength of zero means no
+	 * match). Returns false if the output buffer is too small.
+	 */
+	static bool lz4WriteSequence(UINT8* dst, UINT32 dstSize, UINT32& dstPos, const UINT8* literals, UINT32 numLiterals,
+		UINT32 matchOffset, UINT32 matchLength)
+	{
+		if (dstPos >= dstSize)
+			return false;
+
+		UINT32 tokenPos = dstPos++;
+		UINT8 token = (UINT8)(std::min(numLiterals, 15U) << 4);
+
+		if (numLiterals >= 15 && !lz4WriteLength(dst, dstSize, dstPos, numLiterals - 15))
+			return false;
+
+		if ((dstSize - dstPos) < numLiterals)
+			return false;
+
+		memcpy(dst + dstPos, literals, numLiterals);
+		dstPos += numLiterals;
+
+		if (matchLength > 0)
+		{
+			if ((dstSize - dstPos) < 2)
+				return false;
+
+			dst[dstPos++] = (UINT8)(matchOffset & 0xFF);
+			dst[dstPos++] = (UINT8)(matchOffset >> 8);
+
+			UINT32 encodedLength = matchLength - LZ4_MIN_MATCH;
+			token |= (UINT8)std::min(encodedLength, 15U);
+
+			if (encodedLength >= 15 && !lz4WriteLength(dst, dstSize, dstPos, encodedLength - 15))
+				return false;
+		}
+
+		dst[tokenPos] = token;
+		return true;
+	}
+
+	/**
+	 * Compresses the data using the LZ4 block format. Returns the compressed size, or zero if the compressed data doesn't
+	 * fit in the output buffer.
+	 */
+	static UINT32 lz4Compress(const UINT8* src, UINT32 srcSize, UINT8* dst, UINT32 dstSize)
+	{
+		UINT32 dstPos = 0;
+		UINT32 anchor = 0;
+
+		if (srcSize > LZ4_MF_LIMIT)
+		{
+			// Positions are stored offset by one, so zero can signify an empty slot
+			Vector<UINT32> hashTable(1 << LZ4_HASH_BITS, 0);
+
+			UINT32 matchFindLimit = srcSize - LZ4_MF_LIMIT;
+			UINT32 matchLimit = srcSize - LZ4_LAST_LITERALS;
+
+			UINT32 srcPos = 0;
+			while (srcPos <= matchFindLimit)
+			{
+				UINT32 sequence = lz4Read32(src + srcPos);
+				UINT32& slot = hashTable[lz4Hash(sequence)];
+
+				UINT32 candidate = slot;
+				slot = srcPos + 1;
+
+				if (candidate == 0 || (srcPos - (candidate - 1)) > LZ4_MAX_DISTANCE ||
+					lz4Read32(src + candidate - 1) != sequence)
+				{
+					srcPos++;
+					continue;
+				}
+
+				UINT32 matchPos = candidate - 1;
+				UINT32 matchLength = LZ4_MIN_MATCH;
+				while ((srcPos + matchLength) < matchLimit && src[matchPos + matchLength] == src[srcPos + matchLength])
+					matchLength++;
+
+				if (!lz4WriteSequence(dst, dstSize, dstPos, src + anchor, srcPos - anchor, srcPos - matchPos, matchLength))
+					return 0;
+
+				srcPos += matchLength;
+				anchor = srcPos;
+			}
+		}
+
+		// Remaining data is always stored as literals
+		if (!lz4WriteSequence(dst, dstSize, dstPos, src + anchor, srcSize - anchor, 0, 0))
+			return 0;
+
+		return dstPos;
+	}
+
+	/**
+	 * Decompresses data compressed with lz4Compress(). Returns false if the data is malformed or doesn't decompress to
+	 * exactly @p dstSize bytes.
+	 */
+	static bool lz4Decompress(const UINT8* src, UINT64 srcSize, UINT8* dst, UINT64 dstSize)
+	{
+		UINT64 srcPos = 0;
+		UINT64 dstPos = 0;
+
+		auto readLength = [&](UINT64& length)
+		{
+			UINT8 value;
+			do
+			{
+				if (srcPos >= srcSize)
+					return false;
+
+				value = src[srcPos++];
+				length += value;
+			} while (value == 255);
+
+			return true;
+		};
+
+		while (srcPos < srcSize)
+		{
+			UINT8 token = src[srcPos++];
+
+			UINT64 numLiterals = token >> 4;
+			if (numLiterals == 15 && !readLength(numLiterals))
+				return false;
+
+			if ((srcSize - srcPos) < numLiterals || (dstSize - dstPos) < numLiterals)
+				return false;
+
+			memcpy(dst + dstPos, src + srcPos, (size_t)numLiterals);
+			srcPos += numLiterals;
+			dstPos += numLiterals;
+
+			// Last sequence has no match
+			if (srcPos == srcSize)
+				break;
+
+			if ((srcSize - srcPos) < 2)
+				return false;
+
+			UINT64 matchOffset = src[srcPos] | (src[srcPos + 1] << 8);
+			srcPos += 2;
+
+			if (matchOffset == 0 || matchOffset > dstPos)
+				return false;
+
+			UINT64 matchLength = token & 0xF;
+			if (matchLength == 15 && !readLength(matchLength))
+				return false;
+
+			matchLength += LZ4_MIN_MATCH;
+			if ((dstSize - dstPos) < matchLength)
+				return false;
+
+			// Match can overlap with the data being written, so copy byte by byte
+			const UINT8* matchSrc = dst + dstPos - matchOffset;
+			for (UINT64 i = 0; i < matchLength; i++)
+				dst[dstPos + i] = matchSrc[i];
+
+			dstPos += matchLength;
+		}
+
+		return dstPos == dstSize;
+	}
+
+	/** Stream providing access to an uncompressed package entry, directly from the mapped package memory. */
+	class PackageEntryDataStream : public MemoryDataStream
+	{
+	public:
+		PackageEntryDataStream(const SPtr<MemoryDataStream>& packageData, UINT8* entryData, size_t size)
+			:MemoryDataStream(entryData, size), mPackageData(packageData)
+		{
+			mAccess = READ;
+		}
+
+		~PackageEntryDataStream()
+		{
+			close();
+		}
+
+		/** @copydoc MemoryDataStream::close */
+		void close() override
+		{
+			// Memory is owned by the package, make sure the base class doesn't try to free it
+			mData = nullptr;
+			mPackageData = nullptr;
+		}
+
+	private:
+		SPtr<MemoryDataStream> mPackageData;
+	};
+
+	ResourcePackage::ResourcePackage(const ConstructPrivately& dummy)
+		:mEntries(nullptr), mNumEntries(0)
+	{ }
+
+	bool ResourcePackage::contains(const String& uuid) const
+	{
+		return findEntry(uuid) != nullptr;
+	}
+
+	SPtr<MemoryDataStream> ResourcePackage::read(const String& uuid) const
+	{
+		const ResourcePackageEntry* entry = findEntry(uuid);
+		if (entry == nullptr)
+			return nullptr;
+
+		UINT8* entryData = mData->getPtr() + entry->offset;
+		if ((entry->flags & EF_Compressed) == 0)
+			return bs_shared_ptr_new<PackageEntryDataStream>(mData, entryData, (size_t)entry->size);
+
+		UINT8* uncompressedData = (UINT8*)bs_alloc((UINT32)entry->uncompressedSize);
+		if (!lz4Decompress(entryData, entry->size, uncompressedData, entry->uncompressedSize))
+		{
+			LOGERR("Corrupt resource \"" + uuid + "\" in package \"" + mPath.toString() + "\".");
+
+			bs_free(uncompressedData);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<MemoryDataStream>(uncompressedData, (size_t)entry->uncompressedSize);
+	}
+
+	const ResourcePackageEntry* ResourcePackage::findEntry(const String& uuid) const
+	{
+		UINT64 hash = hashUUID(uuid);
+
+		const ResourcePackageEntry* end = mEntries + mNumEntries;
+		const ResourcePackageEntry* iter = std::lower_bound(mEntries, end, hash,
+			[](const ResourcePackageEntry& entry, UINT64 value) { return entry.uuidHash < value; });
+
+		// Multiple UUIDs can map to the same hash
+		for (; iter != end && iter->uuidHash == hash; ++iter)
+		{
+			if (uuid == iter->uuid)
+				return iter;
+		}
+
+		return nullptr;
+	}
+
+	SPtr<ResourcePackage> ResourcePackage::open(const Path& path)
+	{
+		SPtr<MemoryDataStream> data = FileSystem::mapFile(path);
+		if (data == nullptr)
+			return nullptr;
+
+		auto reportInvalid = [&]()
+		{
+			LOGERR("Cannot open resource package. File \"" + path.toString() + "\" is not a valid package.");
+		};
+
+		UINT64 fileSize = data->size();
+		if (fileSize < (sizeof(PackageHeader) + sizeof(PackageFooter)))
+		{
+			reportInvalid();
+			return nullptr;
+		}
+
+		PackageHeader header;
+		memcpy(&header, data->getPtr(), sizeof(header));
+
+		PackageFooter footer;
+		memcpy(&footer, data->getPtr() + fileSize - sizeof(footer), sizeof(footer));
+
+		if (header.magic != PACKAGE_MAGIC || footer.magic != PACKAGE_MAGIC)
+		{
+			reportInvalid();
+			return nullptr;
+		}
+
+		if (header.version != PACKAGE_VERSION)
+		{
+			LOGERR("Cannot open resource package \"" + path.toString() + "\". Unsupported version: " +
+				toString(header.version));
+			return nullptr;
+		}
+
+		UINT64 tocSize = (UINT64)footer.numEntries * sizeof(ResourcePackageEntry);
+		UINT64 dataEnd = fileSize - sizeof(footer);
+		if ((footer.tocOffset % PACKAGE_ALIGNMENT) != 0 || footer.tocOffset > dataEnd ||
+			tocSize > (dataEnd - footer.tocOffset))
+		{
+			reportInvalid();
+			return nullptr;
+		}
+
+		const ResourcePackageEntry* entries = (const ResourcePackageEntry*)(data->getPtr() + footer.tocOffset);
+		for (UINT32 i = 0; i < footer.numEntries; i++)
+		{
+			const ResourcePackageEntry& entry = entries[i];
+			if (entry.offset > footer.tocOffset || entry.size > (footer.tocOffset - entry.offset) ||
+				entry.uuid[ResourcePackageEntry::MAX_UUID_LENGTH - 1] != '\0' ||
+				entry.uncompressedSize > std::numeric_limits<UINT32>::max())
+			{
+				reportInvalid();
+				return nullptr;
+			}
+		}
+
+		SPtr<ResourcePackage> package = bs_shared_ptr_new<ResourcePackage>(ConstructPrivately());
+		package->mPath = path;
+		package->mData = data;
+		package->mEntries = entries;
+		package->mNumEntries = footer.numEntries;
+
+		return package;
+	}
+
+	bool ResourcePackage::create(const Path& path, const UnorderedMap<String, Path>& resources, bool compress)
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGERR("Unable to create resource package. Cannot open file: " + path.toString());
+			return false;
+		}
+
+		UINT64 offset = 0;
+		bool writeFailed = false;
+		auto writeAligned = [&](const void* data, UINT64 size)
+		{
+			static const UINT8 PADDING[PACKAGE_ALIGNMENT] = { 0 };
+
+			UINT32 padding = (UINT32)((PACKAGE_ALIGNMENT - (offset % PACKAGE_ALIGNMENT)) % PACKAGE_ALIGNMENT);
+			if (stream->write(PADDING, padding) != padding)
+				writeFailed = true;
+
+			offset += padding;
+
+			UINT64 dataOffset = offset;
+			if (stream->write(data, (size_t)size) != (size_t)size)
+				writeFailed = true;
+
+			offset += size;
+
+			return dataOffset;
+		};
+
+		// Leaves no partially written package behind
+		auto abortWrite = [&]()
+		{
+			LOGERR("Unable to create resource package. Failed writing to file: " + path.toString());
+
+			stream->close();
+			FileSystem::remove(path);
+
+			return false;
+		};
+
+		PackageHeader header;
+		memset(&header, 0, sizeof(header));
+		header.magic = PACKAGE_MAGIC;
+		header.version = PACKAGE_VERSION;
+
+		writeAligned(&header, sizeof(header));
+		if (writeFailed)
+			return abortWrite();
+
+		Vector<ResourcePackageEntry> entries;
+		entries.reserve(resources.size());
+
+		for (auto& resource : resources)
+		{
+			const String& uuid = resource.first;
+			if (uuid.size() >= ResourcePackageEntry::MAX_UUID_LENGTH)
+			{
+				LOGWRN("Cannot add resource to package. Invalid UUID: " + uuid);
+				continue;
+			}
+
+			SPtr<DataStream> fileStream = FileSystem::openFile(resource.second);
+			if (fileStream == nullptr)
+				continue;
+
+			if (fileStream->size() > std::numeric_limits<UINT32>::max())
+			{
+				LOGWRN("Cannot add resource to package. File is too large: " + resource.second.toString());
+				continue;
+			}
+
+			MemoryDataStream fileData(fileStream);
+			fileStream->close();
+
+			ResourcePackageEntry entry;
+			memset(&entry, 0, sizeof(entry));
+			entry.uuidHash = hashUUID(uuid);
+			entry.uncompressedSize = fileData.size();
+			memcpy(entry.uuid, uuid.data(), uuid.size());
+
+			const UINT8* dataToWrite = fileData.getPtr();
+			UINT32 sizeToWrite = (UINT32)fileData.size();
+
+			// Only keep the compressed version if it's actually smaller
+			UINT8* compressedData = nullptr;
+			if (compress && sizeToWrite > 0)
+			{
+				compressedData = (UINT8*)bs_alloc(sizeToWrite);
+
+				UINT32 compressedSize = lz4Compress(fileData.getPtr(), sizeToWrite, compressedData, sizeToWrite);
+				if (compressedSize > 0 && compressedSize < sizeToWrite)
+				{
+					dataToWrite = compressedData;
+					sizeToWrite = compressedSize;
+					entry.flags |= EF_Compressed;
+				}
+			}
+
+			entry.size = sizeToWrite;
+			entry.offset = writeAligned(dataToWrite, sizeToWrite);
+
+			if (compressedData != nullptr)
+				bs_free(compressedData);
+
+			if (writeFailed)
+				return abortWrite();
+
+			entries.push_back(entry);
+		}
+
+		// Sort by hash so entries can be found using a binary search
+		std::sort(entries.begin(), entries.end(),
+			[](const ResourcePackageEntry& a, const ResourcePackageEntry& b) { return a.uuidHash < b.uuidHash; });
+
+		PackageFooter footer;
+		memset(&footer, 0, sizeof(footer));
+		footer.numEntries = (UINT32)entries.size();
+		footer.magic = PACKAGE_MAGIC;
+
+		if (!entries.empty())
+			footer.tocOffset = writeAligned(entries.data(), entries.size() * sizeof(ResourcePackageEntry));
+		else
+			footer.tocOffset = writeAligned(nullptr, 0);
+
+		writeAligned(&footer, sizeof(footer));
+		if (writeFailed)
+			return abortWrite();
+
+		stream->close();
+		return true;
+	}
+
+	bool ResourcePackage::create(const Path& path, const SPtr<ResourceManifest>& manifest, bool compress)
+	{
+		return create(path, manifest->getUUIDToFilePathMap(), compress);
+	}
+
+	UINT64 ResourcePackage::hashUUID(const String& uuid)
+	{
+		// 64-bit FNV-1a
+		UINT64 hash = 14695981039346656037ULL;
+		for (auto& entry : uuid)
+		{
+			hash ^= (UINT8)entry;
+			hash *= 1099511628211ULL;
+		}
+
+		return hash;
+	}
+}
@@ -3,8 +3,11 @@
 #include "BsResources.h"
 #include "BsResource.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsException.h"
 #include "BsFileSerializer.h"
+#include "BsBinarySerializer.h"
+#include "BsDataStream.h"
 #include "BsFileSystem.h"
 #include "BsTaskScheduler.h"
 #include "BsUUID.h"
@@ -16,6 +19,7 @@
 namespace BansheeEngine
 {
 	Resources::Resources()
+		:mNumActiveReads(0), mMaxConcurrentReads(4)
 	{
 		mDefaultResourceManifest = ResourceManifest::create("Default");
 		mResourceManifests.push_back(mDefaultResourceManifest);
@@ -26,9 +30,10 @@ namespace BansheeEngine
 		// Unload and invalidate all resources
 		UnorderedMap<String, LoadedResourceData> loadedResourcesCopy;
 		
+		for (auto& shard : mShards)
 		{
-			Lock lock(mLoadedResourceMutex);
-			loadedResourcesCopy = mLoadedResources;
+			Lock lock(shard.loadedMutex);
+			loadedResourcesCopy.insert(shard.loadedResources.begin(), shard.loadedResources.end());
 		}
 
 		for (auto& loadedResourcePair : loadedResourcesCopy)
@@ -37,19 +42,19 @@ namespace BansheeEngine
 
 	HResource Resources::load(const Path& filePath, bool loadDependencies, bool keepInternalReference)
 	{
-		if (!FileSystem::isFile(filePath))
-		{
-			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
-
-			return HResource();
-		}
-
 		String uuid;
 		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
 
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
+		if (!resourceExists(uuid, filePath))
+		{
+			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
+
+			return HResource();
+		}
+
 		return loadInternal(uuid, filePath, true, loadDependencies, keepInternalReference);
 	}
 
@@ -64,33 +69,26 @@ namespace BansheeEngine
 
 	HResource Resources::loadAsync(const Path& filePath, bool loadDependencies, bool keepInternalReference)
 	{
-		if (!FileSystem::isFile(filePath))
-		{
-			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
-
-			return HResource();
-		}
-
 		String uuid;
 		bool foundUUID = getUUIDFromFilePath(filePath, uuid);
 
 		if (!foundUUID)
 			uuid = UUIDGenerator::generateRandom();
 
+		if (!resourceExists(uuid, filePath))
+		{
+			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
+
+			return HResource();
+		}
+
 		return loadInternal(uuid, filePath, false, loadDependencies, keepInternalReference);
 	}
 
 	HResource Resources::loadFromUUID(const String& uuid, bool async, bool loadDependencies, bool keepInternalReference)
 	{
 		Path filePath;
-
-		// Default manifest is at 0th index but all other take priority since Default manifest could
-		// contain obsolete data. 
-		for (auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter)
-		{
-			if ((*iter)->uuidToFilePath(uuid, filePath))
-				break;
-		}
+		getFilePathFromUUID(uuid, filePath);
 
 		return loadInternal(uuid, filePath, !async, loadDependencies, keepInternalReference);
 	}
@@ -98,14 +96,15 @@ namespace BansheeEngine
 	HResource Resources::loadInternal(const String& UUID, const Path& filePath, bool synchronous, bool loadDependencies, bool keepInternalReference)
 	{
 		HResource outputResource;
+		ResourceShard& shard = getShard(UUID);
 
 		bool alreadyLoading = false;
 		bool loadInProgress = false;
 		{
 			// Check if resource is already being loaded on a worker thread
-			Lock inProgressLock(mInProgressResourcesMutex);
-			auto iterFind2 = mInProgressResources.find(UUID);
-			if (iterFind2 != mInProgressResources.end())
+			Lock inProgressLock(shard.inProgressMutex);
+			auto iterFind2 = shard.inProgressResources.find(UUID);
+			if (iterFind2 != shard.inProgressResources.end())
 			{
 				LoadedResourceData& resData = iterFind2->second->resData;
 				outputResource = resData.resource.lock();
@@ -120,15 +119,11 @@ namespace BansheeEngine
 				loadInProgress = true;
 			}
 
-			// Previously being loaded as async but now we want it synced, so we wait
-			if (loadInProgress && synchronous)
-				outputResource.blockUntilLoaded();
-
 			if (!alreadyLoading)
 			{
-				Lock loadedLock(mLoadedResourceMutex);
-				auto iterFind = mLoadedResources.find(UUID);
-				if (iterFind != mLoadedResources.end()) // Resource is already loaded
+				Lock loadedLock(shard.loadedMutex);
+				auto iterFind = shard.loadedResources.find(UUID);
+				if (iterFind != shard.loadedResources.end()) // Resource is already loaded
 				{
 					LoadedResourceData& resData = iterFind->second;
 					outputResource = resData.resource.lock();
@@ -144,25 +139,36 @@ namespace BansheeEngine
 			}
 		}
 
+		// Previously being loaded as async but now we want it synced. Waiting boosts the load so it isn't stuck behind
+		// other queued loads. (Waiting must happen outside of the lock, as the load needs it to complete.)
+		if (loadInProgress && synchronous)
+			outputResource.blockUntilLoaded();
+
+		if (alreadyLoading && !loadInProgress)
+			touchResident(UUID);
+
 		// Not loaded and not in progress, start loading of new resource
 		// (or if already loaded or in progress, load any dependencies)
 		if (!alreadyLoading)
 		{
 			// Check if the handle already exists
-			Lock lock(mLoadedResourceMutex);
-			auto iterFind = mHandles.find(UUID);
-			if (iterFind != mHandles.end())
+			Lock lock(shard.loadedMutex);
+			auto iterFind = shard.handles.find(UUID);
+			if (iterFind != shard.handles.end())
 				outputResource = iterFind->second.lock();
 			else
 			{
 				outputResource = HResource(UUID);
-				mHandles[UUID] = outputResource.getWeak();
+				shard.handles[UUID] = outputResource.getWeak();
 			}			
 		}
 
+		// Resources stored in a package don't require a file on disk
+		bool isPackaged = findPackage(UUID) != nullptr;
+
 		// We have nowhere to load from, warn and complete load if a file path was provided,
 		// otherwise pass through as we might just want to load from memory. 
-		if (filePath.isEmpty())
+		if (filePath.isEmpty() && !isPackaged)
 		{
 			if (!alreadyLoading)
 			{
@@ -174,7 +180,7 @@ namespace BansheeEngine
 				return outputResource;
 			}
 		}
-		else if (!FileSystem::isFile(filePath))
+		else if (!isPackaged && !FileSystem::isFile(filePath))
 		{
 			LOGWRN_VERBOSE("Cannot load resource. Specified file: " + filePath.toString() + " doesn't exist.");
 
@@ -186,168 +192,351 @@ namespace BansheeEngine
 			return outputResource;
 		}
 
-		// Load dependency data if a file path is provided
-		SPtr<SavedResourceData> savedResourceData;
-		if (!filePath.isEmpty())
+		// If already loading keep the old load operation active, otherwise create a new one
+		if (!alreadyLoading)
 		{
-			FileDecoder fs(filePath);
-			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
+			Lock lock(shard.inProgressMutex);
+
+			ResourceLoadData* loadData = bs_new<ResourceLoadData>(outputResource.getWeak(), 1);
+			shard.inProgressResources[UUID] = loadData;
+
+			if (keepInternalReference)
+			{
+				loadData->resData.numInternalRefs++;
+				outputResource.addInternalRef();
+			}
+
+			loadData->notifyImmediately = synchronous; // Make resource listener trigger before exit if loading synchronously
 		}
 
-		// If already loading keep the old load operation active, otherwise create a new one
-		if (!alreadyLoading)
+		// Asynchronous load of a new resource. The file is read, its dependencies discovered and loaded, and the resource 
+		// deserialized, all on worker threads.
+		if (!alreadyLoading && !synchronous)
 		{
+			queueRead(filePath, outputResource, loadDependencies);
+			return outputResource;
+		}
+
+		// Load dependency data if a file path is provided
+		SPtr<MemoryDataStream> fileData;
+		SPtr<SavedResourceData> savedResourceData;
+		if (!filePath.isEmpty() || isPackaged)
+		{
+			if (!alreadyLoading) // Entire file is needed, so read it at once
 			{
-				Lock lock(mInProgressResourcesMutex);
+				fileData = readResourceData(UUID, filePath);
+				savedResourceData = deserializeHeader(fileData);
+			}
+			else
+				savedResourceData = readHeader(UUID, filePath);
+		}
 
-				ResourceLoadData* loadData = bs_new<ResourceLoadData>(outputResource.getWeak(), 0);
-				mInProgressResources[UUID] = loadData;
-				loadData->resData = outputResource.getWeak();
+		// Register and load dependencies. If already loaded or in progress, queue dependencies in case they aren't already
+		// loaded.
+		if (loadDependencies && savedResourceData != nullptr && !savedResourceData->getDependencies().empty())
+			startDependencyLoads(outputResource, savedResourceData->getDependencies(), synchronous, alreadyLoading);
 
-				if (keepInternalReference)
+		// Actually deserialize the resource if not already loaded or in progress
+		if (!alreadyLoading && (!filePath.isEmpty() || isPackaged))
+		{
+			decodeCallback(filePath, fileData, outputResource);
+		}
+		else // File already loaded or in progress
+		{
+			// Complete the load unless its in progress in which case we wait for its worker thread to complete it.
+			// In case file is already loaded this will only decrement dependency count in case this resource is a dependency.
+			if (!loadInProgress)
+				loadComplete(outputResource);
+			else
+			{
+				// In case loading finished in the meantime we cannot be sure at what point ::loadComplete was triggered,
+				// so trigger it manually so that the dependency count is properly decremented in case this resource
+				// is a dependency.
+				bool isLoaded = false;
 				{
-					loadData->resData.numInternalRefs++;
-					outputResource.addInternalRef();
+					Lock lock(shard.loadedMutex);
+					isLoaded = shard.loadedResources.find(UUID) != shard.loadedResources.end();
 				}
 
-				loadData->remainingDependencies = 1;
+				if (isLoaded)
+					loadComplete(outputResource);
+			}
+		}
+
+		return outputResource;
+	}
+
+	void Resources::startDependencyLoads(const HResource& resource, const Vector<String>& dependencies, bool synchronous,
+		bool skipRegistered)
+	{
+		HResource resourceCopy = resource;
+		const String& uuid = resource.getUUID();
+		ResourceShard& shard = getShard(uuid);
+
+		// Take an extra count on the remaining dependencies so the load cannot complete (and its data get freed) while
+		// dependencies are registered from other shards
+		ResourceLoadData* loadData = nullptr;
+		{
+			Lock lock(shard.inProgressMutex);
+
+			auto iterFind = shard.inProgressResources.find(uuid);
+			if (iterFind == shard.inProgressResources.end()) // Fully loaded
+			{
+				loadData = bs_new<ResourceLoadData>(resource.getWeak(), 0);
 				loadData->notifyImmediately = synchronous; // Make resource listener trigger before exit if loading synchronously
 
-				// Register dependencies and count them so we know when the resource is fully loaded
-				if (loadDependencies && savedResourceData != nullptr)
-				{
-					for (auto& dependency : savedResourceData->getDependencies())
-					{
-						if (dependency != UUID)
-						{
-							mDependantLoads[dependency].push_back(loadData);
-							loadData->remainingDependencies++;
-						}
-					}
-				}
+				shard.inProgressResources[uuid] = loadData;
 			}
+			else
+				loadData = iterFind->second;
 
-			if (loadDependencies && savedResourceData != nullptr)
-			{
-				const Vector<String>& dependencyUUIDs = savedResourceData->getDependencies();
-				UINT32 numDependencies = (UINT32)dependencyUUIDs.size();
-				Vector<HResource> dependencies(numDependencies);
+			loadData->remainingDependencies++;
+		}
 
-				for (UINT32 i = 0; i < numDependencies; i++)
-					dependencies[i] = loadFromUUID(dependencyUUIDs[i], !synchronous, true, false);
+		// Register dependencies and count them so we know when the resource is fully loaded. Count is incremented before
+		// registering, so a dependency finishing in the meantime cannot complete the load prematurely.
+		for (auto& dependency : dependencies)
+		{
+			if (dependency == uuid)
+				continue;
+
+			ResourceShard& dependencyShard = getShard(dependency);
+			Lock lock(dependencyShard.inProgressMutex);
 
-				// Keep dependencies alive until the parent is done loading
+			Vector<ResourceLoadData*>& dependantData = dependencyShard.dependantLoads[dependency];
+			if (skipRegistered)
+			{
+				auto iterFind = std::find_if(dependantData.begin(), dependantData.end(),
+					[&](ResourceLoadData* x)
 				{
-					Lock lock(mInProgressResourcesMutex);
+					return x->resData.resource.getUUID() == uuid;
+				});
 
-					// At this point the resource is guaranteed to still be in-progress, so it's safe to update its dependency list
-					mInProgressResources[UUID]->dependencies = dependencies;
-				}
+				if (iterFind != dependantData.end())
+					continue;
 			}
+
+			loadData->remainingDependencies++;
+			dependantData.push_back(loadData);
 		}
-		else if (loadDependencies && savedResourceData != nullptr) // Queue dependencies in case they aren't already loaded
+
+		UINT32 numDependencies = (UINT32)dependencies.size();
+		Vector<HResource> dependencyHandles(numDependencies);
+
+		for (UINT32 i = 0; i < numDependencies; i++)
+			dependencyHandles[i] = loadFromUUID(dependencies[i], !synchronous, true, false);
+
+		// Keep dependencies alive until the parent is done loading
 		{
-			const Vector<String>& dependencies = savedResourceData->getDependencies();
-			if (!dependencies.empty())
-			{
-				{
-					Lock lock(mInProgressResourcesMutex);
+			Lock lock(shard.inProgressMutex);
 
-					ResourceLoadData* loadData = nullptr;
+			// At this point the resource is guaranteed to still be in-progress, so it's safe to update its dependency list
+			loadData->dependencies.insert(loadData->dependencies.end(), dependencyHandles.begin(), dependencyHandles.end());
+		}
 
-					auto iterFind = mInProgressResources.find(UUID);
-					if (iterFind == mInProgressResources.end()) // Fully loaded
-					{
-						loadData = bs_new<ResourceLoadData>(outputResource.getWeak(), 0);
-						loadData->resData = outputResource.getWeak();
-						loadData->remainingDependencies = 0;
-						loadData->notifyImmediately = synchronous; // Make resource listener trigger before exit if loading synchronously
+		if (--loadData->remainingDependencies == 0)
+			loadComplete(resourceCopy);
+	}
 
-						mInProgressResources[UUID] = loadData;
-					}
-					else
-					{
-						loadData = iterFind->second;
-					}
+	void Resources::setMaxConcurrentReads(UINT32 count)
+	{
+		{
+			Lock lock(mLoadQueueMutex);
+			mMaxConcurrentReads = std::max(1U, count);
+		}
 
-					// Register dependencies and count them so we know when the resource is fully loaded
-					for (auto& dependency : dependencies)
-					{
-						if (dependency != UUID)
-						{
-							bool registerDependency = true;
-
-							auto iterFind2 = mDependantLoads.find(dependency);
-							if (iterFind2 != mDependantLoads.end())
-							{
-								Vector<ResourceLoadData*>& dependantData = iterFind2->second;
-								auto iterFind3 = std::find_if(dependantData.begin(), dependantData.end(),
-									[&](ResourceLoadData* x)
-								{
-									return x->resData.resource.getUUID() == outputResource.getUUID();
-								});
-
-								registerDependency = iterFind3 == dependantData.end();
-							}
-
-							if (registerDependency)
-							{
-								mDependantLoads[dependency].push_back(loadData);
-								loadData->remainingDependencies++;
-								loadData->dependencies.push_back(_getResourceHandle(dependency));
-							}
-						}
-					}
-				}
+		startQueuedReads();
+	}
 
-				for (auto& dependency : dependencies)
-					loadFromUUID(dependency, !synchronous, true, false);
-			}
+	void Resources::queueRead(const Path& filePath, const HResource& resource, bool loadDependencies)
+	{
+		{
+			Lock lock(mLoadQueueMutex);
+			mPendingReads.push_back(PendingRead(filePath, resource, loadDependencies));
 		}
 
-		// Actually start the file read operation if not already loaded or in progress
-		if (!alreadyLoading && !filePath.isEmpty())
+		startQueuedReads();
+	}
+
+	void Resources::startQueuedReads()
+	{
+		Vector<PendingRead> readsToStart;
 		{
-			// Synchronous or the resource doesn't support async, read the file immediately
-			if (synchronous || !savedResourceData->allowAsyncLoading())
-			{
-				loadCallback(filePath, outputResource);
-			}
-			else // Asynchronous, read the file on a worker thread
+			Lock lock(mLoadQueueMutex);
+
+			while (!mPendingReads.empty() && mNumActiveReads < mMaxConcurrentReads)
 			{
-				String fileName = filePath.getFilename();
-				String taskName = "Resource load: " + fileName;
+				readsToStart.push_back(mPendingReads.front());
+				mPendingReads.pop_front();
 
-				SPtr<Task> task = Task::create(taskName, std::bind(&Resources::loadCallback, this, filePath, outputResource));
-				TaskScheduler::instance().addTask(task);
+				mNumActiveReads++;
 			}
 		}
-		else // File already loaded or in progress
+
+		for (auto& read : readsToStart)
 		{
-			// Complete the load unless its in progress in which case we wait for its worker thread to complete it.
-			// In case file is already loaded this will only decrement dependency count in case this resource is a dependency.
-			if (!loadInProgress)
-				loadComplete(outputResource);
+			String fileName = read.filePath.getFilename();
+			String taskName = "Resource load: " + fileName;
+
+			SPtr<Task> task = Task::create(taskName, std::bind(&Resources::readCallback, this, read.filePath, read.resource, 
+				read.loadDependencies, false));
+			TaskScheduler::instance().addTask(task);
+		}
+	}
+
+	void Resources::boostLoad(const String& uuid, UnorderedSet<String>& visited)
+	{
+		if (!visited.insert(uuid).second)
+			return;
+
+		// If the load is still waiting in one of the queues, steal it and perform it on this thread
+		bool foundRead = false;
+		bool foundDecode = false;
+		PendingRead read(Path::BLANK, HResource(), false);
+		PendingDecode decode(Path::BLANK, nullptr, HResource());
+		{
+			Lock lock(mLoadQueueMutex);
+
+			auto iterFind = std::find_if(mPendingReads.begin(), mPendingReads.end(),
+				[&](const PendingRead& x) { return x.resource.getUUID() == uuid; });
+
+			if (iterFind != mPendingReads.end())
+			{
+				read = *iterFind;
+				mPendingReads.erase(iterFind);
+
+				foundRead = true;
+			}
 			else
 			{
-				// In case loading finished in the meantime we cannot be sure at what point ::loadComplete was triggered,
-				// so trigger it manually so that the dependency count is properly decremented in case this resource
-				// is a dependency.
-				Lock lock(mLoadedResourceMutex);
-				auto iterFind = mLoadedResources.find(UUID);
-				if (iterFind != mLoadedResources.end())
-					loadComplete(outputResource);
+				auto iterFind2 = std::find_if(mMainThreadDecodes.begin(), mMainThreadDecodes.end(),
+					[&](const PendingDecode& x) { return x.resource.getUUID() == uuid; });
+
+				if (iterFind2 != mMainThreadDecodes.end())
+				{
+					decode = *iterFind2;
+					mMainThreadDecodes.erase(iterFind2);
+
+					foundDecode = true;
+				}
 			}
 		}
 
-		return outputResource;
+		if (foundRead)
+		{
+			readCallback(read.filePath, read.resource, read.loadDependencies, true);
+			return;
+		}
+
+		if (foundDecode)
+		{
+			decodeCallback(decode.filePath, decode.data, decode.resource);
+			return;
+		}
+
+		// Already being read or deserialized on a worker, make sure none of the dependencies are stuck in the queue
+		Vector<HResource> dependencies;
+		{
+			ResourceShard& shard = getShard(uuid);
+			Lock lock(shard.inProgressMutex);
+
+			auto iterFind = shard.inProgressResources.find(uuid);
+			if (iterFind != shard.inProgressResources.end())
+				dependencies = iterFind->second->dependencies;
+		}
+
+		for (auto& dependency : dependencies)
+			boostLoad(dependency.getUUID(), visited);
+	}
+
+	SPtr<MemoryDataStream> Resources::readResourceData(const String& uuid, const Path& filePath)
+	{
+		SPtr<ResourcePackage> package = findPackage(uuid);
+		if (package != nullptr)
+			return package->read(uuid);
+
+		SPtr<DataStream> stream = FileSystem::openFile(filePath);
+		if (stream == nullptr)
+			return nullptr;
+
+		SPtr<MemoryDataStream> data = bs_shared_ptr_new<MemoryDataStream>(stream);
+		stream->close();
+
+		return data;
+	}
+
+	/** 
+	 * Decodes the next object from a stream written by FileEncoder, and advances the stream past it. Returns null if the
+	 * stream doesn't contain a valid object.
+	 */
+	static SPtr<IReflectable> decodeNextObject(const SPtr<MemoryDataStream>& data)
+	{
+		UINT32 objectSize = 0;
+		if (data->read(&objectSize, sizeof(objectSize)) != sizeof(objectSize))
+			return nullptr;
+
+		if ((data->size() - data->tell()) < objectSize)
+			return nullptr;
+
+		BinarySerializer bs;
+		SPtr<IReflectable> object = bs.decode(data->getCurrentPtr(), objectSize);
+		data->skip(objectSize);
+
+		return object;
 	}
 
-	SPtr<Resource> Resources::loadFromDiskAndDeserialize(const Path& filePath)
+	SPtr<SavedResourceData> Resources::readHeader(const String& uuid, const Path& filePath)
 	{
+		// Packaged data is memory mapped, so there is no need to avoid reading the entire file
+		SPtr<ResourcePackage> package = findPackage(uuid);
+		if (package != nullptr)
+			return deserializeHeader(package->read(uuid));
+
 		FileDecoder fs(filePath);
-		fs.skip(); // Skipped over saved resource data
-		SPtr<IReflectable> loadedData = fs.decode();
+		return std::static_pointer_cast<SavedResourceData>(fs.decode());
+	}
+
+	bool Resources::resourceExists(const String& uuid, const Path& filePath) const
+	{
+		if (findPackage(uuid) != nullptr)
+			return true;
+
+		return !filePath.isEmpty() && FileSystem::isFile(filePath);
+	}
+
+	SPtr<ResourcePackage> Resources::findPackage(const String& uuid) const
+	{
+		Lock lock(mManifestMutex);
+
+		// Packages registered later take priority
+		for (auto iter = mResourcePackages.rbegin(); iter != mResourcePackages.rend(); ++iter)
+		{
+			if ((*iter)->contains(uuid))
+				return *iter;
+		}
+
+		return nullptr;
+	}
+
+	SPtr<SavedResourceData> Resources::deserializeHeader(const SPtr<MemoryDataStream>& data)
+	{
+		if (data == nullptr)
+			return nullptr;
+
+		data->seek(0);
+		SPtr<IReflectable> header = decodeNextObject(data);
+
+		if (header == nullptr || !header->isDerivedFrom(SavedResourceData::getRTTIStatic()))
+			return nullptr;
+
+		return std::static_pointer_cast<SavedResourceData>(header);
+	}
+
+	SPtr<Resource> Resources::deserializeResource(const SPtr<MemoryDataStream>& data, const Path& filePath)
+	{
+		SPtr<IReflectable> loadedData;
+		if (data != nullptr)
+			loadedData = decodeNextObject(data);
 
 		if (loadedData == nullptr)
 		{
@@ -366,35 +555,33 @@ namespace BansheeEngine
 	void Resources::release(ResourceHandleBase& resource)
 	{
 		const String& UUID = resource.getUUID();
+		ResourceShard& shard = getShard(UUID);
 
+		bool loadInProgress = false;
 		{
-			bool loadInProgress = false;
-
-			Lock inProgressLock(mInProgressResourcesMutex);
-			auto iterFind2 = mInProgressResources.find(UUID);
-			if (iterFind2 != mInProgressResources.end())
+			Lock inProgressLock(shard.inProgressMutex);
+			auto iterFind2 = shard.inProgressResources.find(UUID);
+			if (iterFind2 != shard.inProgressResources.end())
 				loadInProgress = true;
+		}
 
-			// Technically we should be able to just cancel a load in progress instead of blocking until it finishes.
-			// However that would mean the last reference could get lost on whatever thread did the loading, which
-			// isn't something that's supported. If this ends up being a problem either make handle counting atomic
-			// or add a separate queue for objects destroyed from the load threads.
-			if (loadInProgress)
-				resource.blockUntilLoaded();
+		// Technically we should be able to just cancel a load in progress instead of blocking until it finishes.
+		// However that would mean the last reference could get lost on whatever thread did the loading, which
+		// isn't something that's supported. If this ends up being a problem either make handle counting atomic
+		// or add a separate queue for objects destroyed from the load threads.
+		if (loadInProgress)
+			resource.blockUntilLoaded();
 
+		{
+			Lock loadedLock(shard.loadedMutex);
+			auto iterFind = shard.loadedResources.find(UUID);
+			if (iterFind != shard.loadedResources.end()) // Resource is already loaded
 			{
-				Lock loadedLock(mLoadedResourceMutex);
-				auto iterFind = mLoadedResources.find(UUID);
-				if (iterFind != mLoadedResources.end()) // Resource is already loaded
-				{
-					LoadedResourceData& resData = iterFind->second;
-
-					assert(resData.numInternalRefs > 0);
-					resData.numInternalRefs--;
-					resource.removeInternalRef();
+				LoadedResourceData& resData = iterFind->second;
 
-					return;
-				}
+				assert(resData.numInternalRefs > 0);
+				resData.numInternalRefs--;
+				resource.removeInternalRef();
 			}
 		}
 	}
@@ -403,9 +590,10 @@ namespace BansheeEngine
 	{
 		Vector<HResource> resourcesToUnload;
 
+		for (auto& shard : mShards)
 		{
-			Lock lock(mLoadedResourceMutex);
-			for(auto iter = mLoadedResources.begin(); iter != mLoadedResources.end(); ++iter)
+			Lock lock(shard.loadedMutex);
+			for(auto iter = shard.loadedResources.begin(); iter != shard.loadedResources.end(); ++iter)
 			{
 				const LoadedResourceData& resData = iter->second;
 
@@ -429,13 +617,14 @@ namespace BansheeEngine
 			return;
 
 		const String& uuid = resource.getUUID();
+		ResourceShard& shard = getShard(uuid);
 		if (!resource.isLoaded(false))
 		{
 			bool loadInProgress = false;
 			{
-				Lock lock(mInProgressResourcesMutex);
-				auto iterFind2 = mInProgressResources.find(uuid);
-				if (iterFind2 != mInProgressResources.end())
+				Lock lock(shard.inProgressMutex);
+				auto iterFind2 = shard.inProgressResources.find(uuid);
+				if (iterFind2 != shard.inProgressResources.end())
 					loadInProgress = true;
 			}
 
@@ -450,10 +639,10 @@ namespace BansheeEngine
 		resource.mData->mPtr->destroy();
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			Lock lock(shard.loadedMutex);
 
-			auto iterFind = mLoadedResources.find(uuid);
-			if (iterFind != mLoadedResources.end())
+			auto iterFind = shard.loadedResources.find(uuid);
+			if (iterFind != shard.loadedResources.end())
 			{
 				LoadedResourceData& resData = iterFind->second;
 				while (resData.numInternalRefs > 0)
@@ -462,7 +651,7 @@ namespace BansheeEngine
 					resData.resource.removeInternalRef();
 				}
 
-				mLoadedResources.erase(iterFind);
+				shard.loadedResources.erase(iterFind);
 			}
 			else
 			{
@@ -470,6 +659,7 @@ namespace BansheeEngine
 			}
 		}
 
+		removeResident(uuid);
 		resource.setHandleData(nullptr, uuid);
 	}
 
@@ -482,9 +672,11 @@ namespace BansheeEngine
 		{
 			bool loadInProgress = false;
 			{
-				Lock lock(mInProgressResourcesMutex);
-				auto iterFind2 = mInProgressResources.find(resource.getUUID());
-				if (iterFind2 != mInProgressResources.end())
+				ResourceShard& shard = getShard(resource.getUUID());
+
+				Lock lock(shard.inProgressMutex);
+				auto iterFind2 = shard.inProgressResources.find(resource.getUUID());
+				if (iterFind2 != shard.inProgressResources.end())
 					loadInProgress = true;
 			}
 
@@ -503,7 +695,10 @@ namespace BansheeEngine
 				BS_EXCEPT(InvalidParametersException, "Another file exists at the specified location.");
 		}
 
-		mDefaultResourceManifest->registerResource(resource.getUUID(), filePath);
+		{
+			Lock lock(mManifestMutex);
+			mDefaultResourceManifest->registerResource(resource.getUUID(), filePath);
+		}
 
 		Vector<ResourceDependency> dependencyList = Utility::findResourceDependencies(*resource.get());
 
@@ -533,12 +728,17 @@ namespace BansheeEngine
 		const String& uuid = handle.getUUID();
 		handle.setHandleData(resource, uuid);
 
+		// Resource no longer matches its saved version, so it cannot be unloaded and loaded again
+		removeResident(uuid);
+
 		{
-			Lock lock(mLoadedResourceMutex);
-			auto iterFind = mLoadedResources.find(uuid);
-			if (iterFind == mLoadedResources.end())
+			ResourceShard& shard = getShard(uuid);
+
+			Lock lock(shard.loadedMutex);
+			auto iterFind = shard.loadedResources.find(uuid);
+			if (iterFind == shard.loadedResources.end())
 			{
-				LoadedResourceData& resData = mLoadedResources[uuid];
+				LoadedResourceData& resData = shard.loadedResources[uuid];
 				resData.resource = handle.getWeak();
 			}
 		}
@@ -548,21 +748,43 @@ namespace BansheeEngine
 
 	Vector<String> Resources::getDependencies(const Path& filePath)
 	{
+		String uuid;
+		getUUIDFromFilePath(filePath, uuid);
+
 		SPtr<SavedResourceData> savedResourceData;
-		if (!filePath.isEmpty())
-		{
-			FileDecoder fs(filePath);
-			savedResourceData = std::static_pointer_cast<SavedResourceData>(fs.decode());
-		}
+		if (resourceExists(uuid, filePath))
+			savedResourceData = readHeader(uuid, filePath);
+
+		if (savedResourceData == nullptr)
+			return Vector<String>();
 
 		return savedResourceData->getDependencies();
 	}
 
+	void Resources::registerResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mManifestMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter == mResourcePackages.end())
+			mResourcePackages.push_back(package);
+	}
+
+	void Resources::unregisterResourcePackage(const SPtr<ResourcePackage>& package)
+	{
+		Lock lock(mManifestMutex);
+
+		auto findIter = std::find(mResourcePackages.begin(), mResourcePackages.end(), package);
+		if (findIter != mResourcePackages.end())
+			mResourcePackages.erase(findIter);
+	}
+
 	void Resources::registerResourceManifest(const SPtr<ResourceManifest>& manifest)
 	{
 		if(manifest->getName() == "Default")
 			return;
 
+		Lock lock(mManifestMutex);
 		auto findIter = std::find(mResourceManifests.begin(), mResourceManifests.end(), manifest);
 		if(findIter == mResourceManifests.end())
 			mResourceManifests.push_back(manifest);
@@ -575,6 +797,7 @@ namespace BansheeEngine
 		if (manifest->getName() == "Default")
 			return;
 
+		Lock lock(mManifestMutex);
 		auto findIter = std::find(mResourceManifests.begin(), mResourceManifests.end(), manifest);
 		if (findIter != mResourceManifests.end())
 			mResourceManifests.erase(findIter);
@@ -582,6 +805,7 @@ namespace BansheeEngine
 
 	SPtr<ResourceManifest> Resources::getResourceManifest(const String& name) const
 	{
+		Lock lock(mManifestMutex);
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
 			if(name == (*iter)->getName())
@@ -595,17 +819,19 @@ namespace BansheeEngine
 	{
 		if (checkInProgress)
 		{
-			Lock inProgressLock(mInProgressResourcesMutex);
-			auto iterFind2 = mInProgressResources.find(uuid);
-			if (iterFind2 != mInProgressResources.end())
+			ResourceShard& shard = getShard(uuid);
+
+			Lock inProgressLock(shard.inProgressMutex);
+			auto iterFind2 = shard.inProgressResources.find(uuid);
+			if (iterFind2 != shard.inProgressResources.end())
 			{
 				return true;
 			}
 
 			{
-				Lock loadedLock(mLoadedResourceMutex);
-				auto iterFind = mLoadedResources.find(uuid);
-				if (iterFind != mLoadedResources.end())
+				Lock loadedLock(shard.loadedMutex);
+				auto iterFind = shard.loadedResources.find(uuid);
+				if (iterFind != shard.loadedResources.end())
 				{
 					return true;
 				}
@@ -621,11 +847,12 @@ namespace BansheeEngine
 		HResource newHandle(obj, uuid);
 
 		{
-			Lock lock(mLoadedResourceMutex);
+			ResourceShard& shard = getShard(uuid);
+			Lock lock(shard.loadedMutex);
 
-			LoadedResourceData& resData = mLoadedResources[uuid];
+			LoadedResourceData& resData = shard.loadedResources[uuid];
 			resData.resource = newHandle.getWeak();
-			mHandles[uuid] = newHandle.getWeak();
+			shard.handles[uuid] = newHandle.getWeak();
 		}
 	
 		return newHandle;
@@ -633,22 +860,28 @@ namespace BansheeEngine
 
 	HResource Resources::_getResourceHandle(const String& uuid)
 	{
-		Lock lock(mLoadedResourceMutex);
-		auto iterFind3 = mHandles.find(uuid);
-		if (iterFind3 != mHandles.end()) // Not loaded, but handle does exist
+		ResourceShard& shard = getShard(uuid);
+
+		Lock lock(shard.loadedMutex);
+		auto iterFind3 = shard.handles.find(uuid);
+		if (iterFind3 != shard.handles.end()) // Not loaded, but handle does exist
 		{
 			return iterFind3->second.lock();
 		}
 
 		// Create new handle
 		HResource handle(uuid);
-		mHandles[uuid] = handle.getWeak();
+		shard.handles[uuid] = handle.getWeak();
 
 		return handle;
 	}
 
 	bool Resources::getFilePathFromUUID(const String& uuid, Path& filePath) const
 	{
+		Lock lock(mManifestMutex);
+
+		// Default manifest is at 0th index but all other take priority since Default manifest could
+		// contain obsolete data. 
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
 			if((*iter)->uuidToFilePath(uuid, filePath))
@@ -664,6 +897,7 @@ namespace BansheeEngine
 		if (!manifestPath.isAbsolute())
 			manifestPath.makeAbsolute(FileSystem::getWorkingDirectoryPath());
 
+		Lock lock(mManifestMutex);
 		for(auto iter = mResourceManifests.rbegin(); iter != mResourceManifests.rend(); ++iter) 
 		{
 			if ((*iter)->filePathToUUID(manifestPath, uuid))
@@ -676,55 +910,60 @@ namespace BansheeEngine
 	void Resources::loadComplete(HResource& resource)
 	{
 		String uuid = resource.getUUID();
+		ResourceShard& shard = getShard(uuid);
 
 		ResourceLoadData* myLoadData = nullptr;
 		bool finishLoad = true;
-		Vector<ResourceLoadData*> dependantLoads;
+		Vector<HResource> dependants;
 		{
-			Lock inProgresslock(mInProgressResourcesMutex);
+			Lock inProgresslock(shard.inProgressMutex);
 
-			auto iterFind = mInProgressResources.find(uuid);
-			if (iterFind != mInProgressResources.end())
+			auto iterFind = shard.inProgressResources.find(uuid);
+			if (iterFind != shard.inProgressResources.end())
 			{
 				myLoadData = iterFind->second;
 				finishLoad = myLoadData->remainingDependencies == 0;
 				
 				if (finishLoad)
-					mInProgressResources.erase(iterFind);
+					shard.inProgressResources.erase(iterFind);
 			}
 
-			auto iterFind2 = mDependantLoads.find(uuid);
-
-			if (iterFind2 != mDependantLoads.end())
-				dependantLoads = iterFind2->second;
-
 			if (finishLoad)
 			{
-				mDependantLoads.erase(uuid);
+				auto iterFind2 = shard.dependantLoads.find(uuid);
+				if (iterFind2 != shard.dependantLoads.end())
+				{
+					// Grab the handles before decrementing, as the dependant load data can be freed by another thread as 
+					// soon as its counter reaches zero
+					for (auto& dependantLoad : iterFind2->second)
+					{
+						dependants.push_back(dependantLoad->resData.resource.lock());
+						dependantLoad->remainingDependencies--;
+					}
+
+					shard.dependantLoads.erase(iterFind2);
+				}
 
 				// If loadedData is null then we're probably completing load on an already loaded resource, triggered
 				// by its dependencies.
 				if (myLoadData != nullptr && myLoadData->loadedData != nullptr)
 				{
-					Lock loadedLock(mLoadedResourceMutex);
+					Lock loadedLock(shard.loadedMutex);
 
-					mLoadedResources[uuid] = myLoadData->resData;
+					shard.loadedResources[uuid] = myLoadData->resData;
 					resource.setHandleData(myLoadData->loadedData, uuid);
 				}
-
-				for (auto& dependantLoad : dependantLoads)
-					dependantLoad->remainingDependencies--;
 			}
 		}
 
-		for (auto& dependantLoad : dependantLoads)
-		{
-			HResource dependant = dependantLoad->resData.resource.lock();
+		for (auto& dependant : dependants)
 			loadComplete(dependant);
-		}
 
 		if (finishLoad && myLoadData != nullptr)
 		{
+			if (myLoadData->loadedData != nullptr)
+				addResident(uuid, myLoadData->loadedData);
+
 			onResourceLoaded(resource);
 
 			// This should only ever be true on the main thread
@@ -735,20 +974,243 @@ namespace BansheeEngine
 		}
 	}
 
-	void Resources::loadCallback(const Path& filePath, HResource& resource)
+	void Resources::readCallback(const Path& filePath, const HResource& resource, bool loadDependencies, bool boosted)
 	{
-		SPtr<Resource> rawResource = loadFromDiskAndDeserialize(filePath);
+		SPtr<MemoryDataStream> fileData = readResourceData(resource.getUUID(), filePath);
 
+		// Free up the read slot for the next queued file (stolen reads never took one)
+		if (!boosted)
 		{
-			Lock lock(mInProgressResourcesMutex);
+			{
+				Lock lock(mLoadQueueMutex);
+				mNumActiveReads--;
+			}
+
+			startQueuedReads();
+		}
+
+		SPtr<SavedResourceData> savedResourceData = deserializeHeader(fileData);
+
+		// Dependencies are discovered here, so they start loading (and reading in parallel) while this resource is still
+		// being deserialized. If the load was boosted, the waiting thread needs them as well so load them immediately.
+		if (loadDependencies && savedResourceData != nullptr && !savedResourceData->getDependencies().empty())
+			startDependencyLoads(resource, savedResourceData->getDependencies(), boosted, false);
+
+		if (boosted || savedResourceData == nullptr)
+		{
+			decodeCallback(filePath, fileData, resource);
+		}
+		else if (!savedResourceData->allowAsyncLoading()) // Resource doesn't support async, deserialize on main thread
+		{
+			{
+				Lock lock(mLoadQueueMutex);
+				mMainThreadDecodes.push_back(PendingDecode(filePath, fileData, resource));
+			}
+
+			// The main thread might be blocked waiting on this resource, in which case it must perform the decode itself
+			ResourceHandleBase::notifyLoadProgress();
+		}
+		else
+		{
+			String fileName = filePath.getFilename();
+			String taskName = "Resource decode: " + fileName;
+
+			// Higher priority than reads so already read files get processed first, keeping the amount of buffered file
+			// data low
+			SPtr<Task> task = Task::create(taskName, std::bind(&Resources::decodeCallback, this, filePath, fileData, 
+				resource), TaskPriority::High);
+			TaskScheduler::instance().addTask(task);
+		}
+	}
+
+	void Resources::decodeCallback(const Path& filePath, const SPtr<MemoryDataStream>& data, const HResource& resource)
+	{
+		SPtr<Resource> rawResource = deserializeResource(data, filePath);
+
+		ResourceLoadData* myLoadData = nullptr;
+		{
+			ResourceShard& shard = getShard(resource.getUUID());
+			Lock lock(shard.inProgressMutex);
 
 			// Check if all my dependencies are loaded
-			ResourceLoadData* myLoadData = mInProgressResources[resource.getUUID()];
+			myLoadData = shard.inProgressResources[resource.getUUID()];
 			myLoadData->loadedData = rawResource;
-			myLoadData->remainingDependencies--;
 		}
 
-		loadComplete(resource);
+		HResource resourceCopy = resource;
+		if (--myLoadData->remainingDependencies == 0)
+			loadComplete(resourceCopy);
+	}
+
+	void Resources::_update()
+	{
+		Vector<PendingDecode> decodes;
+		{
+			Lock lock(mLoadQueueMutex);
+			std::swap(decodes, mMainThreadDecodes);
+		}
+
+		for (auto& decode : decodes)
+			decodeCallback(decode.filePath, decode.data, decode.resource);
+
+		enforceMemoryBudgets();
+	}
+
+	void Resources::setMemoryBudget(UINT32 typeId, UINT64 budget)
+	{
+		Lock lock(mBudgetMutex);
+		mTypeBudgets[typeId].budget = budget;
+	}
+
+	UINT64 Resources::getMemoryBudget(UINT32 typeId) const
+	{
+		Lock lock(mBudgetMutex);
+
+		auto iterFind = mTypeBudgets.find(typeId);
+		if (iterFind == mTypeBudgets.end())
+			return 0;
+
+		return iterFind->second.budget;
+	}
+
+	UINT64 Resources::getResidentSize(UINT32 typeId) const
+	{
+		Lock lock(mBudgetMutex);
+
+		auto iterFind = mTypeBudgets.find(typeId);
+		if (iterFind == mTypeBudgets.end())
+			return 0;
+
+		return iterFind->second.residentSize;
+	}
+
+	void Resources::addResident(const String& uuid, const SPtr<Resource>& resource)
+	{
+		UINT64 size = resource->getSize();
+		if (size == 0)
+			return;
+
+		UINT32 typeId = resource->getRTTI()->getRTTIId();
+
+		Lock lock(mBudgetMutex);
+		if (mResidentResources.find(uuid) != mResidentResources.end())
+			return;
+
+		ResourceTypeBudget& typeBudget = mTypeBudgets[typeId];
+		typeBudget.residentSize += size;
+		typeBudget.lru.push_back(uuid);
+
+		ResidentResource& resident = mResidentResources[uuid];
+		resident.typeId = typeId;
+		resident.size = size;
+		resident.lruEntry = std::prev(typeBudget.lru.end());
+	}
+
+	void Resources::removeResident(const String& uuid)
+	{
+		Lock lock(mBudgetMutex);
+
+		auto iterFind = mResidentResources.find(uuid);
+		if (iterFind == mResidentResources.end())
+			return;
+
+		ResourceTypeBudget& typeBudget = mTypeBudgets[iterFind->second.typeId];
+		typeBudget.residentSize -= iterFind->second.size;
+		typeBudget.lru.erase(iterFind->second.lruEntry);
+
+		mResidentResources.erase(iterFind);
+	}
+
+	void Resources::touchResident(const String& uuid)
+	{
+		Lock lock(mBudgetMutex);
+
+		auto iterFind = mResidentResources.find(uuid);
+		if (iterFind == mResidentResources.end())
+			return;
+
+		List<String>& lru = mTypeBudgets[iterFind->second.typeId].lru;
+		lru.splice(lru.end(), lru, iterFind->second.lruEntry);
+	}
+
+	bool Resources::isReferencedOnlyInternally(const String& uuid)
+	{
+		ResourceShard& shard = getShard(uuid);
+
+		// Resources still participating in a load (e.g. as a parent waiting on dependencies) are in use
+		Lock inProgressLock(shard.inProgressMutex);
+		if (shard.inProgressResources.find(uuid) != shard.inProgressResources.end())
+			return false;
+
+		Lock loadedLock(shard.loadedMutex);
+		auto iterFind = shard.loadedResources.find(uuid);
+		if (iterFind == shard.loadedResources.end())
+			return false;
+
+		const LoadedResourceData& resData = iterFind->second;
+		return resData.numInternalRefs > 0 && resData.resource.mData->mRefCount == resData.numInternalRefs;
+	}
+
+	void Resources::enforceMemoryBudgets()
+	{
+		Vector<String> resourcesToUnload;
+		{
+			Lock lock(mBudgetMutex);
+
+			for (auto& entry : mTypeBudgets)
+			{
+				ResourceTypeBudget& typeBudget = entry.second;
+				if (typeBudget.budget == 0 || typeBudget.residentSize <= typeBudget.budget)
+					continue;
+
+				UINT64 excess = typeBudget.residentSize - typeBudget.budget;
+				UINT64 freed = 0;
+
+				// Resources referenced from outside the resource system are in use, move them to the back of the queue
+				UINT32 numToCheck = (UINT32)typeBudget.lru.size();
+				auto iter = typeBudget.lru.begin();
+				for (UINT32 i = 0; i < numToCheck && freed < excess; i++)
+				{
+					auto current = iter++;
+
+					if (isReferencedOnlyInternally(*current))
+					{
+						resourcesToUnload.push_back(*current);
+						freed += mResidentResources[*current].size;
+					}
+					else
+						typeBudget.lru.splice(typeBudget.lru.end(), typeBudget.lru, current);
+				}
+			}
+		}
+
+		for (auto& uuid : resourcesToUnload)
+		{
+			HResource resource;
+			{
+				ResourceShard& shard = getShard(uuid);
+				Lock inProgressLock(shard.inProgressMutex);
+				if (shard.inProgressResources.find(uuid) != shard.inProgressResources.end())
+					continue;
+
+				Lock loadedLock(shard.loadedMutex);
+				auto iterFind = shard.loadedResources.find(uuid);
+				if (iterFind == shard.loadedResources.end())
+					continue;
+
+				LoadedResourceData& resData = iterFind->second;
+				resource = resData.resource.lock();
+
+				// The reference count was checked without holding the shard lock, in the meantime load() could have
+				// handed out a new handle. Only internal references and the handle held here are allowed.
+				if (resData.resource.mData->mRefCount != resData.numInternalRefs + 1)
+					continue;
+			}
+
+			// Handle is left in the same state as after an explicit destroy, it reports as not loaded and can be
+			// passed to load() again
+			destroy(resource);
+		}
 	}
 
 	BS_CORE_EXPORT Resources& gResources()
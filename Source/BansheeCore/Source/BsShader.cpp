@@ -306,6 +306,13 @@ namespace BansheeEngine
 			}
 		}
 
+		// Only consider techniques for other render APIs if none were written for the current one
+		for (auto iter = mTechniques.begin(); iter != mTechniques.end(); ++iter)
+		{
+			if ((*iter)->isSupportedAsFallback())
+				return *iter;
+		}
+
 		return nullptr;
 
 		// TODO - Low priority. Instead of returning null use an extremely simple technique that will be supported almost everywhere as a fallback.
@@ -30,6 +30,15 @@ namespace BansheeEngine
 		return false;
 	}
 
+	bool TechniqueBase::isSupportedAsFallback() const
+	{
+		const StringID& fallbackName = RenderAPICore::instancePtr()->getTechniqueFallbackName();
+		if (fallbackName == StringID::NONE || fallbackName != mRenderAPI)
+			return false;
+
+		return RendererManager::instance().getActive()->getName() == mRenderer || RendererAny == mRenderer;
+	}
+
 	template<bool Core>
 	TTechnique<Core>::TTechnique(const StringID& renderAPI, const StringID& renderer, const Vector<SPtr<PassType>>& passes)
 		: TechniqueBase(renderAPI, renderer), mPasses(passes)
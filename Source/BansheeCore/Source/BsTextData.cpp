@@ -360,7 +360,7 @@ namespace BansheeEngine
 			mFontData = font->getBitmap(nearestSize);
 		}
 
-		if(mFontData == nullptr || mFontData->texturePages.size() == 0)
+		if(mFontData == nullptr || mFontData->getNumTexturePages() == 0)
 			return;
 
 		if(mFontData->size != fontSize)
@@ -545,9 +545,9 @@ namespace BansheeEngine
 			MemBuffer->deallocAll();
 	}
 
-	const HTexture& TextDataBase::getTextureForPage(UINT32 page) const 
+	HTexture TextDataBase::getTextureForPage(UINT32 page) const 
 	{ 
-		return mFontData->texturePages[page]; 
+		return mFontData->getTexturePage(page); 
 	}
 
 	INT32 TextDataBase::getBaselineOffset() const 
@@ -640,11 +640,13 @@ namespace BansheeEngine
 
 	void TextDataBase::BufferData::addCharToPage(UINT32 page, const FontBitmap& fontData)
 	{
-		if(NextFreePageInfo >= PageBufferSize)
+		// Pages of the glyph cache can have indices larger than the buffer, so make sure there is room for all pages up 
+		// to the requested one
+		if(page >= PageBufferSize)
 		{
-			UINT32 newBufferSize = PageBufferSize * 2;
+			UINT32 newBufferSize = std::max(PageBufferSize * 2, page + 1);
 			PageInfo* newBuffer = bs_newN<PageInfo>(newBufferSize);
-			memcpy((void*)PageBuffer, (void*)newBuffer, PageBufferSize);
+			memcpy((void*)newBuffer, (void*)PageBuffer, NextFreePageInfo * sizeof(PageInfo));
 
 			bs_deleteN(PageBuffer, PageBufferSize);
 			PageBuffer = newBuffer;
@@ -202,7 +202,7 @@ namespace BansheeEngine
 		RenderAPICore::destroyCore();
 	}
 
-	void D3D11RenderAPI::setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState)
+	void D3D11RenderAPI::setSamplerStateImpl(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -240,7 +240,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumSamplerBinds);
 	}
 
-	void D3D11RenderAPI::setBlendState(const SPtr<BlendStateCore>& blendState)
+	void D3D11RenderAPI::setBlendStateImpl(const SPtr<BlendStateCore>& blendState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -250,7 +250,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumBlendStateChanges);
 	}
 
-	void D3D11RenderAPI::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	void D3D11RenderAPI::setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -260,7 +260,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumRasterizerStateChanges);
 	}
 
-	void D3D11RenderAPI::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	void D3D11RenderAPI::setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -270,7 +270,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumDepthStencilStateChanges);
 	}
 
-	void D3D11RenderAPI::setTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
+	void D3D11RenderAPI::setTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -313,7 +313,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumTextureBinds);
 	}
 
-	void D3D11RenderAPI::setLoadStoreTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
+	void D3D11RenderAPI::setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
 		const TextureSurface& surface)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -408,7 +408,7 @@ namespace BansheeEngine
 		mDevice->getImmediateContext()->RSSetViewports(1, &mViewport);
 	}
 
-	void D3D11RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	void D3D11RenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -436,7 +436,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumVertexBufferBinds);
 	}
 
-	void D3D11RenderAPI::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	void D3D11RenderAPI::setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -455,21 +455,21 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void D3D11RenderAPI::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	void D3D11RenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		mActiveVertexDeclaration = vertexDeclaration;
 	}
 
-	void D3D11RenderAPI::setDrawOperation(DrawOperationType op)
+	void D3D11RenderAPI::setDrawOperationImpl(DrawOperationType op)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		mDevice->getImmediateContext()->IASetPrimitiveTopology(D3D11Mappings::getPrimitiveType(op));
 	}
 
-	void D3D11RenderAPI::bindGpuProgram(const SPtr<GpuProgramCore>& prg)
+	void D3D11RenderAPI::bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -522,7 +522,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumGpuProgramBinds);
 	}
 
-	void D3D11RenderAPI::unbindGpuProgram(GpuProgramType gptype)
+	void D3D11RenderAPI::unbindGpuProgramImpl(GpuProgramType gptype)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -695,6 +695,9 @@ namespace BansheeEngine
 			// TODO - Ignoring targetMask here
 			D3D11RenderUtility::instance().drawClearQuad(buffers, color, depth, stencil);
 			BS_INC_RENDER_STAT(NumClears);
+
+			// Clear quad binds its own states, buffers and programs directly on the device
+			invalidateStateCache();
 		}
 		else
 			clearRenderTarget(buffers, color, depth, stencil, targetMask);
@@ -759,7 +762,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumClears);
 	}
 
-	void D3D11RenderAPI::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	void D3D11RenderAPI::setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -945,6 +948,8 @@ namespace BansheeEngine
 
 		rsc->setCapability(RSC_PERSTAGECONSTANT);
 
+		rsc->setCapability(RSC_INSTANCING);
+
 		return rsc;
 	}
 
@@ -27,48 +27,48 @@ namespace BansheeEngine
 		/** @copydoc RenderAPICore::getShadingLanguageName() */
 		const String& getShadingLanguageName() const override;
 
-		/** @copydoc RenderAPICore::setRenderTarget() */
-		void setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil = false) override;
+		/** @copydoc RenderAPICore::setRenderTargetImpl() */
+		void setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil) override;
 
-		/** @copydoc RenderAPICore::bindGpuProgram() */
-		void bindGpuProgram(const SPtr<GpuProgramCore>& prg) override;
+		/** @copydoc RenderAPICore::bindGpuProgramImpl() */
+		void bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg) override;
 
-		/** @copydoc RenderAPICore::unbindGpuProgram() */
-		void unbindGpuProgram(GpuProgramType gptype) override;
+		/** @copydoc RenderAPICore::unbindGpuProgramImpl() */
+		void unbindGpuProgramImpl(GpuProgramType gptype) override;
 
 		/** @copydoc RenderAPICore::setConstantBuffers() */
 		void setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& params) override;
 
-		/** @copydoc RenderAPICore::setVertexBuffers() */
-		void setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) override;
+		/** @copydoc RenderAPICore::setVertexBuffersImpl() */
+		void setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) override;
 
-		/** @copydoc RenderAPICore::setIndexBuffer() */
-		void setIndexBuffer(const SPtr<IndexBufferCore>& buffer) override;
+		/** @copydoc RenderAPICore::setIndexBufferImpl() */
+		void setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer) override;
 
-		/** @copydoc RenderAPICore::setVertexDeclaration() */
-		void setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration) override;
+		/** @copydoc RenderAPICore::setVertexDeclarationImpl() */
+		void setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration) override;
 
-		/** @copydoc RenderAPICore::setDrawOperation() */
-		void setDrawOperation(DrawOperationType op) override;
+		/** @copydoc RenderAPICore::setDrawOperationImpl() */
+		void setDrawOperationImpl(DrawOperationType op) override;
 
-		/** @copydoc RenderAPICore::setTexture() */
-		void setTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) override;
+		/** @copydoc RenderAPICore::setTextureImpl() */
+		void setTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) override;
 
-		/** @copydoc RenderAPICore::setLoadStoreTexture() */
-		void setLoadStoreTexture(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr,
+		/** @copydoc RenderAPICore::setLoadStoreTextureImpl() */
+		void setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr,
 			const TextureSurface& surface) override;
 
-		/** @copydoc RenderAPICore::setSamplerState() */
-		void setSamplerState(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) override;
+		/** @copydoc RenderAPICore::setSamplerStateImpl() */
+		void setSamplerStateImpl(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) override;
 
-		/** @copydoc RenderAPICore::setBlendState() */
-		void setBlendState(const SPtr<BlendStateCore>& blendState) override;
+		/** @copydoc RenderAPICore::setBlendStateImpl() */
+		void setBlendStateImpl(const SPtr<BlendStateCore>& blendState) override;
 
-		/** @copydoc RenderAPICore::setRasterizerState() */
-		void setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState) override;
+		/** @copydoc RenderAPICore::setRasterizerStateImpl() */
+		void setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState) override;
 
-		/** @copydoc RenderAPICore::setDepthStencilState() */
-		void setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) override;
+		/** @copydoc RenderAPICore::setDepthStencilStateImpl() */
+		void setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) override;
 
 		/** @copydoc RenderAPICore::setViewport() */
 		void setViewport(const Rect2& area) override;
@@ -192,7 +192,7 @@ namespace BansheeEngine
 		mResourceManager->unlockDeviceAccess();
 	}	
 
-	void D3D9RenderAPI::bindGpuProgram(const SPtr<GpuProgramCore>& prg)
+	void D3D9RenderAPI::bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -225,11 +225,9 @@ namespace BansheeEngine
 			setTextureStageState(nStage, D3DTSS_TEXCOORDINDEX, nStage);
 
 		BS_INC_RENDER_STAT(NumGpuProgramBinds);
-
-		RenderAPICore::bindGpuProgram(prg);
 	}
 
-	void D3D9RenderAPI::unbindGpuProgram(GpuProgramType gptype)
+	void D3D9RenderAPI::unbindGpuProgramImpl(GpuProgramType gptype)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -253,8 +251,6 @@ namespace BansheeEngine
 		};
 
 		BS_INC_RENDER_STAT(NumGpuProgramBinds);
-
-		RenderAPICore::unbindGpuProgram(gptype);
 	}
 
 	void D3D9RenderAPI::setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& bindableParams)
@@ -400,7 +396,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumGpuParamBufferBinds);
 	}
 
-	void D3D9RenderAPI::setTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& tex)
+	void D3D9RenderAPI::setTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& tex)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -478,7 +474,7 @@ namespace BansheeEngine
 		}
 	}
 
-	void D3D9RenderAPI::setLoadStoreTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
+	void D3D9RenderAPI::setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
 		const TextureSurface& surface)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -486,7 +482,7 @@ namespace BansheeEngine
 		LOGWRN("Texture random load/store not supported on DX9.");
 	}
 
-	void D3D9RenderAPI::setSamplerState(GpuProgramType gptype, UINT16 unit, const SPtr<SamplerStateCore>& state)
+	void D3D9RenderAPI::setSamplerStateImpl(GpuProgramType gptype, UINT16 unit, const SPtr<SamplerStateCore>& state)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -525,7 +521,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumSamplerBinds);
 	}
 
-	void D3D9RenderAPI::setBlendState(const SPtr<BlendStateCore>& blendState)
+	void D3D9RenderAPI::setBlendStateImpl(const SPtr<BlendStateCore>& blendState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -553,7 +549,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumBlendStateChanges);
 	}
 
-	void D3D9RenderAPI::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	void D3D9RenderAPI::setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -574,7 +570,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumRasterizerStateChanges);
 	}
 
-	void D3D9RenderAPI::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	void D3D9RenderAPI::setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -999,7 +995,7 @@ namespace BansheeEngine
 			setSamplerState( static_cast<DWORD>(unit), D3DSAMP_MAXANISOTROPY, maxAnisotropy );
 	}
 
-	void D3D9RenderAPI::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	void D3D9RenderAPI::setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -1093,7 +1089,7 @@ namespace BansheeEngine
 		mIsFrameInProgress = false;
 	}
 
-	void D3D9RenderAPI::setVertexDeclaration(const SPtr<VertexDeclarationCore>& decl)
+	void D3D9RenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& decl)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -1106,7 +1102,7 @@ namespace BansheeEngine
 		}
 	}
 
-	void D3D9RenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	void D3D9RenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -1142,7 +1138,7 @@ namespace BansheeEngine
 		}
 	}
 
-	void D3D9RenderAPI::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	void D3D9RenderAPI::setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -1155,7 +1151,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumIndexBufferBinds);
 	}
 
-	void D3D9RenderAPI::setDrawOperation(DrawOperationType op)
+	void D3D9RenderAPI::setDrawOperationImpl(DrawOperationType op)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -2090,6 +2086,7 @@ namespace BansheeEngine
 		// Reset state attributes.	
 		mVertexProgramBound = false;
 		mFragmentProgramBound = false;
+		invalidateStateCache();
 
 		if (mRestoreFrameOnReset)
 		{
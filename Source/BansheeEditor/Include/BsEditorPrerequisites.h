@@ -223,6 +223,7 @@ namespace BansheeEngine
 		TID_Settings = 40019,
 		TID_ProjectSettings = 40020,
 		TID_WindowFrameWidget = 40021,
-		TID_ProjectResourceMeta = 40022
+		TID_ProjectResourceMeta = 40022,
+		TID_TestResource = 40023
 	};
 }
@@ -90,6 +90,18 @@ namespace BansheeEngine
 
 		/**	Tests the frame allocator. */
 		void TestFrameAlloc();
+
+		/** Tests the range allocator, including merging of freed ranges and allocations at size class boundaries. */
+		void TestRangeAlloc();
+
+		/** Tests glyph cache atlas packing, least recently used eviction and pinning of referenced characters. */
+		void TestGlyphCache();
+
+		/** 
+		 * Tests that waiting on an asynchronous load of a resource that must be deserialized on the main thread doesn't
+		 * block the main thread forever.
+		 */
+		void TestMainThreadResourceLoad();
 	};
 
 	/** @} */
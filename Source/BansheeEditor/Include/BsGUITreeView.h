@@ -37,7 +37,8 @@ namespace BansheeEngine
 
 		/**
 		 * Contains data about a single piece of content and all its children. This element may be visible and represented
-		 * by a GUI element, but might not (for example its parent is collapsed).
+		 * by a GUI element, but might not (for example its parent is collapsed, or it is scrolled out of view). GUI 
+		 * elements are only assigned to elements within the visible area, and are recycled as the view scrolls.
 		 */
 		struct TreeElement
 		{
@@ -49,8 +50,13 @@ namespace BansheeEngine
 
 			GUIToggle* mFoldoutBtn;
 			GUILabel* mElement;
+			HEvent mFoldoutToggledConn;
 
 			String mName;
+			Rect2I mLayoutArea;
+
+			mutable Vector2I mOptimalSize;
+			mutable const GUIElementStyle* mOptimalSizeStyle;
 
 			UINT32 mSortedIdx;
 			bool mIsExpanded;
@@ -237,6 +243,24 @@ namespace BansheeEngine
 		/**	Rebuilds the needed GUI elements for the provided TreeElement. */
 		void updateElementGUI(TreeElement* element);
 
+		/** 
+		 * Assigns GUI elements from the pool to the provided TreeElement so it can be displayed, and updates them with the
+		 * element's current state. 
+		 */
+		void bindElementGUI(TreeElement* element);
+
+		/** Returns any GUI elements assigned to the provided TreeElement back to the pool. */
+		void unbindElementGUI(TreeElement* element);
+
+		/** Returns the style used by the GUI elements displaying the tree element names. */
+		const GUIElementStyle* getElementStyle() const;
+
+		/** 
+		 * Returns the optimal size of the label displaying the tree element's name, without requiring the label to exist. 
+		 * The size is cached until the name or the style changes.
+		 */
+		Vector2I getElementSize(const TreeElement* element, const GUIElementStyle* style) const;
+
 		/**	Close any elements that were temporarily expanded due to a drag operation hovering over them. */
 		void closeTemporarilyExpandedElements();
 
@@ -284,6 +308,8 @@ namespace BansheeEngine
 		GUITexture* mBackgroundImage;
 
 		Vector<InteractableElement> mVisibleElements;
+		Vector<GUILabel*> mFreeLabels;
+		Vector<GUIToggle*> mFreeFoldoutBtns;
 
 		bool mIsElementSelected;
 		Vector<SelectedElement> mSelectedElements;
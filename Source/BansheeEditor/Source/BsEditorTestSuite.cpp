@@ -14,7 +14,11 @@
 #include "BsResources.h"
 #include "BsPrefabDiff.h"
 #include "BsFrameAlloc.h"
+#include "BsRangeAlloc.h"
 #include "BsFileSystem.h"
+#include "BsFontManager.h"
+#include "BsGlyphCache.h"
+#include "BsTime.h"
 
 namespace BansheeEngine
 {
@@ -422,6 +426,128 @@ namespace BansheeEngine
 		return TestComponentD::getRTTIStatic();
 	}
 
+	class TestResource : public Resource
+	{
+	public:
+		UINT32 value = 0;
+
+		TestResource()
+			:Resource(false)
+		{ }
+
+		/** @copydoc Resource::allowAsyncLoading */
+		bool allowAsyncLoading() const override { return false; }
+
+		/** Creates a new resource and a handle to it. */
+		static HResource create(UINT32 value)
+		{
+			return gResources()._createResourceHandle(_createPtr(value));
+		}
+
+		/** Creates a new resource without a handle. */
+		static SPtr<TestResource> _createPtr(UINT32 value)
+		{
+			SPtr<TestResource> resource = bs_core_ptr<TestResource>(new (bs_alloc<TestResource>()) TestResource());
+			resource->value = value;
+			resource->_setThisPtr(resource);
+			resource->initialize();
+
+			return resource;
+		}
+
+		/************************************************************************/
+		/* 								RTTI		                     		*/
+		/************************************************************************/
+	public:
+		friend class TestResourceRTTI;
+		static RTTITypeBase* getRTTIStatic();
+		virtual RTTITypeBase* getRTTI() const override;
+	};
+
+	class TestResourceRTTI : public RTTIType < TestResource, Resource, TestResourceRTTI >
+	{
+	private:
+		BS_PLAIN_MEMBER(value)
+
+	public:
+		TestResourceRTTI()
+		{
+			BS_ADD_PLAIN_FIELD(value, 0);
+		}
+
+		virtual const String& getRTTIName() override
+		{
+			static String name = "TestResource";
+			return name;
+		}
+
+		virtual UINT32 getRTTIId() override
+		{
+			return TID_TestResource;
+		}
+
+		virtual SPtr<IReflectable> newRTTIObject() override
+		{
+			return TestResource::_createPtr(0);
+		}
+	};
+
+	RTTITypeBase* TestResource::getRTTIStatic()
+	{
+		return TestResourceRTTI::instance();
+	}
+
+	RTTITypeBase* TestResource::getRTTI() const
+	{
+		return TestResource::getRTTIStatic();
+	}
+
+	/** Rasterizer that renders every character as a square of fixed size and counts how many times it was called. */
+	class TestGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		static const UINT32 GLYPH_SIZE = 100;
+		static const UINT32 MISSING_CHAR = 0xFFFF;
+
+		TestGlyphRasterizer(UnorderedMap<UINT32, UINT32>& numRasterized)
+			:mNumRasterized(numRasterized)
+		{ }
+
+		/** @copydoc GlyphRasterizer::rasterize */
+		bool rasterize(UINT32 charId, RASTERIZED_GLYPH& output) override
+		{
+			mNumRasterized[charId]++;
+
+			if (charId == MISSING_CHAR)
+				return false;
+
+			output.width = GLYPH_SIZE;
+			output.height = GLYPH_SIZE;
+			output.xOffset = 0;
+			output.yOffset = GLYPH_SIZE;
+			output.xAdvance = GLYPH_SIZE;
+			output.yAdvance = 0;
+			output.pixels.assign(GLYPH_SIZE * GLYPH_SIZE, (UINT8)charId);
+
+			return true;
+		}
+
+	private:
+		UnorderedMap<UINT32, UINT32>& mNumRasterized;
+	};
+
+	class TestGlyphRasterizerFactory : public GlyphRasterizerFactory
+	{
+	public:
+		/** @copydoc GlyphRasterizerFactory::create */
+		SPtr<GlyphRasterizer> create(const SPtr<FontSource>& source, UINT32 size) override
+		{
+			return bs_shared_ptr_new<TestGlyphRasterizer>(numRasterized);
+		}
+
+		UnorderedMap<UINT32, UINT32> numRasterized;
+	};
+
 	EditorTestSuite::EditorTestSuite()
 	{
 		BS_ADD_TEST(EditorTestSuite::SceneObjectRecord_UndoRedo);
@@ -429,6 +555,9 @@ namespace BansheeEngine
 		BS_ADD_TEST(EditorTestSuite::BinaryDiff);
 		BS_ADD_TEST(EditorTestSuite::TestPrefabDiff);
 		BS_ADD_TEST(EditorTestSuite::TestFrameAlloc)
+		BS_ADD_TEST(EditorTestSuite::TestRangeAlloc)
+		BS_ADD_TEST(EditorTestSuite::TestGlyphCache)
+		BS_ADD_TEST(EditorTestSuite::TestMainThreadResourceLoad)
 	}
 
 	void EditorTestSuite::SceneObjectRecord_UndoRedo()
@@ -759,4 +888,210 @@ namespace BansheeEngine
 		alloc.dealloc(a13);
 		alloc.clear();
 	}
+
+	void EditorTestSuite::TestRangeAlloc()
+	{
+		// Allocations are placed back to back
+		RangeAlloc alloc(100);
+		UINT32 a1 = alloc.alloc(10);
+		UINT32 a2 = alloc.alloc(20);
+		UINT32 a3 = alloc.alloc(30);
+		UINT32 a4 = alloc.alloc(0);
+
+		BS_TEST_ASSERT(alloc.getOffset(a1) == 0 && alloc.getSize(a1) == 10);
+		BS_TEST_ASSERT(alloc.getOffset(a2) == 10 && alloc.getSize(a2) == 20);
+		BS_TEST_ASSERT(alloc.getOffset(a3) == 30 && alloc.getSize(a3) == 30);
+		BS_TEST_ASSERT(alloc.getOffset(a4) == 60 && alloc.getSize(a4) == 1);
+		BS_TEST_ASSERT(alloc.alloc(40) == RangeAlloc::INVALID_BLOCK);
+
+		UINT32 a5 = alloc.alloc(39);
+		BS_TEST_ASSERT(alloc.getOffset(a5) == 61);
+		BS_TEST_ASSERT(alloc.alloc(1) == RangeAlloc::INVALID_BLOCK);
+
+		// Freed range is re-used
+		alloc.free(a2);
+		UINT32 a6 = alloc.alloc(20);
+		BS_TEST_ASSERT(alloc.getOffset(a6) == 10);
+
+		// Freeing a range between two free ranges merges all three
+		alloc.free(a4);
+		alloc.free(a5);
+		alloc.free(a1);
+		alloc.free(a3);
+		BS_TEST_ASSERT(alloc.alloc(90) == RangeAlloc::INVALID_BLOCK);
+
+		alloc.free(a6);
+		UINT32 a7 = alloc.alloc(100);
+		BS_TEST_ASSERT(a7 != RangeAlloc::INVALID_BLOCK && alloc.getOffset(a7) == 0);
+		alloc.free(a7);
+
+		// Growing extends the free range at the end, if any
+		RangeAlloc growAlloc(64);
+		UINT32 g1 = growAlloc.alloc(32);
+		growAlloc.grow(128);
+		BS_TEST_ASSERT(growAlloc.getCapacity() == 128);
+
+		UINT32 g2 = growAlloc.alloc(96);
+		BS_TEST_ASSERT(g2 != RangeAlloc::INVALID_BLOCK && growAlloc.getOffset(g2) == 32);
+
+		// Growing a full range appends a new free range
+		growAlloc.grow(160);
+		UINT32 g3 = growAlloc.alloc(32);
+		BS_TEST_ASSERT(g3 != RangeAlloc::INVALID_BLOCK && growAlloc.getOffset(g3) == 128);
+
+		// Range after the grown one merges with it once freed
+		growAlloc.free(g2);
+		growAlloc.free(g3);
+		UINT32 g4 = growAlloc.alloc(128);
+		BS_TEST_ASSERT(g4 != RangeAlloc::INVALID_BLOCK && growAlloc.getOffset(g4) == 32);
+		growAlloc.free(g1);
+		growAlloc.free(g4);
+
+		// A free range exactly the requested size must be found, on both sides of the first and second level size class
+		// boundaries
+		UINT32 exactSizes[] = { 1, 15, 16, 17, 31, 32, 33, 48, 63, 64 };
+		for (auto& size : exactSizes)
+		{
+			RangeAlloc exactAlloc(size);
+			UINT32 block = exactAlloc.alloc(size);
+
+			BS_TEST_ASSERT(block != RangeAlloc::INVALID_BLOCK);
+			if (block != RangeAlloc::INVALID_BLOCK)
+				BS_TEST_ASSERT(exactAlloc.getOffset(block) == 0 && exactAlloc.getSize(block) == size);
+
+			BS_TEST_ASSERT(exactAlloc.alloc(1) == RangeAlloc::INVALID_BLOCK);
+		}
+
+		// Largest size class
+		const UINT32 halfRange = 1U << 31;
+		RangeAlloc largeAlloc(halfRange);
+		BS_TEST_ASSERT(largeAlloc.alloc(halfRange + 1) == RangeAlloc::INVALID_BLOCK);
+		BS_TEST_ASSERT(largeAlloc.alloc((UINT32)-1) == RangeAlloc::INVALID_BLOCK);
+
+		UINT32 l1 = largeAlloc.alloc(halfRange);
+		BS_TEST_ASSERT(l1 != RangeAlloc::INVALID_BLOCK && largeAlloc.getSize(l1) == halfRange);
+		BS_TEST_ASSERT(largeAlloc.alloc(1) == RangeAlloc::INVALID_BLOCK);
+
+		largeAlloc.free(l1);
+		UINT32 l2 = largeAlloc.alloc(halfRange / 2);
+		UINT32 l3 = largeAlloc.alloc(halfRange / 2);
+		BS_TEST_ASSERT(l2 != RangeAlloc::INVALID_BLOCK && largeAlloc.getOffset(l2) == 0);
+		BS_TEST_ASSERT(l3 != RangeAlloc::INVALID_BLOCK && largeAlloc.getOffset(l3) == halfRange / 2);
+	}
+
+	void EditorTestSuite::TestGlyphCache()
+	{
+		// Use a rasterizer that doesn't require a font file
+		SPtr<GlyphRasterizerFactory> oldFactory = FontManager::instance().getGlyphRasterizerFactory();
+		SPtr<TestGlyphRasterizerFactory> factory = bs_shared_ptr_new<TestGlyphRasterizerFactory>();
+		FontManager::instance()._setGlyphRasterizerFactory(factory);
+
+		const UINT32 FIRST_PAGE = 2;
+		const UINT32 glyphsPerRow = GlyphCache::PAGE_SIZE / (TestGlyphRasterizer::GLYPH_SIZE + GlyphCache::PADDING);
+		const UINT32 capacity = glyphsPerRow * glyphsPerRow * GlyphCache::MAX_PAGES;
+
+		SPtr<GlyphCache> cache = bs_shared_ptr_new<GlyphCache>(bs_shared_ptr_new<FontSource>(), 10, FIRST_PAGE);
+
+		// Fill the atlas, every glyph must get its own area
+		UnorderedSet<UINT64> areas;
+		for (UINT32 i = 1; i <= capacity; i++)
+		{
+			const CHAR_DESC* desc = cache->getCharDesc(i);
+			BS_TEST_ASSERT(desc != nullptr);
+			if (desc == nullptr)
+				continue;
+
+			BS_TEST_ASSERT(desc->page >= FIRST_PAGE && desc->page < (FIRST_PAGE + GlyphCache::MAX_PAGES));
+			BS_TEST_ASSERT(desc->width == TestGlyphRasterizer::GLYPH_SIZE);
+
+			UINT64 x = (UINT64)Math::roundToInt(desc->uvX * GlyphCache::PAGE_SIZE);
+			UINT64 y = (UINT64)Math::roundToInt(desc->uvY * GlyphCache::PAGE_SIZE);
+			areas.insert(((UINT64)desc->page << 32) | (x << 16) | y);
+		}
+
+		BS_TEST_ASSERT(areas.size() == capacity);
+		BS_TEST_ASSERT(cache->getNumTexturePages() == GlyphCache::MAX_PAGES);
+		BS_TEST_ASSERT(cache->getNumResidentGlyphs() == capacity);
+
+		// Atlas is full and all glyphs were used this frame, so nothing can be evicted
+		BS_TEST_ASSERT(cache->getCharDesc(capacity + 1) == nullptr);
+
+		// Characters the font doesn't have are only rasterized once
+		UINT32 missingChar = TestGlyphRasterizer::MISSING_CHAR;
+		BS_TEST_ASSERT(cache->getCharDesc(missingChar) == nullptr);
+		gTime()._update();
+		BS_TEST_ASSERT(cache->getCharDesc(missingChar) == nullptr);
+		BS_TEST_ASSERT(factory->numRasterized[missingChar] == 1);
+
+		// Reference the least recently used glyphs, which would otherwise be evicted first
+		const UINT32 numReferenced = 10;
+		Vector<UINT32> referencedChars;
+		for (UINT32 i = 1; i <= numReferenced; i++)
+			referencedChars.push_back(i);
+
+		SPtr<GlyphReferences> references = bs_shared_ptr_new<GlyphReferences>(cache, referencedChars);
+
+		// Glyphs from the previous frame can be evicted, least recently used first
+		BS_TEST_ASSERT(cache->getCharDesc(capacity + 1) != nullptr);
+		BS_TEST_ASSERT(cache->getNumResidentGlyphs() == capacity);
+
+		cache->getCharDesc(numReferenced + 1);
+		BS_TEST_ASSERT(factory->numRasterized[numReferenced + 1] == 2);
+
+		// Referenced glyphs survive even when everything else is evicted
+		for (UINT32 i = 0; i < capacity; i++)
+			cache->getCharDesc(capacity + 2 + i);
+
+		for (UINT32 i = 1; i <= numReferenced; i++)
+		{
+			BS_TEST_ASSERT(cache->getCharDesc(i) != nullptr);
+			BS_TEST_ASSERT(factory->numRasterized[i] == 1);
+		}
+
+		// Once released they can be evicted as well. The atlas is then full of glyphs used this frame, so the glyph
+		// cannot be brought back.
+		references = nullptr;
+		gTime()._update();
+
+		for (UINT32 i = 0; i < capacity; i++)
+			cache->getCharDesc(2 * capacity + 2 + i);
+
+		BS_TEST_ASSERT(cache->getNumResidentGlyphs() == capacity);
+		BS_TEST_ASSERT(cache->getCharDesc(1) == nullptr);
+
+		cache->_flush();
+		FontManager::instance()._setGlyphRasterizerFactory(oldFactory);
+	}
+
+	void EditorTestSuite::TestMainThreadResourceLoad()
+	{
+		Path resourcePath = Path::combine(FileSystem::getTempDirectoryPath(), "testmainthreadresource.asset");
+
+		HResource resource = TestResource::create(123);
+		gResources().save(resource, resourcePath, true);
+		resource.destroy();
+
+		// Destroy right after starting the load, while the decode is queued for the main thread (or the file is still 
+		// being read)
+		resource = gResources().loadAsync(resourcePath);
+		resource.destroy();
+		BS_TEST_ASSERT(!resource.isLoaded(false));
+
+		// Wait directly, same as shader includes are waited on during import
+		resource = gResources().loadAsync(resourcePath);
+		resource.blockUntilLoaded();
+		BS_TEST_ASSERT(resource.isLoaded(false));
+		if (resource.isLoaded(false))
+			BS_TEST_ASSERT(static_resource_cast<TestResource>(resource)->value == 123);
+
+		resource.destroy();
+
+		// Save waits for in-progress loads as well
+		resource = gResources().loadAsync(resourcePath);
+		gResources().save(resource, resourcePath, true);
+		BS_TEST_ASSERT(resource.isLoaded(false));
+
+		resource.destroy();
+		FileSystem::remove(resourcePath);
+	}
 }
\ No newline at end of file
@@ -11,6 +11,7 @@
 #include "BsGUITreeViewEditBox.h"
 #include "BsGUIMouseEvent.h"
 #include "BsGUISkin.h"
+#include "BsGUIHelper.h"
 #include "BsGUICommandEvent.h"
 #include "BsGUIVirtualButtonEvent.h"
 #include "BsGUIScrollArea.h"
@@ -32,8 +33,8 @@ namespace BansheeEngine
 	const Color GUITreeView::DISABLED_COLOR = Color(1.0f, 1.0f, 1.0f, 0.6f);
 
 	GUITreeView::TreeElement::TreeElement()
-		: mParent(nullptr), mFoldoutBtn(nullptr), mElement(nullptr), mSortedIdx(0), mIsExpanded(false), mIsSelected(false)
-		, mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false)
+		: mParent(nullptr), mFoldoutBtn(nullptr), mElement(nullptr), mOptimalSizeStyle(nullptr), mSortedIdx(0)
+		, mIsExpanded(false), mIsSelected(false), mIsHighlighted(false), mIsVisible(true), mIsCut(false), mIsDisabled(false)
 	{ }
 
 	GUITreeView::TreeElement::~TreeElement()
@@ -41,6 +42,8 @@ namespace BansheeEngine
 		for(auto& child : mChildren)
 			bs_delete(child);
 
+		mFoldoutToggledConn.disconnect();
+
 		if(mFoldoutBtn != nullptr)
 			GUIElement::destroy(mFoldoutBtn);
 
@@ -749,75 +752,146 @@ namespace BansheeEngine
 		if(element == &getRootElement())
 			return;
 
+		// Name might have changed
+		element->mOptimalSizeStyle = nullptr;
+
 		if(element->mIsVisible)
 		{
-			HString name(toWString(element->mName));
-			if(element->mElement == nullptr)
-			{
-				element->mElement = GUILabel::create(name, mElementBtnStyle);
-				_registerChildElement(element->mElement);
-			}
+			// Elements outside of the visible area get their GUI assigned when laid out
+			if (element->mElement != nullptr)
+				bindElementGUI(element);
+		}
+		else
+		{
+			unbindElementGUI(element);
 
-			if (element->mIsCut)
-			{
-				Color cutTint = element->mTint;
-				cutTint.a = CUT_COLOR.a;
+			if(element->mIsSelected && element->mIsExpanded)
+				unselectElement(element);
+		}
 
-				element->mElement->setTint(cutTint);
-			}
-			else if(element->mIsDisabled)
+		_markLayoutAsDirty();
+	}
+
+	void GUITreeView::bindElementGUI(TreeElement* element)
+	{
+		if(element->mElement == nullptr)
+		{
+			if(!mFreeLabels.empty())
 			{
-				Color disabledTint = element->mTint;
-				disabledTint.a = DISABLED_COLOR.a;
+				element->mElement = mFreeLabels.back();
+				element->mElement->setVisible(true);
 
-				element->mElement->setTint(disabledTint);
+				mFreeLabels.pop_back();
 			}
 			else
-				element->mElement->setTint(element->mTint);
+			{
+				element->mElement = GUILabel::create(HString(L""), mElementBtnStyle);
+				_registerChildElement(element->mElement);
+			}
+		}
+
+		if (element->mIsCut)
+		{
+			Color cutTint = element->mTint;
+			cutTint.a = CUT_COLOR.a;
 
-			if(element->mChildren.size() > 0)
+			element->mElement->setTint(cutTint);
+		}
+		else if(element->mIsDisabled)
+		{
+			Color disabledTint = element->mTint;
+			disabledTint.a = DISABLED_COLOR.a;
+
+			element->mElement->setTint(disabledTint);
+		}
+		else
+			element->mElement->setTint(element->mTint);
+
+		if(element->mChildren.size() > 0)
+		{
+			if(element->mFoldoutBtn == nullptr)
 			{
-				if(element->mFoldoutBtn == nullptr)
+				GUIToggle* foldoutBtn;
+				if(!mFreeFoldoutBtns.empty())
 				{
-					element->mFoldoutBtn = GUIToggle::create(GUIContent(HString(L"")), mFoldoutBtnStyle);
-					_registerChildElement(element->mFoldoutBtn);
-
-					element->mFoldoutBtn->onToggled.connect(std::bind(&GUITreeView::elementToggled, this, element, _1));
+					foldoutBtn = mFreeFoldoutBtns.back();
+					foldoutBtn->setVisible(true);
 
-					if(element->mIsExpanded)
-						element->mFoldoutBtn->toggleOn();
+					mFreeFoldoutBtns.pop_back();
 				}
-			}
-			else
-			{
-				if(element->mFoldoutBtn != nullptr)
+				else
 				{
-					GUIElement::destroy(element->mFoldoutBtn);
-					element->mFoldoutBtn = nullptr;
+					foldoutBtn = GUIToggle::create(GUIContent(HString(L"")), mFoldoutBtnStyle);
+					_registerChildElement(foldoutBtn);
 				}
-			}
 
-			element->mElement->setContent(GUIContent(name));
+				// Sync the state before connecting, so we don't trigger the callback
+				if(element->mIsExpanded)
+					foldoutBtn->toggleOn();
+				else
+					foldoutBtn->toggleOff();
+
+				element->mFoldoutBtn = foldoutBtn;
+				element->mFoldoutToggledConn = foldoutBtn->onToggled.connect(
+					std::bind(&GUITreeView::elementToggled, this, element, _1));
+			}
 		}
 		else
 		{
-			if(element->mElement != nullptr)
-			{
-				GUIElement::destroy(element->mElement);
-				element->mElement = nullptr;
-			}
-
 			if(element->mFoldoutBtn != nullptr)
 			{
-				GUIElement::destroy(element->mFoldoutBtn);
+				element->mFoldoutToggledConn.disconnect();
+				element->mFoldoutBtn->setVisible(false);
+
+				mFreeFoldoutBtns.push_back(element->mFoldoutBtn);
 				element->mFoldoutBtn = nullptr;
 			}
+		}
 
-			if(element->mIsSelected && element->mIsExpanded)
-				unselectElement(element);
+		element->mElement->setContent(GUIContent(HString(toWString(element->mName))));
+		element->mElement->setVisible(element != mEditElement);
+	}
+
+	void GUITreeView::unbindElementGUI(TreeElement* element)
+	{
+		if(element->mElement != nullptr)
+		{
+			element->mElement->setVisible(false);
+
+			mFreeLabels.push_back(element->mElement);
+			element->mElement = nullptr;
 		}
 
-		_markLayoutAsDirty();
+		if(element->mFoldoutBtn != nullptr)
+		{
+			element->mFoldoutToggledConn.disconnect();
+			element->mFoldoutBtn->setVisible(false);
+
+			mFreeFoldoutBtns.push_back(element->mFoldoutBtn);
+			element->mFoldoutBtn = nullptr;
+		}
+	}
+
+	const GUIElementStyle* GUITreeView::getElementStyle() const
+	{
+		if (_getParentWidget() != nullptr)
+			return _getParentWidget()->getSkin().getStyle(mElementBtnStyle);
+
+		return &GUISkin::DefaultStyle;
+	}
+
+	Vector2I GUITreeView::getElementSize(const TreeElement* element, const GUIElementStyle* style) const
+	{
+		if (element->mOptimalSizeStyle != style)
+		{
+			GUIDimensions dimensions = GUIDimensions::create();
+			dimensions.updateWithStyle(style);
+
+			element->mOptimalSize = GUIHelper::calcOptimalContentsSize(toWString(element->mName), *style, dimensions);
+			element->mOptimalSizeStyle = style;
+		}
+
+		return element->mOptimalSize;
 	}
 
 	void GUITreeView::elementToggled(TreeElement* element, bool toggled)
@@ -905,6 +979,8 @@ namespace BansheeEngine
 		}
 		else
 		{
+			const GUIElementStyle* elementStyle = getElementStyle();
+
 			Stack<UpdateTreeElement> todo;
 			todo.push(UpdateTreeElement(&getRootElementConst(), 0));
 
@@ -915,9 +991,9 @@ namespace BansheeEngine
 				todo.pop();
 
 				INT32 yOffset = 0;
-				if(current->mElement != nullptr)
+				if(current != &getRootElementConst())
 				{
-					Vector2I curOptimalSize = current->mElement->_getOptimalSize();
+					Vector2I curOptimalSize = getElementSize(current, elementStyle);
 					optimalSize.x = std::max(optimalSize.x, 
 						(INT32)(INITIAL_INDENT_OFFSET + curOptimalSize.x + currentUpdateElement.indent * INDENT_SIZE));
 					yOffset = curOptimalSize.y + ELEMENT_EXTRA_SPACING;
@@ -983,8 +1059,11 @@ namespace BansheeEngine
 		Stack<UpdateTreeElement> todo;
 		todo.push(UpdateTreeElement(&getRootElement(), 0));
 
-		// NOTE - Instead of iterating through all elements, try to find those within the clip rect
-		// and only iterate through those. Others should somehow be marked in-active (similar to GUIElement::isDisabled()?)
+		// Only rows overlapping the clip rect get GUI elements assigned, others are positioned using their cached size
+		// and have their elements released back to the pool
+		const GUIElementStyle* elementStyle = getElementStyle();
+		INT32 clipTop = data.clipRect.y;
+		INT32 clipBottom = data.clipRect.y + (INT32)data.clipRect.height;
 
 		Vector<TreeElement*> tempOrderedElements;
 
@@ -999,9 +1078,9 @@ namespace BansheeEngine
 
 			INT32 btnHeight = 0;
 			INT32 yOffset = 0;
-			if(current->mElement != nullptr)
+			if(current != &getRootElement())
 			{
-				Vector2I elementSize = current->mElement->_getOptimalSize();
+				Vector2I elementSize = getElementSize(current, elementStyle);
 				btnHeight = elementSize.y;
 
 				mVisibleElements.push_back(InteractableElement(current->mParent, current->mSortedIdx * 2 + 0, Rect2I(data.area.x, offset.y, data.area.width, ELEMENT_EXTRA_SPACING)));
@@ -1016,7 +1095,18 @@ namespace BansheeEngine
 				childData.area.width = elementSize.x;
 				childData.area.height = elementSize.y;
 
-				current->mElement->_setLayoutData(childData);
+				current->mLayoutArea = childData.area;
+
+				bool inView = (offset.y + btnHeight) > clipTop && offset.y < clipBottom;
+				if (inView)
+				{
+					if (current->mElement == nullptr)
+						bindElementGUI(current);
+
+					current->mElement->_setLayoutData(childData);
+				}
+				else
+					unbindElementGUI(current);
 
 				yOffset = btnHeight;
 			}
@@ -1072,25 +1162,25 @@ namespace BansheeEngine
 
 		for(auto selectedElem : mSelectedElements)
 		{
-			GUILabel* targetElement = selectedElem.element->mElement;
-			if (targetElement == nullptr)
+			TreeElement* targetElement = selectedElem.element;
+			if (!targetElement->mIsVisible || targetElement == &getRootElement())
 				continue;
 
 			GUILayoutData childData = data;
-			childData.area.y = targetElement->_getLayoutData().area.y;
-			childData.area.height = targetElement->_getLayoutData().area.height;
+			childData.area.y = targetElement->mLayoutArea.y;
+			childData.area.height = targetElement->mLayoutArea.height;
 
 			selectedElem.background->_setLayoutData(childData);
 		}
 
 		if (mIsElementHighlighted)
 		{
-			GUILabel* targetElement = mHighlightedElement.element->mElement;
-			if (targetElement != nullptr)
+			TreeElement* targetElement = mHighlightedElement.element;
+			if (targetElement->mIsVisible && targetElement != &getRootElement())
 			{
 				GUILayoutData childData = data;
-				childData.area.y = targetElement->_getLayoutData().area.y;
-				childData.area.height = targetElement->_getLayoutData().area.height;
+				childData.area.y = targetElement->mLayoutArea.y;
+				childData.area.height = targetElement->mLayoutArea.height;
 
 				mHighlightedElement.background->_setLayoutData(childData);
 			}
@@ -1098,13 +1188,13 @@ namespace BansheeEngine
 
 		if(mEditElement != nullptr)
 		{
-			GUILabel* targetElement = mEditElement->mElement;
-			if (targetElement != nullptr)
+			TreeElement* targetElement = mEditElement;
+			if (targetElement->mIsVisible && targetElement != &getRootElement())
 			{
 				UINT32 remainingWidth = (UINT32)std::max(0, (((INT32)data.area.width) - (offset.x - data.area.x)));
 
 				GUILayoutData childData = data;
-				childData.area = targetElement->_getLayoutData().area;
+				childData.area = targetElement->mLayoutArea;
 				childData.area.width = remainingWidth;
 
 				mNameEditBox->_setLayoutData(childData);
@@ -1292,7 +1382,7 @@ namespace BansheeEngine
 
 	void GUITreeView::scrollToElement(TreeElement* element, bool center)
 	{
-		if(element->mElement == nullptr)
+		if(!element->mIsVisible || element == &getRootElement())
 			return;
 
 		GUIScrollArea* scrollArea = findParentScrollArea();
@@ -1303,7 +1393,7 @@ namespace BansheeEngine
 		{
 			Rect2I myBounds = _getClippedBounds();
 			INT32 clipVertCenter = myBounds.y + (INT32)Math::roundToInt(myBounds.height * 0.5f);
-			INT32 elemVertCenter = element->mElement->_getLayoutData().area.y + (INT32)Math::roundToInt(element->mElement->_getLayoutData().area.height * 0.5f);
+			INT32 elemVertCenter = element->mLayoutArea.y + (INT32)Math::roundToInt(element->mLayoutArea.height * 0.5f);
 
 			if(elemVertCenter > clipVertCenter)
 				scrollArea->scrollDownPx(elemVertCenter - clipVertCenter);
@@ -1313,8 +1403,8 @@ namespace BansheeEngine
 		else
 		{
 			Rect2I myBounds = _getClippedBounds();
-			INT32 elemVertTop = element->mElement->_getLayoutData().area.y;
-			INT32 elemVertBottom = element->mElement->_getLayoutData().area.y + element->mElement->_getLayoutData().area.height;
+			INT32 elemVertTop = element->mLayoutArea.y;
+			INT32 elemVertBottom = element->mLayoutArea.y + element->mLayoutArea.height;
 
 			INT32 top = myBounds.y;
 			INT32 bottom = myBounds.y + myBounds.height;
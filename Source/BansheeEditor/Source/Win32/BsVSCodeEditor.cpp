@@ -564,11 +564,17 @@ EndProject)";
 			projectPath.append(project.name + L".csproj");
 
 			SPtr<DataStream> projectStream = FileSystem::createAndOpenFile(projectPath);
+			if (projectStream == nullptr)
+				continue;
+
 			projectStream->write(projectString.c_str(), projectString.size() * sizeof(String::value_type));
 			projectStream->close();
 		}
 
 		SPtr<DataStream> solutionStream = FileSystem::createAndOpenFile(solutionPath);
+		if (solutionStream == nullptr)
+			return;
+
 		solutionStream->write(solutionString.c_str(), solutionString.size() * sizeof(String::value_type));
 		solutionStream->close();
 	}
@@ -78,6 +78,7 @@ set(BS_BANSHEEENGINE_SRC_GUI
 	"Source/BsShortcutKey.cpp"
 	"Source/BsShortcutManager.cpp"
 	"Source/BsCGUIWidget.cpp"
+	"Source/BsGUIElementGrid.cpp"
 )
 
 set(BS_BANSHEEENGINE_INC_PLATFORM
@@ -108,6 +109,7 @@ set(BS_BANSHEEENGINE_SRC_2D
 	"Source/BsSprite.cpp"
 	"Source/BsSpriteTexture.cpp"
 	"Source/BsTextSprite.cpp"
+	"Source/BsTextLayoutCache.cpp"
 )
 
 set(BS_BANSHEEENGINE_SRC_UTILITY
@@ -124,6 +126,7 @@ set(BS_BANSHEEENGINE_INC_2D
 	"Include/BsSprite.h"
 	"Include/BsSpriteTexture.h"
 	"Include/BsTextSprite.h"
+	"Include/BsTextLayoutCache.h"
 )
 
 set(BS_BANSHEEENGINE_INC_RTTI
@@ -257,6 +260,7 @@ set(BS_BANSHEEENGINE_INC_GUI
 	"Include/BsCGUIWidget.h"
 	"Include/BsShortcutManager.h"
 	"Include/BsShortcutKey.h"
+	"Include/BsGUIElementGrid.h"
 )
 
 set(BS_BANSHEEENGINE_SRC_NOFILTER
@@ -268,6 +272,14 @@ set(BS_BANSHEEENGINE_SRC_PLATFORM
 	"Source/BsSplashScreen.cpp"
 )
 
+set(BS_BANSHEEENGINE_INC_TESTING
+	"Include/BsEngineBenchmarkSuite.h"
+)
+
+set(BS_BANSHEEENGINE_SRC_TESTING
+	"Source/BsEngineBenchmarkSuite.cpp"
+)
+
 source_group("Header Files\\Components" FILES ${BS_BANSHEEENGINE_INC_COMPONENTS})
 source_group("Source Files\\Resources" FILES ${BS_BANSHEEENGINE_SRC_RESOURCES})
 source_group("Source Files\\Script" FILES ${BS_BANSHEEENGINE_SRC_SCRIPT})
@@ -290,6 +302,8 @@ source_group("Source Files\\Input" FILES ${BS_BANSHEEENGINE_SRC_INPUT})
 source_group("Header Files\\GUI" FILES ${BS_BANSHEEENGINE_INC_GUI})
 source_group("Source Files" FILES ${BS_BANSHEEENGINE_SRC_NOFILTER})
 source_group("Source Files\\Platform" FILES ${BS_BANSHEEENGINE_SRC_PLATFORM})
+source_group("Header Files\\Testing" FILES ${BS_BANSHEEENGINE_INC_TESTING})
+source_group("Source Files\\Testing" FILES ${BS_BANSHEEENGINE_SRC_TESTING})
 
 set(BS_BANSHEEENGINE_SRC
 	${BS_BANSHEEENGINE_INC_COMPONENTS}
@@ -314,4 +328,6 @@ set(BS_BANSHEEENGINE_SRC
 	${BS_BANSHEEENGINE_INC_GUI}
 	${BS_BANSHEEENGINE_SRC_NOFILTER}
 	${BS_BANSHEEENGINE_SRC_PLATFORM}
+	${BS_BANSHEEENGINE_INC_TESTING}
+	${BS_BANSHEEENGINE_SRC_TESTING}
 )
\ No newline at end of file
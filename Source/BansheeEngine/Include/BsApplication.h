@@ -17,7 +17,8 @@ namespace BansheeEngine
 	{
 		DX11,
 		DX9,
-		OpenGL
+		OpenGL,
+		Null /**< Render API that doesn't use the GPU. Used for headless benchmarking and testing. */
 	};
 
 	/**	Types of available renderers. */
@@ -0,0 +1,95 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsTestSuite.h"
+#include "BsFrameAlloc.h"
+#include "BsTexAtlasGenerator.h"
+
+namespace BansheeEngine
+{
+	class BenchmarkRenderQueue;
+
+	/** @addtogroup Testing-Engine
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of benchmarks for performance critical engine systems. Benchmarks don't require a window or a render
+	 * API, but expect the core modules (task scheduler, RTTI) to be started.
+	 *
+	 * @code
+	 * SPtr<TestSuite> benchmarks = TestSuite::create<EngineBenchmarkSuite>();
+	 *
+	 * JSONBenchmarkOutput output;
+	 * benchmarks->runBenchmarks(output);
+	 * output.save("Benchmarks.json");
+	 * @endcode
+	 */
+	class BS_EXPORT EngineBenchmarkSuite : public TestSuite
+	{
+	public:
+		EngineBenchmarkSuite();
+
+	private:
+		/** @copydoc TestSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc TestSuite::shutDown */
+		void shutDown() override;
+
+		/** Serializes a resource manifest with a large number of entries into memory, and deserializes it back. */
+		void SerializeManifest();
+
+		/** Schedules a large number of small tasks on the task scheduler and waits until they complete. */
+		void TaskSchedulerThroughput();
+
+		/** Performs a large number of small allocations using the frame allocator. */
+		void FrameAllocAllocations();
+
+		/** Builds transform matrices and transforms points using them. */
+		void MathTransforms();
+
+		/** Converts an image between 8-bit and floating point pixel formats. */
+		void PixelConversion();
+
+		/** Sorts render queues containing a large number of elements, using distance and material state reduction. */
+		void RenderQueueSort();
+
+		/** Fills the render queues sorted by RenderQueueSort() with unsorted elements. */
+		void RenderQueueSortSetup();
+
+		/** Generates an atlas layout for a large number of glyph sized elements, and checks the atlas occupancy. */
+		void TexAtlasLayout();
+
+		/** 
+		 * Lays out the same elements as TexAtlasLayout() using the binary tree packer TexAtlasGenerator used previously,
+		 * as a baseline for comparison.
+		 */
+		void TexAtlasLayoutTree();
+
+		/** 
+		 * Resizes a single element in a deep and a wide GUI layout hierarchy and updates the layout, as happens when 
+		 * GUI element contents change.
+		 */
+		void GUILayoutUpdate();
+
+		SPtr<ResourceManifest> mManifest;
+		FrameAlloc mFrameAlloc;
+		SPtr<PixelData> mPixelsRGBA8;
+		SPtr<PixelData> mPixelsBGRA8;
+		SPtr<PixelData> mPixelsFloat;
+		SPtr<BenchmarkRenderQueue> mDistanceQueue;
+		SPtr<BenchmarkRenderQueue> mMaterialQueue;
+		Vector<TexAtlasElementDesc> mAtlasElements;
+		Vector<TexAtlasElementDesc> mTreeAtlasElements;
+		float mTreeAtlasOccupancy;
+		GUILayout* mLayoutRoot;
+		GUIFixedSpace* mDeepLayoutSpace;
+		GUIFixedSpace* mWideLayoutSpace;
+		UINT32 mLayoutIteration;
+	};
+
+	/** @} */
+}
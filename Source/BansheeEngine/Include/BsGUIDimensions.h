@@ -17,6 +17,16 @@ namespace BansheeEngine
 		Vector2I optimal;
 		Vector2I min;
 		Vector2I max;
+
+		bool operator== (const LayoutSizeRange& rhs) const
+		{
+			return optimal == rhs.optimal && min == rhs.min && max == rhs.max;
+		}
+
+		bool operator!= (const LayoutSizeRange& rhs) const
+		{
+			return !(*this == rhs);
+		}
 	};
 
 	/**	Flags that identify the type of data stored in a GUIDimensions structure. */
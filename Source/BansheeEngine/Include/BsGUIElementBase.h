@@ -39,7 +39,12 @@ namespace BansheeEngine
 			GUIElem_HiddenSelf = 0x08,
 			GUIElem_InactiveSelf = 0x10,
 			GUIElem_Disabled = 0x20,
-			GUIElem_DisabledSelf = 0x40
+			GUIElem_DisabledSelf = 0x40,
+			GUIElem_LayoutDirty = 0x80, /**< Element's own size range or child list changed. */
+			GUIElem_ChildLayoutDirty = 0x100, /**< One or multiple descendants have GUIElem_LayoutDirty set. */
+			GUIElem_AreaDirty = 0x200, /**< Layout data assigned by the parent changed, or child size ranges changed. */
+
+			GUIElem_AnyLayoutDirty = GUIElem_LayoutDirty | GUIElem_ChildLayoutDirty | GUIElem_AreaDirty
 		};
 
 	public:
@@ -141,7 +146,10 @@ namespace BansheeEngine
 		 */
 		virtual void _updateLayout(const GUILayoutData& data);
 
-		/** Calculates optimal sizes of all child elements, as determined by their style and layout options. */
+		/**
+		 * Calculates optimal sizes of all child elements, as determined by their style and layout options. Only children
+		 * whose layout was marked as dirty are recalculated, the rest keep their previously cached sizes.
+		 */
 		virtual void _updateOptimalLayoutSizes();
 
 		/** @copydoc _updateLayout */
@@ -161,8 +169,11 @@ namespace BansheeEngine
 		virtual void _getElementAreas(const Rect2I& layoutArea, Rect2I* elementAreas, UINT32 numElements,
 			const Vector<LayoutSizeRange>& sizeRanges, const LayoutSizeRange& mySizeRange) const;
 
-		/** Updates layout data that determines GUI elements final position & depth in the GUI widget. */
-		virtual void _setLayoutData(const GUILayoutData& data) { mLayoutData = data; }
+		/** 
+		 * Updates layout data that determines GUI elements final position & depth in the GUI widget. If the data differs
+		 * from the current one the element will be flagged so its child layout is recalculated.
+		 */
+		virtual void _setLayoutData(const GUILayoutData& data);
 
 		/** Retrieves layout data that determines GUI elements final position & depth in the GUI widget. */
 		const GUILayoutData& _getLayoutData() const { return mLayoutData; }
@@ -282,9 +293,33 @@ namespace BansheeEngine
 		/**	Returns true if elements contents have changed since last update. */
 		bool _isDirty() const { return (mFlags & GUIElem_Dirty) != 0; }
 
-		/**	Marks the element contents to be up to date (meaning it's processed by the GUI system). */
+		/**
+		 * Returns true if the element, or one of its descendants, needs its layout updated. Elements for which this
+		 * returns false were already laid out with their current layout data and their layout update can be skipped.
+		 */
+		bool _isLayoutDirty() const { return (mFlags & GUIElem_AnyLayoutDirty) != 0; }
+
+		/**
+		 * Returns true if the element's size range might have changed since the last layout update, either because the
+		 * element itself or one of its descendants changed.
+		 */
+		bool _isSizeRangeDirty() const { return (mFlags & (GUIElem_LayoutDirty | GUIElem_ChildLayoutDirty)) != 0; }
+
+		/** Returns true if the element's own dimensions, contents or child list changed since the last layout update. */
+		bool _isOwnLayoutDirty() const { return (mFlags & GUIElem_LayoutDirty) != 0; }
+
+		/**
+		 * Marks all elements between this element and the provided ancestor (inclusive) as having a dirty descendant,
+		 * ensuring a layout update started from the ancestor reaches this element.
+		 */
+		void _markLayoutPathAsDirty(GUIElementBase* ancestor);
+
+		/**	Marks the element contents and layout to be up to date (meaning it's processed by the GUI system). */
 		void _markAsClean();
 
+		/** Marks only the element layout as up to date, leaving its contents dirty flag as is. */
+		void _markLayoutAsClean();
+
 		/** @} */
 
 	protected:
@@ -321,7 +356,7 @@ namespace BansheeEngine
 		GUIElementBase* mParentElement;
 
 		Vector<GUIElementBase*> mChildren;	
-		UINT8 mFlags;
+		UINT16 mFlags;
 
 		GUIDimensions mDimensions;
 		GUILayoutData mLayoutData;
@@ -0,0 +1,85 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsVector2I.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup GUI-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Spatial index over the clipped bounds of GUI elements belonging to a single widget, used for quickly finding elements
+	 * under a point. Elements are sorted into a uniform grid of cells. Elements marked as dirty are re-inserted lazily on 
+	 * the next query, so layout updates don't need to touch the grid directly.
+	 */
+	class BS_EXPORT GUIElementGrid
+	{
+		/** Range of grid cells an element occupies. */
+		struct CellRange
+		{
+			INT32 minX;
+			INT32 minY;
+			INT32 maxX;
+			INT32 maxY;
+			bool isOversized;
+		};
+
+	public:
+		/** Queues the element's bounds to be refreshed on the next query. */
+		void markDirty(GUIElement* element);
+
+		/** Queues bounds of all the provided elements to be refreshed on the next query. */
+		void markDirty(const Vector<GUIElement*>& elements);
+
+		/** Removes the element from the grid. The element is not dereferenced so it is safe to call during destruction. */
+		void remove(GUIElement* element);
+
+		/** Removes all elements from the grid. */
+		void clear();
+
+		/**
+		 * Finds all elements whose clipped bounds contain the provided point. Caller is expected to perform any precise 
+		 * checks (e.g. GUIElement::_isInBounds()) on the returned elements.
+		 *
+		 * @param[in]	position	Point relative to the parent widget.
+		 * @param[out]	elements	Elements whose bounds contain the point. Elements are appended to the existing contents.
+		 */
+		void findElements(const Vector2I& position, Vector<GUIElement*>& elements);
+
+		/** Width and height of a single grid cell, in pixels. */
+		static const INT32 CELL_SIZE;
+
+		/** 
+		 * Maximum number of cells an element can span. Elements larger than that are kept outside of the grid and tested
+		 * on every query. 
+		 */
+		static const UINT32 MAX_CELLS_PER_ELEMENT;
+
+	private:
+		/** Inserts the element into all cells its current bounds overlap. */
+		void insert(GUIElement* element);
+
+		/** Removes the element from all cells in the provided range. */
+		void removeFromCells(GUIElement* element, const CellRange& range);
+
+		/** Re-inserts all elements marked as dirty. */
+		void updateDirty();
+
+		/** Returns a key that uniquely identifies the cell at the provided coordinates. */
+		static UINT64 getCellKey(INT32 x, INT32 y);
+
+		/** Returns coordinate of the cell containing the provided position. */
+		static INT32 getCellCoord(INT32 position);
+
+		UnorderedMap<UINT64, Vector<GUIElement*>> mCells;
+		UnorderedMap<GUIElement*, CellRange> mElements;
+		Vector<GUIElement*> mOversizedElements;
+		UnorderedSet<GUIElement*> mDirtyElements;
+	};
+
+	/** @} */
+}
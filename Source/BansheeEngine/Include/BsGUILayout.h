@@ -88,6 +88,24 @@ namespace BansheeEngine
 		/** @} */
 
 	protected:
+		/**
+		 * Recalculates optimal sizes of children whose layout changed, and refreshes their entries in the cached child
+		 * size range array. If any of the child size ranges changed the layout is flagged so its child areas get
+		 * recalculated on the next layout update.
+		 *
+		 * @return	True if the layout's own size range needs to be recalculated, false if the cached one is still valid.
+		 */
+		bool updateChildSizeRanges();
+
+		/** 
+		 * Updates layout of children that need it, using their existing layout data. Should be used instead of a full
+		 * layout update when neither the layout area nor child size ranges changed.
+		 */
+		void updateDirtyChildLayouts();
+
+		/** Returns the size range of the provided active child element, as used by this layout. */
+		virtual LayoutSizeRange getChildSizeRange(const GUIElementBase* child) const { return child->_getLayoutSizeRange(); }
+
 		Vector<LayoutSizeRange> mChildSizeRanges;
 		LayoutSizeRange mSizeRange;
 	};
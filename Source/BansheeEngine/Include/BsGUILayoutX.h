@@ -49,6 +49,9 @@ namespace BansheeEngine
 	protected:
 		/** @copydoc GUIElementBase::_updateLayoutInternal */
 		void _updateLayoutInternal(const GUILayoutData& data) override;
+
+		/** @copydoc GUILayout::getChildSizeRange */
+		LayoutSizeRange getChildSizeRange(const GUIElementBase* child) const override;
 	};
 
 	/** @} */
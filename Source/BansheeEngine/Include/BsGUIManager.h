@@ -11,6 +11,8 @@
 #include "BsModule.h"
 #include "BsColor.h"
 #include "BsMatrix4.h"
+#include "BsRect2I.h"
+#include "BsSubMesh.h"
 #include "BsEvent.h"
 #include "BsMaterialParam.h"
 
@@ -48,6 +50,73 @@ namespace BansheeEngine
 			Dragging
 		};
 
+		/** A single render element of a GUI element, keyed by the depth it is rendered at. */
+		struct GUIGroupElement
+		{
+			GUIGroupElement()
+				:element(nullptr), renderElement(0), depth(0)
+			{ }
+
+			GUIGroupElement(GUIElement* _element, UINT32 _renderElement, UINT32 _depth)
+				:element(_element), renderElement(_renderElement), depth(_depth)
+			{ }
+
+			GUIElement* element;
+			UINT32 renderElement;
+			UINT32 depth;
+		};
+
+		/** Sorts GUI render elements from farthest to nearest (highest depth to lowest). */
+		struct GUIGroupElementComparer
+		{
+			bool operator()(const GUIGroupElement& a, const GUIGroupElement& b) const
+			{
+				// Compare pointers just to differentiate between two elements with the same depth, their order doesn't 
+				// really matter, but std::set requires all elements to be unique
+				return (a.depth > b.depth) ||
+					(a.depth == b.depth && a.element > b.element) ||
+					(a.depth == b.depth && a.element == b.element && a.renderElement > b.renderElement);
+			}
+		};
+
+		/** 
+		 * A group of render elements sharing the same material, that get rendered using a single draw call. Geometry of
+		 * all groups in a viewport is packed into a single mesh.
+		 */
+		struct GUIMaterialGroup
+		{
+			GUIMaterialGroup()
+				:numQuads(0), depth(0), minDepth(0), widget(nullptr), quadOffset(0), isDirty(true)
+			{ }
+
+			SpriteMaterialInfo matInfo;
+			UINT32 numQuads;
+			UINT32 depth;
+			UINT32 minDepth;
+			Rect2I bounds;
+			Vector<GUIGroupElement> elements;
+			GUIWidget* widget;
+			SPtr<MeshData> meshData; // Group geometry, with indices relative to the group's first vertex
+			UINT32 quadOffset; // Offset of the group's geometry in the viewport mesh
+			bool isDirty;
+		};
+
+		/** State of a single render element of a GUI element, as it was when the meshes were last built. */
+		struct GUIRenderElementInfo
+		{
+			SpriteMaterialInfo matInfo;
+			UINT32 depth;
+			UINT32 groupIdx;
+		};
+
+		/** State of a single GUI element, as it was when the meshes were last built. */
+		struct GUIElementRenderInfo
+		{
+			GUIWidget* widget;
+			Rect2I bounds;
+			Vector<GUIRenderElementInfo> renderElements;
+		};
+
 		/**	GUI render data for a single viewport. */
 		struct GUIRenderData
 		{
@@ -55,10 +124,11 @@ namespace BansheeEngine
 				:isDirty(true)
 			{ }
 
-			Vector<SPtr<TransientMesh>> cachedMeshes;
-			Vector<SpriteMaterialInfo> cachedMaterials;
-			Vector<GUIWidget*> cachedWidgetsPerMesh;
+			Vector<GUIMaterialGroup> groups; // Sorted from farthest to nearest
+			Set<GUIGroupElement, GUIGroupElementComparer> sortedElements;
+			UnorderedMap<GUIElement*, GUIElementRenderInfo> elementInfos;
 			Vector<GUIWidget*> widgets;
+			SPtr<TransientMesh> mesh; // Geometry of all groups
 			bool isDirty;
 		};
 
@@ -66,6 +136,7 @@ namespace BansheeEngine
 		struct GUICoreRenderData
 		{
 			SPtr<TransientMeshCore> mesh;
+			SubMesh subMesh;
 			SPtr<TextureCore> texture;
 			SpriteMaterial materialType;
 			Color tint;
@@ -220,6 +291,41 @@ namespace BansheeEngine
 		/**	Recreates all dirty GUI meshes and makes them ready for rendering. */
 		void updateMeshes();
 
+		/**
+		 * Refreshes the render information and the depth sorted entries of a GUI element whose contents, visibility or 
+		 * position might have changed, and marks the groups it belonged to as dirty if needed.
+		 *
+		 * @param[in]	renderData		Render data of the viewport the element is rendered on.
+		 * @param[in]	element			Element to refresh. Must be a valid element parented to a widget.
+		 * @param[in]	meshDirty		True if the element's geometry changed and the groups it belongs to must be rebuilt.
+		 *								If false only its bounds or depth might have changed.
+		 * @return						True if the changes require the viewport's render elements to be regrouped.
+		 */
+		bool refreshElement(GUIRenderData& renderData, GUIElement* element, bool meshDirty);
+
+		/**
+		 * Removes a GUI element from the viewport's render data, unless the element was since registered with another 
+		 * widget. Element is never dereferenced.
+		 *
+		 * @return	True if the changes require the viewport's render elements to be regrouped.
+		 */
+		bool removeElement(GUIRenderData& renderData, GUIWidget* widget, GUIElement* element);
+
+		/** 
+		 * Splits all visible render elements of a viewport into groups that can be rendered using a single mesh each. 
+		 * Meshes of groups that have the same contents as before are reused.
+		 */
+		void regroupElements(GUIRenderData& renderData);
+
+		/** Fills out the geometry for a group of render elements. */
+		void buildGroupMesh(GUIMaterialGroup& group);
+
+		/** 
+		 * Packs the geometry of all groups in a viewport into a single mesh, so the whole viewport can be rendered from
+		 * one vertex/index buffer. Releases the previous mesh, if any.
+		 */
+		void buildViewportMesh(GUIRenderData& renderData);
+
 		/**	Recreates the input caret texture. */
 		void updateCaretTexture();
 
@@ -351,6 +457,7 @@ namespace BansheeEngine
 		// Element and widget pointer is currently over
 		Vector<ElementInfoUnderPointer> mElementsUnderPointer;
 		Vector<ElementInfoUnderPointer> mNewElementsUnderPointer;
+		Vector<GUIElement*> mElementsAtPointer;
 
 		// Element and widget that's being clicked on
 		GUIMouseButton mActiveMouseButton;
@@ -114,6 +114,9 @@ namespace BansheeEngine
 		/** @} */
 
 	protected:
+		/** @copydoc GUILayout::getChildSizeRange */
+		LayoutSizeRange getChildSizeRange(const GUIElementBase* child) const override { return _getElementSizeRange(child); }
+
 		INT16 mDepthOffset;
 		UINT16 mDepthRangeMin;
 		UINT16 mDepthRangeMax;
@@ -8,6 +8,7 @@
 #include "BsQuaternion.h"
 #include "BsMatrix4.h"
 #include "BsEvent.h"
+#include "BsGUIElementGrid.h"
 
 namespace BansheeEngine
 {
@@ -125,6 +126,28 @@ namespace BansheeEngine
 		 */
 		void _markContentDirty(GUIElementBase* elem);
 
+		/**
+		 * Updates the contents of all dirty elements and marks the widget as clean, while reporting which elements changed
+		 * since the last call. Used by the GUI manager so it only needs to rebuild the meshes the changes affect.
+		 *
+		 * @param[out]	dirtyElements	Elements that were added to the widget, hidden, or had their contents or meshes 
+		 *								marked as dirty since the last call.
+		 * @param[out]	removedElements	Elements that were removed from the widget since the last call. These might have been
+		 *								destroyed and must not be dereferenced.
+		 * @return						True if the widget itself changed (e.g. its transform or depth) in which case all of
+		 *								its elements should be considered as moved.
+		 */
+		bool _cleanDirty(Vector<GUIElement*>& dirtyElements, Vector<GUIElement*>& removedElements);
+
+		/**
+		 * Finds all elements whose clipped bounds contain the provided point. Caller should still check 
+		 * GUIElement::_isInBounds() for each returned element.
+		 *
+		 * @param[in]	position	Point relative to the widget.
+		 * @param[out]	elements	Elements under the point, appended to the existing contents. In no particular order.
+		 */
+		void _findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements);
+
 		/**	Updates the layout of all child elements, repositioning and resizing them as needed. */
 		void _updateLayout();
 
@@ -193,6 +216,9 @@ namespace BansheeEngine
 		HEvent mOwnerTargetResizedConn;
 
 		Set<GUIElement*> mDirtyContents;
+		Set<GUIElement*> mDirtyMeshes;
+		Vector<GUIElement*> mRemovedElements;
+		GUIElementGrid mElementGrid;
 
 		mutable UINT64 mCachedRTId;
 		mutable bool mWidgetIsDirty;
@@ -51,6 +51,10 @@
  *  Entry point into the application.
  */
 
+/** @defgroup Testing-Engine Testing
+ *  Contains engine benchmarks.
+ */
+
 /** @defgroup Internal-Engine [INTERNAL]
  *	Low-level classes and methods not meant for normal use, useful for those that are modifying the engine.
  *  @{
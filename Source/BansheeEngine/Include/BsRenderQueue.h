@@ -38,6 +38,9 @@ namespace BansheeEngine
 	 * Render objects determines rendering order of objects contained within it. Rendering order is determined by object
 	 * material, and can influence rendering of transparent or opaque objects, or be used to improve performance by grouping
 	 * similar objects together.
+	 *
+	 * Unless state reduction is disabled, elements that would otherwise sort equally are ordered so that ones sharing the
+	 * same material and mesh end up next to each other, allowing the renderer to draw them using instancing.
 	 */
 	class BS_EXPORT RenderQueue
 	{
@@ -45,10 +48,13 @@ namespace BansheeEngine
 		struct SortableElement
 		{
 			UINT32 seqIdx;
+			UINT32 elementIdx;
 			INT32 priority;
 			float distFromCamera;
 			UINT32 shaderId;
 			UINT32 passIdx;
+			const MaterialCore* material;
+			const MeshCore* mesh;
 		};
 
 	public:
@@ -79,6 +85,9 @@ namespace BansheeEngine
 		void setStateReduction(StateReduction mode) { mStateReductionMode = mode; }
 
 	protected:
+		/** Sorts the indices of sortable elements, according to the active state reduction mode. */
+		void sortElementIndices();
+
 		/**	Callback used for sorting elements with no material grouping. */
 		static bool elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup);
 
@@ -33,6 +33,18 @@ namespace BansheeEngine
 
 		/** Binds global GPU parameter buffers used for this Renderable type to the provided element. */
 		virtual void bindGlobalBuffers(const RenderableElement& element);
+
+		/**
+		 * Same as bindPerObjectBuffers(const RenderableElement&), except the buffers are bound when the provided command
+		 * buffer is executed. This allows the bind to be recorded from any thread.
+		 */
+		virtual void bindPerObjectBuffers(RenderCommandBuffer& commands, const RenderableElement& element) = 0;
+
+		/**
+		 * Same as bindGlobalBuffers(const RenderableElement&), except the buffers are bound when the provided command
+		 * buffer is executed. This allows the bind to be recorded from any thread.
+		 */
+		virtual void bindGlobalBuffers(RenderCommandBuffer& commands, const RenderableElement& element);
 	};
 
 	/** @} */
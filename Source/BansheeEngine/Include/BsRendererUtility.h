@@ -70,6 +70,18 @@ namespace BansheeEngine
 		 */
 		void draw(const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh, UINT32 numInstances = 1);
 
+		/**
+		 * Records commands that draw the specified mesh into the provided command buffer. Unlike the other draw() 
+		 * overload, this may be called from any thread.
+		 *
+		 * @param[in]	commands		Command buffer to record the commands in.
+		 * @param[in]	mesh			Mesh to draw.
+		 * @param[in]	subMesh			Portion of the mesh to draw.
+		 * @param[in]	numInstances	Number of times to draw the mesh using instanced rendering.
+		 */
+		void draw(RenderCommandBuffer& commands, const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh, 
+			UINT32 numInstances = 1);
+
 		/**
 		 * Blits contents of the provided texture into the currently bound render target. If the provided texture contains
 		 * multiple samples, they will be resolved.
@@ -0,0 +1,121 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisites.h"
+#include "BsModule.h"
+#include "BsTextSprite.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup 2D-Internal
+	 *  @{
+	 */
+
+	/** Quads generated for a single font texture page of a laid out string. */
+	struct TextLayoutPage
+	{
+		HTexture texture;
+		UINT32 numQuads;
+		Vector<Vector2> vertices;
+		Vector<Vector2> uvs;
+		Vector<UINT32> indices;
+	};
+
+	/** Final, aligned and anchored, quads of a laid out string, split per font texture page. */
+	struct TextLayout
+	{
+		Vector<TextLayoutPage> pages;
+		SPtr<GlyphReferences> glyphRefs; /**< Keeps characters rendered on demand from moving in the font atlas. */
+	};
+
+	/**
+	 * Keeps a least-recently-used cache of laid out text, so text sprites displaying the same string with the same font
+	 * and layout constraints don't need to re-run word breaking, kerning and line layout. Fonts are identified by their
+	 * UUID, and all layouts using a font are flushed when that font is modified or destroyed.
+	 *
+	 * @note	Thread safe.
+	 */
+	class BS_EXPORT TextLayoutCache : public Module<TextLayoutCache>
+	{
+		/** Identifies a single cached layout. Everything affecting quad positions or UVs must be part of the key. */
+		struct Key
+		{
+			Key(const TEXT_SPRITE_DESC& desc);
+
+			WString text;
+			String fontUUID;
+			UINT32 fontSize;
+			UINT32 width;
+			UINT32 height;
+			UINT32 flags;
+			size_t hash;
+
+			class Hash
+			{
+			public:
+				size_t operator()(const Key& key) const { return key.hash; }
+			};
+
+			class Equals
+			{
+			public:
+				bool operator()(const Key& a, const Key& b) const;
+			};
+		};
+
+		/** Cached layout along with its position in the LRU list. */
+		struct Entry
+		{
+			SPtr<const TextLayout> layout;
+			UINT32 numQuads;
+			List<const Key*>::iterator lruEntry;
+		};
+
+	public:
+		/** 
+		 * Maximum number of quads, across all entries, kept in the cache. Least recently used entries are evicted when the
+		 * limit is exceeded.
+		 */
+		static const UINT32 MAX_CACHED_QUADS = 32768;
+
+		/** Strings longer than this are never cached, as they are unlikely to repeat. */
+		static const UINT32 MAX_CACHED_TEXT_LENGTH = 512;
+
+		TextLayoutCache();
+		~TextLayoutCache();
+
+		/** Returns a previously cached layout for the provided description, or null if one doesn't exist. */
+		SPtr<const TextLayout> find(const TEXT_SPRITE_DESC& desc);
+
+		/** Stores a layout generated for the provided description, evicting least recently used entries if needed. */
+		void add(const TEXT_SPRITE_DESC& desc, const SPtr<const TextLayout>& layout);
+
+		/** Removes all cached layouts. */
+		void clear();
+
+	private:
+		/** Evicts least recently used entries until the cache is within its limits. */
+		void evict();
+
+		/** Removes all cached layouts using the font with the specified UUID. */
+		void flushFont(const String& fontUUID);
+
+		/** Triggered when a resource is modified, e.g. when a font is reimported. */
+		void onResourceModified(const HResource& resource);
+
+		/** Triggered when a resource is destroyed. */
+		void onResourceDestroyed(const String& UUID);
+
+		UnorderedMap<Key, Entry, Key::Hash, Key::Equals> mEntries;
+		List<const Key*> mLRU; // Least recently used first
+		UnorderedSet<String> mCachedFonts; // Fonts that had layouts added since they were last flushed
+		UINT32 mNumQuads;
+		Mutex mMutex;
+
+		HEvent mResourceModifiedConn;
+		HEvent mResourceDestroyedConn;
+	};
+
+	/** @} */
+}
@@ -133,7 +133,21 @@ namespace BansheeEngine
 		/**	Clears internal geometry buffers. */
 		void clearMesh();
 
+		/** 
+		 * Releases any existing geometry buffers and allocates new ones for the provided number of pages. 
+		 * @p getNumQuads is called once per page and must return the number of quads required by that page.
+		 */
+		void allocRenderElements(UINT32 numPages, const std::function<UINT32(UINT32)>& getNumQuads);
+
+		/** Assigns the material used for rendering a single page of text. */
+		static void setMaterialInfo(SpriteRenderElement& renderElem, const HTexture& texture, 
+			const TEXT_SPRITE_DESC& desc, UINT64 groupId);
+
+		/** Keeps characters the font renders on demand in its atlas while the sprite is displaying them. */
+		static SPtr<GlyphReferences> referenceGlyphs(const TEXT_SPRITE_DESC& desc);
+
 		mutable StaticAlloc<STATIC_BUFFER_SIZE, STATIC_BUFFER_SIZE> mAlloc;
+		SPtr<GlyphReferences> mGlyphRefs;
 	};
 
 	/** @} */
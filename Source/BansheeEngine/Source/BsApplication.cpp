@@ -14,6 +14,7 @@
 #include "BsPlainTextImporter.h"
 #include "BsImporter.h"
 #include "BsShortcutManager.h"
+#include "BsTextLayoutCache.h"
 #include "BsCoreObjectManager.h"
 #include "BsRendererManager.h"
 #include "BsRendererMaterialManager.h"
@@ -56,6 +57,7 @@ namespace BansheeEngine
 
 		ShortcutManager::shutDown();
 		GUIManager::shutDown();
+		TextLayoutCache::shutDown();
 		BuiltinResources::shutDown();
 		RendererMaterialManager::shutDown();
 		VirtualInput::shutDown();
@@ -72,6 +74,7 @@ namespace BansheeEngine
 		BuiltinResources::startUp();
 		RendererMaterialManager::startUp();
 		RendererManager::instance().initialize();
+		TextLayoutCache::startUp();
 		GUIManager::startUp();
 		ShortcutManager::startUp();
 
@@ -191,6 +194,7 @@ namespace BansheeEngine
 		static String DX11Name = "BansheeD3D11RenderAPI";
 		static String DX9Name = "BansheeD3D9RenderAPI";
 		static String OpenGLName = "BansheeGLRenderAPI";
+		static String NullName = "BansheeNullRenderAPI";
 
 		switch (plugin)
 		{
@@ -200,6 +204,8 @@ namespace BansheeEngine
 			return DX9Name;
 		case RenderAPIPlugin::OpenGL:
 			return OpenGLName;
+		case RenderAPIPlugin::Null:
+			return NullName;
 		}
 
 		return StringUtil::BLANK;
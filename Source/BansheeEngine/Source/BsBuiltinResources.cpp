@@ -1312,6 +1312,8 @@ namespace BansheeEngine
 	void BuiltinResourcesHelper::writeTimestamp(const Path& file)
 	{
 		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(file);
+		if (fileStream == nullptr)
+			return;
 
 		time_t currentTime = std::time(nullptr);
 		fileStream->write(&currentTime, sizeof(currentTime));
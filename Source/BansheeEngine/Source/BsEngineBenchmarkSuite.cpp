@@ -0,0 +1,476 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsEngineBenchmarkSuite.h"
+#include "BsResourceManifest.h"
+#include "BsMemorySerializer.h"
+#include "BsTaskScheduler.h"
+#include "BsPixelData.h"
+#include "BsPixelUtil.h"
+#include "BsRenderQueue.h"
+#include "BsUUID.h"
+#include "BsMatrix4.h"
+#include "BsQuaternion.h"
+#include "BsMath.h"
+#include "BsGUILayoutX.h"
+#include "BsGUILayoutY.h"
+#include "BsGUISpace.h"
+#include "BsGUIOptions.h"
+
+namespace BansheeEngine
+{
+	/** @cond TEST */
+
+	/** Render queue that allows elements to be queued without a material, for the purposes of sort benchmarking. */
+	class BenchmarkRenderQueue : public RenderQueue
+	{
+	public:
+		/** Fills the queue with the provided number of elements, using a deterministic pseudo-random distribution. */
+		void populate(UINT32 numElements)
+		{
+			clear();
+
+			UINT32 seed = 12345;
+			for (UINT32 i = 0; i < numElements; i++)
+			{
+				seed = seed * 1664525 + 1013904223;
+
+				mSortableElementIdx.push_back(i);
+				mSortableElements.push_back(SortableElement());
+
+				SortableElement& elem = mSortableElements.back();
+				elem.seqIdx = i;
+				elem.priority = (seed >> 28) % 4;
+				elem.shaderId = (seed >> 16) % 64;
+				elem.passIdx = (seed >> 8) % 2;
+				elem.distFromCamera = (float)(seed % 10000) * 0.1f;
+			}
+		}
+
+		/** Sorts the queued elements. */
+		void sortIndices()
+		{
+			sortElementIndices();
+		}
+	};
+
+	/** 
+	 * Binary tree node packer that TexAtlasGenerator used before switching to a skyline packer. Kept as a baseline for
+	 * comparing atlas layout time and occupancy.
+	 */
+	class BenchmarkTreeAtlasNode
+	{
+	public:
+		BenchmarkTreeAtlasNode()
+			:x(0), y(0), width(0), height(0), children(nullptr), nodeFull(false)
+		{ }
+
+		BenchmarkTreeAtlasNode(UINT32 _x, UINT32 _y, UINT32 _width, UINT32 _height)
+			:x(_x), y(_y), width(_width), height(_height), children(nullptr), nodeFull(false)
+		{ }
+
+		~BenchmarkTreeAtlasNode()
+		{
+			if(children != nullptr)
+				bs_deleteN(children, 2);
+		}
+
+		/** Attempts to place the element in the node or one of its children. Returns false if it doesn't fit. */
+		bool insert(TexAtlasElementDesc& element)
+		{
+			if (children != nullptr)
+			{
+				if (children[0].insert(element))
+					return true;
+
+				return children[1].insert(element);
+			}
+
+			if(nodeFull)
+				return false;
+
+			if (element.input.width > width || element.input.height > height)
+				return false;
+
+			if (element.input.width == width && element.input.height == height)
+			{
+				element.output.x = x;
+				element.output.y = y;
+				nodeFull = true;
+
+				return true;
+			}
+
+			float aspect = width / (float)height;
+			float dw = (float)(width - element.input.width);
+			float dh = (height - element.input.height) * aspect;
+
+			children = bs_newN<BenchmarkTreeAtlasNode>(2);
+
+			if (dw > dh)
+			{
+				children[0].setArea(x, y, element.input.width, height);
+				children[1].setArea(x + element.input.width, y, width - element.input.width, height);
+			}
+			else
+			{
+				children[0].setArea(x, y, width, element.input.height);
+				children[1].setArea(x, y + element.input.height, width, height - element.input.height);
+			}
+
+			return children[0].insert(element);
+		}
+
+		/** 
+		 * Places elements into fixed size pages, largest unplaced element first, same as the old TexAtlasGenerator did.
+		 * Returns the number of pages used.
+		 */
+		static UINT32 pack(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height)
+		{
+			for (auto& element : elements)
+				element.output.page = -1;
+
+			UINT32 numPages = 0;
+			while (true)
+			{
+				INT32 largestId = findLargestWithoutPage(elements, std::numeric_limits<UINT32>::max());
+				if (largestId == -1)
+					return numPages;
+
+				BenchmarkTreeAtlasNode root(0, 0, width, height);
+				root.insert(elements[largestId]);
+				elements[largestId].output.page = numPages;
+
+				// Keep adding the largest element that still fits, until nothing does
+				UINT32 sizeLimit = std::numeric_limits<UINT32>::max();
+				while (true)
+				{
+					INT32 elementId = findLargestWithoutPage(elements, sizeLimit);
+					if (elementId == -1)
+						break;
+
+					TexAtlasElementDesc& element = elements[elementId];
+					if (root.insert(element))
+						element.output.page = numPages;
+					else
+						sizeLimit = element.input.width * element.input.height;
+				}
+
+				numPages++;
+			}
+		}
+
+		UINT32 x, y, width, height;
+		BenchmarkTreeAtlasNode* children;
+		bool nodeFull;
+
+	private:
+		/** Sets the area covered by an empty node. */
+		void setArea(UINT32 _x, UINT32 _y, UINT32 _width, UINT32 _height)
+		{
+			x = _x;
+			y = _y;
+			width = _width;
+			height = _height;
+		}
+
+		/** Returns the largest element without a page whose area is smaller than the limit, or -1 if none. */
+		static INT32 findLargestWithoutPage(const Vector<TexAtlasElementDesc>& elements, UINT32 sizeLimit)
+		{
+			INT32 largestId = -1;
+			UINT32 largestSize = 0;
+
+			for (size_t i = 0; i < elements.size(); i++)
+			{
+				if (elements[i].output.page != -1)
+					continue;
+
+				UINT32 size = elements[i].input.width * elements[i].input.height;
+				if (size > largestSize && size < sizeLimit)
+				{
+					largestSize = size;
+					largestId = (INT32)i;
+				}
+			}
+
+			return largestId;
+		}
+	};
+
+	/** @endcond */
+
+	/** 
+	 * Returns the portion of the area covered by elements in all but the last page of an atlas. The last page is excluded
+	 * as it is often only partially filled.
+	 */
+	static float calcAtlasOccupancy(const Vector<TexAtlasElementDesc>& elements, UINT32 numPages, UINT32 pageSize)
+	{
+		if (numPages <= 1)
+			return 1.0f;
+
+		UINT32 numFullPages = numPages - 1;
+
+		UINT64 usedArea = 0;
+		for (auto& element : elements)
+		{
+			if (element.output.page >= 0 && (UINT32)element.output.page < numFullPages)
+				usedArea += element.input.width * element.input.height;
+		}
+
+		UINT64 totalArea = (UINT64)numFullPages * pageSize * pageSize;
+		return (float)(usedArea / (double)totalArea);
+	}
+
+	/** 
+	 * Marks the element and all of its descendants whose layout changed as clean, same as GUIWidget does after a layout
+	 * update.
+	 */
+	static void markLayoutAsClean(GUIElementBase* element)
+	{
+		element->_markAsClean();
+
+		UINT32 numChildren = element->_getNumChildren();
+		for (UINT32 i = 0; i < numChildren; i++)
+		{
+			GUIElementBase* child = element->_getChild(i);
+			if (child->_isLayoutDirty())
+				markLayoutAsClean(child);
+		}
+	}
+
+	static const UINT32 NUM_MANIFEST_ENTRIES = 5000;
+	static const UINT32 NUM_TASKS = 256;
+	static const UINT32 NUM_FRAME_ALLOCS = 10000;
+	static const UINT32 NUM_TRANSFORMS = 10000;
+	static const UINT32 IMAGE_SIZE = 512;
+	static const UINT32 NUM_QUEUE_ELEMENTS = 10000;
+	static const UINT32 NUM_ATLAS_ELEMENTS = 5000;
+	static const UINT32 ATLAS_PAGE_SIZE = 1024;
+	static const float MIN_ATLAS_OCCUPANCY = 0.85f;
+	static const UINT32 LAYOUT_DEPTH = 64;
+	static const UINT32 LAYOUT_WIDTH = 1024;
+	static const UINT32 NUM_SPACES_PER_LAYOUT = 4;
+
+	EngineBenchmarkSuite::EngineBenchmarkSuite()
+		:mTreeAtlasOccupancy(0.0f), mLayoutRoot(nullptr), mDeepLayoutSpace(nullptr), mWideLayoutSpace(nullptr), mLayoutIteration(0)
+	{
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::SerializeManifest);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::TaskSchedulerThroughput);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::FrameAllocAllocations);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::MathTransforms);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::PixelConversion);
+		BS_ADD_BENCHMARK_SETUP(EngineBenchmarkSuite::RenderQueueSort, EngineBenchmarkSuite::RenderQueueSortSetup);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::TexAtlasLayout);
+		BS_ADD_BENCHMARK_ITERATIONS(EngineBenchmarkSuite::TexAtlasLayoutTree, 1, 10);
+		BS_ADD_BENCHMARK(EngineBenchmarkSuite::GUILayoutUpdate);
+	}
+
+	void EngineBenchmarkSuite::startUp()
+	{
+		mManifest = ResourceManifest::create("Benchmark");
+		for (UINT32 i = 0; i < NUM_MANIFEST_ENTRIES; i++)
+		{
+			String uuid = UUIDGenerator::generateRandom();
+			mManifest->registerResource(uuid, Path("Resources/Benchmark/" + toString(i) + ".asset"));
+		}
+
+		mPixelsRGBA8 = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_R8G8B8A8);
+		mPixelsBGRA8 = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_B8G8R8A8);
+		mPixelsFloat = PixelData::create(IMAGE_SIZE, IMAGE_SIZE, 1, PF_FLOAT32_RGBA);
+
+		UINT8* pixels = mPixelsRGBA8->getData();
+		UINT32 size = mPixelsRGBA8->getSize();
+		for (UINT32 i = 0; i < size; i++)
+			pixels[i] = (UINT8)(i * 31);
+
+		mDistanceQueue = bs_shared_ptr_new<BenchmarkRenderQueue>();
+		mDistanceQueue->setStateReduction(StateReduction::Distance);
+
+		mMaterialQueue = bs_shared_ptr_new<BenchmarkRenderQueue>();
+		mMaterialQueue->setStateReduction(StateReduction::Material);
+
+		// Glyph-like elements, mostly similar heights with varying widths
+		mAtlasElements.resize(NUM_ATLAS_ELEMENTS);
+
+		UINT32 seed = 12345;
+		for (auto& element : mAtlasElements)
+		{
+			seed = seed * 1664525 + 1013904223;
+
+			element.input.width = 2 + (seed >> 24) % 30;
+			element.input.height = 12 + (seed >> 16) % 12;
+		}
+
+		mTreeAtlasElements = mAtlasElements;
+
+		UINT32 numTreePages = BenchmarkTreeAtlasNode::pack(mTreeAtlasElements, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+		mTreeAtlasOccupancy = calcAtlasOccupancy(mTreeAtlasElements, numTreePages, ATLAS_PAGE_SIZE);
+
+		// Fixed size root, with a deep hierarchy of alternating horizontal and vertical layouts on one side, and a wide
+		// layout containing many small vertical layouts on the other
+		mLayoutRoot = GUILayoutX::create(GUIOptions(GUIOption::fixedWidth(1920), GUIOption::fixedHeight(1080)));
+
+		GUILayout* deepParent = mLayoutRoot->addNewElement<GUILayoutY>();
+		for (UINT32 i = 0; i < LAYOUT_DEPTH; i++)
+		{
+			GUILayout* child;
+			if ((i % 2) == 0)
+				child = deepParent->addNewElement<GUILayoutX>();
+			else
+				child = deepParent->addNewElement<GUILayoutY>();
+
+			deepParent->addNewElement<GUIFixedSpace>(10);
+			deepParent->addNewElement<GUIFlexibleSpace>();
+			deepParent = child;
+		}
+
+		mDeepLayoutSpace = deepParent->addNewElement<GUIFixedSpace>(10);
+
+		GUILayout* wideParent = mLayoutRoot->addNewElement<GUILayoutX>();
+		for (UINT32 i = 0; i < LAYOUT_WIDTH; i++)
+		{
+			GUILayout* child = wideParent->addNewElement<GUILayoutY>();
+			for (UINT32 j = 0; j < NUM_SPACES_PER_LAYOUT; j++)
+				child->addNewElement<GUIFixedSpace>(10);
+		}
+
+		GUILayout* wideChild = static_cast<GUILayout*>(wideParent->_getChild(LAYOUT_WIDTH / 2));
+		mWideLayoutSpace = static_cast<GUIFixedSpace*>(wideChild->_getChild(0));
+
+		GUILayoutData layoutData;
+		layoutData.area = Rect2I(0, 0, 1920, 1080);
+		layoutData.clipRect = layoutData.area;
+
+		mLayoutRoot->_setLayoutData(layoutData);
+		mLayoutRoot->_updateLayout(layoutData);
+		markLayoutAsClean(mLayoutRoot);
+	}
+
+	void EngineBenchmarkSuite::shutDown()
+	{
+		mManifest = nullptr;
+		mPixelsRGBA8 = nullptr;
+		mPixelsBGRA8 = nullptr;
+		mPixelsFloat = nullptr;
+		mDistanceQueue = nullptr;
+		mMaterialQueue = nullptr;
+		mAtlasElements.clear();
+		mTreeAtlasElements.clear();
+
+		GUILayout::destroy(mLayoutRoot);
+		mLayoutRoot = nullptr;
+		mDeepLayoutSpace = nullptr;
+		mWideLayoutSpace = nullptr;
+	}
+
+	void EngineBenchmarkSuite::SerializeManifest()
+	{
+		MemorySerializer serializer;
+
+		UINT32 size = 0;
+		UINT8* data = serializer.encode(mManifest.get(), size, (void*(*)(UINT32))&bs_alloc);
+
+		SPtr<IReflectable> decoded = serializer.decode(data, size);
+		bs_free(data);
+
+		BS_TEST_ASSERT(decoded != nullptr);
+	}
+
+	void EngineBenchmarkSuite::TaskSchedulerThroughput()
+	{
+		std::atomic<UINT32> counter(0);
+
+		Vector<SPtr<Task>> tasks(NUM_TASKS);
+		for (UINT32 i = 0; i < NUM_TASKS; i++)
+		{
+			tasks[i] = Task::create("Benchmark", [&counter]() { counter++; });
+			TaskScheduler::instance().addTask(tasks[i]);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		BS_TEST_ASSERT(counter == NUM_TASKS);
+	}
+
+	void EngineBenchmarkSuite::FrameAllocAllocations()
+	{
+		mFrameAlloc.markFrame();
+
+		for (UINT32 i = 0; i < NUM_FRAME_ALLOCS; i++)
+		{
+			UINT8* data = mFrameAlloc.alloc(16 + (i % 16) * 16);
+			data[0] = (UINT8)i;
+		}
+
+		mFrameAlloc.clear();
+	}
+
+	void EngineBenchmarkSuite::MathTransforms()
+	{
+		Vector3 accum = Vector3::ZERO;
+		for (UINT32 i = 0; i < NUM_TRANSFORMS; i++)
+		{
+			float t = (float)i;
+
+			Quaternion rotation(Degree(t * 0.1f), Degree(t * 0.2f), Degree(t * 0.3f));
+			Matrix4 world = Matrix4::TRS(Vector3(t, -t, t * 0.5f), rotation, Vector3::ONE);
+			Matrix4 worldInv = world.inverseAffine();
+
+			accum += (world * worldInv).multiplyAffine(Vector3(1.0f, 2.0f, 3.0f));
+		}
+
+		BS_TEST_ASSERT(!Math::isNaN(accum.x));
+	}
+
+	void EngineBenchmarkSuite::PixelConversion()
+	{
+		PixelUtil::bulkPixelConversion(*mPixelsRGBA8, *mPixelsBGRA8);
+		PixelUtil::bulkPixelConversion(*mPixelsRGBA8, *mPixelsFloat);
+		PixelUtil::bulkPixelConversion(*mPixelsFloat, *mPixelsRGBA8);
+	}
+
+	void EngineBenchmarkSuite::RenderQueueSortSetup()
+	{
+		mDistanceQueue->populate(NUM_QUEUE_ELEMENTS);
+		mMaterialQueue->populate(NUM_QUEUE_ELEMENTS);
+	}
+
+	void EngineBenchmarkSuite::RenderQueueSort()
+	{
+		mDistanceQueue->sortIndices();
+		mMaterialQueue->sortIndices();
+	}
+
+	void EngineBenchmarkSuite::TexAtlasLayout()
+	{
+		TexAtlasGenerator generator(false, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+		Vector<TexAtlasPageDesc> pages = generator.createAtlasLayout(mAtlasElements);
+
+		BS_TEST_ASSERT(!pages.empty());
+
+		float occupancy = calcAtlasOccupancy(mAtlasElements, (UINT32)pages.size(), ATLAS_PAGE_SIZE);
+		BS_TEST_ASSERT_MSG(occupancy >= MIN_ATLAS_OCCUPANCY, "Atlas occupancy too low.");
+		BS_TEST_ASSERT_MSG(occupancy >= mTreeAtlasOccupancy, "Atlas occupancy lower than the tree packer baseline.");
+	}
+
+	void EngineBenchmarkSuite::TexAtlasLayoutTree()
+	{
+		UINT32 numPages = BenchmarkTreeAtlasNode::pack(mTreeAtlasElements, ATLAS_PAGE_SIZE, ATLAS_PAGE_SIZE);
+
+		BS_TEST_ASSERT(numPages > 0);
+	}
+
+	void EngineBenchmarkSuite::GUILayoutUpdate()
+	{
+		mLayoutIteration++;
+		UINT32 size = 10 + (mLayoutIteration % 2) * 5;
+
+		mDeepLayoutSpace->setSize(size);
+		mWideLayoutSpace->setSize(size);
+
+		mLayoutRoot->_updateLayout(mLayoutRoot->_getLayoutData());
+		markLayoutAsClean(mLayoutRoot);
+
+		BS_TEST_ASSERT(mWideLayoutSpace->_getLayoutData().area.height == (INT32)size);
+	}
+}
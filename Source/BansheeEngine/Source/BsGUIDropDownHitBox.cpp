@@ -38,6 +38,9 @@ namespace BansheeEngine
 		mBounds.push_back(bounds);
 
 		updateClippedBounds();
+
+		// Bounds aren't set through the layout, so let the widget know they changed
+		_markMeshAsDirty();
 	}
 
 	void GUIDropDownHitBox::setBounds(const Vector<Rect2I>& bounds)
@@ -45,6 +48,7 @@ namespace BansheeEngine
 		mBounds = bounds;
 
 		updateClippedBounds();
+		_markMeshAsDirty();
 	}
 
 	void GUIDropDownHitBox::updateClippedBounds()
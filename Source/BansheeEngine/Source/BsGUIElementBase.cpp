@@ -12,14 +12,14 @@ namespace BansheeEngine
 {
 	GUIElementBase::GUIElementBase()
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty)
+		, mFlags(GUIElem_Dirty | GUIElem_LayoutDirty)
 	{
 
 	}
 
 	GUIElementBase::GUIElementBase(const GUIDimensions& dimensions)
 		: mParentWidget(nullptr), mAnchorParent(nullptr), mUpdateParent(nullptr), mParentElement(nullptr)
-		, mFlags(GUIElem_Dirty), mDimensions(dimensions)
+		, mFlags(GUIElem_Dirty | GUIElem_LayoutDirty), mDimensions(dimensions)
 	{
 
 	}
@@ -185,7 +185,12 @@ namespace BansheeEngine
 	
 	void GUIElementBase::_markAsClean()
 	{
-		mFlags &= ~GUIElem_Dirty;
+		mFlags &= ~(GUIElem_Dirty | GUIElem_AnyLayoutDirty);
+	}
+
+	void GUIElementBase::_markLayoutAsClean()
+	{
+		mFlags &= ~GUIElem_AnyLayoutDirty;
 	}
 
 	void GUIElementBase::_markLayoutAsDirty() 
@@ -193,12 +198,26 @@ namespace BansheeEngine
 		if(!_isVisible())
 			return;
 
+		// Flag the path up to the update parent, so the layout update can find this element without visiting its siblings
+		mFlags |= GUIElem_LayoutDirty;
+		_markLayoutPathAsDirty(mUpdateParent);
+
 		if (mUpdateParent != nullptr)
 			mUpdateParent->mFlags |= GUIElem_Dirty;
 		else
 			mFlags |= GUIElem_Dirty;
 	}
 
+	void GUIElementBase::_markLayoutPathAsDirty(GUIElementBase* ancestor)
+	{
+		GUIElementBase* current = this;
+		while (current != ancestor && current->mParentElement != nullptr)
+		{
+			current = current->mParentElement;
+			current->mFlags |= GUIElem_ChildLayoutDirty;
+		}
+	}
+
 	void GUIElementBase::_markContentAsDirty()
 	{
 		if (!_isVisible())
@@ -388,9 +407,11 @@ namespace BansheeEngine
 
 	void GUIElementBase::_updateOptimalLayoutSizes()
 	{
+		// Children whose layout didn't change keep their cached sizes
 		for(auto& child : mChildren)
 		{
-			child->_updateOptimalLayoutSizes();
+			if (child->_isSizeRangeDirty())
+				child->_updateOptimalLayoutSizes();
 		}
 	}
 
@@ -402,6 +423,19 @@ namespace BansheeEngine
 		}
 	}
 
+	void GUIElementBase::_setLayoutData(const GUILayoutData& data)
+	{
+		// Element depth is ignored as elements store their own depth there, and it doesn't affect child layout
+		bool isModified = data.area != mLayoutData.area || data.clipRect != mLayoutData.clipRect ||
+			(data.depth & 0xFFFFFF00) != (mLayoutData.depth & 0xFFFFFF00) || data.depthRangeMin != mLayoutData.depthRangeMin ||
+			data.depthRangeMax != mLayoutData.depthRangeMax;
+
+		if (isModified)
+			mFlags |= GUIElem_AreaDirty;
+
+		mLayoutData = data;
+	}
+
 	LayoutSizeRange GUIElementBase::_calculateLayoutSizeRange() const
 	{
 		const GUIDimensions& dimensions = _getDimensions();
@@ -0,0 +1,159 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsGUIElementGrid.h"
+#include "BsGUIElement.h"
+
+namespace BansheeEngine
+{
+	const INT32 GUIElementGrid::CELL_SIZE = 64;
+	const UINT32 GUIElementGrid::MAX_CELLS_PER_ELEMENT = 64;
+
+	void GUIElementGrid::markDirty(GUIElement* element)
+	{
+		mDirtyElements.insert(element);
+	}
+
+	void GUIElementGrid::markDirty(const Vector<GUIElement*>& elements)
+	{
+		mDirtyElements.insert(elements.begin(), elements.end());
+	}
+
+	void GUIElementGrid::remove(GUIElement* element)
+	{
+		mDirtyElements.erase(element);
+
+		auto iterFind = mElements.find(element);
+		if (iterFind == mElements.end())
+			return;
+
+		removeFromCells(element, iterFind->second);
+		mElements.erase(iterFind);
+	}
+
+	void GUIElementGrid::clear()
+	{
+		mCells.clear();
+		mElements.clear();
+		mOversizedElements.clear();
+		mDirtyElements.clear();
+	}
+
+	void GUIElementGrid::findElements(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		updateDirty();
+
+		auto iterFind = mCells.find(getCellKey(getCellCoord(position.x), getCellCoord(position.y)));
+		if (iterFind != mCells.end())
+		{
+			for (auto& element : iterFind->second)
+			{
+				if (element->_getClippedBounds().contains(position))
+					elements.push_back(element);
+			}
+		}
+
+		for (auto& element : mOversizedElements)
+		{
+			if (element->_getClippedBounds().contains(position))
+				elements.push_back(element);
+		}
+	}
+
+	void GUIElementGrid::insert(GUIElement* element)
+	{
+		// Elements that aren't visible or have no area can never be under a point
+		const Rect2I& bounds = element->_getClippedBounds();
+		if (!element->_isVisible() || bounds.width == 0 || bounds.height == 0)
+			return;
+
+		CellRange range;
+		range.minX = getCellCoord(bounds.x);
+		range.minY = getCellCoord(bounds.y);
+		range.maxX = getCellCoord(bounds.x + (INT32)bounds.width - 1);
+		range.maxY = getCellCoord(bounds.y + (INT32)bounds.height - 1);
+
+		UINT64 numCells = (UINT64)(range.maxX - range.minX + 1) * (UINT64)(range.maxY - range.minY + 1);
+		range.isOversized = numCells > MAX_CELLS_PER_ELEMENT;
+
+		if (range.isOversized)
+			mOversizedElements.push_back(element);
+		else
+		{
+			for (INT32 y = range.minY; y <= range.maxY; y++)
+			{
+				for (INT32 x = range.minX; x <= range.maxX; x++)
+					mCells[getCellKey(x, y)].push_back(element);
+			}
+		}
+
+		mElements[element] = range;
+	}
+
+	void GUIElementGrid::removeFromCells(GUIElement* element, const CellRange& range)
+	{
+		if (range.isOversized)
+		{
+			auto iterFind = std::find(mOversizedElements.begin(), mOversizedElements.end(), element);
+			if (iterFind != mOversizedElements.end())
+				mOversizedElements.erase(iterFind);
+
+			return;
+		}
+
+		for (INT32 y = range.minY; y <= range.maxY; y++)
+		{
+			for (INT32 x = range.minX; x <= range.maxX; x++)
+			{
+				auto iterFindCell = mCells.find(getCellKey(x, y));
+				if (iterFindCell == mCells.end())
+					continue;
+
+				Vector<GUIElement*>& cellElements = iterFindCell->second;
+				auto iterFind = std::find(cellElements.begin(), cellElements.end(), element);
+				if (iterFind != cellElements.end())
+				{
+					// Order within a cell doesn't matter
+					*iterFind = cellElements.back();
+					cellElements.pop_back();
+				}
+
+				if (cellElements.empty())
+					mCells.erase(iterFindCell);
+			}
+		}
+	}
+
+	void GUIElementGrid::updateDirty()
+	{
+		if (mDirtyElements.empty())
+			return;
+
+		for (auto& element : mDirtyElements)
+		{
+			auto iterFind = mElements.find(element);
+			if (iterFind != mElements.end())
+			{
+				removeFromCells(element, iterFind->second);
+				mElements.erase(iterFind);
+			}
+
+			insert(element);
+		}
+
+		mDirtyElements.clear();
+	}
+
+	UINT64 GUIElementGrid::getCellKey(INT32 x, INT32 y)
+	{
+		return ((UINT64)(UINT32)x << 32) | (UINT64)(UINT32)y;
+	}
+
+	INT32 GUIElementGrid::getCellCoord(INT32 position)
+	{
+		// Round towards negative infinity so cells left and above the widget origin don't overlap cell zero
+		if (position >= 0)
+			return position / CELL_SIZE;
+
+		return -((-position + CELL_SIZE - 1) / CELL_SIZE);
+	}
+}
@@ -70,6 +70,52 @@ namespace BansheeEngine
 		_markLayoutAsDirty();
 	}
 
+	bool GUILayout::updateChildSizeRanges()
+	{
+		// Update all children first, otherwise we can't determine our own optimal size
+		GUIElementBase::_updateOptimalLayoutSizes();
+
+		// Child list or our own dimensions changed, cached entries can't be trusted
+		bool refreshAll = _isOwnLayoutDirty() || mChildren.size() != mChildSizeRanges.size();
+		if (mChildren.size() != mChildSizeRanges.size())
+			mChildSizeRanges.resize(mChildren.size());
+
+		bool isModified = refreshAll;
+		UINT32 childIdx = 0;
+		for (auto& child : mChildren)
+		{
+			if (refreshAll || child->_isSizeRangeDirty())
+			{
+				LayoutSizeRange childSizeRange;
+				if (child->_isActive())
+					childSizeRange = getChildSizeRange(child);
+
+				// Child's own changes (e.g. padding or fixed size) can affect its area even if the size range is the same
+				if (child->_isOwnLayoutDirty() || childSizeRange != mChildSizeRanges[childIdx])
+				{
+					mChildSizeRanges[childIdx] = childSizeRange;
+					isModified = true;
+				}
+			}
+
+			childIdx++;
+		}
+
+		if (isModified)
+			mFlags |= GUIElem_AreaDirty;
+
+		return isModified;
+	}
+
+	void GUILayout::updateDirtyChildLayouts()
+	{
+		for (auto& child : mChildren)
+		{
+			if (child->_isActive() && child->_isLayoutDirty())
+				child->_updateLayoutInternal(child->_getLayoutData());
+		}
+	}
+
 	const RectOffset& GUILayout::_getPadding() const
 	{
 		static RectOffset padding;
@@ -44,13 +44,23 @@ namespace BansheeEngine
 		return sizeRange;
 	}
 
-	void GUILayoutX::_updateOptimalLayoutSizes()
+	LayoutSizeRange GUILayoutX::getChildSizeRange(const GUIElementBase* child) const
 	{
-		// Update all children first, otherwise we can't determine our own optimal size
-		GUIElementBase::_updateOptimalLayoutSizes();
+		LayoutSizeRange childSizeRange = child->_getLayoutSizeRange();
+		if (child->_getType() == GUIElementBase::Type::FixedSpace)
+		{
+			childSizeRange.optimal.y = 0;
+			childSizeRange.min.y = 0;
+		}
+
+		return childSizeRange;
+	}
 
-		if(mChildren.size() != mChildSizeRanges.size())
-			mChildSizeRanges.resize(mChildren.size());
+	void GUILayoutX::_updateOptimalLayoutSizes()
+	{
+		// Our size range depends only on child size ranges, so keep the cached one if none of them changed
+		if (!updateChildSizeRanges())
+			return;
 
 		Vector2I optimalSize;
 		Vector2I minSize;
@@ -58,16 +68,9 @@ namespace BansheeEngine
 		UINT32 childIdx = 0;
 		for(auto& child : mChildren)
 		{
-			LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
-
 			if (child->_isActive())
 			{
-				childSizeRange = child->_getLayoutSizeRange();
-				if (child->_getType() == GUIElementBase::Type::FixedSpace)
-				{
-					childSizeRange.optimal.y = 0;
-					childSizeRange.min.y = 0;
-				}
+				const LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
 
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
 				UINT32 paddingY = child->_getPadding().top + child->_getPadding().bottom;
@@ -78,8 +81,6 @@ namespace BansheeEngine
 				minSize.x += childSizeRange.min.x + paddingX;
 				minSize.y = std::max((UINT32)minSize.y, childSizeRange.min.y + paddingY);
 			}
-			else
-				childSizeRange = LayoutSizeRange();
 
 			childIdx++;
 		}
@@ -393,6 +394,13 @@ namespace BansheeEngine
 
 	void GUILayoutX::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		// Child areas can only change if our area or child size ranges changed
+		if (!_isOwnLayoutDirty() && (mFlags & GUIElem_AreaDirty) == 0)
+		{
+			updateDirtyChildLayouts();
+			return;
+		}
+
 		UINT32 numElements = (UINT32)mChildren.size();
 		Rect2I* elementAreas = nullptr;
 
@@ -414,7 +422,10 @@ namespace BansheeEngine
 				childData.clipRect.clip(data.clipRect);
 
 				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+
+				// Children that kept their area and have no dirty descendants are already up to date
+				if (child->_isLayoutDirty())
+					child->_updateLayoutInternal(childData);
 			}
 
 			childIdx++;
@@ -44,13 +44,23 @@ namespace BansheeEngine
 		return sizeRange;
 	}
 
-	void GUILayoutY::_updateOptimalLayoutSizes()
+	LayoutSizeRange GUILayoutY::getChildSizeRange(const GUIElementBase* child) const
 	{
-		// Update all children first, otherwise we can't determine our own optimal size
-		GUIElementBase::_updateOptimalLayoutSizes();
+		LayoutSizeRange childSizeRange = child->_getLayoutSizeRange();
+		if (child->_getType() == GUIElementBase::Type::FixedSpace)
+		{
+			childSizeRange.optimal.x = 0;
+			childSizeRange.min.x = 0;
+		}
+
+		return childSizeRange;
+	}
 
-		if(mChildren.size() != mChildSizeRanges.size())
-			mChildSizeRanges.resize(mChildren.size());
+	void GUILayoutY::_updateOptimalLayoutSizes()
+	{
+		// Our size range depends only on child size ranges, so keep the cached one if none of them changed
+		if (!updateChildSizeRanges())
+			return;
 
 		Vector2I optimalSize;
 		Vector2I minSize;
@@ -58,16 +68,9 @@ namespace BansheeEngine
 		UINT32 childIdx = 0;
 		for(auto& child : mChildren)
 		{
-			LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
-
 			if (child->_isActive())
 			{
-				childSizeRange = child->_getLayoutSizeRange();
-				if (child->_getType() == GUIElementBase::Type::FixedSpace)
-				{
-					childSizeRange.optimal.x = 0;
-					childSizeRange.min.x = 0;
-				}
+				const LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
 
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
 				UINT32 paddingY = child->_getPadding().top + child->_getPadding().bottom;
@@ -78,8 +81,6 @@ namespace BansheeEngine
 				minSize.y += childSizeRange.min.y + paddingY;
 				minSize.x = std::max((UINT32)minSize.x, childSizeRange.min.x + paddingX);
 			}
-			else
-				childSizeRange = LayoutSizeRange();
 
 			childIdx++;
 		}
@@ -394,6 +395,13 @@ namespace BansheeEngine
 
 	void GUILayoutY::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		// Child areas can only change if our area or child size ranges changed
+		if (!_isOwnLayoutDirty() && (mFlags & GUIElem_AreaDirty) == 0)
+		{
+			updateDirtyChildLayouts();
+			return;
+		}
+
 		UINT32 numElements = (UINT32)mChildren.size();
 		Rect2I* elementAreas = nullptr;
 		
@@ -415,7 +423,10 @@ namespace BansheeEngine
 				childData.clipRect.clip(data.clipRect);
 
 				child->_setLayoutData(childData);
-				child->_updateLayoutInternal(childData);
+
+				// Children that kept their area and have no dirty descendants are already up to date
+				if (child->_isLayoutDirty())
+					child->_updateLayoutInternal(childData);
 			}
 
 			childIdx++;
@@ -42,29 +42,6 @@ using namespace std::placeholders;
 
 namespace BansheeEngine
 {
-	struct GUIGroupElement
-	{
-		GUIGroupElement()
-		{ }
-
-		GUIGroupElement(GUIElement* _element, UINT32 _renderElement)
-			:element(_element), renderElement(_renderElement)
-		{ }
-
-		GUIElement* element;
-		UINT32 renderElement;
-	};
-
-	struct GUIMaterialGroup
-	{
-		SpriteMaterialInfo matInfo;
-		UINT32 numQuads;
-		UINT32 depth;
-		UINT32 minDepth;
-		Rect2I bounds;
-		Vector<GUIGroupElement> elements;
-	};
-
 	const UINT32 GUIManager::DRAG_DISTANCE = 3;
 	const float GUIManager::TOOLTIP_HOVER_TIME = 1.0f;
 	const UINT32 GUIManager::MESH_HEAP_INITIAL_NUM_VERTS = 16384;
@@ -218,11 +195,8 @@ namespace BansheeEngine
 
 		if(renderData.widgets.size() == 0)
 		{
-			for (auto& mesh : renderData.cachedMeshes)
-			{
-				if (mesh != nullptr)
-					mMeshHeap->dealloc(mesh);
-			}
+			if (renderData.mesh != nullptr)
+				mMeshHeap->dealloc(renderData.mesh);
 
 			mCachedGUIData.erase(renderTarget);
 			mCoreDirty = true;
@@ -388,23 +362,19 @@ namespace BansheeEngine
 				auto insertedData = corePerCameraData.insert(std::make_pair(camera->getCore(), Vector<GUICoreRenderData>()));
 				Vector<GUICoreRenderData>& cameraData = insertedData.first->second;
 
-				UINT32 meshIdx = 0;
-				for (auto& mesh : renderData.cachedMeshes)
+				if (renderData.mesh == nullptr)
+					continue;
+
+				SPtr<TransientMeshCore> meshCore = renderData.mesh->getCore();
+				for (auto& group : renderData.groups)
 				{
-					SpriteMaterialInfo materialInfo = renderData.cachedMaterials[meshIdx];
-					GUIWidget* widget = renderData.cachedWidgetsPerMesh[meshIdx];
+					const SpriteMaterialInfo& materialInfo = group.matInfo;
 
 					if (materialInfo.texture == nullptr || !materialInfo.texture.isLoaded())
-					{
-						meshIdx++;
 						continue;
-					}
 
-					if (mesh == nullptr)
-					{
-						meshIdx++;
+					if (group.numQuads == 0)
 						continue;
-					}
 
 					cameraData.push_back(GUICoreRenderData());
 					GUICoreRenderData& newEntry = cameraData.back();
@@ -412,10 +382,9 @@ namespace BansheeEngine
 					newEntry.materialType = materialInfo.type;
 					newEntry.texture = materialInfo.texture->getCore();
 					newEntry.tint = materialInfo.tint;
-					newEntry.mesh = mesh->getCore();
-					newEntry.worldTransform = widget->getWorldTfrm();
-
-					meshIdx++;
+					newEntry.mesh = meshCore;
+					newEntry.subMesh = SubMesh(group.quadOffset * 6, group.numQuads * 6, DOT_TRIANGLE_LIST);
+					newEntry.worldTransform = group.widget->getWorldTfrm();
 				}
 			}
 
@@ -428,249 +397,421 @@ namespace BansheeEngine
 
 	void GUIManager::updateMeshes()
 	{
+		Vector<GUIElement*> dirtyElements;
+		Vector<GUIElement*> removedElements;
+
 		for(auto& cachedMeshData : mCachedGUIData)
 		{
 			GUIRenderData& renderData = cachedMeshData.second;
 
-			// Check if anything is dirty. If nothing is we can skip the update
-			bool isDirty = renderData.isDirty;
+			// If widgets were added or removed we rebuild all the render data from scratch
+			bool rebuildAll = renderData.isDirty;
 			renderData.isDirty = false;
 
-			for(auto& widget : renderData.widgets)
+			if(rebuildAll)
 			{
-				if (widget->isDirty(true))
-				{
-					isDirty = true;
-				}
-			}
+				for (auto& group : renderData.groups)
+					group.isDirty = true;
 
-			if(!isDirty)
-				continue;
+				renderData.sortedElements.clear();
+				renderData.elementInfos.clear();
+			}
 
-			mCoreDirty = true;
+			bool isDirty = rebuildAll;
+			bool needsRegroup = rebuildAll;
 
 			bs_frame_mark();
 			{
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto elemComp = [](const GUIGroupElement& a, const GUIGroupElement& b)
-				{
-					UINT32 aDepth = a.element->_getRenderElementDepth(a.renderElement);
-					UINT32 bDepth = b.element->_getRenderElementDepth(b.renderElement);
-
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-					return (aDepth > bDepth) || 
-						(aDepth == bDepth && a.element > b.element) || 
-						(aDepth == bDepth && a.element == b.element && a.renderElement > b.renderElement); 
-				};
-
-				FrameSet<GUIGroupElement, std::function<bool(const GUIGroupElement&, const GUIGroupElement&)>> allElements(elemComp);
+				// Find elements that changed since the last update
+				FrameVector<GUIElement*> meshDirtyElements;
+				FrameVector<GUIElement*> movedElements;
 
 				for (auto& widget : renderData.widgets)
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
+					dirtyElements.clear();
+					removedElements.clear();
+
+					bool widgetIsDirty = widget->_cleanDirty(dirtyElements, removedElements);
+					if (widgetIsDirty || dirtyElements.size() > 0 || removedElements.size() > 0)
+						isDirty = true;
 
-					for (auto& element : elements)
+					if (!rebuildAll)
 					{
-						if (!element->_isVisible())
-							continue;
+						for (auto& element : removedElements)
+							needsRegroup |= removeElement(renderData, widget, element);
+					}
 
-						UINT32 numRenderElems = element->_getNumRenderElements();
-						for (UINT32 i = 0; i < numRenderElems; i++)
-						{
-							allElements.insert(GUIGroupElement(element, i));
-						}
+					meshDirtyElements.insert(meshDirtyElements.end(), dirtyElements.begin(), dirtyElements.end());
+
+					if (widgetIsDirty || rebuildAll)
+					{
+						const Vector<GUIElement*>& elements = widget->getElements();
+						movedElements.insert(movedElements.end(), elements.begin(), elements.end());
 					}
 				}
 
-				// Group the elements in such a way so that we end up with a smallest amount of
-				// meshes, without breaking back to front rendering order
-				FrameUnorderedMap<std::reference_wrapper<const SpriteMaterialInfo>, FrameVector<GUIMaterialGroup>> materialGroups;
-				for (auto& elem : allElements)
+				if (isDirty)
 				{
-					GUIElement* guiElem = elem.element;
-					UINT32 renderElemIdx = elem.renderElement;
-					UINT32 elemDepth = guiElem->_getRenderElementDepth(renderElemIdx);
-
-					Rect2I tfrmedBounds = guiElem->_getClippedBounds();
-					tfrmedBounds.transform(guiElem->_getParentWidget()->getWorldTfrm());
-
-					const SpriteMaterialInfo& matInfo = guiElem->_getMaterial(renderElemIdx);
-					FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[std::cref(matInfo)];
-					
-					// Try to find a group this material will fit in:
-					//  - Group that has a depth value same or one below elements depth will always be a match
-					//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
-					//    overlap the current elements bounds.
-					GUIMaterialGroup* foundGroup = nullptr;
-
-					for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+					mCoreDirty = true;
+
+					for (auto& element : meshDirtyElements)
+						needsRegroup |= refreshElement(renderData, element, true);
+
+					for (auto& element : movedElements)
+						needsRegroup |= refreshElement(renderData, element, false);
+
+					// Only redo the grouping if depth, bounds or materials changed, otherwise just rebuild meshes of groups
+					// containing dirty elements
+					if (needsRegroup)
+						regroupElements(renderData);
+
+					for (auto& group : renderData.groups)
 					{
-						// If we separate meshes by widget, ignore any groups with widget parents other than mine
-						if (mSeparateMeshesByWidget)
-						{
-							if (groupIter->elements.size() > 0)
-							{
-								GUIElement* otherElem = groupIter->elements.begin()->element; // We only need to check the first element
-								if (otherElem->_getParentWidget() != guiElem->_getParentWidget())
-									continue;
-							}
-						}
+						if (group.isDirty)
+							buildGroupMesh(group);
+					}
 
-						GUIMaterialGroup& group = *groupIter;
+					buildViewportMesh(renderData);
+				}
+			}
+			bs_frame_clear();
+		}
+	}
 
-						if (group.depth == elemDepth)
-						{
-							foundGroup = &group;
-							break;
-						}
-						else
-						{
-							UINT32 startDepth = elemDepth;
-							UINT32 endDepth = group.depth;
+	bool GUIManager::refreshElement(GUIRenderData& renderData, GUIElement* element, bool meshDirty)
+	{
+		GUIElementRenderInfo newInfo;
+		newInfo.widget = element->_getParentWidget();
+
+		if (newInfo.widget != nullptr && element->_isVisible())
+		{
+			newInfo.bounds = element->_getClippedBounds();
+			newInfo.bounds.transform(newInfo.widget->getWorldTfrm());
+
+			UINT32 numRenderElems = element->_getNumRenderElements();
+			newInfo.renderElements.resize(numRenderElems);
+
+			for (UINT32 i = 0; i < numRenderElems; i++)
+			{
+				GUIRenderElementInfo& renderElemInfo = newInfo.renderElements[i];
+				renderElemInfo.matInfo = element->_getMaterial(i);
+				renderElemInfo.depth = element->_getRenderElementDepth(i);
+				renderElemInfo.groupIdx = (UINT32)-1;
+			}
+		}
+
+		bool needsRegroup;
+		auto iterFind = renderData.elementInfos.find(element);
+		if (iterFind != renderData.elementInfos.end())
+		{
+			GUIElementRenderInfo& oldInfo = iterFind->second;
+			UINT32 numOldRenderElems = (UINT32)oldInfo.renderElements.size();
+
+			needsRegroup = oldInfo.widget != newInfo.widget || oldInfo.bounds != newInfo.bounds ||
+				numOldRenderElems != (UINT32)newInfo.renderElements.size();
+
+			for (UINT32 i = 0; i < numOldRenderElems && !needsRegroup; i++)
+			{
+				const GUIRenderElementInfo& oldRenderElemInfo = oldInfo.renderElements[i];
+				const GUIRenderElementInfo& newRenderElemInfo = newInfo.renderElements[i];
+
+				if (oldRenderElemInfo.depth != newRenderElemInfo.depth || oldRenderElemInfo.matInfo != newRenderElemInfo.matInfo)
+					needsRegroup = true;
+			}
+
+			for (UINT32 i = 0; i < numOldRenderElems; i++)
+			{
+				const GUIRenderElementInfo& oldRenderElemInfo = oldInfo.renderElements[i];
+
+				// If the grouping doesn't change the element stays in the same group
+				if (!needsRegroup)
+					newInfo.renderElements[i].groupIdx = oldRenderElemInfo.groupIdx;
+
+				if (meshDirty && oldRenderElemInfo.groupIdx < (UINT32)renderData.groups.size())
+					renderData.groups[oldRenderElemInfo.groupIdx].isDirty = true;
+
+				renderData.sortedElements.erase(GUIGroupElement(element, i, oldRenderElemInfo.depth));
+			}
+
+			renderData.elementInfos.erase(iterFind);
+		}
+		else
+			needsRegroup = newInfo.renderElements.size() > 0;
+
+		UINT32 numRenderElems = (UINT32)newInfo.renderElements.size();
+		if (numRenderElems > 0)
+		{
+			for (UINT32 i = 0; i < numRenderElems; i++)
+				renderData.sortedElements.insert(GUIGroupElement(element, i, newInfo.renderElements[i].depth));
+
+			renderData.elementInfos[element] = std::move(newInfo);
+		}
+
+		return needsRegroup;
+	}
+
+	bool GUIManager::removeElement(GUIRenderData& renderData, GUIWidget* widget, GUIElement* element)
+	{
+		auto iterFind = renderData.elementInfos.find(element);
+		if (iterFind == renderData.elementInfos.end())
+			return false;
+
+		// Element might have already been moved to another widget on this viewport
+		GUIElementRenderInfo& info = iterFind->second;
+		if (info.widget != widget)
+			return false;
+
+		for (UINT32 i = 0; i < (UINT32)info.renderElements.size(); i++)
+		{
+			const GUIRenderElementInfo& renderElemInfo = info.renderElements[i];
+
+			// Mark the group dirty so its mesh doesn't get reused, in case a new element gets allocated at the same address
+			if (renderElemInfo.groupIdx < (UINT32)renderData.groups.size())
+				renderData.groups[renderElemInfo.groupIdx].isDirty = true;
+
+			renderData.sortedElements.erase(GUIGroupElement(element, i, renderElemInfo.depth));
+		}
+
+		renderData.elementInfos.erase(iterFind);
+		return true;
+	}
+
+	void GUIManager::regroupElements(GUIRenderData& renderData)
+	{
+		// Group the elements in such a way so that we end up with a smallest amount of
+		// meshes, without breaking back to front rendering order
+		FrameUnorderedMap<std::reference_wrapper<const SpriteMaterialInfo>, FrameVector<GUIMaterialGroup>> materialGroups;
+		for (auto& elem : renderData.sortedElements)
+		{
+			GUIElement* guiElem = elem.element;
+			UINT32 renderElemIdx = elem.renderElement;
+			UINT32 elemDepth = elem.depth;
+
+			const GUIElementRenderInfo& elemInfo = renderData.elementInfos[guiElem];
+			const Rect2I& tfrmedBounds = elemInfo.bounds;
+
+			const SpriteMaterialInfo& matInfo = elemInfo.renderElements[renderElemIdx].matInfo;
+			FrameVector<GUIMaterialGroup>& groupsPerMaterial = materialGroups[std::cref(matInfo)];
+			
+			// Try to find a group this material will fit in:
+			//  - Group that has a depth value same or one below elements depth will always be a match
+			//  - Otherwise, we search higher depth values as well, but we only use them if no elements in between those depth values
+			//    overlap the current elements bounds.
+			GUIMaterialGroup* foundGroup = nullptr;
+
+			for (auto groupIter = groupsPerMaterial.rbegin(); groupIter != groupsPerMaterial.rend(); ++groupIter)
+			{
+				// If we separate meshes by widget, ignore any groups with widget parents other than mine
+				if (mSeparateMeshesByWidget)
+				{
+					if (groupIter->widget != elemInfo.widget)
+						continue;
+				}
 
-							Rect2I potentialGroupBounds = group.bounds;
-							potentialGroupBounds.encapsulate(tfrmedBounds);
+				GUIMaterialGroup& group = *groupIter;
 
-							bool foundOverlap = false;
-							for (auto& material : materialGroups)
+				if (group.depth == elemDepth)
+				{
+					foundGroup = &group;
+					break;
+				}
+				else
+				{
+					UINT32 startDepth = elemDepth;
+					UINT32 endDepth = group.depth;
+
+					Rect2I potentialGroupBounds = group.bounds;
+					potentialGroupBounds.encapsulate(tfrmedBounds);
+
+					bool foundOverlap = false;
+					for (auto& material : materialGroups)
+					{
+						for (auto& matGroup : material.second)
+						{
+							if (&matGroup == &group)
+								continue;
+
+							if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
+								|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
 							{
-								for (auto& matGroup : material.second)
+								if (matGroup.bounds.overlaps(potentialGroupBounds))
 								{
-									if (&matGroup == &group)
-										continue;
-
-									if ((matGroup.minDepth >= startDepth && matGroup.minDepth <= endDepth)
-										|| (matGroup.depth >= startDepth && matGroup.depth <= endDepth))
-									{
-										if (matGroup.bounds.overlaps(potentialGroupBounds))
-										{
-											foundOverlap = true;
-											break;
-										}
-									}
+									foundOverlap = true;
+									break;
 								}
 							}
-
-							if (!foundOverlap)
-							{
-								foundGroup = &group;
-								break;
-							}
 						}
 					}
 
-					if (foundGroup == nullptr)
-					{
-						groupsPerMaterial.push_back(GUIMaterialGroup());
-						foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
-
-						foundGroup->depth = elemDepth;
-						foundGroup->minDepth = elemDepth;
-						foundGroup->bounds = tfrmedBounds;
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->matInfo = matInfo;
-						foundGroup->numQuads = guiElem->_getNumQuads(renderElemIdx);
-					}
-					else
+					if (!foundOverlap)
 					{
-						foundGroup->bounds.encapsulate(tfrmedBounds);
-						foundGroup->elements.push_back(GUIGroupElement(guiElem, renderElemIdx));
-						foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
-						foundGroup->numQuads += guiElem->_getNumQuads(renderElemIdx);
+						foundGroup = &group;
+						break;
 					}
 				}
+			}
 
-				// Make a list of all GUI elements, sorted from farthest to nearest (highest depth to lowest)
-				auto groupComp = [](GUIMaterialGroup* a, GUIMaterialGroup* b)
-				{
-					return (a->depth > b->depth) || (a->depth == b->depth && a > b);
-					// Compare pointers just to differentiate between two elements with the same depth, their order doesn't really matter, but std::set
-					// requires all elements to be unique
-				};
+			if (foundGroup == nullptr)
+			{
+				groupsPerMaterial.push_back(GUIMaterialGroup());
+				foundGroup = &groupsPerMaterial[groupsPerMaterial.size() - 1];
+
+				foundGroup->depth = elemDepth;
+				foundGroup->minDepth = elemDepth;
+				foundGroup->bounds = tfrmedBounds;
+				foundGroup->elements.push_back(elem);
+				foundGroup->matInfo = matInfo;
+				foundGroup->widget = elemInfo.widget;
+			}
+			else
+			{
+				foundGroup->bounds.encapsulate(tfrmedBounds);
+				foundGroup->elements.push_back(elem);
+				foundGroup->minDepth = std::min(foundGroup->minDepth, elemDepth);
+			}
+		}
 
-				FrameSet<GUIMaterialGroup*, std::function<bool(GUIMaterialGroup*, GUIMaterialGroup*)>> sortedGroups(groupComp);
-				for(auto& material : materialGroups)
+		// Sort the groups from farthest to nearest (highest depth to lowest)
+		FrameVector<GUIMaterialGroup*> sortedGroups;
+		for(auto& material : materialGroups)
+		{
+			for(auto& group : material.second)
+				sortedGroups.push_back(&group);
+		}
+
+		std::sort(sortedGroups.begin(), sortedGroups.end(), 
+			[](GUIMaterialGroup* a, GUIMaterialGroup* b)
+		{
+			return (a->depth > b->depth) || (a->depth == b->depth && a > b);
+		});
+
+		Vector<GUIMaterialGroup> newGroups;
+		newGroups.reserve(sortedGroups.size());
+
+		for(auto& group : sortedGroups)
+		{
+			newGroups.push_back(std::move(*group));
+			GUIMaterialGroup& newGroup = newGroups.back();
+
+			// If the old group containing the first element has exactly the same contents, keep using its mesh
+			const GUIGroupElement& firstElem = newGroup.elements[0];
+			UINT32 oldGroupIdx = renderData.elementInfos[firstElem.element].renderElements[firstElem.renderElement].groupIdx;
+
+			if (oldGroupIdx >= (UINT32)renderData.groups.size())
+				continue;
+
+			GUIMaterialGroup& oldGroup = renderData.groups[oldGroupIdx];
+			if (oldGroup.isDirty || oldGroup.meshData == nullptr || oldGroup.matInfo != newGroup.matInfo)
+				continue;
+
+			if (oldGroup.elements.size() != newGroup.elements.size())
+				continue;
+
+			bool isSame = true;
+			for (UINT32 i = 0; i < (UINT32)newGroup.elements.size(); i++)
+			{
+				const GUIGroupElement& oldElem = oldGroup.elements[i];
+				const GUIGroupElement& newElem = newGroup.elements[i];
+
+				if (oldElem.element != newElem.element || oldElem.renderElement != newElem.renderElement)
 				{
-					for(auto& group : material.second)
-					{
-						sortedGroups.insert(&group);
-					}
+					isSame = false;
+					break;
 				}
+			}
 
-				UINT32 numMeshes = (UINT32)sortedGroups.size();
-				UINT32 oldNumMeshes = (UINT32)renderData.cachedMeshes.size();
+			if (!isSame)
+				continue;
 
-				if(numMeshes < oldNumMeshes)
-				{
-					for (UINT32 i = numMeshes; i < oldNumMeshes; i++)
-						mMeshHeap->dealloc(renderData.cachedMeshes[i]);
+			newGroup.meshData = oldGroup.meshData;
+			newGroup.numQuads = oldGroup.numQuads;
+			newGroup.isDirty = false;
+		}
 
-					renderData.cachedMeshes.resize(numMeshes);
-				}
+		renderData.groups = std::move(newGroups);
 
-				renderData.cachedMaterials.resize(numMeshes);
+		for (UINT32 i = 0; i < (UINT32)renderData.groups.size(); i++)
+		{
+			for (auto& elem : renderData.groups[i].elements)
+				renderData.elementInfos[elem.element].renderElements[elem.renderElement].groupIdx = i;
+		}
+	}
 
-				if(mSeparateMeshesByWidget)
-					renderData.cachedWidgetsPerMesh.resize(numMeshes);
+	void GUIManager::buildGroupMesh(GUIMaterialGroup& group)
+	{
+		group.numQuads = 0;
+		for (auto& matElement : group.elements)
+			group.numQuads += matElement.element->_getNumQuads(matElement.renderElement);
 
-				// Fill buffers for each group and update their meshes
-				UINT32 groupIdx = 0;
-				for(auto& group : sortedGroups)
-				{
-					renderData.cachedMaterials[groupIdx] = group->matInfo;
+		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(group.numQuads * 4, group.numQuads * 6, mVertexDesc);
 
-					if(mSeparateMeshesByWidget)
-					{
-						if(group->elements.size() == 0)
-							renderData.cachedWidgetsPerMesh[groupIdx] = nullptr;
-						else
-						{
-							GUIElement* elem = group->elements.begin()->element;
-							renderData.cachedWidgetsPerMesh[groupIdx] = elem->_getParentWidget();
-						}
-					}
+		UINT8* vertices = meshData->getElementData(VES_POSITION);
+		UINT8* uvs = meshData->getElementData(VES_TEXCOORD);
+		UINT32* indices = meshData->getIndices32();
+		UINT32 vertexStride = meshData->getVertexDesc()->getVertexStride();
+		UINT32 indexStride = meshData->getIndexElementSize();
 
-					SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(group->numQuads * 4, group->numQuads * 6, mVertexDesc);
+		UINT32 quadOffset = 0;
+		for(auto& matElement : group.elements)
+		{
+			matElement.element->_fillBuffer(vertices, uvs, indices, quadOffset, group.numQuads, vertexStride, indexStride, matElement.renderElement);
 
-					UINT8* vertices = meshData->getElementData(VES_POSITION);
-					UINT8* uvs = meshData->getElementData(VES_TEXCOORD);
-					UINT32* indices = meshData->getIndices32();
-					UINT32 vertexStride = meshData->getVertexDesc()->getVertexStride();
-					UINT32 indexStride = meshData->getIndexElementSize();
+			UINT32 numQuads = matElement.element->_getNumQuads(matElement.renderElement);
+			UINT32 indexStart = quadOffset * 6;
+			UINT32 indexEnd = indexStart + numQuads * 6;
+			UINT32 vertOffset = quadOffset * 4;
 
-					UINT32 quadOffset = 0;
-					for(auto& matElement : group->elements)
-					{
-						matElement.element->_fillBuffer(vertices, uvs, indices, quadOffset, group->numQuads, vertexStride, indexStride, matElement.renderElement);
+			for(UINT32 i = indexStart; i < indexEnd; i++)
+				indices[i] += vertOffset;
 
-						UINT32 numQuads = matElement.element->_getNumQuads(matElement.renderElement);
-						UINT32 indexStart = quadOffset * 6;
-						UINT32 indexEnd = indexStart + numQuads * 6;
-						UINT32 vertOffset = quadOffset * 4;
+			quadOffset += numQuads;
+		}
 
-						for(UINT32 i = indexStart; i < indexEnd; i++)
-							indices[i] += vertOffset;
+		group.meshData = meshData;
+		group.isDirty = false;
+	}
 
-						quadOffset += numQuads;
-					}
+	void GUIManager::buildViewportMesh(GUIRenderData& renderData)
+	{
+		if (renderData.mesh != nullptr)
+		{
+			mMeshHeap->dealloc(renderData.mesh);
+			renderData.mesh = nullptr;
+		}
 
-					if(groupIdx < (UINT32)renderData.cachedMeshes.size())
-					{
-						mMeshHeap->dealloc(renderData.cachedMeshes[groupIdx]);
-						renderData.cachedMeshes[groupIdx] = mMeshHeap->alloc(meshData);
-					}
-					else
-					{
-						renderData.cachedMeshes.push_back(mMeshHeap->alloc(meshData));
-					}
+		UINT32 totalNumQuads = 0;
+		for (auto& group : renderData.groups)
+		{
+			group.quadOffset = totalNumQuads;
+			totalNumQuads += group.numQuads;
+		}
 
-					groupIdx++;
-				}
-			}
+		if (totalNumQuads == 0)
+			return;
+
+		SPtr<MeshData> meshData = bs_shared_ptr_new<MeshData>(totalNumQuads * 4, totalNumQuads * 6, mVertexDesc);
+
+		UINT8* vertices = meshData->getStreamData(0);
+		UINT32* indices = meshData->getIndices32();
+		UINT32 vertexStride = meshData->getVertexDesc()->getVertexStride();
+
+		for (auto& group : renderData.groups)
+		{
+			if (group.numQuads == 0)
+				continue;
 
-			bs_frame_clear();			
+			UINT32 vertOffset = group.quadOffset * 4;
+			UINT32 indexOffset = group.quadOffset * 6;
+			UINT32 numIndices = group.numQuads * 6;
+
+			memcpy(vertices + vertOffset * vertexStride, group.meshData->getStreamData(0), group.numQuads * 4 * vertexStride);
+
+			UINT32* srcIndices = group.meshData->getIndices32();
+			for (UINT32 i = 0; i < numIndices; i++)
+				indices[indexOffset + i] = srcIndices[i] + vertOffset;
 		}
+
+		renderData.mesh = mMeshHeap->alloc(meshData);
 	}
 
 	void GUIManager::updateCaretTexture()
@@ -1198,7 +1339,11 @@ namespace BansheeEngine
 
 	bool GUIManager::findElementUnderPointer(const Vector2I& pointerScreenPos, bool buttonStates[3], bool shift, bool control, bool alt)
 	{
-		Vector<const RenderWindow*> widgetWindows;
+		bs_frame_mark();
+
+		FrameVector<const RenderWindow*> widgetWindows;
+		widgetWindows.reserve(mWidgets.size());
+
 		for(auto& widgetInfo : mWidgets)
 			widgetWindows.push_back(getWidgetWindow(*widgetInfo.widget));
 
@@ -1222,24 +1367,25 @@ namespace BansheeEngine
 
 		mNewElementsUnderPointer.clear();
 
+		// Usually there are only a handful of windows so a linear search for already checked ones is fine
 		const RenderWindow* windowUnderPointer = nullptr;
-		UnorderedSet<const RenderWindow*> uniqueWindows;
+		FrameVector<const RenderWindow*> checkedWindows;
 
 		for(auto& window : widgetWindows)
 		{
 			if(window == nullptr)
 				continue;
 
-			uniqueWindows.insert(window);
-		}
+			if (std::find(checkedWindows.begin(), checkedWindows.end(), window) != checkedWindows.end())
+				continue;
 
-		for(auto& window : uniqueWindows)
-		{
 			if(Platform::isPointOverWindow(*window, pointerScreenPos))
 			{
 				windowUnderPointer = window;
 				break;
 			}
+
+			checkedWindows.push_back(window);
 		}
 
 		if(windowUnderPointer != nullptr)
@@ -1260,14 +1406,13 @@ namespace BansheeEngine
 				if(widgetWindows[widgetIdx] == windowUnderPointer 
 					&& widget->inBounds(windowToBridgedCoords(widget->getTarget()->getTarget(), windowPos)))
 				{
-					const Vector<GUIElement*>& elements = widget->getElements();
 					Vector2I localPos = getWidgetRelativePos(widget, pointerScreenPos);
 
-					// Elements with lowest depth (most to the front) get handled first
-					for(auto iter = elements.begin(); iter != elements.end(); ++iter)
-					{
-						GUIElement* element = *iter;
+					mElementsAtPointer.clear();
+					widget->_findElementsAt(localPos, mElementsAtPointer);
 
+					for(auto& element : mElementsAtPointer)
+					{
 						if(element->_isVisible() && element->_isInBounds(localPos))
 						{
 							ElementInfoUnderPointer elementInfo(element, widget);
@@ -1290,6 +1435,9 @@ namespace BansheeEngine
 			}
 		}
 
+		bs_frame_clear();
+
+		// Elements with lowest depth (most to the front) get handled first
 		std::sort(mNewElementsUnderPointer.begin(), mNewElementsUnderPointer.end(), 
 			[](const ElementInfoUnderPointer& a, const ElementInfoUnderPointer& b)
 		{
@@ -1795,6 +1943,10 @@ namespace BansheeEngine
 
 		float invViewportWidth = 1.0f / (camera->getViewport()->getWidth() * 0.5f);
 		float invViewportHeight = 1.0f / (camera->getViewport()->getHeight() * 0.5f);
+
+		// All entries share the same mesh, so only the material parameters and the drawn index range change between
+		// them. Programs and render states are only re-applied when the material changes.
+		MaterialInfo* lastMatInfo = nullptr;
 		for (auto& entry : renderData)
 		{
 			MaterialInfo& matInfo = entry.materialType == SpriteMaterial::Text ? mTextMaterialInfo :
@@ -1807,11 +1959,15 @@ namespace BansheeEngine
 			matInfo.invViewportHeightParam.set(invViewportHeight);
 			matInfo.worldTransformParam.set(entry.worldTransform);
 
-			// TODO - I shouldn't be re-applying the entire material for each entry, instead just check which programs
-			// changed, and apply only those + the modified constant buffers and/or texture.
+			if (&matInfo != lastMatInfo)
+			{
+				gRendererUtility().setPass(matInfo.material, 0);
+				lastMatInfo = &matInfo;
+			}
+			else
+				gRendererUtility().setPassParams(matInfo.material, 0);
 
-			gRendererUtility().setPass(matInfo.material, 0);
-			gRendererUtility().draw(entry.mesh, entry.mesh->getProperties().getSubMesh(0));
+			gRendererUtility().draw(entry.mesh, entry.subMesh);
 		}
 	}
 
@@ -82,11 +82,9 @@ namespace BansheeEngine
 
 	void GUIPanel::_updateOptimalLayoutSizes()
 	{
-		// Update all children first, otherwise we can't determine our own optimal size
-		GUIElementBase::_updateOptimalLayoutSizes();
-
-		if (mChildren.size() != mChildSizeRanges.size())
-			mChildSizeRanges.resize(mChildren.size());
+		// Our size range depends only on child size ranges, so keep the cached one if none of them changed
+		if (!updateChildSizeRanges())
+			return;
 
 		Vector2I optimalSize;
 		Vector2I minSize;
@@ -94,11 +92,9 @@ namespace BansheeEngine
 		UINT32 childIdx = 0;
 		for (auto& child : mChildren)
 		{
-			LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
-
 			if (child->_isActive())
 			{
-				childSizeRange = _getElementSizeRange(child);
+				const LayoutSizeRange& childSizeRange = mChildSizeRanges[childIdx];
 
 				UINT32 paddingX = child->_getPadding().left + child->_getPadding().right;
 				UINT32 paddingY = child->_getPadding().top + child->_getPadding().bottom;
@@ -116,8 +112,6 @@ namespace BansheeEngine
 				minSize.x = std::max(minSize.x, childMax.x);
 				minSize.y = std::max(minSize.y, childMax.y);
 			}
-			else
-				childSizeRange = LayoutSizeRange();
 
 			childIdx++;
 		}
@@ -222,6 +216,13 @@ namespace BansheeEngine
 
 	void GUIPanel::_updateLayoutInternal(const GUILayoutData& data)
 	{
+		// Child areas can only change if our area or child size ranges changed
+		if (!_isOwnLayoutDirty() && (mFlags & GUIElem_AreaDirty) == 0)
+		{
+			updateDirtyChildLayouts();
+			return;
+		}
+
 		GUILayoutData childData = data;
 		_updateDepthRange(childData);
 
@@ -259,7 +260,10 @@ namespace BansheeEngine
 		childData.clipRect.clip(data.clipRect);
 
 		element->_setLayoutData(childData);
-		element->_updateLayoutInternal(childData);
+
+		// Children that kept their area and have no dirty descendants are already up to date
+		if (element->_isLayoutDirty())
+			element->_updateLayoutInternal(childData);
 	}
 
 	GUIPanel* GUIPanel::create(INT16 depth, UINT16 depthRangeMin, UINT16 depthRangeMax)
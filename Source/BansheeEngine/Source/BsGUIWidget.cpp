@@ -81,6 +81,9 @@ namespace BansheeEngine
 
 		mElements.clear();
 		mDirtyContents.clear();
+		mDirtyMeshes.clear();
+		mRemovedElements.clear();
+		mElementGrid.clear();
 	}
 
 	void GUIWidget::setDepth(UINT8 depth)
@@ -173,16 +176,20 @@ namespace BansheeEngine
 				assert(updateParent != nullptr || currentElem == mPanel);
 
 				if (updateParent != nullptr)
+				{
+					// Make sure the update reaches the dirty element, as only paths to the update parent are flagged
+					currentElem->_markLayoutPathAsDirty(updateParent);
 					_updateLayout(updateParent);
+				}
 				else // Must be root panel
 					_updateLayout(mPanel);
 			}
-			else
-			{
-				UINT32 numChildren = currentElem->_getNumChildren();
-				for (UINT32 i = 0; i < numChildren; i++)
-					todo.push(currentElem->_getChild(i));
-			}
+
+			// Keep searching even below updated elements, as the update only visits paths to elements whose layout
+			// changed, and there might be other dirty elements further down
+			UINT32 numChildren = currentElem->_getNumChildren();
+			for (UINT32 i = 0; i < numChildren; i++)
+				todo.push(currentElem->_getChild(i));
 		}
 
 		bs_frame_clear();
@@ -207,7 +214,10 @@ namespace BansheeEngine
 			GUIPanel* panel = static_cast<GUIPanel*>(updateParent);
 
 			GUIElementBase* dirtyElement = elem;
-			dirtyElement->_updateOptimalLayoutSizes();
+
+			// Updates only the dirty element, but also refreshes the panel's cached size range for it
+			bool panelWasLayoutDirty = panel->_isLayoutDirty();
+			panel->_updateOptimalLayoutSizes();
 
 			LayoutSizeRange elementSizeRange = panel->_getElementSizeRange(dirtyElement);
 			Rect2I elementArea = panel->_getElementArea(panel->_getLayoutData().area, dirtyElement, elementSizeRange);
@@ -217,6 +227,11 @@ namespace BansheeEngine
 			childLayoutData.area = elementArea;
 
 			panel->_updateChildLayout(dirtyElement, childLayoutData);
+
+			// Refreshing the size ranges flags the panel, but the element they changed for was just laid out. Any flags the
+			// panel had before belong to pending updates of its own, so leave those alone.
+			if (!panelWasLayoutDirty)
+				panel->_markLayoutAsClean();
 		}
 		else
 		{
@@ -224,7 +239,7 @@ namespace BansheeEngine
 			updateParent->_updateLayout(childLayoutData);
 		}
 		
-		// Mark dirty contents
+		// Mark dirty contents. Only elements whose layout changed need to be visited, the rest were left as is.
 		bs_frame_mark();
 		{
 			FrameStack<GUIElementBase*> todo;
@@ -235,8 +250,14 @@ namespace BansheeEngine
 				GUIElementBase* currentElem = todo.top();
 				todo.pop();
 
+				if (currentElem != elem && !currentElem->_isLayoutDirty())
+					continue;
+
 				if (currentElem->_getType() == GUIElementBase::Type::Element)
+				{
 					mDirtyContents.insert(static_cast<GUIElement*>(currentElem));
+					mElementGrid.markDirty(static_cast<GUIElement*>(currentElem));
+				}
 
 				currentElem->_markAsClean();
 
@@ -255,7 +276,8 @@ namespace BansheeEngine
 		if (elem->_getType() == GUIElementBase::Type::Element)
 		{
 			mElements.push_back(static_cast<GUIElement*>(elem));
-			mWidgetIsDirty = true;
+			mDirtyMeshes.insert(static_cast<GUIElement*>(elem));
+			mElementGrid.markDirty(static_cast<GUIElement*>(elem));
 		}
 	}
 
@@ -268,22 +290,44 @@ namespace BansheeEngine
 		if (iterFind != mElements.end())
 		{
 			mElements.erase(iterFind);
-			mWidgetIsDirty = true;
+			mRemovedElements.push_back(static_cast<GUIElement*>(elem));
 		}
 
 		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
 			mDirtyContents.erase(static_cast<GUIElement*>(elem));
+			mDirtyMeshes.erase(static_cast<GUIElement*>(elem));
+			mElementGrid.remove(static_cast<GUIElement*>(elem));
+		}
 	}
 
 	void GUIWidget::_markMeshDirty(GUIElementBase* elem)
 	{
-		mWidgetIsDirty = true;
+		// Layouts have no meshes of their own, and we don't know which child elements they affect
+		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
+			mDirtyMeshes.insert(static_cast<GUIElement*>(elem));
+			mElementGrid.markDirty(static_cast<GUIElement*>(elem));
+		}
+		else
+		{
+			mWidgetIsDirty = true;
+			mElementGrid.markDirty(mElements);
+		}
 	}
 
 	void GUIWidget::_markContentDirty(GUIElementBase* elem)
 	{
 		if (elem->_getType() == GUIElementBase::Type::Element)
+		{
 			mDirtyContents.insert(static_cast<GUIElement*>(elem));
+			mElementGrid.markDirty(static_cast<GUIElement*>(elem));
+		}
+	}
+
+	void GUIWidget::_findElementsAt(const Vector2I& position, Vector<GUIElement*>& elements)
+	{
+		mElementGrid.findElements(position, elements);
 	}
 
 	void GUIWidget::setSkin(const HGUISkin& skin)
@@ -339,22 +383,56 @@ namespace BansheeEngine
 		if (!mIsActive)
 			return false;
 
-		bool dirty = mWidgetIsDirty || mDirtyContents.size() > 0;
+		bool dirty = mWidgetIsDirty || mDirtyContents.size() > 0 || mDirtyMeshes.size() > 0 || mRemovedElements.size() > 0;
 
 		if(cleanIfDirty && dirty)
 		{
-			mWidgetIsDirty = false;
+			Vector<GUIElement*> dirtyElements;
+			Vector<GUIElement*> removedElements;
 
-			for (auto& dirtyElement : mDirtyContents)
-				dirtyElement->_updateRenderElements();
-
-			mDirtyContents.clear();
-			updateBounds();
+			_cleanDirty(dirtyElements, removedElements);
 		}
 		
 		return dirty;
 	}
 
+	bool GUIWidget::_cleanDirty(Vector<GUIElement*>& dirtyElements, Vector<GUIElement*>& removedElements)
+	{
+		// Removed elements are always reported, as they might be destroyed before the widget is activated again
+		removedElements.insert(removedElements.end(), mRemovedElements.begin(), mRemovedElements.end());
+
+		if (!mIsActive)
+		{
+			mRemovedElements.clear();
+			return false;
+		}
+
+		bool widgetIsDirty = mWidgetIsDirty;
+		bool dirty = mWidgetIsDirty || mDirtyContents.size() > 0 || mDirtyMeshes.size() > 0 || mRemovedElements.size() > 0;
+
+		for (auto& dirtyElement : mDirtyContents)
+		{
+			dirtyElement->_updateRenderElements();
+			dirtyElements.push_back(dirtyElement);
+		}
+
+		for (auto& dirtyElement : mDirtyMeshes)
+		{
+			if (mDirtyContents.find(dirtyElement) == mDirtyContents.end())
+				dirtyElements.push_back(dirtyElement);
+		}
+
+		mWidgetIsDirty = false;
+		mDirtyContents.clear();
+		mDirtyMeshes.clear();
+		mRemovedElements.clear();
+
+		if (dirty)
+			updateBounds();
+
+		return widgetIsDirty;
+	}
+
 	bool GUIWidget::inBounds(const Vector2I& position) const
 	{
 		Viewport* target = getTarget();
@@ -31,6 +31,7 @@ namespace BansheeEngine
 		SPtr<MaterialCore> material = element->material;
 		SPtr<ShaderCore> shader = material->getShader();
 
+		UINT32 elementIdx = (UINT32)mElements.size();
 		mElements.push_back(element);
 		
 		UINT32 queuePriority = shader->getQueuePriority();
@@ -63,52 +64,30 @@ namespace BansheeEngine
 			SortableElement& sortableElem = mSortableElements.back();
 
 			sortableElem.seqIdx = idx;
+			sortableElem.elementIdx = elementIdx;
 			sortableElem.priority = queuePriority;
 			sortableElem.shaderId = shaderId;
 			sortableElem.passIdx = i;
 			sortableElem.distFromCamera = distFromCamera;
+			sortableElem.material = material.get();
+			sortableElem.mesh = element->mesh.get();
 		}
 	}
 
 	void RenderQueue::sort()
 	{
-		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
-
-		switch (mStateReductionMode)
-		{
-		case StateReduction::None:
-			sortMethod = &elementSorterNoGroup;
-			break;
-		case StateReduction::Material:
-			sortMethod = &elementSorterPreferGroup;
-			break;
-		case StateReduction::Distance:
-			sortMethod = &elementSorterPreferSort;
-			break;
-		}
-
-		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
-		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
+		sortElementIndices();
 
 		UINT32 prevShaderId = (UINT32)-1;
 		UINT32 prevPassIdx = (UINT32)-1;
-		RenderableElement* renderElem = nullptr;
-		INT32 currentElementIdx = -1;
-		UINT32 numPassesInCurrentElement = 0;
-		bool separablePasses = true;
 		for (UINT32 i = 0; i < (UINT32)mSortableElementIdx.size(); i++)
 		{
 			UINT32 idx = mSortableElementIdx[i];
 
-			while (numPassesInCurrentElement == 0)
-			{
-				currentElementIdx++;
-				renderElem = mElements[currentElementIdx];
-				numPassesInCurrentElement = renderElem->material->getNumPasses();
-				separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
-			}
-
 			const SortableElement& elem = mSortableElements[idx];
+			RenderableElement* renderElem = mElements[elem.elementIdx];
+
+			bool separablePasses = renderElem->material->getShader()->getAllowSeparablePasses();
 			if (separablePasses)
 			{
 				mSortedRenderElements.push_back(RenderQueueElement());
@@ -125,12 +104,11 @@ namespace BansheeEngine
 				}
 				else
 					sortedElem.applyPass = false;
-
-				numPassesInCurrentElement--;
 			}
 			else
 			{
-				for (UINT32 j = 0; j < numPassesInCurrentElement; j++)
+				UINT32 numPasses = renderElem->material->getNumPasses();
+				for (UINT32 j = 0; j < numPasses; j++)
 				{
 					mSortedRenderElements.push_back(RenderQueueElement());
 
@@ -142,10 +120,29 @@ namespace BansheeEngine
 					prevShaderId = elem.shaderId;
 					prevPassIdx = j;
 				}
+			}
+		}
+	}
 
-				numPassesInCurrentElement = 0;
-			}			
+	void RenderQueue::sortElementIndices()
+	{
+		std::function<bool(UINT32, UINT32, const Vector<SortableElement>&)> sortMethod;
+
+		switch (mStateReductionMode)
+		{
+		case StateReduction::None:
+			sortMethod = &elementSorterNoGroup;
+			break;
+		case StateReduction::Material:
+			sortMethod = &elementSorterPreferGroup;
+			break;
+		case StateReduction::Distance:
+			sortMethod = &elementSorterPreferSort;
+			break;
 		}
+
+		// Sort only indices since we generate an entirely new data set anyway, it doesn't make sense to move sortable elements
+		std::sort(mSortableElementIdx.begin(), mSortableElementIdx.end(), std::bind(sortMethod, _1, _2, mSortableElements));
 	}
 
 	bool RenderQueue::elementSorterNoGroup(UINT32 aIdx, UINT32 bIdx, const Vector<SortableElement>& lookup)
@@ -169,15 +166,19 @@ namespace BansheeEngine
 		const SortableElement& a = lookup[aIdx];
 		const SortableElement& b = lookup[bIdx];
 		
-		UINT8 isHigher = (a.priority > b.priority) << 4 |
-			(a.shaderId < b.shaderId) << 3 |
-			(a.passIdx < b.passIdx) << 2 |
+		UINT8 isHigher = (a.priority > b.priority) << 6 |
+			(a.shaderId < b.shaderId) << 5 |
+			(a.passIdx < b.passIdx) << 4 |
+			(a.material < b.material) << 3 |
+			(a.mesh < b.mesh) << 2 |
 			(a.distFromCamera < b.distFromCamera) << 1 |
 			(a.seqIdx < b.seqIdx);
 
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.shaderId > b.shaderId) << 3 |
-			(a.passIdx > b.passIdx) << 2 |
+		UINT8 isLower = (a.priority < b.priority) << 6 |
+			(a.shaderId > b.shaderId) << 5 |
+			(a.passIdx > b.passIdx) << 4 |
+			(a.material > b.material) << 3 |
+			(a.mesh > b.mesh) << 2 |
 			(a.distFromCamera > b.distFromCamera) << 1 |
 			(a.seqIdx > b.seqIdx);
 
@@ -189,16 +190,20 @@ namespace BansheeEngine
 		const SortableElement& a = lookup[aIdx];
 		const SortableElement& b = lookup[bIdx];
 
-		UINT8 isHigher = (a.priority > b.priority) << 4 | 
-			(a.distFromCamera < b.distFromCamera) << 3 | 
-			(a.shaderId < b.shaderId) << 2 | 
-			(a.passIdx < b.passIdx) << 1 | 
+		UINT8 isHigher = (a.priority > b.priority) << 6 | 
+			(a.distFromCamera < b.distFromCamera) << 5 | 
+			(a.shaderId < b.shaderId) << 4 | 
+			(a.passIdx < b.passIdx) << 3 | 
+			(a.material < b.material) << 2 |
+			(a.mesh < b.mesh) << 1 |
 			(a.seqIdx < b.seqIdx);
 
-		UINT8 isLower = (a.priority < b.priority) << 4 |
-			(a.distFromCamera > b.distFromCamera) << 3 |
-			(a.shaderId > b.shaderId) << 2 |
-			(a.passIdx > b.passIdx) << 1 |
+		UINT8 isLower = (a.priority < b.priority) << 6 |
+			(a.distFromCamera > b.distFromCamera) << 5 |
+			(a.shaderId > b.shaderId) << 4 |
+			(a.passIdx > b.passIdx) << 3 |
+			(a.material > b.material) << 2 |
+			(a.mesh > b.mesh) << 1 |
 			(a.seqIdx > b.seqIdx);
 
 		return isHigher > isLower;
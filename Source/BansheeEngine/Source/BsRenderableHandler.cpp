@@ -4,6 +4,7 @@
 #include "BsGpuParams.h"
 #include "BsMaterial.h"
 #include "BsRenderableElement.h"
+#include "BsRenderCommandBuffer.h"
 
 namespace BansheeEngine
 {
@@ -15,4 +16,14 @@ namespace BansheeEngine
 			passParams->getParamByIdx(rendererBuffer.paramsIdx)->setParamBlockBuffer(rendererBuffer.slotIdx, rendererBuffer.buffer);
 		}
 	}
+
+	void RenderableHandler::bindGlobalBuffers(RenderCommandBuffer& commands, const RenderableElement& element)
+	{
+		for (auto& rendererBuffer : element.rendererBuffers)
+		{
+			SPtr<PassParametersCore> passParams = element.material->getPassParameters(rendererBuffer.passIdx);
+			commands.setParamBlockBuffer(passParams->getParamByIdx(rendererBuffer.paramsIdx), rendererBuffer.slotIdx, 
+				rendererBuffer.buffer);
+		}
+	}
 }
\ No newline at end of file
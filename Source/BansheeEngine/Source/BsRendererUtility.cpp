@@ -14,6 +14,7 @@
 #include "BsShapeMeshes3D.h"
 #include "BsLight.h"
 #include "BsShader.h"
+#include "BsRenderCommandBuffer.h"
 
 namespace BansheeEngine
 {
@@ -270,9 +271,13 @@ namespace BansheeEngine
 		}
 	}
 
-	void RendererUtility::draw(const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
+	/** 
+	 * Binds the mesh buffers and issues a draw call for the specified sub-mesh on the provided target, which may either be
+	 * a RenderAPICore or a RenderCommandBuffer.
+	 */
+	template<class T>
+	static void drawMesh(T& rs, const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
 	{
-		RenderAPICore& rs = RenderAPICore::instance();
 		SPtr<VertexData> vertexData = mesh->getVertexData();
 
 		rs.setVertexDeclaration(vertexData->vertexDeclaration);
@@ -310,10 +315,23 @@ namespace BansheeEngine
 		rs.setIndexBuffer(indexBuffer);
 		rs.drawIndexed(subMesh.indexOffset + mesh->getIndexOffset(), indexCount, mesh->getVertexOffset(), 
 			vertexData->vertexCount, numInstances);
+	}
+
+	void RendererUtility::draw(const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh, UINT32 numInstances)
+	{
+		drawMesh(RenderAPICore::instance(), mesh, subMesh, numInstances);
 
 		mesh->_notifyUsedOnGPU();
 	}
 
+	void RendererUtility::draw(RenderCommandBuffer& commands, const SPtr<MeshCoreBase>& mesh, const SubMesh& subMesh,
+		UINT32 numInstances)
+	{
+		drawMesh(commands, mesh, subMesh, numInstances);
+
+		commands.notifyMeshUsed(mesh);
+	}
+
 	void RendererUtility::blit(const SPtr<TextureCore>& texture, const Rect2I& area)
 	{
 		auto& texProps = texture->getProperties();
@@ -4,8 +4,105 @@
 #include "BsVector2.h"
 #include "BsTexture.h"
 
+#if BS_SSE2
+#include <emmintrin.h>
+#endif
+
 namespace BansheeEngine
 {
+#if BS_SSE2
+	/** Number of quads processed at once by clipQuadsSIMD(). */
+	static const UINT32 SIMD_QUAD_BATCH = 4;
+
+	/**
+	 * Copies four quads into the output buffers, clipping them to the provided rectangle and offsetting their positions.
+	 * Clip calculations are done on all four quads at once in SoA form, after which the results are interleaved into the
+	 * (strided) output buffers. Produces the same results as clipToRect(), except degenerate (zero width or height) 
+	 * quads have their UVs left unchanged instead of becoming NaN.
+	 */
+	static void clipQuadsSIMD(const Vector2* srcVerts, const Vector2* srcUVs, UINT8* vertDst, UINT8* uvDst,
+		UINT32 vertStride, __m128 left, __m128 right, __m128 top, __m128 bottom, const Vector2& offset)
+	{
+		// Quad vertices are ordered: top left, top right, bottom left, bottom right
+		const Vector2* v = srcVerts;
+		const Vector2* t = srcUVs;
+
+		__m128 ax = _mm_setr_ps(v[0].x, v[4].x, v[8].x, v[12].x);
+		__m128 ay = _mm_setr_ps(v[0].y, v[4].y, v[8].y, v[12].y);
+		__m128 bx = _mm_setr_ps(v[1].x, v[5].x, v[9].x, v[13].x);
+		__m128 cy = _mm_setr_ps(v[2].y, v[6].y, v[10].y, v[14].y);
+
+		__m128 uax = _mm_setr_ps(t[0].x, t[4].x, t[8].x, t[12].x);
+		__m128 uay = _mm_setr_ps(t[0].y, t[4].y, t[8].y, t[12].y);
+		__m128 ubx = _mm_setr_ps(t[1].x, t[5].x, t[9].x, t[13].x);
+		__m128 ucy = _mm_setr_ps(t[2].y, t[6].y, t[10].y, t[14].y);
+
+		__m128 zero = _mm_setzero_ps();
+
+		__m128 width = _mm_sub_ps(bx, ax);
+		__m128 height = _mm_sub_ps(cy, ay);
+
+		__m128 du = _mm_and_ps(_mm_cmpneq_ps(width, zero), _mm_div_ps(_mm_sub_ps(ubx, uax), width));
+		__m128 dv = _mm_and_ps(_mm_cmpneq_ps(height, zero), _mm_div_ps(_mm_sub_ps(ucy, uay), height));
+
+		__m128 newLeft = _mm_min_ps(_mm_max_ps(ax, left), right);
+		__m128 newRight = _mm_min_ps(_mm_max_ps(bx, left), right);
+		__m128 newTop = _mm_min_ps(_mm_max_ps(ay, top), bottom);
+		__m128 newBottom = _mm_min_ps(_mm_max_ps(cy, top), bottom);
+
+		__m128 uvLeftOffset = _mm_mul_ps(_mm_sub_ps(newLeft, ax), du);
+		__m128 uvRightOffset = _mm_mul_ps(_mm_sub_ps(bx, newRight), du);
+		__m128 uvTopOffset = _mm_mul_ps(_mm_sub_ps(newTop, ay), dv);
+		__m128 uvBottomOffset = _mm_mul_ps(_mm_sub_ps(cy, newBottom), dv);
+
+		__m128 offsetX = _mm_set1_ps(offset.x);
+		__m128 offsetY = _mm_set1_ps(offset.y);
+
+		newLeft = _mm_add_ps(newLeft, offsetX);
+		newRight = _mm_add_ps(newRight, offsetX);
+		newTop = _mm_add_ps(newTop, offsetY);
+		newBottom = _mm_add_ps(newBottom, offsetY);
+
+		float outLeft[4], outRight[4], outTop[4], outBottom[4];
+		float outUVLeft[4], outUVRight[4], outUVTop[4], outUVBottom[4];
+
+		_mm_storeu_ps(outLeft, newLeft);
+		_mm_storeu_ps(outRight, newRight);
+		_mm_storeu_ps(outTop, newTop);
+		_mm_storeu_ps(outBottom, newBottom);
+		_mm_storeu_ps(outUVLeft, uvLeftOffset);
+		_mm_storeu_ps(outUVRight, uvRightOffset);
+		_mm_storeu_ps(outUVTop, uvTopOffset);
+		_mm_storeu_ps(outUVBottom, uvBottomOffset);
+
+		// Interleave into the output vertex layout
+		for (UINT32 i = 0; i < SIMD_QUAD_BATCH; i++)
+		{
+			const Vector2* uv = &srcUVs[i * 4];
+
+			*(Vector2*)(vertDst) = Vector2(outLeft[i], outTop[i]);
+			*(Vector2*)(uvDst) = Vector2(uv[0].x + outUVLeft[i], uv[0].y + outUVTop[i]);
+			vertDst += vertStride;
+			uvDst += vertStride;
+
+			*(Vector2*)(vertDst) = Vector2(outRight[i], outTop[i]);
+			*(Vector2*)(uvDst) = Vector2(uv[1].x - outUVRight[i], uv[1].y + outUVTop[i]);
+			vertDst += vertStride;
+			uvDst += vertStride;
+
+			*(Vector2*)(vertDst) = Vector2(outLeft[i], outBottom[i]);
+			*(Vector2*)(uvDst) = Vector2(uv[2].x + outUVLeft[i], uv[2].y - outUVBottom[i]);
+			vertDst += vertStride;
+			uvDst += vertStride;
+
+			*(Vector2*)(vertDst) = Vector2(outRight[i], outBottom[i]);
+			*(Vector2*)(uvDst) = Vector2(uv[3].x - outUVRight[i], uv[3].y - outUVBottom[i]);
+			vertDst += vertStride;
+			uvDst += vertStride;
+		}
+	}
+#endif
+
 	Sprite::Sprite()
 	{ }
 
@@ -60,11 +157,41 @@ namespace BansheeEngine
 		UINT8* vertDst = vertices + startVert * vertexStride;
 		UINT8* uvDst = uv + startVert * vertexStride;
 
-		// TODO - I'm sure this can be done in a more cache friendly way. Profile it later.
 		Vector2 vecOffset((float)offset.x, (float)offset.y);
 		if(clip)
 		{
-			for(UINT32 i = 0; i < renderElem.numQuads; i++)
+			UINT32 i = 0;
+
+#if BS_SSE2
+			float left = (float)clipRect.x;
+			float right = (float)clipRect.x + clipRect.width;
+			float top = (float)clipRect.y;
+			float bottom = (float)clipRect.y + clipRect.height;
+
+			if (right < left)
+				std::swap(left, right);
+
+			if (bottom < top)
+				std::swap(bottom, top);
+
+			__m128 leftV = _mm_set1_ps(left);
+			__m128 rightV = _mm_set1_ps(right);
+			__m128 topV = _mm_set1_ps(top);
+			__m128 bottomV = _mm_set1_ps(bottom);
+
+			for(; (i + SIMD_QUAD_BATCH) <= renderElem.numQuads; i += SIMD_QUAD_BATCH)
+			{
+				UINT32 vertIdx = i * 4;
+				clipQuadsSIMD(&renderElem.vertices[vertIdx], &renderElem.uvs[vertIdx], vertDst, uvDst, vertexStride,
+					leftV, rightV, topV, bottomV, vecOffset);
+
+				vertDst += vertexStride * 4 * SIMD_QUAD_BATCH;
+				uvDst += vertexStride * 4 * SIMD_QUAD_BATCH;
+			}
+#endif
+
+			// Remaining quads
+			for(; i < renderElem.numQuads; i++)
 			{
 				UINT8* vecStart = vertDst;
 				UINT8* uvStart = uvDst;
@@ -263,6 +390,8 @@ namespace BansheeEngine
 			if(vecA->x >= left && vecB->x <= right &&
 				vecA->y >= top && vecC->y <= bottom)
 			{
+				vertices += vertStride * 4;
+				uv += vertStride * 4;
 				continue;
 			}
 
@@ -0,0 +1,163 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsTextLayoutCache.h"
+#include "BsFont.h"
+#include "BsResources.h"
+
+using namespace std::placeholders;
+
+namespace BansheeEngine
+{
+	TextLayoutCache::Key::Key(const TEXT_SPRITE_DESC& desc)
+		: text(desc.text), fontUUID(desc.font.getUUID()), fontSize(desc.fontSize), width(desc.width), height(desc.height), hash(0)
+	{
+		// Width and height only matter for wrapping and alignment, but keep them in the key regardless as most labels
+		// are laid out within the same bounds every frame
+		flags = (desc.wordWrap ? 1 : 0) | (desc.wordBreak ? 2 : 0) | ((UINT32)desc.horzAlign << 2) |
+			((UINT32)desc.vertAlign << 4) | ((UINT32)desc.anchor << 6);
+
+		hash_combine(hash, text);
+		hash_combine(hash, fontUUID);
+		hash_combine(hash, fontSize);
+		hash_combine(hash, width);
+		hash_combine(hash, height);
+		hash_combine(hash, flags);
+	}
+
+	bool TextLayoutCache::Key::Equals::operator()(const Key& a, const Key& b) const
+	{
+		return a.hash == b.hash && a.fontSize == b.fontSize && a.width == b.width &&
+			a.height == b.height && a.flags == b.flags && a.fontUUID == b.fontUUID && a.text == b.text;
+	}
+
+	TextLayoutCache::TextLayoutCache()
+		:mNumQuads(0)
+	{
+		mResourceModifiedConn = gResources().onResourceModified.connect(std::bind(&TextLayoutCache::onResourceModified, this, _1));
+		mResourceDestroyedConn = gResources().onResourceDestroyed.connect(std::bind(&TextLayoutCache::onResourceDestroyed, this, _1));
+	}
+
+	TextLayoutCache::~TextLayoutCache()
+	{
+		mResourceModifiedConn.disconnect();
+		mResourceDestroyedConn.disconnect();
+	}
+
+	SPtr<const TextLayout> TextLayoutCache::find(const TEXT_SPRITE_DESC& desc)
+	{
+		if (desc.text.size() > MAX_CACHED_TEXT_LENGTH)
+			return nullptr;
+
+		Key key(desc);
+
+		Lock lock(mMutex);
+
+		auto iterFind = mEntries.find(key);
+		if (iterFind == mEntries.end())
+			return nullptr;
+
+		Entry& entry = iterFind->second;
+		mLRU.splice(mLRU.end(), mLRU, entry.lruEntry);
+
+		return entry.layout;
+	}
+
+	void TextLayoutCache::add(const TEXT_SPRITE_DESC& desc, const SPtr<const TextLayout>& layout)
+	{
+		if (desc.text.size() > MAX_CACHED_TEXT_LENGTH)
+			return;
+
+		UINT32 numQuads = 0;
+		for (auto& page : layout->pages)
+			numQuads += page.numQuads;
+
+		if (numQuads > MAX_CACHED_QUADS)
+			return;
+
+		Key key(desc);
+
+		Lock lock(mMutex);
+
+		auto iterFind = mEntries.find(key);
+		if (iterFind != mEntries.end())
+		{
+			Entry& entry = iterFind->second;
+			mNumQuads -= entry.numQuads;
+
+			entry.layout = layout;
+			entry.numQuads = numQuads;
+			mLRU.splice(mLRU.end(), mLRU, entry.lruEntry);
+		}
+		else
+		{
+			auto iterInsert = mEntries.insert(std::make_pair(key, Entry())).first;
+
+			Entry& entry = iterInsert->second;
+			entry.layout = layout;
+			entry.numQuads = numQuads;
+			entry.lruEntry = mLRU.insert(mLRU.end(), &iterInsert->first);
+
+			mCachedFonts.insert(key.fontUUID);
+		}
+
+		mNumQuads += numQuads;
+		evict();
+	}
+
+	void TextLayoutCache::clear()
+	{
+		Lock lock(mMutex);
+
+		mEntries.clear();
+		mLRU.clear();
+		mCachedFonts.clear();
+		mNumQuads = 0;
+	}
+
+	void TextLayoutCache::flushFont(const String& fontUUID)
+	{
+		Lock lock(mMutex);
+
+		// Most modified or destroyed resources aren't fonts used by any cached layout
+		auto iterFind = mCachedFonts.find(fontUUID);
+		if (iterFind == mCachedFonts.end())
+			return;
+
+		mCachedFonts.erase(iterFind);
+
+		for (auto iter = mEntries.begin(); iter != mEntries.end();)
+		{
+			if (iter->first.fontUUID == fontUUID)
+			{
+				mNumQuads -= iter->second.numQuads;
+				mLRU.erase(iter->second.lruEntry);
+				iter = mEntries.erase(iter);
+			}
+			else
+				++iter;
+		}
+	}
+
+	void TextLayoutCache::onResourceModified(const HResource& resource)
+	{
+		flushFont(resource.getUUID());
+	}
+
+	void TextLayoutCache::onResourceDestroyed(const String& UUID)
+	{
+		flushFont(UUID);
+	}
+
+	void TextLayoutCache::evict()
+	{
+		while (mNumQuads > MAX_CACHED_QUADS && !mLRU.empty())
+		{
+			const Key* key = mLRU.front();
+			mLRU.pop_front();
+
+			auto iterFind = mEntries.find(*key);
+			mNumQuads -= iterFind->second.numQuads;
+			mEntries.erase(iterFind);
+		}
+	}
+}
@@ -2,6 +2,8 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTextSprite.h"
 #include "BsTextData.h"
+#include "BsTextLayoutCache.h"
+#include "BsFont.h"
 #include "BsVector2.h"
 
 namespace BansheeEngine
@@ -18,47 +20,45 @@ namespace BansheeEngine
 
 	void TextSprite::update(const TEXT_SPRITE_DESC& desc, UINT64 groupId)
 	{
-		bs_frame_mark();
-		{
-			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
+		SPtr<const TextLayout> cachedLayout;
+		if (TextLayoutCache::isStarted())
+			cachedLayout = TextLayoutCache::instance().find(desc);
 
-			UINT32 numPages = textData.getNumPages();
+		if (cachedLayout != nullptr)
+		{
+			UINT32 numPages = (UINT32)cachedLayout->pages.size();
+			allocRenderElements(numPages, [&](UINT32 page) { return cachedLayout->pages[page].numQuads; });
 
-			// Free all previous memory
-			for (auto& cachedElem : mCachedRenderElements)
+			for (UINT32 i = 0; i < numPages; i++)
 			{
-				if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
-				if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
-				if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
-			}
+				const TextLayoutPage& layoutPage = cachedLayout->pages[i];
+				SpriteRenderElement& renderElem = mCachedRenderElements[i];
 
-			mAlloc.clear();
+				UINT32 numVertices = layoutPage.numQuads * 4;
+				UINT32 numIndices = layoutPage.numQuads * 6;
 
-			// Resize cached mesh array to needed size
-			if (mCachedRenderElements.size() != numPages)
-				mCachedRenderElements.resize(numPages);
+				if (numVertices > 0)
+				{
+					memcpy(renderElem.vertices, layoutPage.vertices.data(), sizeof(Vector2) * numVertices);
+					memcpy(renderElem.uvs, layoutPage.uvs.data(), sizeof(Vector2) * numVertices);
+					memcpy(renderElem.indexes, layoutPage.indices.data(), sizeof(UINT32) * numIndices);
+				}
 
-			// Actually generate a mesh
-			UINT32 texPage = 0;
-			for (auto& cachedElem : mCachedRenderElements)
-			{
-				UINT32 newNumQuads = textData.getNumQuadsForPage(texPage);
+				setMaterialInfo(renderElem, layoutPage.texture, desc, groupId);
+			}
 
-				cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
-				cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
-				cachedElem.numQuads = newNumQuads;
+			mGlyphRefs = cachedLayout->glyphRefs;
 
-				const HTexture& tex = textData.getTextureForPage(texPage);
+			updateBounds();
+			return;
+		}
 
-				SpriteMaterialInfo& matInfo = cachedElem.matInfo;
-				matInfo.groupId = groupId;
-				matInfo.texture = tex;
-				matInfo.tint = desc.color;
-				matInfo.type = SpriteMaterial::Text;
+		bs_frame_mark();
+		{
+			TextData<FrameAlloc> textData(desc.text, desc.font, desc.fontSize, desc.width, desc.height, desc.wordWrap, desc.wordBreak);
 
-				texPage++;
-			}
+			UINT32 numPages = textData.getNumPages();
+			allocRenderElements(numPages, [&](UINT32 page) { return textData.getNumQuadsForPage(page); });
 
 			// Calc alignment and anchor offsets and set final line positions
 			for (UINT32 j = 0; j < numPages; j++)
@@ -67,14 +67,83 @@ namespace BansheeEngine
 
 				genTextQuads(j, textData, desc.width, desc.height, desc.horzAlign, desc.vertAlign, desc.anchor,
 					renderElem.vertices, renderElem.uvs, renderElem.indexes, renderElem.numQuads);
+
+				setMaterialInfo(renderElem, textData.getTextureForPage(j), desc, groupId);
 			}
 		}
 
 		bs_frame_clear();
 
+		mGlyphRefs = referenceGlyphs(desc);
+
+		// Store the generated quads so other sprites with the same text and layout can skip the layout step
+		if (TextLayoutCache::isStarted() && desc.text.size() <= TextLayoutCache::MAX_CACHED_TEXT_LENGTH)
+		{
+			SPtr<TextLayout> layout = bs_shared_ptr_new<TextLayout>();
+			layout->pages.resize(mCachedRenderElements.size());
+			layout->glyphRefs = mGlyphRefs;
+
+			for (UINT32 i = 0; i < (UINT32)mCachedRenderElements.size(); i++)
+			{
+				const SpriteRenderElement& renderElem = mCachedRenderElements[i];
+				TextLayoutPage& layoutPage = layout->pages[i];
+
+				UINT32 numVertices = renderElem.numQuads * 4;
+				UINT32 numIndices = renderElem.numQuads * 6;
+
+				layoutPage.texture = renderElem.matInfo.texture;
+				layoutPage.numQuads = renderElem.numQuads;
+				layoutPage.vertices.assign(renderElem.vertices, renderElem.vertices + numVertices);
+				layoutPage.uvs.assign(renderElem.uvs, renderElem.uvs + numVertices);
+				layoutPage.indices.assign(renderElem.indexes, renderElem.indexes + numIndices);
+			}
+
+			TextLayoutCache::instance().add(desc, layout);
+		}
+
 		updateBounds();
 	}
 
+	void TextSprite::allocRenderElements(UINT32 numPages, const std::function<UINT32(UINT32)>& getNumQuads)
+	{
+		// Free all previous memory
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			if (cachedElem.vertices != nullptr) mAlloc.free(cachedElem.vertices);
+			if (cachedElem.uvs != nullptr) mAlloc.free(cachedElem.uvs);
+			if (cachedElem.indexes != nullptr) mAlloc.free(cachedElem.indexes);
+		}
+
+		mAlloc.clear();
+
+		// Resize cached mesh array to needed size
+		if (mCachedRenderElements.size() != numPages)
+			mCachedRenderElements.resize(numPages);
+
+		UINT32 texPage = 0;
+		for (auto& cachedElem : mCachedRenderElements)
+		{
+			UINT32 newNumQuads = getNumQuads(texPage);
+
+			cachedElem.vertices = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.uvs = (Vector2*)mAlloc.alloc(sizeof(Vector2) * newNumQuads * 4);
+			cachedElem.indexes = (UINT32*)mAlloc.alloc(sizeof(UINT32) * newNumQuads * 6);
+			cachedElem.numQuads = newNumQuads;
+
+			texPage++;
+		}
+	}
+
+	void TextSprite::setMaterialInfo(SpriteRenderElement& renderElem, const HTexture& texture, 
+		const TEXT_SPRITE_DESC& desc, UINT64 groupId)
+	{
+		SpriteMaterialInfo& matInfo = renderElem.matInfo;
+		matInfo.groupId = groupId;
+		matInfo.texture = texture;
+		matInfo.tint = desc.color;
+		matInfo.type = SpriteMaterial::Text;
+	}
+
 	UINT32 TextSprite::genTextQuads(UINT32 page, const TextDataBase& textData, UINT32 width, UINT32 height,
 		TextHorzAlign horzAlign, TextVertAlign vertAlign, SpriteAnchor anchor, Vector2* vertices, Vector2* uv, UINT32* indices, UINT32 bufferSizeQuads)
 	{
@@ -220,7 +289,20 @@ namespace BansheeEngine
 
 		mCachedRenderElements.clear();
 		mAlloc.clear();
+		mGlyphRefs = nullptr;
 
 		updateBounds();
 	}
+
+	SPtr<GlyphReferences> TextSprite::referenceGlyphs(const TEXT_SPRITE_DESC& desc)
+	{
+		if (!desc.font.isLoaded())
+			return nullptr;
+
+		SPtr<const FontBitmap> fontBitmap = desc.font->getBitmap(desc.font->getClosestSize(desc.fontSize));
+		if (fontBitmap == nullptr)
+			return nullptr;
+
+		return fontBitmap->referenceGlyphs(desc.text);
+	}
 }
\ No newline at end of file
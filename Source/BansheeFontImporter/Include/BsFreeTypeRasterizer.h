@@ -0,0 +1,81 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsFontPrerequisites.h"
+#include "BsFontDesc.h"
+#include "BsGlyphRasterizer.h"
+
+#include <ft2build.h>
+#include <freetype/freetype.h>
+#include FT_FREETYPE_H
+
+namespace BansheeEngine
+{
+	/** @addtogroup Font
+	 *  @{
+	 */
+
+	/** Bitmap and metrics of a single glyph rendered by FreeType. */
+	struct RenderedGlyph
+	{
+		UINT32 charId;
+		FT_UInt glyphIndex;
+		UINT32 width;
+		UINT32 height;
+		INT32 bitmapLeft;
+		INT32 bitmapTop;
+		INT32 advanceX;
+		INT32 advanceY;
+		INT32 bearingY;
+		Vector<UINT8> pixels; /**< Single channel, 8 bits per pixel, tightly packed. */
+	};
+
+	/** Loads and renders a glyph with the provided index, storing its bitmap (unpacked to 8 bits per pixel) and metrics. */
+	void renderGlyph(FT_Face face, FT_UInt glyphIndex, FT_Int32 loadFlags, FT_Render_Mode renderMode, 
+		RenderedGlyph& output);
+
+	/** Returns FreeType glyph load flags corresponding to the provided render mode. */
+	FT_Int32 getLoadFlags(FontRenderMode renderMode);
+
+	/** 
+	 * FreeType library and face owned by a single user. FreeType objects cannot be shared between threads, so each
+	 * user creates its own instance from the shared font file data. Font file data must outlive the instance.
+	 */
+	class FontFaceInstance
+	{
+	public:
+		FontFaceInstance(const Vector<UINT8>& fontData, UINT32 fontSize, UINT32 dpi);
+		~FontFaceInstance();
+
+		FT_Face face;
+
+	private:
+		FT_Library mLibrary;
+	};
+
+	/** Renders glyphs of a font imported with FontImportOptions::setDynamic() enabled, on demand. */
+	class FreeTypeGlyphRasterizer : public GlyphRasterizer
+	{
+	public:
+		FreeTypeGlyphRasterizer(const SPtr<FontSource>& source, UINT32 size);
+
+		/** @copydoc GlyphRasterizer::rasterize */
+		bool rasterize(UINT32 charId, RASTERIZED_GLYPH& output) override;
+
+	private:
+		SPtr<FontSource> mSource; // Must be declared before the face, as FreeType reads directly from the font data
+		FontFaceInstance mFaceInstance;
+		FT_Int32 mLoadFlags;
+	};
+
+	/** Creates FreeTypeGlyphRasterizer instances. */
+	class FreeTypeGlyphRasterizerFactory : public GlyphRasterizerFactory
+	{
+	public:
+		/** @copydoc GlyphRasterizerFactory::create */
+		SPtr<GlyphRasterizer> create(const SPtr<FontSource>& source, UINT32 size) override;
+	};
+
+	/** @} */
+}
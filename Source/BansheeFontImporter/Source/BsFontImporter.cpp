@@ -1,6 +1,7 @@
 //********************************** Banshee Engine (www.banshee3d.com) **************************************************//
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsFontImporter.h"
+#include "BsFreeTypeRasterizer.h"
 #include "BsFontImportOptions.h"
 #include "BsPixelData.h"
 #include "BsTexture.h"
@@ -10,15 +11,183 @@
 #include "BsCoreApplication.h"
 #include "BsCoreThread.h"
 #include "BsCoreThreadAccessor.h"
-
-#include <ft2build.h>
-#include <freetype/freetype.h>
-#include FT_FREETYPE_H
+#include "BsTaskScheduler.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
 
 using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	/** Number of glyphs rendered by a single import task. */
+	static const UINT32 GLYPHS_PER_TASK = 256;
+
+	/** Intermediate data for importing a single font size. */
+	struct FontSizeImportData
+	{
+		UINT32 size;
+		UINT32 spaceWidth;
+		INT32 faceAscender;
+		UINT32 faceLineHeight;
+		CHAR_DESC missingGlyph;
+		Vector<RenderedGlyph> glyphs; /**< Glyphs for all present characters, followed by the missing glyph. */
+		Vector<TexAtlasElementDesc> atlasElements;
+		Vector<TexAtlasPageDesc> pages;
+
+		Vector<SPtr<PixelData>> pagePixels;
+		Vector<Vector<CHAR_DESC>> pageChars;
+		Vector<INT32> pageBaselineOffsets;
+		Vector<UINT32> pageLineHeights;
+	};
+
+	/** 
+	 * Runs the provided jobs on the task scheduler and waits until they complete. If any of the jobs throws, an exception
+	 * is thrown on the calling thread once all jobs finish.
+	 */
+	static void runParallel(const Vector<std::function<void()>>& jobs)
+	{
+		Mutex errorMutex;
+		String error;
+
+		Vector<SPtr<Task>> tasks;
+		for (auto& job : jobs)
+		{
+			SPtr<Task> task = Task::create("Font import", [&errorMutex, &error, job]()
+			{
+				try
+				{
+					job();
+				}
+				catch (const Exception& e)
+				{
+					Lock lock(errorMutex);
+					if (error.empty())
+						error = e.getFullDescription();
+				}
+			});
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		if (!error.empty())
+			BS_EXCEPT(InternalErrorException, error);
+	}
+
+	/** 
+	 * Copies all glyphs on the specified atlas page into a newly allocated pixel buffer and generates their character
+	 * descriptors.
+	 */
+	static void fillAtlasPage(FontSizeImportData& sizeData, UINT32 pageIdx, const Vector<UINT8>& fontData, UINT32 dpi)
+	{
+		const TexAtlasPageDesc& page = sizeData.pages[pageIdx];
+		UINT32 numChars = (UINT32)sizeData.glyphs.size() - 1;
+
+		// TODO - I don't actually need a 2 channel texture
+		SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(page.width, page.height, 1, PF_R8G8);
+
+		pixelData->allocateInternalBuffer();
+		UINT8* pixelBuffer = pixelData->getData();
+		memset(pixelBuffer, 0, page.width * page.height * 2);
+
+		// Kerning is only looked up if the font has a kerning table, otherwise every lookup would return zero
+		FontFaceInstance faceInstance(fontData, sizeData.size, dpi);
+		FT_Face face = faceInstance.face;
+		bool hasKerning = FT_HAS_KERNING(face) != 0;
+
+		INT32 baselineOffset = 0;
+		UINT32 lineHeight = 0;
+		Vector<CHAR_DESC>& chars = sizeData.pageChars[pageIdx];
+
+		float invTexWidth = 1.0f / page.width;
+		float invTexHeight = 1.0f / page.height;
+
+		for(size_t elementIdx = 0; elementIdx < sizeData.atlasElements.size(); elementIdx++)
+		{
+			// Copy character bitmap
+			const TexAtlasElementDesc& curElement = sizeData.atlasElements[elementIdx];
+			if(curElement.output.page != pageIdx)
+				continue;
+
+			const RenderedGlyph& glyph = sizeData.glyphs[elementIdx];
+
+			const UINT8* sourceBuffer = glyph.pixels.data();
+			UINT8* dstBuffer = pixelBuffer + (curElement.output.y * page.width * 2) + curElement.output.x * 2;
+
+			for(UINT32 bitmapRow = 0; bitmapRow < glyph.height; bitmapRow++)
+			{
+				for(UINT32 bitmapColumn = 0; bitmapColumn < glyph.width; bitmapColumn++)
+				{
+					dstBuffer[bitmapColumn * 2 + 0] = sourceBuffer[bitmapColumn];
+					dstBuffer[bitmapColumn * 2 + 1] = sourceBuffer[bitmapColumn];
+				}
+
+				dstBuffer += page.width * 2;
+				sourceBuffer += glyph.width;
+			}
+
+			// Store character information
+			CHAR_DESC charDesc;
+			charDesc.charId = glyph.charId;
+			charDesc.width = curElement.input.width;
+			charDesc.height = curElement.input.height;
+			charDesc.page = curElement.output.page;
+			charDesc.uvWidth = invTexWidth * curElement.input.width;
+			charDesc.uvHeight = invTexHeight * curElement.input.height;
+			charDesc.uvX = invTexWidth * curElement.output.x;
+			charDesc.uvY = invTexHeight * curElement.output.y;
+			charDesc.xOffset = glyph.bitmapLeft;
+			charDesc.yOffset = glyph.bitmapTop;
+			charDesc.xAdvance = glyph.advanceX;
+			charDesc.yAdvance = glyph.advanceY;
+
+			baselineOffset = std::max(baselineOffset, glyph.bearingY);
+			lineHeight = std::max(lineHeight, charDesc.height);
+
+			// Load kerning
+			bool isMissingGlypth = elementIdx == numChars;
+			if(!isMissingGlypth && hasKerning)
+			{
+				FT_Vector resultKerning;
+				for(UINT32 otherIdx = 0; otherIdx < numChars; otherIdx++)
+				{
+					const RenderedGlyph& otherGlyph = sizeData.glyphs[otherIdx];
+					if(otherGlyph.charId == glyph.charId)
+						continue;
+
+					// Note: FreeType expects glyph indices here, not character codes
+					FT_Error error = FT_Get_Kerning(face, glyph.glyphIndex, otherGlyph.glyphIndex, FT_KERNING_DEFAULT, 
+						&resultKerning);
+
+					if(error)
+						BS_EXCEPT(InternalErrorException, "Failed to get kerning information for character: " + toString(glyph.charId));
+
+					INT32 kerningX = (INT32)(resultKerning.x >> 6); // Y kerning is ignored because it is so rare
+					if(kerningX == 0) // We don't store 0 kerning, this is assumed default
+						continue;
+
+					KerningPair pair;
+					pair.amount = kerningX;
+					pair.otherCharId = otherGlyph.charId;
+
+					charDesc.kerningPairs.push_back(pair);
+				}
+			}
+
+			if (!isMissingGlypth)
+				chars.push_back(charDesc);
+			else
+				sizeData.missingGlyph = charDesc;
+		}
+
+		sizeData.pagePixels[pageIdx] = pixelData;
+		sizeData.pageBaselineOffsets[pageIdx] = baselineOffset;
+		sizeData.pageLineHeights[pageIdx] = lineHeight;
+	}
+
 	FontImporter::FontImporter()
 		:SpecificImporter() 
 	{
@@ -54,6 +223,15 @@ namespace BansheeEngine
 	{
 		const FontImportOptions* fontImportOptions = static_cast<const FontImportOptions*>(importOptions.get());
 
+		// Read the font file once, every import task creates its own face from this data
+		SPtr<DataStream> stream = FileSystem::openFile(filePath);
+		if (stream == nullptr)
+			BS_EXCEPT(InternalErrorException, "Failed to load font file: " + filePath.toString() + ". Cannot open file.");
+
+		Vector<UINT8> fontData(stream->size());
+		stream->read(fontData.data(), fontData.size());
+		stream->close();
+
 		FT_Library library;
 
 		FT_Error error = FT_Init_FreeType(&library);
@@ -61,7 +239,7 @@ namespace BansheeEngine
 			BS_EXCEPT(InternalErrorException, "Error occurred during FreeType library initialization.");
 
 		FT_Face face;
-		error = FT_New_Face(library, filePath.toString().c_str(), 0, &face);
+		error = FT_New_Memory_Face(library, fontData.data(), (FT_Long)fontData.size(), 0, &face);
 
 		if (error == FT_Err_Unknown_File_Format)
 		{
@@ -76,29 +254,27 @@ namespace BansheeEngine
 		Vector<UINT32> fontSizes = fontImportOptions->getFontSizes();
 		UINT32 dpi = fontImportOptions->getDPI();
 
-		FT_Int32 loadFlags;
-		switch (fontImportOptions->getRenderMode())
+		FT_Int32 loadFlags = getLoadFlags(fontImportOptions->getRenderMode());
+		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
+
+		// Find glyphs for all requested characters. Characters the font has no glyph for are skipped, as text rendering
+		// falls back to the missing glyph for them anyway.
+		Vector<std::pair<UINT32, FT_UInt>> charGlyphs;
+		for(auto iter = charIndexRanges.begin(); iter != charIndexRanges.end(); ++iter)
 		{
-		case FontRenderMode::Smooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::Raster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
-			break;
-		case FontRenderMode::HintedSmooth:
-			loadFlags = FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
-			break;
-		case FontRenderMode::HintedRaster:
-			loadFlags = FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
-			break;
-		default:
-			loadFlags = FT_LOAD_TARGET_NORMAL;
-			break;
+			for(UINT32 charIdx = iter->first; charIdx <= iter->second; charIdx++)
+			{
+				FT_UInt glyphIndex = FT_Get_Char_Index(face, (FT_ULong)charIdx);
+				if (glyphIndex != 0)
+					charGlyphs.push_back(std::make_pair(charIdx, glyphIndex));
+			}
 		}
 
-		FT_Render_Mode renderMode = FT_LOAD_TARGET_MODE(loadFlags);
+		// Missing glyph is always the last element
+		charGlyphs.push_back(std::make_pair(0U, 0U));
+		UINT32 numGlyphs = (UINT32)charGlyphs.size();
 
-		Vector<SPtr<FontBitmap>> dataPerSize;
+		Vector<FontSizeImportData> sizeData(fontSizes.size());
 		for(size_t i = 0; i < fontSizes.size(); i++)
 		{
 			// Note: Disabled as its not working and I have bigger issues to handle than to figure this out atm
@@ -122,208 +298,95 @@ namespace BansheeEngine
 			if (FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
 				BS_EXCEPT(InternalErrorException, "Could not set character size.");
 
-			SPtr<FontBitmap> fontData = bs_shared_ptr_new<FontBitmap>();
-
-			// Get all char sizes so we can generate texture layout
-			Vector<TexAtlasElementDesc> atlasElements;
-			Map<UINT32, UINT32> seqIdxToCharIdx;
-			for(auto iter = charIndexRanges.begin(); iter != charIndexRanges.end(); ++iter)
-			{
-				for(UINT32 charIdx = iter->first; charIdx <= iter->second; charIdx++)
-				{
-					error = FT_Load_Char(face, (FT_ULong)charIdx, loadFlags);
-
-					if(error)
-						BS_EXCEPT(InternalErrorException, "Failed to load a character");
-
-					FT_Render_Glyph(face->glyph, renderMode);
-
-					if (error)
-						BS_EXCEPT(InternalErrorException, "Failed to render a character");
-
-					FT_GlyphSlot slot = face->glyph;
-
-					TexAtlasElementDesc atlasElement;
-					atlasElement.input.width = slot->bitmap.width;
-					atlasElement.input.height = slot->bitmap.rows;
-
-					atlasElements.push_back(atlasElement);
-					seqIdxToCharIdx[(UINT32)atlasElements.size() - 1] = charIdx;
-				}
-			}
-
-			// Add missing glyph
-			{
-				error = FT_Load_Glyph(face, (FT_ULong)0, loadFlags);
-
-				if(error)
-					BS_EXCEPT(InternalErrorException, "Failed to load a character");
-
-				FT_Render_Glyph(face->glyph, renderMode);
-
-				if (error)
-					BS_EXCEPT(InternalErrorException, "Failed to render a character");
-
-				FT_GlyphSlot slot = face->glyph;
-
-				TexAtlasElementDesc atlasElement;
-				atlasElement.input.width = slot->bitmap.width;
-				atlasElement.input.height = slot->bitmap.rows;
+			// Get space size
+			error = FT_Load_Char(face, 32, loadFlags);
 
-				atlasElements.push_back(atlasElement);
-			}
+			if(error)
+				BS_EXCEPT(InternalErrorException, "Failed to load a character");
 
-			// Create an optimal layout for character bitmaps
-			TexAtlasGenerator texAtlasGen(false, MAXIMUM_TEXTURE_SIZE, MAXIMUM_TEXTURE_SIZE);
-			Vector<TexAtlasPageDesc> pages = texAtlasGen.createAtlasLayout(atlasElements);
+			sizeData[i].size = fontSizes[i];
+			sizeData[i].spaceWidth = face->glyph->advance.x >> 6;
+			sizeData[i].faceAscender = (INT32)(face->size->metrics.ascender >> 6);
+			sizeData[i].faceLineHeight = (UINT32)(face->size->metrics.height >> 6);
+			sizeData[i].glyphs.resize(numGlyphs);
+		}
 
-			INT32 baselineOffset = 0;
-			UINT32 lineHeight = 0;
+		FT_Done_FreeType(library);
 
-			// Create char bitmap atlas textures and load character information
-			UINT32 pageIdx = 0;
-			for(auto pageIter = pages.begin(); pageIter != pages.end(); ++pageIter)
+		// Render glyph bitmaps for all sizes, in parallel over sizes and glyph ranges. Bitmaps are kept around so they
+		// can be used for both the atlas layout and the atlas page copy.
+		Vector<std::function<void()>> renderJobs;
+		for(auto& entry : sizeData)
+		{
+			FontSizeImportData* curSizeData = &entry;
+			for(UINT32 start = 0; start < numGlyphs; start += GLYPHS_PER_TASK)
 			{
-				UINT32 bufferSize = pageIter->width * pageIter->height * 2;
-
-				// TODO - I don't actually need a 2 channel texture
-				SPtr<PixelData> pixelData = bs_shared_ptr_new<PixelData>(pageIter->width, pageIter->height, 1, PF_R8G8);
-
-				pixelData->allocateInternalBuffer();
-				UINT8* pixelBuffer = pixelData->getData();
-				memset(pixelBuffer, 0, bufferSize);
-
-				for(size_t elementIdx = 0; elementIdx < atlasElements.size(); elementIdx++)
+				UINT32 end = std::min(start + GLYPHS_PER_TASK, numGlyphs);
+				renderJobs.push_back([&, curSizeData, start, end]()
 				{
-					// Copy character bitmap
-					if(atlasElements[elementIdx].output.page != pageIdx)
-						continue;
-
-					TexAtlasElementDesc curElement = atlasElements[elementIdx];
-					bool isMissingGlypth = elementIdx == (atlasElements.size() - 1); // It's always the last element
-
-					UINT32 charIdx = 0;
-					if(!isMissingGlypth)
-					{
-						charIdx = seqIdxToCharIdx[(UINT32)elementIdx];
+					FontFaceInstance faceInstance(fontData, curSizeData->size, dpi);
 
-						error = FT_Load_Char(face, charIdx, loadFlags);
-					}
-					else
+					for(UINT32 glyphIdx = start; glyphIdx < end; glyphIdx++)
 					{
-						error = FT_Load_Glyph(face, 0, loadFlags);
+						RenderedGlyph& glyph = curSizeData->glyphs[glyphIdx];
+						renderGlyph(faceInstance.face, charGlyphs[glyphIdx].second, loadFlags, renderMode, glyph);
+						glyph.charId = charGlyphs[glyphIdx].first;
 					}
+				});
+			}
+		}
 
-					if(error)
-						BS_EXCEPT(InternalErrorException, "Failed to load a character");
-
-					FT_Render_Glyph(face->glyph, renderMode);
-
-					if (error)
-						BS_EXCEPT(InternalErrorException, "Failed to render a character");
+		runParallel(renderJobs);
 
-					FT_GlyphSlot slot = face->glyph;
+		// Create an optimal layout for character bitmaps
+		Vector<std::function<void()>> pageJobs;
+		for(auto& entry : sizeData)
+		{
+			entry.atlasElements.resize(numGlyphs);
+			for(UINT32 glyphIdx = 0; glyphIdx < numGlyphs; glyphIdx++)
+			{
+				entry.atlasElements[glyphIdx].input.width = entry.glyphs[glyphIdx].width;
+				entry.atlasElements[glyphIdx].input.height = entry.glyphs[glyphIdx].height;
+			}
 
-					if(slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
-						BS_EXCEPT(InternalErrorException, "Failed to render glyph bitmap");
+			TexAtlasGenerator texAtlasGen(false, MAXIMUM_TEXTURE_SIZE, MAXIMUM_TEXTURE_SIZE);
+			entry.pages = texAtlasGen.createAtlasLayout(entry.atlasElements);
 
-					UINT8* sourceBuffer = slot->bitmap.buffer;
-					UINT8* dstBuffer = pixelBuffer + (curElement.output.y * pageIter->width * 2) + curElement.output.x * 2;
+			UINT32 numPages = (UINT32)entry.pages.size();
+			entry.pagePixels.resize(numPages);
+			entry.pageChars.resize(numPages);
+			entry.pageBaselineOffsets.resize(numPages, 0);
+			entry.pageLineHeights.resize(numPages, 0);
 
-					if(slot->bitmap.pixel_mode == ft_pixel_mode_grays)
-					{
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								dstBuffer[bitmapColumn * 2 + 0] = sourceBuffer[bitmapColumn];
-								dstBuffer[bitmapColumn * 2 + 1] = sourceBuffer[bitmapColumn];
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else if(slot->bitmap.pixel_mode == ft_pixel_mode_mono)
-					{
-						// 8 pixels are packed into a byte, so do some unpacking
-						for(INT32 bitmapRow = 0; bitmapRow < slot->bitmap.rows; bitmapRow++)
-						{
-							for(INT32 bitmapColumn = 0; bitmapColumn < slot->bitmap.width; bitmapColumn++)
-							{
-								UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
-								UINT8 dstValue = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
-
-								dstBuffer[bitmapColumn * 2 + 0] = dstValue;
-								dstBuffer[bitmapColumn * 2 + 1] = dstValue;
-							}
-
-							dstBuffer += pageIter->width * 2;
-							sourceBuffer += slot->bitmap.pitch;
-						}
-					}
-					else
-						BS_EXCEPT(InternalErrorException, "Unsupported pixel mode for a FreeType bitmap.");
-
-					// Store character information
-					CHAR_DESC charDesc;
-
-					float invTexWidth = 1.0f / pageIter->width;
-					float invTexHeight = 1.0f / pageIter->height;
-
-					charDesc.charId = charIdx;
-					charDesc.width = curElement.input.width;
-					charDesc.height = curElement.input.height;
-					charDesc.page = curElement.output.page;
-					charDesc.uvWidth = invTexWidth * curElement.input.width;
-					charDesc.uvHeight = invTexHeight * curElement.input.height;
-					charDesc.uvX = invTexWidth * curElement.output.x;
-					charDesc.uvY = invTexHeight * curElement.output.y;
-					charDesc.xOffset = slot->bitmap_left;
-					charDesc.yOffset = slot->bitmap_top;
-					charDesc.xAdvance = slot->advance.x >> 6;
-					charDesc.yAdvance = slot->advance.y >> 6;
-
-					baselineOffset = std::max(baselineOffset, (INT32)(slot->metrics.horiBearingY >> 6));
-					lineHeight = std::max(lineHeight, charDesc.height);
-
-					// Load kerning and store char
-					if(!isMissingGlypth)
-					{
-						FT_Vector resultKerning;
-						for(auto kerningIter = charIndexRanges.begin(); kerningIter != charIndexRanges.end(); ++kerningIter)
-						{
-							for(UINT32 kerningCharIdx = kerningIter->first; kerningCharIdx <= kerningIter->second; kerningCharIdx++)
-							{
-								if(kerningCharIdx == charIdx)
-									continue;
+			FontSizeImportData* curSizeData = &entry;
+			for(UINT32 pageIdx = 0; pageIdx < numPages; pageIdx++)
+				pageJobs.push_back([&, curSizeData, pageIdx]() { fillAtlasPage(*curSizeData, pageIdx, fontData, dpi); });
+		}
 
-								error = FT_Get_Kerning(face, charIdx, kerningCharIdx, FT_KERNING_DEFAULT, &resultKerning);
+		// Fill atlas pages and load character information, in parallel over sizes and pages
+		runParallel(pageJobs);
 
-								if(error)
-									BS_EXCEPT(InternalErrorException, "Failed to get kerning information for character: " + toString(charIdx));
+		// Create char bitmap atlas textures
+		Vector<SPtr<FontBitmap>> dataPerSize;
+		for(auto& entry : sizeData)
+		{
+			SPtr<FontBitmap> fontBitmap = bs_shared_ptr_new<FontBitmap>();
 
-								INT32 kerningX = (INT32)(resultKerning.x >> 6); // Y kerning is ignored because it is so rare
-								if(kerningX == 0) // We don't store 0 kerning, this is assumed default
-									continue;
+			INT32 baselineOffset = 0;
+			UINT32 lineHeight = 0;
 
-								KerningPair pair;
-								pair.amount = kerningX;
-								pair.otherCharId = kerningCharIdx;
+			for(UINT32 pageIdx = 0; pageIdx < (UINT32)entry.pages.size(); pageIdx++)
+			{
+				const TexAtlasPageDesc& page = entry.pages[pageIdx];
+				const SPtr<PixelData>& pixelData = entry.pagePixels[pageIdx];
 
-								charDesc.kerningPairs.push_back(pair);
-							}
-						}
+				for(auto& charDesc : entry.pageChars[pageIdx])
+					fontBitmap->fontDesc.characters[charDesc.charId] = charDesc;
 
-						fontData->fontDesc.characters[charIdx] = charDesc;
-					}
-					else
-					{
-						fontData->fontDesc.missingGlyph = charDesc;
-					}
-				}
+				baselineOffset = std::max(baselineOffset, entry.pageBaselineOffsets[pageIdx]);
+				lineHeight = std::max(lineHeight, entry.pageLineHeights[pageIdx]);
 
-				HTexture newTex = Texture::create(TEX_TYPE_2D, pageIter->width, pageIter->height, 0, PF_R8G8);
+				HTexture newTex = Texture::create(TEX_TYPE_2D, page.width, page.height, 0, PF_R8G8);
 				UINT32 subresourceIdx = newTex->getProperties().mapToSubresourceIdx(0, 0);
 
 				// It's possible the formats no longer match
@@ -339,34 +402,40 @@ namespace BansheeEngine
 					newTex->writeSubresource(gCoreAccessor(), subresourceIdx, pixelData, false);
 				}
 
-				newTex->setName(L"FontPage" + toWString((UINT32)fontData->texturePages.size()));
-				fontData->texturePages.push_back(newTex);
-
-				pageIdx++;
+				newTex->setName(L"FontPage" + toWString((UINT32)fontBitmap->texturePages.size()));
+				fontBitmap->texturePages.push_back(newTex);
 			}
 
-			fontData->size = fontSizes[i];
-			fontData->fontDesc.baselineOffset = baselineOffset;
-			fontData->fontDesc.lineHeight = lineHeight;
-
-			// Get space size
-			error = FT_Load_Char(face, 32, loadFlags);
-
-			if(error)
-				BS_EXCEPT(InternalErrorException, "Failed to load a character");
+			// Characters rendered at runtime aren't known yet, so account for the tallest characters the face can have
+			if (fontImportOptions->getDynamic())
+			{
+				baselineOffset = std::max(baselineOffset, entry.faceAscender);
+				lineHeight = std::max(lineHeight, entry.faceLineHeight);
+			}
 
-			fontData->fontDesc.spaceWidth = face->glyph->advance.x >> 6;
+			fontBitmap->size = entry.size;
+			fontBitmap->fontDesc.missingGlyph = entry.missingGlyph;
+			fontBitmap->fontDesc.baselineOffset = baselineOffset;
+			fontBitmap->fontDesc.lineHeight = lineHeight;
+			fontBitmap->fontDesc.spaceWidth = entry.spaceWidth;
 
-			dataPerSize.push_back(fontData);
+			dataPerSize.push_back(fontBitmap);
 		}
 
-		SPtr<Font> newFont = Font::_createPtr(dataPerSize);
+		SPtr<FontSource> fontSource;
+		if (fontImportOptions->getDynamic())
+		{
+			fontSource = bs_shared_ptr_new<FontSource>();
+			fontSource->fontData = std::move(fontData);
+			fontSource->dpi = dpi;
+			fontSource->renderMode = fontImportOptions->getRenderMode();
+		}
 
-		FT_Done_FreeType(library);
+		SPtr<Font> newFont = Font::_createPtr(dataPerSize, fontSource);
 
 		WString fileName = filePath.getWFilename(false);
 		newFont->setName(fileName);
 
 		return newFont;
 	}
-}
\ No newline at end of file
+}
@@ -3,6 +3,8 @@
 #include "BsFontPrerequisites.h"
 #include "BsImporter.h"
 #include "BsFontImporter.h"
+#include "BsFreeTypeRasterizer.h"
+#include "BsFontManager.h"
 
 namespace BansheeEngine
 {
@@ -19,6 +21,9 @@ namespace BansheeEngine
 		FontImporter* importer = bs_new<FontImporter>();
 		Importer::instance()._registerAssetImporter(importer);
 
+		// Allows fonts imported as dynamic to render characters on demand
+		FontManager::instance()._setGlyphRasterizerFactory(bs_shared_ptr_new<FreeTypeGlyphRasterizerFactory>());
+
 		return nullptr;
 	}
 }
\ No newline at end of file
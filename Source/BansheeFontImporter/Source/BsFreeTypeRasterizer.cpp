@@ -0,0 +1,159 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsFreeTypeRasterizer.h"
+#include "BsFont.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	void renderGlyph(FT_Face face, FT_UInt glyphIndex, FT_Int32 loadFlags, FT_Render_Mode renderMode, 
+		RenderedGlyph& output)
+	{
+		FT_Error error = FT_Load_Glyph(face, glyphIndex, loadFlags);
+		if (error)
+			BS_EXCEPT(InternalErrorException, "Failed to load a character");
+
+		error = FT_Render_Glyph(face->glyph, renderMode);
+		if (error)
+			BS_EXCEPT(InternalErrorException, "Failed to render a character");
+
+		FT_GlyphSlot slot = face->glyph;
+		if (slot->bitmap.buffer == nullptr && slot->bitmap.rows > 0 && slot->bitmap.width > 0)
+			BS_EXCEPT(InternalErrorException, "Failed to render glyph bitmap");
+
+		output.glyphIndex = glyphIndex;
+		output.width = slot->bitmap.width;
+		output.height = slot->bitmap.rows;
+		output.bitmapLeft = slot->bitmap_left;
+		output.bitmapTop = slot->bitmap_top;
+		output.advanceX = slot->advance.x >> 6;
+		output.advanceY = slot->advance.y >> 6;
+		output.bearingY = (INT32)(slot->metrics.horiBearingY >> 6);
+		output.pixels.resize(output.width * output.height);
+
+		UINT8* sourceBuffer = slot->bitmap.buffer;
+		UINT8* dstBuffer = output.pixels.data();
+
+		if (slot->bitmap.pixel_mode == ft_pixel_mode_grays)
+		{
+			for (UINT32 bitmapRow = 0; bitmapRow < output.height; bitmapRow++)
+			{
+				memcpy(dstBuffer, sourceBuffer, output.width);
+
+				dstBuffer += output.width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (slot->bitmap.pixel_mode == ft_pixel_mode_mono)
+		{
+			// 8 pixels are packed into a byte, so do some unpacking
+			for (UINT32 bitmapRow = 0; bitmapRow < output.height; bitmapRow++)
+			{
+				for (UINT32 bitmapColumn = 0; bitmapColumn < output.width; bitmapColumn++)
+				{
+					UINT8 srcValue = sourceBuffer[bitmapColumn >> 3];
+					dstBuffer[bitmapColumn] = (srcValue & (128 >> (bitmapColumn & 7))) != 0 ? 255 : 0;
+				}
+
+				dstBuffer += output.width;
+				sourceBuffer += slot->bitmap.pitch;
+			}
+		}
+		else if (output.width > 0 && output.height > 0)
+			BS_EXCEPT(InternalErrorException, "Unsupported pixel mode for a FreeType bitmap.");
+	}
+
+	FT_Int32 getLoadFlags(FontRenderMode renderMode)
+	{
+		switch (renderMode)
+		{
+		case FontRenderMode::Smooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_HINTING;
+		case FontRenderMode::Raster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_HINTING;
+		case FontRenderMode::HintedSmooth:
+			return FT_LOAD_TARGET_NORMAL | FT_LOAD_NO_AUTOHINT;
+		case FontRenderMode::HintedRaster:
+			return FT_LOAD_TARGET_MONO | FT_LOAD_NO_AUTOHINT;
+		default:
+			return FT_LOAD_TARGET_NORMAL;
+		}
+	}
+
+	FontFaceInstance::FontFaceInstance(const Vector<UINT8>& fontData, UINT32 fontSize, UINT32 dpi)
+		:face(nullptr), mLibrary(nullptr)
+	{
+		FT_Error error = FT_Init_FreeType(&mLibrary);
+		if (error)
+			BS_EXCEPT(InternalErrorException, "Error occurred during FreeType library initialization.");
+
+		error = FT_New_Memory_Face(mLibrary, fontData.data(), (FT_Long)fontData.size(), 0, &face);
+		if (error)
+		{
+			FT_Done_FreeType(mLibrary);
+			BS_EXCEPT(InternalErrorException, "Failed to load font face.");
+		}
+
+		FT_F26Dot6 ftSize = (FT_F26Dot6)(fontSize * (1 << 6));
+		if (FT_Set_Char_Size(face, ftSize, 0, dpi, dpi))
+		{
+			FT_Done_Face(face);
+			FT_Done_FreeType(mLibrary);
+			BS_EXCEPT(InternalErrorException, "Could not set character size.");
+		}
+	}
+
+	FontFaceInstance::~FontFaceInstance()
+	{
+		if (face != nullptr)
+			FT_Done_Face(face);
+
+		if (mLibrary != nullptr)
+			FT_Done_FreeType(mLibrary);
+	}
+
+	FreeTypeGlyphRasterizer::FreeTypeGlyphRasterizer(const SPtr<FontSource>& source, UINT32 size)
+		:mSource(source), mFaceInstance(source->fontData, size, source->dpi), mLoadFlags(getLoadFlags(source->renderMode))
+	{ }
+
+	bool FreeTypeGlyphRasterizer::rasterize(UINT32 charId, RASTERIZED_GLYPH& output)
+	{
+		FT_UInt glyphIndex = FT_Get_Char_Index(mFaceInstance.face, (FT_ULong)charId);
+		if (glyphIndex == 0)
+			return false;
+
+		RenderedGlyph glyph;
+		try
+		{
+			renderGlyph(mFaceInstance.face, glyphIndex, mLoadFlags, FT_LOAD_TARGET_MODE(mLoadFlags), glyph);
+		}
+		catch (const Exception& e)
+		{
+			LOGWRN("Unable to render character " + toString(charId) + ": " + e.getDescription());
+			return false;
+		}
+
+		output.width = glyph.width;
+		output.height = glyph.height;
+		output.xOffset = glyph.bitmapLeft;
+		output.yOffset = glyph.bitmapTop;
+		output.xAdvance = glyph.advanceX;
+		output.yAdvance = glyph.advanceY;
+		output.pixels = std::move(glyph.pixels);
+
+		return true;
+	}
+
+	SPtr<GlyphRasterizer> FreeTypeGlyphRasterizerFactory::create(const SPtr<FontSource>& source, UINT32 size)
+	{
+		try
+		{
+			return bs_shared_ptr_new<FreeTypeGlyphRasterizer>(source, size);
+		}
+		catch (const Exception& e)
+		{
+			LOGWRN("Unable to create a FreeType rasterizer: " + e.getDescription());
+			return nullptr;
+		}
+	}
+}
@@ -208,12 +208,15 @@ namespace BansheeEngine
 			bs_deleteN(mTextureTypes, mNumTextureTypes);
 	}
 
-	void GLRenderAPI::bindGpuProgram(const SPtr<GpuProgramCore>& prg)
+	void GLRenderAPI::bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		SPtr<GLSLGpuProgramCore> glprg = std::static_pointer_cast<GLSLGpuProgramCore>(prg);
 
+		// Sampler units are assigned through program uniforms, so a newly bound program has none of them set
+		invalidateSamplerStateCache(glprg->getProperties().getType());
+
 		switch (glprg->getProperties().getType())
 		{
 		case GPT_VERTEX_PROGRAM:
@@ -234,17 +237,13 @@ namespace BansheeEngine
 		case GPT_COMPUTE_PROGRAM:
 			mCurrentComputeProgram = glprg;
 		}
-
-		RenderAPICore::bindGpuProgram(prg);
 	}
 
-	void GLRenderAPI::unbindGpuProgram(GpuProgramType gptype)
+	void GLRenderAPI::unbindGpuProgramImpl(GpuProgramType gptype)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		setActiveProgram(gptype, nullptr);
-
-		RenderAPICore::unbindGpuProgram(gptype);
 	}
 
 	void GLRenderAPI::setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& bindableParams)
@@ -381,10 +380,13 @@ namespace BansheeEngine
 		}
 	}
 
-	void GLRenderAPI::setTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
+	void GLRenderAPI::setTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
+		// Sampler state is stored in the texture object, so it must be applied again to the new texture
+		invalidateSamplerStateCache(gptype, unit);
+
 		unit = getGLTextureUnit(gptype, unit);
 		if (!activateGLTextureUnit(unit))
 			return;
@@ -408,7 +410,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumTextureBinds);
 	}
 
-	void GLRenderAPI::setSamplerState(GpuProgramType gptype, UINT16 unit, const SPtr<SamplerStateCore>& state)
+	void GLRenderAPI::setSamplerStateImpl(GpuProgramType gptype, UINT16 unit, const SPtr<SamplerStateCore>& state)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -442,7 +444,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumSamplerBinds);
 	}
 
-	void GLRenderAPI::setLoadStoreTexture(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
+	void GLRenderAPI::setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
 		const TextureSurface& surface)
 	{
 		THROW_IF_NOT_CORE_THREAD;
@@ -460,7 +462,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumTextureBinds);
 	}
 
-	void GLRenderAPI::setBlendState(const SPtr<BlendStateCore>& blendState)
+	void GLRenderAPI::setBlendStateImpl(const SPtr<BlendStateCore>& blendState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -488,7 +490,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumBlendStateChanges);
 	}
 
-	void GLRenderAPI::setRasterizerState(const SPtr<RasterizerStateCore>& rasterizerState)
+	void GLRenderAPI::setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -511,7 +513,7 @@ namespace BansheeEngine
 		BS_INC_RENDER_STAT(NumRasterizerStateChanges);
 	}
 
-	void GLRenderAPI::setDepthStencilState(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	void GLRenderAPI::setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -547,7 +549,7 @@ namespace BansheeEngine
 		applyViewport();
 	}
 
-	void GLRenderAPI::setRenderTarget(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	void GLRenderAPI::setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -615,7 +617,7 @@ namespace BansheeEngine
 		glDisable(GL_SCISSOR_TEST);
 	}
 
-	void GLRenderAPI::setVertexBuffers(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	void GLRenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -628,21 +630,21 @@ namespace BansheeEngine
 		}
 	}
 
-	void GLRenderAPI::setVertexDeclaration(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	void GLRenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		mBoundVertexDeclaration = vertexDeclaration;
 	}
 
-	void GLRenderAPI::setDrawOperation(DrawOperationType op)
+	void GLRenderAPI::setDrawOperationImpl(DrawOperationType op)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
 		mCurrentDrawOperation = op;
 	}
 
-	void GLRenderAPI::setIndexBuffer(const SPtr<IndexBufferCore>& buffer)
+	void GLRenderAPI::setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer)
 	{
 		THROW_IF_NOT_CORE_THREAD;
 
@@ -1859,6 +1861,9 @@ namespace BansheeEngine
 		glDepthMask(mDepthWrite);
 		glColorMask(mColorWrite[0], mColorWrite[1], mColorWrite[2], mColorWrite[3]);
 		glStencilMask(mStencilWriteMask);
+
+		// Nothing we have bound so far is known to be bound on the new context
+		invalidateStateCache();
 	}
 
 	RenderAPICapabilities* GLRenderAPI::createRenderSystemCapabilities() const
@@ -1996,6 +2001,12 @@ namespace BansheeEngine
 		// Infinite far plane always supported
 		rsc->setCapability(RSC_INFINITE_FAR_PLANE);
 
+		// Indexed instanced draws require glDrawElementsInstancedBaseVertex
+		if (GLEW_VERSION_3_2)
+		{
+			rsc->setCapability(RSC_INSTANCING);
+		}
+
 		// Check for non-power-of-2 texture support
 		if (getGLSupport()->checkExtension("GL_ARB_texture_non_power_of_two"))
 		{
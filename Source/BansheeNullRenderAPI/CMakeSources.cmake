@@ -0,0 +1,53 @@
+set(BS_BANSHEENULLRENDERAPI_INC_NOFILTER
+	"Include/BsNullCommandStream.h"
+	"Include/BsNullGpuBuffer.h"
+	"Include/BsNullGpuProgram.h"
+	"Include/BsNullHLSLParamParser.h"
+	"Include/BsNullHardwareBuffer.h"
+	"Include/BsNullHardwareBufferManager.h"
+	"Include/BsNullIndexBuffer.h"
+	"Include/BsNullPrerequisites.h"
+	"Include/BsNullQuery.h"
+	"Include/BsNullQueryManager.h"
+	"Include/BsNullRenderAPI.h"
+	"Include/BsNullRenderAPIFactory.h"
+	"Include/BsNullRenderAPITestSuite.h"
+	"Include/BsNullRenderTexture.h"
+	"Include/BsNullRenderWindow.h"
+	"Include/BsNullRenderWindowManager.h"
+	"Include/BsNullTexture.h"
+	"Include/BsNullTextureManager.h"
+	"Include/BsNullVertexBuffer.h"
+	"Include/BsNullVideoModeInfo.h"
+)
+
+set(BS_BANSHEENULLRENDERAPI_SRC_NOFILTER
+	"Source/BsNullCommandStream.cpp"
+	"Source/BsNullGpuBuffer.cpp"
+	"Source/BsNullGpuProgram.cpp"
+	"Source/BsNullHLSLParamParser.cpp"
+	"Source/BsNullHardwareBuffer.cpp"
+	"Source/BsNullHardwareBufferManager.cpp"
+	"Source/BsNullIndexBuffer.cpp"
+	"Source/BsNullPlugin.cpp"
+	"Source/BsNullQuery.cpp"
+	"Source/BsNullQueryManager.cpp"
+	"Source/BsNullRenderAPI.cpp"
+	"Source/BsNullRenderAPIFactory.cpp"
+	"Source/BsNullRenderAPITestSuite.cpp"
+	"Source/BsNullRenderTexture.cpp"
+	"Source/BsNullRenderWindow.cpp"
+	"Source/BsNullRenderWindowManager.cpp"
+	"Source/BsNullTexture.cpp"
+	"Source/BsNullTextureManager.cpp"
+	"Source/BsNullVertexBuffer.cpp"
+	"Source/BsNullVideoModeInfo.cpp"
+)
+
+source_group("Header Files" FILES ${BS_BANSHEENULLRENDERAPI_INC_NOFILTER})
+source_group("Source Files" FILES ${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER})
+
+set(BS_BANSHEENULLRENDERAPI_SRC
+	${BS_BANSHEENULLRENDERAPI_INC_NOFILTER}
+	${BS_BANSHEENULLRENDERAPI_SRC_NOFILTER}
+)
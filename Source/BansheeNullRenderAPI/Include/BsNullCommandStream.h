@@ -0,0 +1,125 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/** Types of RenderAPICore calls that are counted and recorded by the null render API. */
+	enum NullRenderAPICall
+	{
+		NRC_SetSamplerState,
+		NRC_SetBlendState,
+		NRC_SetRasterizerState,
+		NRC_SetDepthStencilState,
+		NRC_SetTexture,
+		NRC_SetLoadStoreTexture,
+		NRC_BeginFrame,
+		NRC_EndFrame,
+		NRC_ClearRenderTarget,
+		NRC_ClearViewport,
+		NRC_SetRenderTarget,
+		NRC_SetViewport,
+		NRC_SetScissorRect,
+		NRC_SetVertexBuffers,
+		NRC_SetIndexBuffer,
+		NRC_SetVertexDeclaration,
+		NRC_SetDrawOperation,
+		NRC_Draw,
+		NRC_DrawIndexed,
+		NRC_DispatchCompute,
+		NRC_BindGpuProgram,
+		NRC_UnbindGpuProgram,
+		NRC_SetConstantBuffers,
+		NRC_SetClipPlanes,
+		NRC_SwapBuffers,
+		NRC_Count // Keep at end
+	};
+
+	/**
+	 * A single recorded render API call. Call arguments are not stored in the command itself but in the arrays of the
+	 * NullCommandStream that owns it.
+	 */
+	struct NullCommand
+	{
+		NullRenderAPICall type;
+		UINT32 firstArg;
+		UINT32 numArgs;
+		UINT32 firstObject;
+		UINT32 numObjects;
+	};
+
+	/**
+	 * Stream of render API calls recorded by the null render API. Recorded objects are the null render API's own 
+	 * resources, so the stream can only be inspected or replayed on a null render API.
+	 *
+	 * Arguments of all commands are stored in two shared arrays (one for plain values and one for object references), so
+	 * recording doesn't allocate once the arrays have grown to the size of a typical frame.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_NULL_EXPORT NullCommandStream
+	{
+	public:
+		/** Starts a new command of the specified type. Arguments added afterwards belong to this command. */
+		void beginCommand(NullRenderAPICall type);
+
+		/** Appends an integer argument to the command started by the last call to beginCommand(). */
+		void addArg(UINT32 value);
+
+		/** Appends a floating point argument to the command started by the last call to beginCommand(). */
+		void addArg(float value);
+
+		/** Appends an object argument to the command started by the last call to beginCommand(). */
+		void addObject(const SPtr<CoreObjectCore>& object);
+
+		/** Removes all recorded commands. Internal buffers are kept so they can be reused by subsequent recordings. */
+		void clear();
+
+		/** Returns the number of recorded commands. */
+		UINT32 getNumCommands() const { return (UINT32)mCommands.size(); }
+
+		/** Returns a recorded command at the specified index. */
+		const NullCommand& getCommand(UINT32 idx) const { return mCommands[idx]; }
+
+		/** Returns an integer argument of the provided command. */
+		UINT32 getArgUInt(const NullCommand& command, UINT32 idx) const { return mArgs[command.firstArg + idx].u; }
+
+		/** Returns a floating point argument of the provided command. */
+		float getArgFloat(const NullCommand& command, UINT32 idx) const { return mArgs[command.firstArg + idx].f; }
+
+		/** Returns an object argument of the provided command, cast to the requested type. */
+		template<class T>
+		SPtr<T> getObject(const NullCommand& command, UINT32 idx) const
+		{
+			return std::static_pointer_cast<T>(mObjects[command.firstObject + idx]);
+		}
+
+		/**
+		 * Executes all the recorded commands, in order, on the provided render API. Must be a null render API, as the
+		 * recorded objects are its resources.
+		 *
+		 * @note	Core thread only.
+		 */
+		void replay(RenderAPICore& target) const;
+
+	private:
+		/** Storage for a single plain command argument. */
+		union Arg
+		{
+			UINT32 u;
+			float f;
+		};
+
+		Vector<NullCommand> mCommands;
+		Vector<Arg> mArgs;
+		Vector<SPtr<CoreObjectCore>> mObjects;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,57 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuBuffer.h"
+#include "BsNullHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**	Null implementation of a generic GPU buffer, backed by system memory. */
+	class BS_NULL_EXPORT NullGpuBufferCore : public GpuBufferCore
+	{
+	public:
+		~NullGpuBufferCore();
+
+		/** @copydoc GpuBufferCore::lock */
+		void* lock(UINT32 offset, UINT32 length, GpuLockOptions options) override;
+
+		/** @copydoc GpuBufferCore::unlock */
+		void unlock() override;
+
+		/** @copydoc GpuBufferCore::readData */
+		void readData(UINT32 offset, UINT32 length, void* pDest) override;
+
+		/** @copydoc GpuBufferCore::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* pSource,
+			BufferWriteType writeFlags = BufferWriteType::Normal) override;
+
+		/** @copydoc GpuBufferCore::copyData */
+		void copyData(GpuBufferCore& srcBuffer, UINT32 srcOffset,
+			UINT32 dstOffset, UINT32 length, bool discardWholeBuffer = false) override;
+
+	protected:
+		friend class NullHardwareBufferCoreManager;
+
+		NullGpuBufferCore(UINT32 elementCount, UINT32 elementSize, GpuBufferType type, 
+			GpuBufferUsage usage, bool randomGpuWrite = false, bool useCounter = false);
+
+		/** @copydoc GpuBufferCore::initialize */
+		void initialize() override;
+
+		/** @copydoc GpuBufferCore::createView */
+		GpuBufferView* createView() override;
+
+		/** @copydoc GpuBufferCore::destroyView */
+		void destroyView(GpuBufferView* view) override;
+
+		NullHardwareBuffer* mBuffer;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,57 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuProgram.h"
+#include "BsGpuProgramManager.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * GPU program that is never compiled. It always reports successful compilation, and its parameters are parsed
+	 * directly from the HLSL source so that materials can be created and their parameters set. Vertex programs report an
+	 * empty input declaration so they are compatible with any mesh.
+	 */
+	class BS_NULL_EXPORT NullGpuProgramCore : public GpuProgramCore
+	{
+	public:
+		virtual ~NullGpuProgramCore();
+
+	protected:
+		friend class NullGpuProgramFactory;
+
+		NullGpuProgramCore(const String& source, const String& entryPoint, GpuProgramType gptype,
+			GpuProgramProfile profile, bool isAdjacencyInfoRequired);
+
+		/** @copydoc GpuProgramCore::initialize */
+		void initialize() override;
+	};
+
+	/**
+	 * Handles creation of null GPU programs. Programs are expected to be in HLSL, as the null render API falls back to
+	 * DirectX 11 techniques.
+	 */
+	class BS_NULL_EXPORT NullGpuProgramFactory : public GpuProgramFactory
+	{
+	public:
+		/** @copydoc GpuProgramFactory::getLanguage */
+		const String& getLanguage() const override;
+
+		/** @copydoc GpuProgramFactory::create(const String&, const String&, GpuProgramType, GpuProgramProfile, bool) */
+		SPtr<GpuProgramCore> create(const String& source, const String& entryPoint, GpuProgramType gptype, 
+			GpuProgramProfile profile, bool requiresAdjacency) override;
+
+		/** @copydoc GpuProgramFactory::create(GpuProgramType) */
+		SPtr<GpuProgramCore> create(GpuProgramType type) override;
+
+	protected:
+		static const String LANGUAGE_NAME;
+	};
+
+	/** @} */
+}
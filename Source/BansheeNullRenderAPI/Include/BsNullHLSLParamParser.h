@@ -0,0 +1,157 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsGpuParamDesc.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * Extracts GPU program parameter descriptions directly from HLSL source, without compiling it. Constant buffers are
+	 * laid out using HLSL packing rules and resources are assigned registers the same way the HLSL compiler assigns
+	 * them, so the output matches what DirectX 11 reflection reports for the same program.
+	 *
+	 * Unlike reflection, parameters the program declares but never uses are reported as well. Preprocessor directives are
+	 * ignored, so parameters must not be declared through macros.
+	 */
+	class NullHLSLParamParser
+	{
+	public:
+		/**
+		 * Parses the provided HLSL source and outputs descriptions of all of its constant buffers, their members and
+		 * resources.
+		 *
+		 * @param[in]	source	HLSL source code of a single GPU program.
+		 * @param[out]	desc	Output object that will contain parameter descriptions.
+		 */
+		void parse(const String& source, GpuParamDesc& desc);
+
+	private:
+		/** Types of tokens the source is split into. */
+		enum class TokenType
+		{
+			Identifier, Number, Symbol, End
+		};
+
+		/** Single token in the source code. */
+		struct Token
+		{
+			TokenType type;
+			String text;
+		};
+
+		/** Data type of a constant buffer member. Size is in multiples of 4 bytes. */
+		struct DataType
+		{
+			GpuParamDataType type;
+			UINT32 size;
+		};
+
+		/** Constant buffer member, or a global variable placed in the default constant buffer. */
+		struct Variable
+		{
+			String name;
+			DataType dataType;
+			UINT32 arraySize;
+			INT32 packOffset; /**< Offset provided in the source through packoffset(), or -1. */
+			UINT32 offset; /**< In multiples of 4 bytes. */
+		};
+
+		/** Object (texture, sampler, buffer) parameter, before it is assigned a register. */
+		struct Resource
+		{
+			String name;
+			GpuParamObjectType type;
+			char registerType;
+			UINT32 count;
+			INT32 slot; /**< Register provided in the source, or -1. */
+		};
+
+		/** Constant buffer, before it is assigned a register. */
+		struct ConstantBuffer
+		{
+			String name;
+			Vector<Variable> variables;
+			bool isShareable;
+			char registerType; /**< 'b' for cbuffers, 't' for tbuffers. */
+			INT32 slot; /**< Register provided in the source, or -1. */
+		};
+
+		/** Splits the source into tokens, skipping comments and preprocessor directives. */
+		void tokenize(const String& source);
+
+		/** Parses a struct declaration and records its size. */
+		void parseStruct();
+
+		/** Parses a cbuffer or a tbuffer declaration. */
+		void parseConstantBuffer();
+
+		/**
+		 * Parses a global declaration of a variable, resource or a function. Variables are added to the default constant
+		 * buffer.
+		 */
+		void parseDeclaration(Vector<Variable>& globals);
+
+		/**
+		 * Parses declarations of one or multiple variables of the same type, until the closing ';'. Variables are only
+		 * output if @p output is not null.
+		 */
+		void parseVariables(const String& typeName, bool rowMajor, Vector<Variable>* output);
+
+		/** Parses declarations of one or multiple resources of the same type, until the closing ';'. */
+		void parseResources(GpuParamObjectType type, char registerType);
+
+		/** Parses an optional array size following a name. Returns 1 if the name isn't an array. */
+		UINT32 parseArraySize();
+
+		/**
+		 * Parses an optional register(), packoffset() or semantic following a name. Outputs the register or pack offset,
+		 * or -1 if none.
+		 */
+		void parseBinding(char registerType, INT32& slot, INT32& packOffset);
+
+		/** Looks up a data type from its name. Returns false if the type can't be part of a constant buffer. */
+		bool getDataType(const String& name, bool rowMajor, DataType& type) const;
+
+		/**
+		 * Looks up a resource type from its name. Returns false if the name doesn't refer to a resource type, or the
+		 * resource type isn't supported.
+		 */
+		bool getResourceType(const String& name, GpuParamObjectType& type, char& registerType) const;
+
+		/** Assigns offsets to the variables using HLSL packing rules. Returns the total size, in multiples of 4 bytes. */
+		static UINT32 layoutVariables(Vector<Variable>& variables);
+
+		/** Returns the token at the provided offset from the current token. */
+		const Token& peek(UINT32 offset = 0) const;
+
+		/** Moves to the next token and returns the current one. */
+		const Token& next();
+
+		/** Checks if the current token is the provided symbol. */
+		bool isSymbol(char symbol) const;
+
+		/** Checks if the current token is the provided identifier. */
+		bool isIdentifier(const char* name) const;
+
+		/** Skips a block starting at the current token, up to and including the matching closing symbol. */
+		void skipBlock(char open, char close);
+
+		/** Skips tokens up to and including the next ';' not contained in a nested block. */
+		void skipStatement();
+
+		Vector<Token> mTokens;
+		UINT32 mCurrent = 0;
+
+		UnorderedMap<String, UINT32> mStructSizes;
+		Vector<ConstantBuffer> mConstantBuffers;
+		Vector<Resource> mResources;
+	};
+
+	/** @} */
+}
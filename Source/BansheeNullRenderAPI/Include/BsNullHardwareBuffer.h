@@ -0,0 +1,41 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/** System memory storage used by null vertex, index and generic buffers in place of GPU memory. */
+	class BS_NULL_EXPORT NullHardwareBuffer
+	{
+	public:
+		NullHardwareBuffer(UINT32 size);
+		~NullHardwareBuffer();
+
+		/** Returns a pointer to the buffer memory at the specified offset. */
+		void* lock(UINT32 offset, UINT32 length);
+
+		/** Copies a portion of the buffer memory into the provided buffer. */
+		void readData(UINT32 offset, UINT32 length, void* dest) const;
+
+		/** Copies data from the provided buffer into a portion of the buffer memory. */
+		void writeData(UINT32 offset, UINT32 length, const void* source);
+
+		/** Copies a portion of another buffer's memory into this buffer. */
+		void copyData(const NullHardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length);
+
+		/** Returns the size of the buffer in bytes. */
+		UINT32 getSize() const { return mSize; }
+
+	private:
+		UINT8* mData;
+		UINT32 mSize;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,34 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsHardwareBufferManager.h"
+
+namespace BansheeEngine 
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**	Handles creation of null hardware buffers. All buffers are backed by system memory. */
+	class BS_NULL_EXPORT NullHardwareBufferCoreManager : public HardwareBufferCoreManager
+	{
+	protected:
+		/** @copydoc HardwareBufferCoreManager::createVertexBufferInternal */
+		SPtr<VertexBufferCore> createVertexBufferInternal(UINT32 vertexSize, 
+			UINT32 numVerts, GpuBufferUsage usage, bool streamOut = false) override;
+
+		/** @copydoc HardwareBufferCoreManager::createIndexBufferInternal */
+		SPtr<IndexBufferCore> createIndexBufferInternal(IndexType itype, UINT32 numIndices, GpuBufferUsage usage) override;
+
+		/** @copydoc HardwareBufferCoreManager::createGpuParamBlockBufferInternal */
+		SPtr<GpuParamBlockBufferCore> createGpuParamBlockBufferInternal(UINT32 size, GpuParamBlockUsage usage = GPBU_DYNAMIC) override;
+
+		/** @copydoc HardwareBufferCoreManager::createGpuBufferInternal */
+		SPtr<GpuBufferCore> createGpuBufferInternal(UINT32 elementCount, UINT32 elementSize, 
+			GpuBufferType type, GpuBufferUsage usage, bool randomGpuWrite = false, bool useCounter = false) override;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,51 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsCorePrerequisites.h"
+
+/** @addtogroup Plugins
+ *  @{
+ */
+
+/** @defgroup Null BansheeNullRenderAPI
+ *	Render API that doesn't talk to any GPU or windowing system. Used for headless benchmarking and testing of the
+ *	renderer.
+ */
+
+/** @} */
+
+namespace BansheeEngine
+{
+	class NullRenderAPI;
+	class NullRenderAPIFactory;
+	class NullCommandStream;
+	class NullTextureCore;
+	class NullTextureManager;
+	class NullTextureCoreManager;
+	class NullRenderWindow;
+	class NullRenderWindowCore;
+	class NullHardwareBufferCoreManager;
+	class NullVertexBufferCore;
+	class NullIndexBufferCore;
+	class NullGpuBufferCore;
+	class NullGpuProgramCore;
+	class NullGpuProgramFactory;
+	class NullQueryManager;
+
+#if (BS_PLATFORM == BS_PLATFORM_WIN32) && !defined(BS_STATIC_LIB)
+#	ifdef BS_RSNULL_EXPORTS
+#		define BS_NULL_EXPORT __declspec(dllexport)
+#	else
+#       if defined( __MINGW32__ )
+#           define BS_NULL_EXPORT
+#       else
+#    		define BS_NULL_EXPORT __declspec(dllimport)
+#       endif
+#	endif
+#elif defined (BS_GCC_VISIBILITY)
+#    define BS_NULL_EXPORT  __attribute__ ((visibility("default")))
+#else
+#	define BS_NULL_EXPORT
+#endif
+}
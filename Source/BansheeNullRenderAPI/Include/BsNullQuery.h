@@ -0,0 +1,86 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsEventQuery.h"
+#include "BsTimerQuery.h"
+#include "BsOcclusionQuery.h"
+#include "BsTimer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/** Event query that is considered complete as soon as it is issued. */
+	class BS_NULL_EXPORT NullEventQuery : public EventQuery
+	{
+	public:
+		NullEventQuery();
+		~NullEventQuery();
+
+		/** @copydoc EventQuery::begin */
+		void begin() override;
+
+		/** @copydoc EventQuery::isReady */
+		bool isReady() const override;
+	};
+
+	/**
+	 * Timer query that measures the time the CPU spent between the begin() and end() calls, since there is no GPU work
+	 * to measure.
+	 */
+	class BS_NULL_EXPORT NullTimerQuery : public TimerQuery
+	{
+	public:
+		NullTimerQuery();
+		~NullTimerQuery();
+
+		/** @copydoc TimerQuery::begin */
+		void begin() override;
+
+		/** @copydoc TimerQuery::end */
+		void end() override;
+
+		/** @copydoc TimerQuery::isReady */
+		bool isReady() const override;
+
+		/** @copydoc TimerQuery::getTimeMs */
+		float getTimeMs() override;
+
+	private:
+		Timer mTimer;
+		bool mQueryEndCalled;
+		float mTimeDelta;
+	};
+
+	/** 
+	 * Occlusion query that is complete as soon as it is ended. It always reports a single sample so that any geometry it
+	 * is used on is considered visible.
+	 */
+	class BS_NULL_EXPORT NullOcclusionQuery : public OcclusionQuery
+	{
+	public:
+		NullOcclusionQuery(bool binary);
+		~NullOcclusionQuery();
+
+		/** @copydoc OcclusionQuery::begin */
+		void begin() override;
+
+		/** @copydoc OcclusionQuery::end */
+		void end() override;
+
+		/** @copydoc OcclusionQuery::isReady */
+		bool isReady() const override;
+
+		/** @copydoc OcclusionQuery::getNumSamples */
+		UINT32 getNumSamples() override;
+
+	private:
+		bool mQueryEndCalled;
+	};
+
+	/** @} */
+}
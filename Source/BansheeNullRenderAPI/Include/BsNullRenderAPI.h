@@ -0,0 +1,189 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsNullCommandStream.h"
+#include "BsRenderAPI.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * Implementation of a render API that doesn't require a GPU or a window. All calls are no-ops apart from keeping
+	 * track of bound state, and all resources are either empty or backed by system memory. This makes it possible to
+	 * measure the CPU cost of the renderer on machines without a graphics device.
+	 *
+	 * Every call is counted, and can optionally be recorded into a NullCommandStream so it can be inspected.
+	 *
+	 * Shaders have no techniques written for the null API, so it falls back to the DirectX 11 techniques and accepts their
+	 * HLSL GPU programs. The programs are never compiled, but their parameters are parsed from the source so materials
+	 * and GPU parameters work the same as on a real render API.
+	 */
+	class BS_NULL_EXPORT NullRenderAPI : public RenderAPICore
+	{
+	public:
+		NullRenderAPI();
+		~NullRenderAPI();
+
+		/** @copydoc RenderAPICore::getName */
+		const StringID& getName() const override;
+
+		/** @copydoc RenderAPICore::getShadingLanguageName */
+		const String& getShadingLanguageName() const override;
+
+		/** @copydoc RenderAPICore::getTechniqueFallbackName */
+		const StringID& getTechniqueFallbackName() const override;
+
+		/** @copydoc RenderAPICore::setBlendStateImpl */
+		void setBlendStateImpl(const SPtr<BlendStateCore>& blendState) override;
+
+		/** @copydoc RenderAPICore::setRasterizerStateImpl */
+		void setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState) override;
+
+		/** @copydoc RenderAPICore::setDepthStencilStateImpl */
+		void setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue) override;
+
+		/** @copydoc RenderAPICore::setSamplerStateImpl */
+		void setSamplerStateImpl(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState) override;
+
+		/** @copydoc RenderAPICore::setTextureImpl */
+		void setTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr) override;
+
+		/** @copydoc RenderAPICore::setLoadStoreTextureImpl */
+		void setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 texUnit, bool enabled, const SPtr<TextureCore>& texPtr,
+			const TextureSurface& surface) override;
+
+		/** @copydoc RenderAPICore::beginFrame */
+		void beginFrame() override;
+
+		/** @copydoc RenderAPICore::endFrame */
+		void endFrame() override;
+
+		/** @copydoc RenderAPICore::clearRenderTarget */
+		void clearRenderTarget(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF) override;
+
+		/** @copydoc RenderAPICore::clearViewport */
+		void clearViewport(UINT32 buffers, const Color& color = Color::Black, float depth = 1.0f, UINT16 stencil = 0,
+			UINT8 targetMask = 0xFF) override;
+
+		/** @copydoc RenderAPICore::setRenderTargetImpl */
+		void setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil) override;
+
+		/** @copydoc RenderAPICore::setViewport */
+		void setViewport(const Rect2& area) override;
+
+		/** @copydoc RenderAPICore::setScissorRect */
+		void setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom) override;
+
+		/** @copydoc RenderAPICore::setVertexBuffersImpl */
+		void setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers) override;
+
+		/** @copydoc RenderAPICore::setIndexBufferImpl */
+		void setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer) override;
+
+		/** @copydoc RenderAPICore::setVertexDeclarationImpl */
+		void setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration) override;
+
+		/** @copydoc RenderAPICore::setDrawOperationImpl */
+		void setDrawOperationImpl(DrawOperationType op) override;
+
+		/** @copydoc RenderAPICore::draw */
+		void draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount = 0) override;
+
+		/** @copydoc RenderAPICore::drawIndexed */
+		void drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+			UINT32 instanceCount = 0) override;
+
+		/** @copydoc RenderAPICore::dispatchCompute */
+		void dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY = 1, UINT32 numGroupsZ = 1) override;
+
+		/** @copydoc RenderAPICore::swapBuffers */
+		void swapBuffers(const SPtr<RenderTargetCore>& target) override;
+
+		/** @copydoc RenderAPICore::bindGpuProgramImpl */
+		void bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg) override;
+
+		/** @copydoc RenderAPICore::unbindGpuProgramImpl */
+		void unbindGpuProgramImpl(GpuProgramType gptype) override;
+
+		/** @copydoc RenderAPICore::setConstantBuffers */
+		void setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& params) override;
+
+		/** @copydoc RenderAPICore::setClipPlanes */
+		void setClipPlanes(const PlaneList& clipPlanes) override;
+
+		/** @copydoc RenderAPICore::setClipPlanesImpl */
+		void setClipPlanesImpl(const PlaneList& clipPlanes) override;
+
+		/** @copydoc RenderAPICore::convertProjectionMatrix */
+		void convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest) override;
+
+		/** @copydoc RenderAPICore::getAPIInfo */
+		const RenderAPIInfo& getAPIInfo() const override;
+
+		/** @copydoc RenderAPICore::generateParamBlockDesc() */
+		GpuParamBlockDesc generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params) override;
+
+		/************************************************************************/
+		/* 				Call counting & recording                  				*/
+		/************************************************************************/
+
+		/** Returns the number of times the provided call was made since the counters were last reset. */
+		UINT64 getCallCount(NullRenderAPICall call) const { return mCallCounts[call]; }
+
+		/** Resets all call counters to zero. */
+		void resetCallCounts();
+
+		/**
+		 * Starts recording all render API calls into a command stream, retrievable through getRecording(). Any previously
+		 * recorded commands are discarded.
+		 */
+		void startRecording();
+
+		/** Stops recording render API calls. Already recorded commands remain available through getRecording(). */
+		void stopRecording();
+
+		/** Checks is the render API currently recording calls. */
+		bool isRecording() const { return mIsRecording; }
+
+		/** Returns the stream containing calls recorded between the last startRecording() and stopRecording() calls. */
+		const NullCommandStream& getRecording() const { return mRecording; }
+
+	protected:
+		friend class NullRenderAPIFactory;
+
+		/** @copydoc RenderAPICore::initializePrepare */
+		void initializePrepare() override;
+
+		/** @copydoc RenderAPICore::initializeFinalize */
+		void initializeFinalize(const SPtr<RenderWindowCore>& primaryWindow) override;
+
+		/** @copydoc RenderAPICore::destroyCore */
+		void destroyCore() override;
+
+		/** Creates and populates a set of render system capabilities describing which functionality is available. */
+		RenderAPICapabilities* createRenderSystemCapabilities() const;
+
+		/**
+		 * Increments the counter for the provided call and returns true if the call should also be recorded, in which
+		 * case the caller is expected to append its arguments to the recording.
+		 */
+		bool registerCall(NullRenderAPICall call);
+
+	private:
+		NullGpuProgramFactory* mGpuProgramFactory;
+
+		UINT64 mCallCounts[NRC_Count];
+		NullCommandStream mRecording;
+		bool mIsRecording;
+
+		DrawOperationType mActiveDrawOp;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,80 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of unit tests and benchmarks for render API functionality that is shared between render APIs, 
+	 * verified by inspecting the calls recorded by the null render API, or the parameters it parsed from program source.
+	 * Tests expect the core thread to be running and the null render API to be the active render API.
+	 */
+	class BS_NULL_EXPORT NullRenderAPITestSuite : public TestSuite
+	{
+	public:
+		NullRenderAPITestSuite();
+
+	private:
+		/** @copydoc TestSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc TestSuite::shutDown */
+		void shutDown() override;
+
+		/** Tests that commands recorded in a RenderCommandBuffer are executed in order and with the recorded arguments. */
+		void CommandBufferExecute();
+
+		/** Core thread part of CommandBufferExecute(). */
+		void CommandBufferExecuteCore();
+
+		/**
+		 * Tests that command buffers recorded in parallel on worker threads execute in the order the buffers are
+		 * submitted in, regardless of the order they were recorded in.
+		 */
+		void CommandBufferWorkerOrder();
+
+		/** Core thread part of CommandBufferWorkerOrder(). */
+		void CommandBufferWorkerOrderCore();
+
+		/**
+		 * Tests that parameter block buffers assigned through a RenderCommandBuffer are only assigned when the commands
+		 * execute, in order with the constant buffer binds around them.
+		 */
+		void CommandBufferParamBlockOrder();
+
+		/** Core thread part of CommandBufferParamBlockOrder(). */
+		void CommandBufferParamBlockOrderCore();
+
+		/**
+		 * Tests that material data parameters accessed by index respect parameter types and array bounds, match values
+		 * accessed by name, and are synced to the core thread material.
+		 */
+		void MaterialDataParams();
+
+		/** Core thread part of MaterialDataParams(). */
+		void MaterialDataParamsCore(const SPtr<MaterialCore>& material);
+
+		/** Assigns a set of material data parameters a number of times, looking each parameter up by name. */
+		void MaterialSetParamsByName();
+
+		/** 
+		 * Assigns the same parameters as MaterialSetParamsByName(), using parameter indices resolved before the
+		 * benchmark. 
+		 */
+		void MaterialSetParamsByIndex();
+
+		/** Assigns the same parameters as MaterialSetParamsByName(), using handles retrieved before the benchmark. */
+		void MaterialSetParamsByHandle();
+
+		HMaterial mBenchmarkMaterial;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,94 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsRenderTexture.h"
+#include "BsMultiRenderTexture.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * Null implementation of a render texture. Rendering into it has no effect on the contents of its surfaces.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_NULL_EXPORT NullRenderTextureCore : public RenderTextureCore
+	{
+	public:
+		NullRenderTextureCore(const RENDER_TEXTURE_CORE_DESC& desc);
+		virtual ~NullRenderTextureCore() { }
+
+	protected:
+		/** @copydoc RenderTextureCore::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		RenderTextureProperties mProperties;
+	};
+
+	/**
+	 * Null implementation of a render texture.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_NULL_EXPORT NullRenderTexture : public RenderTexture
+	{
+	public:
+		virtual ~NullRenderTexture() { }
+
+	protected:
+		friend class NullTextureManager;
+
+		NullRenderTexture(const RENDER_TEXTURE_DESC& desc);
+
+		/** @copydoc RenderTexture::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		RenderTextureProperties mProperties;
+	};
+
+	/**
+	 * Null implementation of a render texture with multiple color surfaces.
+	 *
+	 * @note	Core thread only.
+	 */
+	class BS_NULL_EXPORT NullMultiRenderTextureCore : public MultiRenderTextureCore
+	{
+	public:
+		NullMultiRenderTextureCore(const MULTI_RENDER_TEXTURE_CORE_DESC& desc);
+		virtual ~NullMultiRenderTextureCore() { }
+
+	protected:
+		/** @copydoc MultiRenderTextureCore::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		MultiRenderTextureProperties mProperties;
+	};
+
+	/**
+	 * Null implementation of a render texture with multiple color surfaces.
+	 *
+	 * @note	Sim thread only.
+	 */
+	class BS_NULL_EXPORT NullMultiRenderTexture : public MultiRenderTexture
+	{
+	public:
+		virtual ~NullMultiRenderTexture() { }
+
+	protected:
+		friend class NullTextureManager;
+
+		NullMultiRenderTexture(const MULTI_RENDER_TEXTURE_DESC& desc);
+
+		/** @copydoc MultiRenderTexture::getProperties */
+		const RenderTargetProperties& getPropertiesInternal() const override { return mProperties; }
+
+		MultiRenderTextureProperties mProperties;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,56 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsTexture.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**
+	 * Null implementation of a texture. Texture contents are kept in system memory, allocated the first time a
+	 * sub-resource is accessed. Textures that are only ever rendered to or sampled from therefore require no memory.
+	 */
+	class BS_NULL_EXPORT NullTextureCore : public TextureCore
+	{
+	public:
+		~NullTextureCore();
+
+		/** @copydoc TextureCore::readData */
+		void readData(PixelData& dest, UINT32 mipLevel = 0, UINT32 face = 0) override;
+
+		/** @copydoc TextureCore::writeData */
+		void writeData(const PixelData& src, UINT32 mipLevel = 0, UINT32 face = 0, bool discardWholeBuffer = false) override;
+
+	protected:
+		friend class NullTextureCoreManager;
+
+		NullTextureCore(TextureType textureType, UINT32 width, UINT32 height, UINT32 depth, UINT32 numMipmaps,
+			PixelFormat format, int usage, bool hwGamma, UINT32 multisampleCount, UINT32 numArraySlices,
+			const SPtr<PixelData>& initialData);
+
+		/** @copydoc CoreObjectCore::initialize() */
+		void initialize() override;
+
+		/** @copydoc TextureCore::lockImpl */
+		PixelData lockImpl(GpuLockOptions options, UINT32 mipLevel = 0, UINT32 face = 0) override;
+
+		/** @copydoc TextureCore::unlockImpl */
+		void unlockImpl() override;
+
+		/** @copydoc TextureCore::copyImpl */
+		void copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel, 
+			const SPtr<TextureCore>& target) override;
+
+		/** Returns the system memory storage of the specified sub-resource, allocating it if needed. */
+		PixelData& getSubresourceData(UINT32 face, UINT32 mipLevel);
+
+		Vector<SPtr<PixelData>> mSubresourceData;
+	};
+
+	/** @} */
+}
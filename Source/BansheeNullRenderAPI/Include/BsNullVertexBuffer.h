@@ -0,0 +1,45 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsVertexBuffer.h"
+#include "BsNullHardwareBuffer.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/**	Null implementation of a vertex buffer, backed by system memory. */
+	class BS_NULL_EXPORT NullVertexBufferCore : public VertexBufferCore
+	{
+	public:
+		NullVertexBufferCore(UINT32 vertexSize, UINT32 numVertices, GpuBufferUsage usage, bool streamOut);
+		~NullVertexBufferCore();
+
+		/** @copydoc VertexBufferCore::readData */
+		void readData(UINT32 offset, UINT32 length, void* dest) override;
+
+		/** @copydoc VertexBufferCore::writeData */
+		void writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags = BufferWriteType::Normal) override;
+
+		/** @copydoc VertexBufferCore::copyData */
+		void copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length, bool discardWholeBuffer = false) override;
+
+	protected: 
+		/** @copydoc VertexBufferCore::lockImpl */
+		void* lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options) override;
+
+		/** @copydoc VertexBufferCore::unlockImpl */
+		void unlockImpl() override;
+
+		/** @copydoc VertexBufferCore::initialize */
+		void initialize() override;
+
+		NullHardwareBuffer* mBuffer;
+	};
+
+	/** @} */
+}
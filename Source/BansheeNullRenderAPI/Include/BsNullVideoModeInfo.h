@@ -0,0 +1,29 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsNullPrerequisites.h"
+#include "BsVideoModeInfo.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Null
+	 *  @{
+	 */
+
+	/** @copydoc VideoOutputInfo */
+	class BS_NULL_EXPORT NullVideoOutputInfo : public VideoOutputInfo
+	{
+	public:
+		NullVideoOutputInfo(UINT32 width, UINT32 height);
+	};
+
+	/** Describes a single virtual output device with a single video mode. */
+	class BS_NULL_EXPORT NullVideoModeInfo : public VideoModeInfo
+	{
+	public:
+		NullVideoModeInfo(UINT32 width, UINT32 height);
+	};
+
+	/** @} */
+}
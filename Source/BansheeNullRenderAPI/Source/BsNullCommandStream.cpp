@@ -0,0 +1,189 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullCommandStream.h"
+#include "BsRenderAPI.h"
+#include "BsRenderAPICapabilities.h"
+#include "BsSamplerState.h"
+#include "BsBlendState.h"
+#include "BsRasterizerState.h"
+#include "BsDepthStencilState.h"
+#include "BsTexture.h"
+#include "BsRenderTarget.h"
+#include "BsVertexBuffer.h"
+#include "BsIndexBuffer.h"
+#include "BsVertexDeclaration.h"
+#include "BsGpuProgram.h"
+#include "BsGpuParams.h"
+
+namespace BansheeEngine
+{
+	void NullCommandStream::beginCommand(NullRenderAPICall type)
+	{
+		NullCommand command;
+		command.type = type;
+		command.firstArg = (UINT32)mArgs.size();
+		command.numArgs = 0;
+		command.firstObject = (UINT32)mObjects.size();
+		command.numObjects = 0;
+
+		mCommands.push_back(command);
+	}
+
+	void NullCommandStream::addArg(UINT32 value)
+	{
+		Arg arg;
+		arg.u = value;
+
+		mArgs.push_back(arg);
+		mCommands.back().numArgs++;
+	}
+
+	void NullCommandStream::addArg(float value)
+	{
+		Arg arg;
+		arg.f = value;
+
+		mArgs.push_back(arg);
+		mCommands.back().numArgs++;
+	}
+
+	void NullCommandStream::addObject(const SPtr<CoreObjectCore>& object)
+	{
+		mObjects.push_back(object);
+		mCommands.back().numObjects++;
+	}
+
+	void NullCommandStream::clear()
+	{
+		mCommands.clear();
+		mArgs.clear();
+		mObjects.clear();
+	}
+
+	void NullCommandStream::replay(RenderAPICore& target) const
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		for (auto& command : mCommands)
+		{
+			switch (command.type)
+			{
+			case NRC_SetSamplerState:
+				target.setSamplerState((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getObject<SamplerStateCore>(command, 0));
+				break;
+			case NRC_SetBlendState:
+				target.setBlendState(getObject<BlendStateCore>(command, 0));
+				break;
+			case NRC_SetRasterizerState:
+				target.setRasterizerState(getObject<RasterizerStateCore>(command, 0));
+				break;
+			case NRC_SetDepthStencilState:
+				target.setDepthStencilState(getObject<DepthStencilStateCore>(command, 0), getArgUInt(command, 0));
+				break;
+			case NRC_SetTexture:
+				target.setTexture((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getArgUInt(command, 2) != 0, getObject<TextureCore>(command, 0));
+				break;
+			case NRC_SetLoadStoreTexture:
+			{
+				TextureSurface surface(getArgUInt(command, 3), getArgUInt(command, 4), getArgUInt(command, 5),
+					getArgUInt(command, 6));
+
+				target.setLoadStoreTexture((GpuProgramType)getArgUInt(command, 0), (UINT16)getArgUInt(command, 1),
+					getArgUInt(command, 2) != 0, getObject<TextureCore>(command, 0), surface);
+			}
+				break;
+			case NRC_BeginFrame:
+				target.beginFrame();
+				break;
+			case NRC_EndFrame:
+				target.endFrame();
+				break;
+			case NRC_ClearRenderTarget:
+			case NRC_ClearViewport:
+			{
+				UINT32 buffers = getArgUInt(command, 0);
+				Color color(getArgFloat(command, 1), getArgFloat(command, 2), getArgFloat(command, 3),
+					getArgFloat(command, 4));
+				float depth = getArgFloat(command, 5);
+				UINT16 stencil = (UINT16)getArgUInt(command, 6);
+				UINT8 targetMask = (UINT8)getArgUInt(command, 7);
+
+				if (command.type == NRC_ClearRenderTarget)
+					target.clearRenderTarget(buffers, color, depth, stencil, targetMask);
+				else
+					target.clearViewport(buffers, color, depth, stencil, targetMask);
+			}
+				break;
+			case NRC_SetRenderTarget:
+				target.setRenderTarget(getObject<RenderTargetCore>(command, 0), getArgUInt(command, 0) != 0);
+				break;
+			case NRC_SetViewport:
+				target.setViewport(Rect2(getArgFloat(command, 0), getArgFloat(command, 1), getArgFloat(command, 2),
+					getArgFloat(command, 3)));
+				break;
+			case NRC_SetScissorRect:
+				target.setScissorRect(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2),
+					getArgUInt(command, 3));
+				break;
+			case NRC_SetVertexBuffers:
+			{
+				SPtr<VertexBufferCore> buffers[MAX_BOUND_VERTEX_BUFFERS];
+
+				UINT32 numBuffers = std::min(command.numObjects, (UINT32)MAX_BOUND_VERTEX_BUFFERS);
+				for (UINT32 i = 0; i < numBuffers; i++)
+					buffers[i] = getObject<VertexBufferCore>(command, i);
+
+				target.setVertexBuffers(getArgUInt(command, 0), buffers, numBuffers);
+			}
+				break;
+			case NRC_SetIndexBuffer:
+				target.setIndexBuffer(getObject<IndexBufferCore>(command, 0));
+				break;
+			case NRC_SetVertexDeclaration:
+				target.setVertexDeclaration(getObject<VertexDeclarationCore>(command, 0));
+				break;
+			case NRC_SetDrawOperation:
+				target.setDrawOperation((DrawOperationType)getArgUInt(command, 0));
+				break;
+			case NRC_Draw:
+				target.draw(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2));
+				break;
+			case NRC_DrawIndexed:
+				target.drawIndexed(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2),
+					getArgUInt(command, 3), getArgUInt(command, 4));
+				break;
+			case NRC_DispatchCompute:
+				target.dispatchCompute(getArgUInt(command, 0), getArgUInt(command, 1), getArgUInt(command, 2));
+				break;
+			case NRC_BindGpuProgram:
+				target.bindGpuProgram(getObject<GpuProgramCore>(command, 0));
+				break;
+			case NRC_UnbindGpuProgram:
+				target.unbindGpuProgram((GpuProgramType)getArgUInt(command, 0));
+				break;
+			case NRC_SetConstantBuffers:
+				target.setConstantBuffers((GpuProgramType)getArgUInt(command, 0), getObject<GpuParamsCore>(command, 0));
+				break;
+			case NRC_SetClipPlanes:
+			{
+				PlaneList planes;
+				for (UINT32 i = 0; (i + 3) < command.numArgs; i += 4)
+				{
+					planes.push_back(Plane(getArgFloat(command, i + 0), getArgFloat(command, i + 1),
+						getArgFloat(command, i + 2), getArgFloat(command, i + 3)));
+				}
+
+				target.setClipPlanes(planes);
+			}
+				break;
+			case NRC_SwapBuffers:
+				target.swapBuffers(getObject<RenderTargetCore>(command, 0));
+				break;
+			default:
+				break;
+			}
+		}
+	}
+}
@@ -0,0 +1,87 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuBuffer.h"
+#include "BsGpuBufferView.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullGpuBufferCore::NullGpuBufferCore(UINT32 elementCount, UINT32 elementSize, GpuBufferType type, 
+		GpuBufferUsage usage, bool randomGpuWrite, bool useCounter)
+		: GpuBufferCore(elementCount, elementSize, type, usage, randomGpuWrite, useCounter), mBuffer(nullptr)
+	{
+	}
+
+	NullGpuBufferCore::~NullGpuBufferCore()
+	{
+		clearBufferViews();
+
+		if (mBuffer != nullptr)
+			bs_delete(mBuffer);
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuBuffer);
+	}
+
+	void NullGpuBufferCore::initialize()
+	{
+		const GpuBufferProperties& props = getProperties();
+		mBuffer = bs_new<NullHardwareBuffer>(props.getElementCount() * props.getElementSize());
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuBuffer);
+		GpuBufferCore::initialize();
+	}
+
+	void* NullGpuBufferCore::lock(UINT32 offset, UINT32 length, GpuLockOptions options)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_GpuBuffer);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+		}
+#endif
+
+		return mBuffer->lock(offset, length);
+	}
+
+	void NullGpuBufferCore::unlock()
+	{
+		// Do nothing, memory is always accessible
+	}
+
+	void NullGpuBufferCore::readData(UINT32 offset, UINT32 length, void* pDest)
+	{
+		mBuffer->readData(offset, length, pDest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_GpuBuffer);
+	}
+
+	void NullGpuBufferCore::writeData(UINT32 offset, UINT32 length, const void* pSource, BufferWriteType writeFlags)
+	{
+		mBuffer->writeData(offset, length, pSource);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_GpuBuffer);
+	}
+
+	void NullGpuBufferCore::copyData(GpuBufferCore& srcBuffer, UINT32 srcOffset,
+		UINT32 dstOffset, UINT32 length, bool discardWholeBuffer)
+	{
+		NullGpuBufferCore& nullSrcBuffer = static_cast<NullGpuBufferCore&>(srcBuffer);
+		mBuffer->copyData(*nullSrcBuffer.mBuffer, srcOffset, dstOffset, length);
+	}
+
+	GpuBufferView* NullGpuBufferCore::createView()
+	{
+		return bs_new<GpuBufferView>();
+	}
+
+	void NullGpuBufferCore::destroyView(GpuBufferView* view)
+	{
+		if (view != nullptr)
+			bs_delete(view);
+	}
+}
@@ -0,0 +1,66 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullGpuProgram.h"
+#include "BsNullHLSLParamParser.h"
+#include "BsHardwareBufferManager.h"
+#include "BsVertexDeclaration.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullGpuProgramCore::NullGpuProgramCore(const String& source, const String& entryPoint, GpuProgramType gptype,
+		GpuProgramProfile profile, bool isAdjacencyInfoRequired)
+		: GpuProgramCore(source, entryPoint, gptype, profile, isAdjacencyInfoRequired)
+	{ }
+
+	NullGpuProgramCore::~NullGpuProgramCore()
+	{
+		mInputDeclaration = nullptr;
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_GpuProgram);
+	}
+
+	void NullGpuProgramCore::initialize()
+	{
+		mIsCompiled = true;
+
+		if (!mProperties.getSource().empty())
+		{
+			NullHLSLParamParser parser;
+			parser.parse(mProperties.getSource(), *mParametersDesc);
+		}
+
+		if (mProperties.getType() == GPT_VERTEX_PROGRAM)
+			mInputDeclaration = HardwareBufferCoreManager::instance().createVertexDeclaration(List<VertexElement>());
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_GpuProgram);
+
+		GpuProgramCore::initialize();
+	}
+
+	const String NullGpuProgramFactory::LANGUAGE_NAME = "hlsl";
+
+	const String& NullGpuProgramFactory::getLanguage() const
+	{
+		return LANGUAGE_NAME;
+	}
+
+	SPtr<GpuProgramCore> NullGpuProgramFactory::create(const String& source, const String& entryPoint,
+		GpuProgramType gptype, GpuProgramProfile profile, bool requireAdjacencyInfo)
+	{
+		SPtr<GpuProgramCore> gpuProg = bs_shared_ptr<NullGpuProgramCore>(new (bs_alloc<NullGpuProgramCore>())
+			NullGpuProgramCore(source, entryPoint, gptype, profile, requireAdjacencyInfo));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+
+	SPtr<GpuProgramCore> NullGpuProgramFactory::create(GpuProgramType type)
+	{
+		SPtr<GpuProgramCore> gpuProg = bs_shared_ptr<NullGpuProgramCore>(new (bs_alloc<NullGpuProgramCore>())
+			NullGpuProgramCore("", "", type, GPP_NONE, false));
+		gpuProg->_setThisPtr(gpuProg);
+
+		return gpuProg;
+	}
+}
@@ -0,0 +1,864 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHLSLParamParser.h"
+#include "BsDebug.h"
+
+namespace BansheeEngine
+{
+	/** Rounds the provided size, in multiples of 4 bytes, up to a full 16 byte register. */
+	static UINT32 alignToRegister(UINT32 size)
+	{
+		return (size + 3) & ~3U;
+	}
+
+	void NullHLSLParamParser::parse(const String& source, GpuParamDesc& desc)
+	{
+		tokenize(source);
+
+		mCurrent = 0;
+		mStructSizes.clear();
+		mConstantBuffers.clear();
+		mResources.clear();
+
+		Vector<Variable> globals;
+		while (peek().type != TokenType::End)
+		{
+			if (isSymbol(';'))
+				next();
+			else if (isSymbol('[')) // Attributes
+				skipBlock('[', ']');
+			else if (isIdentifier("struct"))
+				parseStruct();
+			else if (isIdentifier("cbuffer") || isIdentifier("tbuffer"))
+				parseConstantBuffer();
+			else if (isIdentifier("typedef") || isIdentifier("namespace"))
+				skipStatement();
+			else
+				parseDeclaration(globals);
+		}
+
+		// Global variables are placed in a default buffer, which the compiler binds before any other unbound buffers
+		if (!globals.empty())
+		{
+			ConstantBuffer globalBuffer;
+			globalBuffer.name = "$Globals";
+			globalBuffer.variables = globals;
+			globalBuffer.isShareable = false;
+			globalBuffer.registerType = 'b';
+			globalBuffer.slot = -1;
+
+			mConstantBuffers.insert(mConstantBuffers.begin(), globalBuffer);
+		}
+
+		// Assign registers, explicitly bound parameters first and then the rest in declaration order to the lowest free
+		// register(s)
+		Map<char, Vector<bool>> usedRegisters;
+		auto allocateRegisters = [&](char registerType, UINT32 count, INT32 slot)
+		{
+			Vector<bool>& used = usedRegisters[registerType];
+
+			UINT32 start = 0;
+			if (slot >= 0)
+				start = (UINT32)slot;
+			else
+			{
+				UINT32 numFree = 0;
+				for (UINT32 i = 0; i < (UINT32)used.size() && numFree < count; i++)
+				{
+					if (used[i])
+					{
+						start = i + 1;
+						numFree = 0;
+					}
+					else
+						numFree++;
+				}
+			}
+
+			if (used.size() < start + count)
+				used.resize(start + count, false);
+
+			for (UINT32 i = 0; i < count; i++)
+				used[start + i] = true;
+
+			return start;
+		};
+
+		for (auto& buffer : mConstantBuffers)
+		{
+			if (buffer.slot >= 0)
+				allocateRegisters(buffer.registerType, 1, buffer.slot);
+		}
+
+		for (auto& resource : mResources)
+		{
+			if (resource.slot >= 0)
+				allocateRegisters(resource.registerType, resource.count, resource.slot);
+		}
+
+		for (auto& buffer : mConstantBuffers)
+		{
+			if (buffer.slot < 0)
+				buffer.slot = (INT32)allocateRegisters(buffer.registerType, 1, -1);
+
+			GpuParamBlockDesc blockDesc;
+			blockDesc.name = buffer.name;
+			blockDesc.slot = (UINT32)buffer.slot;
+			blockDesc.blockSize = alignToRegister(layoutVariables(buffer.variables));
+			blockDesc.isShareable = buffer.isShareable;
+
+			desc.paramBlocks[blockDesc.name] = blockDesc;
+
+			for (auto& variable : buffer.variables)
+			{
+				GpuParamDataDesc paramDesc;
+				paramDesc.name = variable.name;
+				paramDesc.type = variable.dataType.type;
+				paramDesc.elementSize = variable.dataType.size;
+				paramDesc.arraySize = variable.arraySize;
+				paramDesc.arrayElementStride = variable.arraySize > 1 ? alignToRegister(variable.dataType.size) :
+					variable.dataType.size;
+				paramDesc.paramBlockSlot = blockDesc.slot;
+				paramDesc.gpuMemOffset = variable.offset;
+				paramDesc.cpuMemOffset = variable.offset;
+
+				desc.params.insert(std::make_pair(paramDesc.name, paramDesc));
+			}
+		}
+
+		for (auto& resource : mResources)
+		{
+			if (resource.slot < 0)
+				resource.slot = (INT32)allocateRegisters(resource.registerType, resource.count, -1);
+
+			GpuParamObjectDesc objectDesc;
+			objectDesc.name = resource.name;
+			objectDesc.type = resource.type;
+			objectDesc.slot = (UINT32)resource.slot;
+
+			switch (resource.type)
+			{
+			case GPOT_SAMPLER2D:
+				desc.samplers.insert(std::make_pair(objectDesc.name, objectDesc));
+				break;
+			case GPOT_TEXTURE1D:
+			case GPOT_TEXTURE2D:
+			case GPOT_TEXTURE3D:
+			case GPOT_TEXTURECUBE:
+			case GPOT_TEXTURE2DMS:
+				desc.textures.insert(std::make_pair(objectDesc.name, objectDesc));
+				break;
+			case GPOT_RWTEXTURE1D:
+			case GPOT_RWTEXTURE2D:
+			case GPOT_RWTEXTURE3D:
+			case GPOT_RWTEXTURE2DMS:
+				desc.loadStoreTextures.insert(std::make_pair(objectDesc.name, objectDesc));
+				break;
+			default:
+				desc.buffers.insert(std::make_pair(objectDesc.name, objectDesc));
+				break;
+			}
+		}
+
+		mTokens.clear();
+	}
+
+	void NullHLSLParamParser::tokenize(const String& source)
+	{
+		mTokens.clear();
+
+		UINT32 length = (UINT32)source.size();
+		UINT32 i = 0;
+		bool lineStart = true;
+		while (i < length)
+		{
+			char ch = source[i];
+
+			if (ch == '\n')
+			{
+				lineStart = true;
+				i++;
+			}
+			else if (isspace((unsigned char)ch))
+				i++;
+			else if (ch == '#' && lineStart) // Preprocessor directive, skip until the end of the (continued) line
+			{
+				while (i < length && source[i] != '\n')
+				{
+					if (source[i] == '\\' && (i + 1) < length && (source[i + 1] == '\n' || source[i + 1] == '\r'))
+					{
+						i++;
+						if (source[i] == '\r' && (i + 1) < length && source[i + 1] == '\n')
+							i++;
+					}
+
+					i++;
+				}
+			}
+			else if (ch == '/' && (i + 1) < length && source[i + 1] == '/')
+			{
+				while (i < length && source[i] != '\n')
+					i++;
+			}
+			else if (ch == '/' && (i + 1) < length && source[i + 1] == '*')
+			{
+				i += 2;
+				while (i < length && !(source[i] == '*' && (i + 1) < length && source[i + 1] == '/'))
+					i++;
+
+				i += 2;
+			}
+			else if (ch == '"')
+			{
+				i++;
+				while (i < length && source[i] != '"')
+				{
+					if (source[i] == '\\')
+						i++;
+
+					i++;
+				}
+
+				i++;
+				lineStart = false;
+			}
+			else if (isalpha((unsigned char)ch) || ch == '_')
+			{
+				UINT32 start = i;
+				while (i < length && (isalnum((unsigned char)source[i]) || source[i] == '_'))
+					i++;
+
+				mTokens.push_back({ TokenType::Identifier, source.substr(start, i - start) });
+				lineStart = false;
+			}
+			else if (isdigit((unsigned char)ch) || (ch == '.' && (i + 1) < length && isdigit((unsigned char)source[i + 1])))
+			{
+				UINT32 start = i;
+				while (i < length)
+				{
+					char numCh = source[i];
+					if (isalnum((unsigned char)numCh) || numCh == '.')
+						i++;
+					else if ((numCh == '+' || numCh == '-') && (source[i - 1] == 'e' || source[i - 1] == 'E'))
+						i++;
+					else
+						break;
+				}
+
+				mTokens.push_back({ TokenType::Number, source.substr(start, i - start) });
+				lineStart = false;
+			}
+			else
+			{
+				mTokens.push_back({ TokenType::Symbol, String(1, ch) });
+				lineStart = false;
+				i++;
+			}
+		}
+	}
+
+	void NullHLSLParamParser::parseStruct()
+	{
+		next(); // "struct"
+
+		String name;
+		if (peek().type == TokenType::Identifier)
+			name = next().text;
+
+		if (!isSymbol('{'))
+		{
+			skipStatement();
+			return;
+		}
+
+		next(); // "{"
+
+		Vector<Variable> members;
+		while (peek().type != TokenType::End && !isSymbol('}'))
+		{
+			bool rowMajor = false;
+			while (isIdentifier("row_major") || isIdentifier("column_major") || isIdentifier("nointerpolation") ||
+				isIdentifier("linear") || isIdentifier("centroid") || isIdentifier("noperspective") ||
+				isIdentifier("sample") || isIdentifier("precise"))
+			{
+				rowMajor = isIdentifier("row_major");
+				next();
+			}
+
+			if (peek().type != TokenType::Identifier)
+			{
+				skipStatement();
+				continue;
+			}
+
+			String typeName = next().text;
+			if (isSymbol('<'))
+				skipBlock('<', '>');
+
+			parseVariables(typeName, rowMajor, &members);
+		}
+
+		if (isSymbol('}'))
+			next();
+
+		if (!name.empty())
+			mStructSizes[name] = layoutVariables(members);
+
+		// Skip any variables declared together with the struct, and the closing ';'
+		skipStatement();
+	}
+
+	void NullHLSLParamParser::parseConstantBuffer()
+	{
+		char registerType = isIdentifier("tbuffer") ? 't' : 'b';
+		next(); // "cbuffer" or "tbuffer"
+
+		if (peek().type != TokenType::Identifier)
+		{
+			skipStatement();
+			return;
+		}
+
+		ConstantBuffer buffer;
+		buffer.name = next().text;
+		buffer.isShareable = true;
+		buffer.registerType = registerType;
+
+		INT32 packOffset;
+		parseBinding(registerType, buffer.slot, packOffset);
+
+		if (!isSymbol('{'))
+		{
+			skipStatement();
+			return;
+		}
+
+		next(); // "{"
+
+		while (peek().type != TokenType::End && !isSymbol('}'))
+		{
+			bool rowMajor = false;
+			while (isIdentifier("row_major") || isIdentifier("column_major") || isIdentifier("uniform") ||
+				isIdentifier("precise"))
+			{
+				if (isIdentifier("row_major"))
+					rowMajor = true;
+				else if (isIdentifier("column_major"))
+					rowMajor = false;
+
+				next();
+			}
+
+			if (peek().type != TokenType::Identifier)
+			{
+				skipStatement();
+				continue;
+			}
+
+			String typeName = next().text;
+			if (isSymbol('<'))
+				skipBlock('<', '>');
+
+			parseVariables(typeName, rowMajor, &buffer.variables);
+		}
+
+		if (isSymbol('}'))
+			next();
+
+		mConstantBuffers.push_back(buffer);
+	}
+
+	void NullHLSLParamParser::parseDeclaration(Vector<Variable>& globals)
+	{
+		bool isStatic = false;
+		bool isGroupShared = false;
+		bool rowMajor = false;
+
+		while (peek().type == TokenType::Identifier)
+		{
+			if (isIdentifier("static"))
+				isStatic = true;
+			else if (isIdentifier("groupshared"))
+				isGroupShared = true;
+			else if (isIdentifier("row_major"))
+				rowMajor = true;
+			else if (isIdentifier("column_major"))
+				rowMajor = false;
+			else if (!isIdentifier("const") && !isIdentifier("uniform") && !isIdentifier("extern") &&
+				!isIdentifier("inline") && !isIdentifier("precise") && !isIdentifier("volatile") &&
+				!isIdentifier("shared"))
+				break;
+
+			next();
+		}
+
+		if (isIdentifier("struct"))
+		{
+			parseStruct();
+			return;
+		}
+
+		if (peek().type != TokenType::Identifier)
+		{
+			skipStatement();
+			return;
+		}
+
+		String typeName = next().text;
+		if (isSymbol('<'))
+			skipBlock('<', '>');
+
+		// Functions
+		if (peek().type == TokenType::Identifier && peek(1).type == TokenType::Symbol && peek(1).text[0] == '(')
+		{
+			next(); // Name
+			skipBlock('(', ')');
+
+			// Skip the return semantic, up to the body or the end of the prototype
+			while (peek().type != TokenType::End && !isSymbol('{') && !isSymbol(';'))
+				next();
+
+			if (isSymbol('{'))
+				skipBlock('{', '}');
+			else if (isSymbol(';'))
+				next();
+
+			return;
+		}
+
+		GpuParamObjectType resourceType;
+		char registerType;
+		if (getResourceType(typeName, resourceType, registerType))
+		{
+			if (isStatic)
+				skipStatement();
+			else
+				parseResources(resourceType, registerType);
+
+			return;
+		}
+
+		parseVariables(typeName, rowMajor, (isStatic || isGroupShared) ? nullptr : &globals);
+	}
+
+	void NullHLSLParamParser::parseVariables(const String& typeName, bool rowMajor, Vector<Variable>* output)
+	{
+		DataType dataType;
+		bool isValidType = getDataType(typeName, rowMajor, dataType);
+
+		while (peek().type == TokenType::Identifier)
+		{
+			Variable variable;
+			variable.name = next().text;
+			variable.arraySize = parseArraySize();
+			variable.offset = 0;
+
+			// Methods inside structs
+			if (isSymbol('('))
+			{
+				skipBlock('(', ')');
+
+				if (isSymbol('{'))
+					skipBlock('{', '}');
+				else
+					skipStatement();
+
+				return;
+			}
+
+			INT32 slot;
+			parseBinding('c', slot, variable.packOffset);
+
+			// Skip the initializer
+			if (isSymbol('='))
+			{
+				while (peek().type != TokenType::End && !isSymbol(',') && !isSymbol(';'))
+				{
+					if (isSymbol('{'))
+						skipBlock('{', '}');
+					else if (isSymbol('('))
+						skipBlock('(', ')');
+					else
+						next();
+				}
+			}
+
+			if (output != nullptr && isValidType)
+			{
+				variable.dataType = dataType;
+				output->push_back(variable);
+			}
+
+			if (!isSymbol(','))
+				break;
+
+			next(); // ","
+		}
+
+		skipStatement();
+	}
+
+	void NullHLSLParamParser::parseResources(GpuParamObjectType type, char registerType)
+	{
+		while (peek().type == TokenType::Identifier)
+		{
+			Resource resource;
+			resource.name = next().text;
+			resource.type = type;
+			resource.registerType = registerType;
+			resource.count = parseArraySize();
+
+			INT32 packOffset;
+			parseBinding(registerType, resource.slot, packOffset);
+
+			// Effect style sampler state initializers
+			if (isSymbol('{'))
+				skipBlock('{', '}');
+
+			mResources.push_back(resource);
+
+			if (!isSymbol(','))
+				break;
+
+			next(); // ","
+		}
+
+		skipStatement();
+	}
+
+	UINT32 NullHLSLParamParser::parseArraySize()
+	{
+		UINT32 arraySize = 1;
+		while (isSymbol('['))
+		{
+			next(); // "["
+
+			UINT32 dimension = 1;
+			if (peek().type == TokenType::Number)
+				dimension = std::max(parseUINT32(next().text), 1U);
+
+			// Sizes provided through macros or expressions can't be evaluated, treat them as a single element
+			while (peek().type != TokenType::End && !isSymbol(']'))
+				next();
+
+			if (isSymbol(']'))
+				next();
+
+			arraySize *= dimension;
+		}
+
+		return arraySize;
+	}
+
+	void NullHLSLParamParser::parseBinding(char registerType, INT32& slot, INT32& packOffset)
+	{
+		slot = -1;
+		packOffset = -1;
+
+		while (isSymbol(':'))
+		{
+			next(); // ":"
+
+			if (isIdentifier("register") || isIdentifier("packoffset"))
+			{
+				bool isRegister = isIdentifier("register");
+				next();
+
+				if (!isSymbol('('))
+					continue;
+
+				next(); // "("
+
+				while (peek().type != TokenType::End && !isSymbol(')'))
+				{
+					const Token& token = next();
+					if (token.type != TokenType::Identifier || token.text.size() < 2)
+						continue;
+
+					// Registers are in the form of "t3", pack offsets in the form of "c2" optionally followed by ".y"
+					char type = (char)tolower(token.text[0]);
+					if (!isdigit((unsigned char)token.text[1]))
+						continue;
+
+					UINT32 index = parseUINT32(token.text.substr(1));
+					if (isRegister && type == registerType)
+						slot = (INT32)index;
+					else if (!isRegister && type == 'c')
+					{
+						packOffset = (INT32)(index * 4);
+
+						if (isSymbol('.') && peek(1).type == TokenType::Identifier)
+						{
+							next(); // "."
+
+							static const char* COMPONENTS = "xyzw";
+							const char* component = strchr(COMPONENTS, next().text[0]);
+							if (component != nullptr)
+								packOffset += (INT32)(component - COMPONENTS);
+						}
+					}
+				}
+
+				if (isSymbol(')'))
+					next();
+			}
+			else if (peek().type == TokenType::Identifier) // Semantic
+				next();
+		}
+	}
+
+	bool NullHLSLParamParser::getDataType(const String& name, bool rowMajor, DataType& type) const
+	{
+		auto iterFindStruct = mStructSizes.find(name);
+		if (iterFindStruct != mStructSizes.end())
+		{
+			type.type = GPDT_STRUCT;
+			type.size = iterFindStruct->second;
+			return true;
+		}
+
+		String typeName = name;
+		if (typeName == "matrix")
+			typeName = "float4x4";
+		else if (typeName == "vector")
+			typeName = "float4";
+
+		static const char* FLOAT_TYPES[] = { "float", "half", "min16float", "min10float" };
+		static const char* INT_TYPES[] = { "int", "uint", "dword", "min16int", "min12int", "min16uint", "bool" };
+
+		bool isFloat = false;
+		bool isBool = false;
+		String dimensions;
+		for (auto& floatType : FLOAT_TYPES)
+		{
+			if (StringUtil::startsWith(typeName, floatType, false))
+			{
+				isFloat = true;
+				dimensions = typeName.substr(strlen(floatType));
+				break;
+			}
+		}
+
+		if (!isFloat)
+		{
+			bool isInt = false;
+			for (auto& intType : INT_TYPES)
+			{
+				if (StringUtil::startsWith(typeName, intType, false))
+				{
+					isInt = true;
+					isBool = strcmp(intType, "bool") == 0;
+					dimensions = typeName.substr(strlen(intType));
+					break;
+				}
+			}
+
+			if (!isInt)
+				return false;
+		}
+
+		// Scalar
+		if (dimensions.empty())
+		{
+			type.type = isFloat ? GPDT_FLOAT1 : (isBool ? GPDT_BOOL : GPDT_INT1);
+			type.size = 1;
+			return true;
+		}
+
+		if (!isdigit((unsigned char)dimensions[0]) || dimensions[0] < '1' || dimensions[0] > '4')
+			return false;
+
+		UINT32 rows = (UINT32)(dimensions[0] - '0');
+
+		// Vector
+		if (dimensions.size() == 1)
+		{
+			if (isFloat)
+				type.type = (GpuParamDataType)(GPDT_FLOAT1 + rows - 1);
+			else
+				type.type = (GpuParamDataType)(GPDT_INT1 + rows - 1);
+
+			type.size = rows;
+			return true;
+		}
+
+		// Matrix
+		if (dimensions.size() != 3 || dimensions[1] != 'x' || dimensions[2] < '1' || dimensions[2] > '4' || !isFloat)
+			return false;
+
+		UINT32 columns = (UINT32)(dimensions[2] - '0');
+		if (rows < 2 || columns < 2)
+			return false;
+
+		static const GpuParamDataType MATRIX_TYPES[3][3] =
+		{
+			{ GPDT_MATRIX_2X2, GPDT_MATRIX_2X3, GPDT_MATRIX_2X4 },
+			{ GPDT_MATRIX_3X2, GPDT_MATRIX_3X3, GPDT_MATRIX_3X4 },
+			{ GPDT_MATRIX_4X2, GPDT_MATRIX_4X3, GPDT_MATRIX_4X4 }
+		};
+
+		type.type = MATRIX_TYPES[rows - 2][columns - 2];
+
+		// Every row (or column, if column major) occupies its own register
+		if (rowMajor)
+			type.size = (rows - 1) * 4 + columns;
+		else
+			type.size = (columns - 1) * 4 + rows;
+
+		return true;
+	}
+
+	bool NullHLSLParamParser::getResourceType(const String& name, GpuParamObjectType& type, char& registerType) const
+	{
+		static const UnorderedMap<String, std::pair<GpuParamObjectType, char>> RESOURCE_TYPES =
+		{
+			{ "SamplerState", { GPOT_SAMPLER2D, 's' } },
+			{ "SamplerComparisonState", { GPOT_SAMPLER2D, 's' } },
+			{ "Texture1D", { GPOT_TEXTURE1D, 't' } },
+			{ "Texture2D", { GPOT_TEXTURE2D, 't' } },
+			{ "Texture3D", { GPOT_TEXTURE3D, 't' } },
+			{ "TextureCube", { GPOT_TEXTURECUBE, 't' } },
+			{ "Texture2DMS", { GPOT_TEXTURE2DMS, 't' } },
+			{ "StructuredBuffer", { GPOT_STRUCTURED_BUFFER, 't' } },
+			{ "ByteAddressBuffer", { GPOT_BYTE_BUFFER, 't' } },
+			{ "RWTexture1D", { GPOT_RWTEXTURE1D, 'u' } },
+			{ "RWTexture2D", { GPOT_RWTEXTURE2D, 'u' } },
+			{ "RWTexture3D", { GPOT_RWTEXTURE3D, 'u' } },
+			{ "RWTexture2DMS", { GPOT_RWTEXTURE2DMS, 'u' } },
+			{ "RWBuffer", { GPOT_RWTYPED_BUFFER, 'u' } },
+			{ "RWStructuredBuffer", { GPOT_RWSTRUCTURED_BUFFER, 'u' } },
+			{ "RWByteAddressBuffer", { GPOT_RWBYTE_BUFFER, 'u' } },
+			{ "AppendStructuredBuffer", { GPOT_RWAPPEND_BUFFER, 'u' } },
+			{ "ConsumeStructuredBuffer", { GPOT_RWCONSUME_BUFFER, 'u' } }
+		};
+
+		auto iterFind = RESOURCE_TYPES.find(name);
+		if (iterFind != RESOURCE_TYPES.end())
+		{
+			type = iterFind->second.first;
+			registerType = iterFind->second.second;
+			return true;
+		}
+
+		// Same resource types the DX11 render API doesn't support
+		static const char* UNSUPPORTED_TYPES[] = { "Texture1DArray", "Texture2DArray", "TextureCubeArray",
+			"Texture2DMSArray", "RWTexture1DArray", "RWTexture2DArray", "Buffer" };
+
+		for (auto& unsupportedType : UNSUPPORTED_TYPES)
+		{
+			if (name == unsupportedType)
+			{
+				LOGWRN("Skipping resource because it has unsupported type: " + name);
+				return false;
+			}
+		}
+
+		return false;
+	}
+
+	UINT32 NullHLSLParamParser::layoutVariables(Vector<Variable>& variables)
+	{
+		UINT32 offset = 0;
+		UINT32 size = 0;
+		for (auto& variable : variables)
+		{
+			if (variable.packOffset >= 0)
+				offset = (UINT32)variable.packOffset;
+			else
+			{
+				bool isScalarOrVector = variable.dataType.type <= GPDT_FLOAT4 ||
+					(variable.dataType.type >= GPDT_INT1 && variable.dataType.type <= GPDT_BOOL);
+
+				// Arrays, matrices and structs always start at a new register, other variables only if they'd
+				// otherwise straddle a register boundary
+				if (variable.arraySize > 1 || !isScalarOrVector || ((offset % 4) + variable.dataType.size) > 4)
+					offset = alignToRegister(offset);
+			}
+
+			variable.offset = offset;
+
+			UINT32 variableSize = variable.dataType.size;
+			if (variable.arraySize > 1)
+				variableSize += alignToRegister(variable.dataType.size) * (variable.arraySize - 1);
+
+			offset += variableSize;
+			size = std::max(size, offset);
+		}
+
+		return size;
+	}
+
+	const NullHLSLParamParser::Token& NullHLSLParamParser::peek(UINT32 offset) const
+	{
+		static const Token END_TOKEN = { TokenType::End, "" };
+
+		if ((mCurrent + offset) < (UINT32)mTokens.size())
+			return mTokens[mCurrent + offset];
+
+		return END_TOKEN;
+	}
+
+	const NullHLSLParamParser::Token& NullHLSLParamParser::next()
+	{
+		const Token& token = peek();
+		if (mCurrent < (UINT32)mTokens.size())
+			mCurrent++;
+
+		return token;
+	}
+
+	bool NullHLSLParamParser::isSymbol(char symbol) const
+	{
+		const Token& token = peek();
+		return token.type == TokenType::Symbol && token.text[0] == symbol;
+	}
+
+	bool NullHLSLParamParser::isIdentifier(const char* name) const
+	{
+		const Token& token = peek();
+		return token.type == TokenType::Identifier && token.text == name;
+	}
+
+	void NullHLSLParamParser::skipBlock(char open, char close)
+	{
+		UINT32 depth = 0;
+		while (peek().type != TokenType::End)
+		{
+			const Token& token = next();
+			if (token.type != TokenType::Symbol)
+				continue;
+
+			if (token.text[0] == open)
+				depth++;
+			else if (token.text[0] == close)
+			{
+				if (depth <= 1)
+					return;
+
+				depth--;
+			}
+		}
+	}
+
+	void NullHLSLParamParser::skipStatement()
+	{
+		while (peek().type != TokenType::End)
+		{
+			if (isSymbol('{'))
+				skipBlock('{', '}');
+			else if (isSymbol('('))
+				skipBlock('(', ')');
+			else if (isSymbol('['))
+				skipBlock('[', ']');
+			else if (isSymbol(';'))
+			{
+				next();
+				return;
+			}
+			else if (isSymbol('}')) // End of the enclosing block, leave it to the caller
+				return;
+			else
+				next();
+		}
+	}
+}
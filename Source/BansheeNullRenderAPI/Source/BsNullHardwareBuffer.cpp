@@ -0,0 +1,59 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHardwareBuffer.h"
+#include "BsException.h"
+
+namespace BansheeEngine
+{
+	NullHardwareBuffer::NullHardwareBuffer(UINT32 size)
+		:mData(nullptr), mSize(size)
+	{
+		if (mSize > 0)
+		{
+			mData = (UINT8*)bs_alloc(mSize);
+			memset(mData, 0, mSize);
+		}
+	}
+
+	NullHardwareBuffer::~NullHardwareBuffer()
+	{
+		if (mData != nullptr)
+			bs_free(mData);
+	}
+
+	void* NullHardwareBuffer::lock(UINT32 offset, UINT32 length)
+	{
+		if ((offset + length) > mSize)
+			BS_EXCEPT(InvalidParametersException, "Provided offset(" + toString(offset) + ") + length(" + toString(length) + ") "
+				"is larger than the buffer " + toString(mSize) + ".");
+
+		return mData + offset;
+	}
+
+	void NullHardwareBuffer::readData(UINT32 offset, UINT32 length, void* dest) const
+	{
+		if ((offset + length) > mSize)
+			BS_EXCEPT(InvalidParametersException, "Provided offset(" + toString(offset) + ") + length(" + toString(length) + ") "
+				"is larger than the buffer " + toString(mSize) + ".");
+
+		memcpy(dest, mData + offset, length);
+	}
+
+	void NullHardwareBuffer::writeData(UINT32 offset, UINT32 length, const void* source)
+	{
+		if ((offset + length) > mSize)
+			BS_EXCEPT(InvalidParametersException, "Provided offset(" + toString(offset) + ") + length(" + toString(length) + ") "
+				"is larger than the buffer " + toString(mSize) + ".");
+
+		memcpy(mData + offset, source, length);
+	}
+
+	void NullHardwareBuffer::copyData(const NullHardwareBuffer& srcBuffer, UINT32 srcOffset, UINT32 dstOffset, UINT32 length)
+	{
+		if ((srcOffset + length) > srcBuffer.mSize)
+			BS_EXCEPT(InvalidParametersException, "Source offset(" + toString(srcOffset) + ") + length(" + toString(length) + ") "
+				"is larger than the source buffer " + toString(srcBuffer.mSize) + ".");
+
+		writeData(dstOffset, length, srcBuffer.mData + srcOffset);
+	}
+}
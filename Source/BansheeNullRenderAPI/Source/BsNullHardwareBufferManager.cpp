@@ -0,0 +1,53 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullVertexBuffer.h"
+#include "BsNullIndexBuffer.h"
+#include "BsNullGpuBuffer.h"
+#include "BsGpuParamBlockBuffer.h"
+
+namespace BansheeEngine 
+{
+	SPtr<VertexBufferCore> NullHardwareBufferCoreManager::createVertexBufferInternal(UINT32 vertexSize, 
+		UINT32 numVerts, GpuBufferUsage usage, bool streamOut)
+	{
+		SPtr<NullVertexBufferCore> ret = bs_shared_ptr_new<NullVertexBufferCore>(vertexSize, numVerts, usage, streamOut);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<IndexBufferCore> NullHardwareBufferCoreManager::createIndexBufferInternal(IndexType itype, UINT32 numIndices, 
+		GpuBufferUsage usage)
+	{
+		SPtr<NullIndexBufferCore> ret = bs_shared_ptr_new<NullIndexBufferCore>(itype, numIndices, usage);
+		ret->_setThisPtr(ret);
+
+		return ret;
+	}
+
+	SPtr<GpuParamBlockBufferCore> NullHardwareBufferCoreManager::createGpuParamBlockBufferInternal(UINT32 size, 
+		GpuParamBlockUsage usage)
+	{
+		// Generic buffers keep their contents in system memory, which is exactly what we need
+		GenericGpuParamBlockBufferCore* paramBlockBuffer = 
+			new (bs_alloc<GenericGpuParamBlockBufferCore>()) GenericGpuParamBlockBufferCore(size, usage);
+
+		SPtr<GpuParamBlockBufferCore> paramBlockBufferPtr = bs_shared_ptr<GenericGpuParamBlockBufferCore>(paramBlockBuffer);
+		paramBlockBufferPtr->_setThisPtr(paramBlockBufferPtr);
+
+		return paramBlockBufferPtr;
+	}
+
+	SPtr<GpuBufferCore> NullHardwareBufferCoreManager::createGpuBufferInternal(UINT32 elementCount, UINT32 elementSize,
+		GpuBufferType type, GpuBufferUsage usage, bool randomGpuWrite, bool useCounter)
+	{
+		NullGpuBufferCore* buffer = new (bs_alloc<NullGpuBufferCore>()) 
+			NullGpuBufferCore(elementCount, elementSize, type, usage, randomGpuWrite, useCounter);
+
+		SPtr<GpuBufferCore> bufferPtr = bs_shared_ptr<NullGpuBufferCore>(buffer);
+		bufferPtr->_setThisPtr(bufferPtr);
+
+		return bufferPtr;
+	}
+}
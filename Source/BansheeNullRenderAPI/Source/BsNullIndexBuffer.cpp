@@ -0,0 +1,70 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullIndexBuffer.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullIndexBufferCore::NullIndexBufferCore(IndexType idxType, UINT32 numIndices, GpuBufferUsage usage)
+		:IndexBufferCore(idxType, numIndices, usage), mBuffer(nullptr)
+	{ }
+
+	NullIndexBufferCore::~NullIndexBufferCore()
+	{
+		if (mBuffer != nullptr)
+			bs_delete(mBuffer);
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_IndexBuffer);
+	}
+
+	void* NullIndexBufferCore::lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_IndexBuffer);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer);
+		}
+#endif
+
+		return mBuffer->lock(offset, length);
+	}
+
+	void NullIndexBufferCore::unlockImpl()
+	{
+		// Do nothing, memory is always accessible
+	}
+
+	void NullIndexBufferCore::readData(UINT32 offset, UINT32 length, void* dest)
+	{
+		mBuffer->readData(offset, length, dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_IndexBuffer);
+	}
+
+	void NullIndexBufferCore::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags)
+	{
+		mBuffer->writeData(offset, length, source);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_IndexBuffer);
+	}
+
+	void NullIndexBufferCore::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, 
+		UINT32 dstOffset, UINT32 length, bool discardWholeBuffer)
+	{
+		NullIndexBufferCore& nullSrcBuffer = static_cast<NullIndexBufferCore&>(srcBuffer);
+		mBuffer->copyData(*nullSrcBuffer.mBuffer, srcOffset, dstOffset, length);
+	}
+
+	void NullIndexBufferCore::initialize()
+	{
+		mBuffer = bs_new<NullHardwareBuffer>(mSizeInBytes);
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_IndexBuffer);
+		IndexBufferCore::initialize();
+	}
+}
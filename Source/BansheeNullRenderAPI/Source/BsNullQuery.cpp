@@ -0,0 +1,97 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullQuery.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullEventQuery::NullEventQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullEventQuery::~NullEventQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullEventQuery::begin()
+	{
+		setActive(true);
+	}
+
+	bool NullEventQuery::isReady() const
+	{
+		return true;
+	}
+
+	NullTimerQuery::NullTimerQuery()
+		:mQueryEndCalled(false), mTimeDelta(0.0f)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullTimerQuery::~NullTimerQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullTimerQuery::begin()
+	{
+		mTimer.reset();
+
+		mQueryEndCalled = false;
+		mTimeDelta = 0.0f;
+
+		setActive(true);
+	}
+
+	void NullTimerQuery::end()
+	{
+		mTimeDelta = mTimer.getMicroseconds() / 1000.0f;
+		mQueryEndCalled = true;
+	}
+
+	bool NullTimerQuery::isReady() const
+	{
+		return mQueryEndCalled;
+	}
+
+	float NullTimerQuery::getTimeMs()
+	{
+		return mTimeDelta;
+	}
+
+	NullOcclusionQuery::NullOcclusionQuery(bool binary)
+		:OcclusionQuery(binary), mQueryEndCalled(false)
+	{
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Query);
+	}
+
+	NullOcclusionQuery::~NullOcclusionQuery()
+	{
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Query);
+	}
+
+	void NullOcclusionQuery::begin()
+	{
+		mQueryEndCalled = false;
+
+		setActive(true);
+	}
+
+	void NullOcclusionQuery::end()
+	{
+		mQueryEndCalled = true;
+	}
+
+	bool NullOcclusionQuery::isReady() const
+	{
+		return mQueryEndCalled;
+	}
+
+	UINT32 NullOcclusionQuery::getNumSamples()
+	{
+		return 1;
+	}
+}
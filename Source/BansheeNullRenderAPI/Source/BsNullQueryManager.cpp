@@ -0,0 +1,31 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullQueryManager.h"
+#include "BsNullQuery.h"
+
+namespace BansheeEngine
+{
+	SPtr<EventQuery> NullQueryManager::createEventQuery() const
+	{
+		SPtr<EventQuery> query = SPtr<NullEventQuery>(bs_new<NullEventQuery>(), &QueryManager::deleteEventQuery, StdAlloc<NullEventQuery>());
+		mEventQueries.push_back(query.get());
+
+		return query;
+	}
+
+	SPtr<TimerQuery> NullQueryManager::createTimerQuery() const
+	{
+		SPtr<TimerQuery> query = SPtr<NullTimerQuery>(bs_new<NullTimerQuery>(), &QueryManager::deleteTimerQuery, StdAlloc<NullTimerQuery>());
+		mTimerQueries.push_back(query.get());
+
+		return query;
+	}
+
+	SPtr<OcclusionQuery> NullQueryManager::createOcclusionQuery(bool binary) const
+	{
+		SPtr<OcclusionQuery> query = SPtr<NullOcclusionQuery>(bs_new<NullOcclusionQuery>(binary), &QueryManager::deleteOcclusionQuery, StdAlloc<NullOcclusionQuery>());
+		mOcclusionQueries.push_back(query.get());
+
+		return query;
+	}
+}
@@ -0,0 +1,665 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPI.h"
+#include "BsNullTextureManager.h"
+#include "BsNullHardwareBufferManager.h"
+#include "BsNullRenderWindowManager.h"
+#include "BsNullGpuProgram.h"
+#include "BsNullQueryManager.h"
+#include "BsNullVideoModeInfo.h"
+#include "BsRenderStateManager.h"
+#include "BsGpuProgramManager.h"
+#include "BsRenderAPICapabilities.h"
+#include "BsRenderTarget.h"
+#include "BsVertexBuffer.h"
+#include "BsIndexBuffer.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamDesc.h"
+#include "BsGpuParamBlockBuffer.h"
+#include "BsCoreThread.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	/** Number of texture units and parameter buffers reported per GPU program stage. Matches DirectX 11 limits. */
+	static const UINT32 NULL_NUM_TEXTURE_UNITS = 128;
+	static const UINT32 NULL_NUM_PARAM_BUFFERS = 14;
+
+	NullRenderAPI::NullRenderAPI()
+		: mGpuProgramFactory(nullptr), mIsRecording(false), mActiveDrawOp(DOT_TRIANGLE_LIST)
+	{
+		mClipPlanesDirty = false; // Clip planes are never applied, there is nothing to apply them to
+
+		resetCallCounts();
+	}
+
+	NullRenderAPI::~NullRenderAPI()
+	{
+
+	}
+
+	const StringID& NullRenderAPI::getName() const
+	{
+		static StringID strName("NullRenderAPI");
+		return strName;
+	}
+
+	const String& NullRenderAPI::getShadingLanguageName() const
+	{
+		// Programs of the fallback techniques are HLSL
+		static String strName("hlsl");
+		return strName;
+	}
+
+	const StringID& NullRenderAPI::getTechniqueFallbackName() const
+	{
+		// No shaders are written for the null API, so use the ones written for DX11
+		static StringID strName("D3D11RenderAPI");
+		return strName;
+	}
+
+	void NullRenderAPI::initializePrepare()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mVideoModeInfo = bs_shared_ptr_new<NullVideoModeInfo>(1920, 1080);
+
+		TextureManager::startUp<NullTextureManager>();
+		TextureCoreManager::startUp<NullTextureCoreManager>();
+
+		HardwareBufferManager::startUp();
+		HardwareBufferCoreManager::startUp<NullHardwareBufferCoreManager>();
+
+		RenderWindowManager::startUp<NullRenderWindowManager>();
+		RenderWindowCoreManager::startUp<NullRenderWindowCoreManager>();
+
+		RenderStateCoreManager::startUp();
+
+		mGpuProgramFactory = bs_new<NullGpuProgramFactory>();
+
+		mCurrentCapabilities = createRenderSystemCapabilities();
+
+		mCurrentCapabilities->addShaderProfile("hlsl");
+		GpuProgramCoreManager::instance().addFactory(mGpuProgramFactory);
+
+		RenderAPICore::initializePrepare();
+	}
+
+	void NullRenderAPI::initializeFinalize(const SPtr<RenderWindowCore>& primaryWindow)
+	{
+		QueryManager::startUp<NullQueryManager>();
+
+		RenderAPICore::initializeFinalize(primaryWindow);
+	}
+
+	void NullRenderAPI::destroyCore()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mRecording.clear();
+		mIsRecording = false;
+
+		QueryManager::shutDown();
+
+		if (mGpuProgramFactory != nullptr)
+		{
+			GpuProgramCoreManager::instance().removeFactory(mGpuProgramFactory);
+
+			bs_delete(mGpuProgramFactory);
+			mGpuProgramFactory = nullptr;
+		}
+
+		mActiveRenderTarget = nullptr;
+
+		RenderStateCoreManager::shutDown();
+		RenderWindowCoreManager::shutDown();
+		RenderWindowManager::shutDown();
+		HardwareBufferCoreManager::shutDown();
+		HardwareBufferManager::shutDown();
+		TextureCoreManager::shutDown();
+		TextureManager::shutDown();
+
+		RenderAPICore::destroyCore();
+	}
+
+	void NullRenderAPI::setSamplerStateImpl(GpuProgramType gptype, UINT16 texUnit, const SPtr<SamplerStateCore>& samplerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetSamplerState))
+		{
+			mRecording.addArg((UINT32)gptype);
+			mRecording.addArg((UINT32)texUnit);
+			mRecording.addObject(samplerState);
+		}
+
+		BS_INC_RENDER_STAT(NumSamplerBinds);
+	}
+
+	void NullRenderAPI::setBlendStateImpl(const SPtr<BlendStateCore>& blendState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetBlendState))
+			mRecording.addObject(blendState);
+
+		BS_INC_RENDER_STAT(NumBlendStateChanges);
+	}
+
+	void NullRenderAPI::setRasterizerStateImpl(const SPtr<RasterizerStateCore>& rasterizerState)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetRasterizerState))
+			mRecording.addObject(rasterizerState);
+
+		BS_INC_RENDER_STAT(NumRasterizerStateChanges);
+	}
+
+	void NullRenderAPI::setDepthStencilStateImpl(const SPtr<DepthStencilStateCore>& depthStencilState, UINT32 stencilRefValue)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetDepthStencilState))
+		{
+			mRecording.addArg(stencilRefValue);
+			mRecording.addObject(depthStencilState);
+		}
+
+		BS_INC_RENDER_STAT(NumDepthStencilStateChanges);
+	}
+
+	void NullRenderAPI::setTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetTexture))
+		{
+			mRecording.addArg((UINT32)gptype);
+			mRecording.addArg((UINT32)unit);
+			mRecording.addArg((UINT32)(enabled ? 1 : 0));
+			mRecording.addObject(texPtr);
+		}
+
+		BS_INC_RENDER_STAT(NumTextureBinds);
+	}
+
+	void NullRenderAPI::setLoadStoreTextureImpl(GpuProgramType gptype, UINT16 unit, bool enabled, const SPtr<TextureCore>& texPtr,
+		const TextureSurface& surface)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetLoadStoreTexture))
+		{
+			mRecording.addArg((UINT32)gptype);
+			mRecording.addArg((UINT32)unit);
+			mRecording.addArg((UINT32)(enabled ? 1 : 0));
+			mRecording.addArg(surface.mipLevel);
+			mRecording.addArg(surface.numMipLevels);
+			mRecording.addArg(surface.arraySlice);
+			mRecording.addArg(surface.numArraySlices);
+			mRecording.addObject(texPtr);
+		}
+
+		BS_INC_RENDER_STAT(NumTextureBinds);
+	}
+
+	void NullRenderAPI::beginFrame()
+	{
+		registerCall(NRC_BeginFrame);
+	}
+
+	void NullRenderAPI::endFrame()
+	{
+		registerCall(NRC_EndFrame);
+	}
+
+	void NullRenderAPI::setViewport(const Rect2& vp)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetViewport))
+		{
+			mRecording.addArg(vp.x);
+			mRecording.addArg(vp.y);
+			mRecording.addArg(vp.width);
+			mRecording.addArg(vp.height);
+		}
+	}
+
+	void NullRenderAPI::setVertexBuffersImpl(UINT32 index, SPtr<VertexBufferCore>* buffers, UINT32 numBuffers)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 maxBoundVertexBuffers = mCurrentCapabilities->getMaxBoundVertexBuffers();
+		if ((index + numBuffers) >= maxBoundVertexBuffers)
+			BS_EXCEPT(InvalidParametersException, "Invalid vertex index: " + toString(index) + ". Valid range is 0 .. " + toString(maxBoundVertexBuffers - 1));
+
+		if (registerCall(NRC_SetVertexBuffers))
+		{
+			mRecording.addArg(index);
+
+			for (UINT32 i = 0; i < numBuffers; i++)
+				mRecording.addObject(buffers[i]);
+		}
+
+		BS_INC_RENDER_STAT(NumVertexBufferBinds);
+	}
+
+	void NullRenderAPI::setIndexBufferImpl(const SPtr<IndexBufferCore>& buffer)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetIndexBuffer))
+			mRecording.addObject(buffer);
+
+		BS_INC_RENDER_STAT(NumIndexBufferBinds);
+	}
+
+	void NullRenderAPI::setVertexDeclarationImpl(const SPtr<VertexDeclarationCore>& vertexDeclaration)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetVertexDeclaration))
+			mRecording.addObject(vertexDeclaration);
+	}
+
+	void NullRenderAPI::setDrawOperationImpl(DrawOperationType op)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mActiveDrawOp = op;
+
+		if (registerCall(NRC_SetDrawOperation))
+			mRecording.addArg((UINT32)op);
+	}
+
+	void NullRenderAPI::bindGpuProgramImpl(const SPtr<GpuProgramCore>& prg)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_BindGpuProgram))
+			mRecording.addObject(prg);
+
+		BS_INC_RENDER_STAT(NumGpuProgramBinds);
+	}
+
+	void NullRenderAPI::unbindGpuProgramImpl(GpuProgramType gptype)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_UnbindGpuProgram))
+			mRecording.addArg((UINT32)gptype);
+
+		BS_INC_RENDER_STAT(NumGpuProgramBinds);
+	}
+
+	void NullRenderAPI::setConstantBuffers(GpuProgramType gptype, const SPtr<GpuParamsCore>& bindableParams)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		// Still flush dirty parameter data into the (system memory) buffers, as that is a part of the CPU cost we want
+		// to measure
+		bindableParams->updateHardwareBuffers();
+
+		if (registerCall(NRC_SetConstantBuffers))
+		{
+			mRecording.addArg((UINT32)gptype);
+			mRecording.addObject(bindableParams);
+
+			// Parameters are recorded by reference, so also record the buffers bound at the time of the call, in the
+			// order of GpuParamDesc::paramBlocks
+			const GpuParamDesc& paramDesc = bindableParams->getParamDesc();
+			for (auto& entry : paramDesc.paramBlocks)
+				mRecording.addObject(bindableParams->getParamBlockBuffer(entry.second.slot));
+		}
+
+#if BS_PROFILING_ENABLED
+		const GpuParamDesc& paramDesc = bindableParams->getParamDesc();
+		for (UINT32 i = 0; i < (UINT32)paramDesc.paramBlocks.size(); i++)
+		{
+			BS_INC_RENDER_STAT(NumGpuParamBufferBinds);
+		}
+#endif
+	}
+
+	void NullRenderAPI::draw(UINT32 vertexOffset, UINT32 vertexCount, UINT32 instanceCount)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_Draw))
+		{
+			mRecording.addArg(vertexOffset);
+			mRecording.addArg(vertexCount);
+			mRecording.addArg(instanceCount);
+		}
+
+		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::drawIndexed(UINT32 startIndex, UINT32 indexCount, UINT32 vertexOffset, UINT32 vertexCount,
+		UINT32 instanceCount)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_DrawIndexed))
+		{
+			mRecording.addArg(startIndex);
+			mRecording.addArg(indexCount);
+			mRecording.addArg(vertexOffset);
+			mRecording.addArg(vertexCount);
+			mRecording.addArg(instanceCount);
+		}
+
+		UINT32 primCount = vertexCountToPrimCount(mActiveDrawOp, vertexCount);
+
+		BS_INC_RENDER_STAT(NumDrawCalls);
+		BS_ADD_RENDER_STAT(NumVertices, vertexCount);
+		BS_ADD_RENDER_STAT(NumPrimitives, primCount);
+	}
+
+	void NullRenderAPI::dispatchCompute(UINT32 numGroupsX, UINT32 numGroupsY, UINT32 numGroupsZ)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_DispatchCompute))
+		{
+			mRecording.addArg(numGroupsX);
+			mRecording.addArg(numGroupsY);
+			mRecording.addArg(numGroupsZ);
+		}
+
+		BS_INC_RENDER_STAT(NumComputeCalls);
+	}
+
+	void NullRenderAPI::swapBuffers(const SPtr<RenderTargetCore>& target)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SwapBuffers))
+			mRecording.addObject(target);
+
+		RenderAPICore::swapBuffers(target);
+	}
+
+	void NullRenderAPI::setScissorRect(UINT32 left, UINT32 top, UINT32 right, UINT32 bottom)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetScissorRect))
+		{
+			mRecording.addArg(left);
+			mRecording.addArg(top);
+			mRecording.addArg(right);
+			mRecording.addArg(bottom);
+		}
+	}
+
+	void NullRenderAPI::clearViewport(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_ClearViewport))
+		{
+			mRecording.addArg(buffers);
+			mRecording.addArg(color.r);
+			mRecording.addArg(color.g);
+			mRecording.addArg(color.b);
+			mRecording.addArg(color.a);
+			mRecording.addArg(depth);
+			mRecording.addArg((UINT32)stencil);
+			mRecording.addArg((UINT32)targetMask);
+		}
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::clearRenderTarget(UINT32 buffers, const Color& color, float depth, UINT16 stencil, UINT8 targetMask)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_ClearRenderTarget))
+		{
+			mRecording.addArg(buffers);
+			mRecording.addArg(color.r);
+			mRecording.addArg(color.g);
+			mRecording.addArg(color.b);
+			mRecording.addArg(color.a);
+			mRecording.addArg(depth);
+			mRecording.addArg((UINT32)stencil);
+			mRecording.addArg((UINT32)targetMask);
+		}
+
+		BS_INC_RENDER_STAT(NumClears);
+	}
+
+	void NullRenderAPI::setRenderTargetImpl(const SPtr<RenderTargetCore>& target, bool readOnlyDepthStencil)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mActiveRenderTarget = target;
+
+		if (registerCall(NRC_SetRenderTarget))
+		{
+			mRecording.addArg((UINT32)(readOnlyDepthStencil ? 1 : 0));
+			mRecording.addObject(target);
+		}
+
+		BS_INC_RENDER_STAT(NumRenderTargetChanges);
+	}
+
+	void NullRenderAPI::setClipPlanes(const PlaneList& clipPlanes)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (registerCall(NRC_SetClipPlanes))
+		{
+			for (auto& plane : clipPlanes)
+			{
+				mRecording.addArg(plane.normal.x);
+				mRecording.addArg(plane.normal.y);
+				mRecording.addArg(plane.normal.z);
+				mRecording.addArg(plane.d);
+			}
+		}
+
+		RenderAPICore::setClipPlanes(clipPlanes);
+		mClipPlanesDirty = false;
+	}
+
+	void NullRenderAPI::setClipPlanesImpl(const PlaneList& clipPlanes)
+	{
+		// Do nothing
+	}
+
+	RenderAPICapabilities* NullRenderAPI::createRenderSystemCapabilities() const
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		RenderAPICapabilities* rsc = bs_new<RenderAPICapabilities>();
+
+		rsc->setDriverVersion(mDriverVersion);
+		rsc->setDeviceName("Null device");
+		rsc->setRenderAPIName(getName());
+		rsc->setVendor(GPU_UNKNOWN);
+
+		rsc->setStencilBufferBitDepth(8);
+
+		rsc->setCapability(RSC_ANISOTROPY);
+		rsc->setCapability(RSC_AUTOMIPMAP);
+		rsc->setCapability(RSC_CUBEMAPPING);
+		rsc->setCapability(RSC_TEXTURE_COMPRESSION);
+		rsc->setCapability(RSC_TEXTURE_COMPRESSION_DXT);
+		rsc->setCapability(RSC_TWO_SIDED_STENCIL);
+		rsc->setCapability(RSC_STENCIL_WRAP);
+		rsc->setCapability(RSC_HWOCCLUSION);
+		rsc->setCapability(RSC_HWOCCLUSION_ASYNCHRONOUS);
+
+		rsc->setMaxBoundVertexBuffers(32);
+
+		const char* profiles[] = { "vs_4_0", "ps_4_0", "gs_4_0", "vs_4_1", "ps_4_1", "gs_4_1",
+			"vs_5_0", "ps_5_0", "gs_5_0", "cs_5_0", "hs_5_0", "ds_5_0" };
+
+		for (auto& profile : profiles)
+			rsc->addShaderProfile(profile);
+
+		rsc->addGpuProgramProfile(GPP_VS_4_0, "vs_4_0");
+		rsc->addGpuProgramProfile(GPP_FS_4_0, "ps_4_0");
+		rsc->addGpuProgramProfile(GPP_GS_4_0, "gs_4_0");
+		rsc->addGpuProgramProfile(GPP_VS_4_1, "vs_4_1");
+		rsc->addGpuProgramProfile(GPP_FS_4_1, "ps_4_1");
+		rsc->addGpuProgramProfile(GPP_GS_4_1, "gs_4_1");
+		rsc->addGpuProgramProfile(GPP_VS_5_0, "vs_5_0");
+		rsc->addGpuProgramProfile(GPP_FS_5_0, "ps_5_0");
+		rsc->addGpuProgramProfile(GPP_GS_5_0, "gs_5_0");
+		rsc->addGpuProgramProfile(GPP_CS_5_0, "cs_5_0");
+		rsc->addGpuProgramProfile(GPP_HS_5_0, "hs_5_0");
+		rsc->addGpuProgramProfile(GPP_DS_5_0, "ds_5_0");
+
+		GpuProgramType programTypes[] = { GPT_VERTEX_PROGRAM, GPT_FRAGMENT_PROGRAM, GPT_GEOMETRY_PROGRAM,
+			GPT_HULL_PROGRAM, GPT_DOMAIN_PROGRAM, GPT_COMPUTE_PROGRAM };
+
+		UINT32 numPrograms = sizeof(programTypes) / sizeof(programTypes[0]);
+		for (UINT32 i = 0; i < numPrograms; i++)
+		{
+			rsc->setNumTextureUnits(programTypes[i], NULL_NUM_TEXTURE_UNITS);
+			rsc->setNumGpuParamBlockBuffers(programTypes[i], NULL_NUM_PARAM_BUFFERS);
+		}
+
+		rsc->setNumCombinedTextureUnits(NULL_NUM_TEXTURE_UNITS * numPrograms);
+		rsc->setNumCombinedGpuParamBlockBuffers(NULL_NUM_PARAM_BUFFERS * numPrograms);
+
+		rsc->setCapability(RSC_SHADER_SUBROUTINE);
+		rsc->setCapability(RSC_USER_CLIP_PLANES);
+		rsc->setCapability(RSC_VERTEX_FORMAT_UBYTE4);
+		rsc->setCapability(RSC_INFINITE_FAR_PLANE);
+		rsc->setCapability(RSC_TEXTURE_3D);
+		rsc->setCapability(RSC_NON_POWER_OF_2_TEXTURES);
+		rsc->setCapability(RSC_HWRENDER_TO_TEXTURE);
+		rsc->setCapability(RSC_TEXTURE_FLOAT);
+
+		rsc->setNumMultiRenderTargets(8);
+		rsc->setCapability(RSC_MRT_DIFFERENT_BIT_DEPTHS);
+
+		rsc->setCapability(RSC_POINT_SPRITES);
+		rsc->setCapability(RSC_POINT_EXTENDED_PARAMETERS);
+		rsc->setMaxPointSize(256);
+
+		rsc->setCapability(RSC_VERTEX_TEXTURE_FETCH);
+		rsc->setCapability(RSC_MIPMAP_LOD_BIAS);
+		rsc->setCapability(RSC_PERSTAGECONSTANT);
+		rsc->setCapability(RSC_INSTANCING);
+
+		return rsc;
+	}
+
+	void NullRenderAPI::convertProjectionMatrix(const Matrix4& matrix, Matrix4& dest)
+	{
+		dest = matrix;
+
+		// Convert depth range from [-1,+1] to [0,1], same as DX11
+		dest[2][0] = (dest[2][0] + dest[3][0]) / 2;
+		dest[2][1] = (dest[2][1] + dest[3][1]) / 2;
+		dest[2][2] = (dest[2][2] + dest[3][2]) / 2;
+		dest[2][3] = (dest[2][3] + dest[3][3]) / 2;
+	}
+
+	const RenderAPIInfo& NullRenderAPI::getAPIInfo() const
+	{
+		static RenderAPIInfo info(0.0f, 0.0f, 0.0f, 1.0f, VET_COLOR_ABGR, false, true, false);
+
+		return info;
+	}
+
+	GpuParamBlockDesc NullRenderAPI::generateParamBlockDesc(const String& name, Vector<GpuParamDataDesc>& params)
+	{
+		// Uses the same packing rules as DX11, so parameter buffer sizes match the ones on the real device
+		GpuParamBlockDesc block;
+		block.blockSize = 0;
+		block.isShareable = true;
+		block.name = name;
+		block.slot = 0;
+
+		for (auto& param : params)
+		{
+			const GpuParamDataTypeInfo& typeInfo = GpuParams::PARAM_SIZES.lookup[param.type];
+			UINT32 size = typeInfo.size / 4;
+
+			if (param.arraySize > 1)
+			{
+				// Arrays perform no packing and their elements are always padded and aligned to four component vectors
+				UINT32 alignOffset = size % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+					size += typeInfo.baseTypeSize - alignOffset;
+
+				alignOffset = block.blockSize % typeInfo.baseTypeSize;
+				if (alignOffset != 0)
+					block.blockSize += typeInfo.baseTypeSize - alignOffset;
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size * param.arraySize;
+			}
+			else
+			{
+				// Pack everything as tightly as possible as long as the data doesn't cross 16 byte boundary
+				UINT32 alignOffset = block.blockSize % 4;
+				if (alignOffset != 0 && size > (4 - alignOffset))
+					block.blockSize += 4 - alignOffset;
+
+				param.elementSize = size;
+				param.arrayElementStride = size;
+				param.cpuMemOffset = block.blockSize;
+				param.gpuMemOffset = 0;
+
+				block.blockSize += size;
+			}
+
+			param.paramBlockSlot = 0;
+		}
+
+		if (block.blockSize % 4 != 0)
+			block.blockSize += (4 - (block.blockSize % 4));
+
+		return block;
+	}
+
+	void NullRenderAPI::resetCallCounts()
+	{
+		for (UINT32 i = 0; i < NRC_Count; i++)
+			mCallCounts[i] = 0;
+	}
+
+	void NullRenderAPI::startRecording()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mRecording.clear();
+		mIsRecording = true;
+	}
+
+	void NullRenderAPI::stopRecording()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		mIsRecording = false;
+	}
+
+	bool NullRenderAPI::registerCall(NullRenderAPICall call)
+	{
+		mCallCounts[call]++;
+
+		if (!mIsRecording)
+			return false;
+
+		mRecording.beginCommand(call);
+		return true;
+	}
+}
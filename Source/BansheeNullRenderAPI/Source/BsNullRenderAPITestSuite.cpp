@@ -0,0 +1,400 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderAPITestSuite.h"
+#include "BsNullRenderAPI.h"
+#include "BsRenderCommandBuffer.h"
+#include "BsCoreThread.h"
+#include "BsTaskScheduler.h"
+#include "BsGpuParams.h"
+#include "BsGpuParamDesc.h"
+#include "BsGpuParamBlockBuffer.h"
+#include "BsGpuProgram.h"
+#include "BsPass.h"
+#include "BsTechnique.h"
+#include "BsShader.h"
+#include "BsMaterial.h"
+#include "BsCoreObjectManager.h"
+
+namespace BansheeEngine
+{
+	static const UINT32 NUM_WORKER_BUFFERS = 8;
+	static const UINT32 NUM_DRAWS_PER_BUFFER = 16;
+	static const UINT32 NUM_PARAM_WEIGHTS = 4;
+	static const UINT32 NUM_PARAM_SETS = 10000;
+
+	/** Checks if the recorded command at the provided index is of the specified type and has the specified arguments. */
+	static bool checkCommand(const NullCommandStream& stream, UINT32 idx, NullRenderAPICall type,
+		const Vector<UINT32>& args)
+	{
+		if (idx >= stream.getNumCommands())
+			return false;
+
+		const NullCommand& command = stream.getCommand(idx);
+		if (command.type != type || command.numArgs != (UINT32)args.size())
+			return false;
+
+		for (UINT32 i = 0; i < (UINT32)args.size(); i++)
+		{
+			if (stream.getArgUInt(command, i) != args[i])
+				return false;
+		}
+
+		return true;
+	}
+
+	/**
+	 * Creates a shader with a single pass whose fragment program reads a color, a 4D vector, a float array and a matrix
+	 * from a constant buffer. The color parameter is declared as a 4D vector in the program.
+	 */
+	static HShader createParamTestShader()
+	{
+		String numWeights = toString(NUM_PARAM_WEIGHTS);
+
+		String source =
+			"cbuffer Params\n"
+			"{\n"
+			"	float4 gTint;\n"
+			"	float4 gOffset;\n"
+			"	float gWeights[" + numWeights + "];\n"
+			"	float4x4 gTransform;\n"
+			"}\n"
+			"\n"
+			"float4 main(float4 position : SV_Position) : SV_Target\n"
+			"{\n"
+			"	return mul(gTransform, gTint * gWeights[0] + gOffset);\n"
+			"}\n";
+
+		PASS_DESC passDesc;
+		passDesc.stencilRefValue = 0;
+		passDesc.fragmentProgram = GpuProgram::create(source, "main", "hlsl", GPT_FRAGMENT_PROGRAM, GPP_FS_4_0);
+
+		SPtr<Pass> pass = Pass::create(passDesc);
+		SPtr<Technique> technique = Technique::create(RenderAPIAny, RendererAny, { pass });
+
+		SHADER_DESC shaderDesc;
+		shaderDesc.addParameter("tint", "gTint", GPDT_COLOR);
+		shaderDesc.addParameter("offset", "gOffset", GPDT_FLOAT4);
+		shaderDesc.addParameter("weights", "gWeights", GPDT_FLOAT1, StringID::NONE, NUM_PARAM_WEIGHTS);
+		shaderDesc.addParameter("transform", "gTransform", GPDT_MATRIX_4X4);
+
+		return Shader::create("ParamTest", shaderDesc, { technique });
+	}
+
+	NullRenderAPITestSuite::NullRenderAPITestSuite()
+	{
+		BS_ADD_TEST(NullRenderAPITestSuite::CommandBufferExecute);
+		BS_ADD_TEST(NullRenderAPITestSuite::CommandBufferWorkerOrder);
+		BS_ADD_TEST(NullRenderAPITestSuite::CommandBufferParamBlockOrder);
+		BS_ADD_TEST(NullRenderAPITestSuite::MaterialDataParams);
+
+		BS_ADD_BENCHMARK(NullRenderAPITestSuite::MaterialSetParamsByName);
+		BS_ADD_BENCHMARK(NullRenderAPITestSuite::MaterialSetParamsByIndex);
+		BS_ADD_BENCHMARK(NullRenderAPITestSuite::MaterialSetParamsByHandle);
+	}
+
+	void NullRenderAPITestSuite::startUp()
+	{
+		mBenchmarkMaterial = Material::create(createParamTestShader());
+	}
+
+	void NullRenderAPITestSuite::shutDown()
+	{
+		mBenchmarkMaterial.destroy();
+	}
+
+	void NullRenderAPITestSuite::CommandBufferExecute()
+	{
+		gCoreAccessor().queueCommand(std::bind(&NullRenderAPITestSuite::CommandBufferExecuteCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void NullRenderAPITestSuite::CommandBufferExecuteCore()
+	{
+		NullRenderAPI& rapi = static_cast<NullRenderAPI&>(RenderAPICore::instance());
+		UINT64 numDrawCalls = rapi.getCallCount(NRC_Draw);
+
+		RenderCommandBuffer commands;
+		commands.setScissorRect(1, 2, 3, 4);
+		commands.draw(5, 6);
+		commands.drawIndexed(7, 8, 9, 10, 2);
+		commands.dispatchCompute(11, 12, 13);
+		commands.draw(14, 15, 3);
+
+		// Recording must not reach the render API
+		BS_TEST_ASSERT(commands.getNumCommands() == 5);
+		BS_TEST_ASSERT(rapi.getCallCount(NRC_Draw) == numDrawCalls);
+
+		rapi.startRecording();
+		rapi.executeCommands(commands);
+		rapi.stopRecording();
+
+		const NullCommandStream& recording = rapi.getRecording();
+		BS_TEST_ASSERT(recording.getNumCommands() == 5);
+		BS_TEST_ASSERT(checkCommand(recording, 0, NRC_SetScissorRect, { 1, 2, 3, 4 }));
+		BS_TEST_ASSERT(checkCommand(recording, 1, NRC_Draw, { 5, 6, 0 }));
+		BS_TEST_ASSERT(checkCommand(recording, 2, NRC_DrawIndexed, { 7, 8, 9, 10, 2 }));
+		BS_TEST_ASSERT(checkCommand(recording, 3, NRC_DispatchCompute, { 11, 12, 13 }));
+		BS_TEST_ASSERT(checkCommand(recording, 4, NRC_Draw, { 14, 15, 3 }));
+
+		// Executing doesn't consume the commands, and cleared buffers can be recorded into again
+		rapi.startRecording();
+		rapi.executeCommands(commands);
+		rapi.stopRecording();
+		BS_TEST_ASSERT(rapi.getRecording().getNumCommands() == 5);
+
+		commands.clear();
+		commands.draw(16, 17);
+
+		rapi.startRecording();
+		rapi.executeCommands(commands);
+		rapi.stopRecording();
+		BS_TEST_ASSERT(rapi.getRecording().getNumCommands() == 1);
+		BS_TEST_ASSERT(checkCommand(rapi.getRecording(), 0, NRC_Draw, { 16, 17, 0 }));
+	}
+
+	void NullRenderAPITestSuite::CommandBufferWorkerOrder()
+	{
+		gCoreAccessor().queueCommand(std::bind(&NullRenderAPITestSuite::CommandBufferWorkerOrderCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void NullRenderAPITestSuite::CommandBufferWorkerOrderCore()
+	{
+		NullRenderAPI& rapi = static_cast<NullRenderAPI&>(RenderAPICore::instance());
+
+		// Record every buffer on its own task, same as the renderer does, so buffers finish recording in arbitrary order
+		Vector<RenderCommandBuffer> commandBuffers(NUM_WORKER_BUFFERS);
+		Vector<SPtr<Task>> tasks;
+		for (UINT32 i = 0; i < NUM_WORKER_BUFFERS; i++)
+		{
+			RenderCommandBuffer& commands = commandBuffers[i];
+			SPtr<Task> task = Task::create("Record test commands", [&commands, i]()
+			{
+				for (UINT32 j = 0; j < NUM_DRAWS_PER_BUFFER; j++)
+					commands.draw(i * NUM_DRAWS_PER_BUFFER + j, 3);
+			});
+
+			TaskScheduler::instance().addTask(task);
+			tasks.push_back(task);
+		}
+
+		for (auto& task : tasks)
+			task->wait();
+
+		rapi.startRecording();
+		for (UINT32 i = 0; i < NUM_WORKER_BUFFERS; i++)
+			rapi.executeCommands(commandBuffers[i]);
+		rapi.stopRecording();
+
+		const NullCommandStream& recording = rapi.getRecording();
+		UINT32 numDraws = NUM_WORKER_BUFFERS * NUM_DRAWS_PER_BUFFER;
+		BS_TEST_ASSERT(recording.getNumCommands() == numDraws);
+
+		bool inOrder = true;
+		for (UINT32 i = 0; i < numDraws; i++)
+			inOrder &= checkCommand(recording, i, NRC_Draw, { i, 3, 0 });
+
+		BS_TEST_ASSERT_MSG(inOrder, "Commands from worker buffers weren't executed in submission order.");
+	}
+
+	void NullRenderAPITestSuite::CommandBufferParamBlockOrder()
+	{
+		gCoreAccessor().queueCommand(std::bind(&NullRenderAPITestSuite::CommandBufferParamBlockOrderCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void NullRenderAPITestSuite::CommandBufferParamBlockOrderCore()
+	{
+		NullRenderAPI& rapi = static_cast<NullRenderAPI&>(RenderAPICore::instance());
+
+		GpuParamBlockDesc blockDesc;
+		blockDesc.name = "TestBlock";
+		blockDesc.slot = 0;
+		blockDesc.blockSize = 4;
+		blockDesc.isShareable = true;
+
+		SPtr<GpuParamDesc> paramDesc = bs_shared_ptr_new<GpuParamDesc>();
+		paramDesc->paramBlocks[blockDesc.name] = blockDesc;
+
+		SPtr<GpuParamsCore> params = GpuParamsCore::create(paramDesc, false);
+
+		UINT32 bufferSize = blockDesc.blockSize * sizeof(UINT32);
+		SPtr<GpuParamBlockBufferCore> bufferA = GpuParamBlockBufferCore::create(bufferSize);
+		SPtr<GpuParamBlockBufferCore> bufferB = GpuParamBlockBufferCore::create(bufferSize);
+		SPtr<GpuParamBlockBufferCore> bufferC = GpuParamBlockBufferCore::create(bufferSize);
+
+		// Two buffers sharing the same parameters, as when neighbouring batches of the same material are recorded on
+		// different workers
+		RenderCommandBuffer first;
+		first.setParamBlockBuffer(params, 0, bufferA);
+		first.setConstantBuffers(GPT_VERTEX_PROGRAM, params);
+		first.draw(0, 3);
+		first.setParamBlockBuffer(params, 0, bufferB);
+		first.setConstantBuffers(GPT_VERTEX_PROGRAM, params);
+		first.draw(3, 3);
+
+		RenderCommandBuffer second;
+		second.setParamBlockBuffer(params, 0, bufferC);
+		second.setConstantBuffers(GPT_VERTEX_PROGRAM, params);
+		second.draw(6, 3);
+
+		// Assignment is deferred until execution
+		BS_TEST_ASSERT(params->getParamBlockBuffer(0) == nullptr);
+
+		rapi.executeCommands(first);
+		BS_TEST_ASSERT(params->getParamBlockBuffer(0) == bufferB);
+
+		rapi.executeCommands(second);
+		BS_TEST_ASSERT(params->getParamBlockBuffer(0) == bufferC);
+
+		// Re-executing the first buffer restores its assignments, in order
+		rapi.startRecording();
+		rapi.executeCommands(first);
+		rapi.executeCommands(second);
+		rapi.stopRecording();
+
+		const NullCommandStream& recording = rapi.getRecording();
+		BS_TEST_ASSERT(recording.getNumCommands() == 6);
+
+		SPtr<GpuParamBlockBufferCore> expectedBuffers[] = { bufferA, bufferB, bufferC };
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			UINT32 bindIdx = i * 2;
+			UINT32 drawIdx = bindIdx + 1;
+
+			BS_TEST_ASSERT(checkCommand(recording, bindIdx, NRC_SetConstantBuffers, { (UINT32)GPT_VERTEX_PROGRAM }));
+			BS_TEST_ASSERT(checkCommand(recording, drawIdx, NRC_Draw, { i * 3, 3, 0 }));
+
+			if (bindIdx < recording.getNumCommands())
+			{
+				const NullCommand& bind = recording.getCommand(bindIdx);
+				BS_TEST_ASSERT(bind.numObjects == 2);
+
+				if (bind.numObjects == 2)
+				{
+					BS_TEST_ASSERT_MSG(recording.getObject<GpuParamBlockBufferCore>(bind, 1) == expectedBuffers[i],
+						"Parameter block buffer assigned out of order.");
+				}
+			}
+		}
+	}
+
+	void NullRenderAPITestSuite::MaterialDataParams()
+	{
+		HMaterial material = Material::create(createParamTestShader());
+
+		UINT32 tintIdx = material->getDataParamIdx("tint");
+		UINT32 weightsIdx = material->getDataParamIdx("weights");
+		BS_TEST_ASSERT(tintIdx != MaterialBase::INVALID_PARAM_IDX);
+		BS_TEST_ASSERT(weightsIdx != MaterialBase::INVALID_PARAM_IDX);
+		BS_TEST_ASSERT(material->getDataParamIdx("missing") == MaterialBase::INVALID_PARAM_IDX);
+
+		// Values assigned by index must be visible by name, and the other way around
+		for (UINT32 i = 0; i < NUM_PARAM_WEIGHTS; i++)
+			material->setDataParam(weightsIdx, (float)(i + 1), i);
+
+		for (UINT32 i = 0; i < NUM_PARAM_WEIGHTS; i++)
+			BS_TEST_ASSERT(material->getFloat("weights", i) == (float)(i + 1));
+
+		material->setFloat("weights", 10.0f, 0);
+		BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, 0) == 10.0f);
+
+		// Writes outside of the array are ignored, and reads return a default value
+		material->setDataParam(weightsIdx, 20.0f, NUM_PARAM_WEIGHTS);
+		BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, NUM_PARAM_WEIGHTS) == 0.0f);
+		BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, NUM_PARAM_WEIGHTS - 1) == (float)NUM_PARAM_WEIGHTS);
+
+		// Values of a different type are ignored, as are invalid indices
+		material->setDataParam(weightsIdx, Vector2(30.0f, 30.0f), 0);
+		BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, 0) == 10.0f);
+
+		material->setDataParam(MaterialBase::INVALID_PARAM_IDX, 40.0f);
+		BS_TEST_ASSERT(material->getDataParam<float>(MaterialBase::INVALID_PARAM_IDX) == 0.0f);
+
+		// Colors and 4D vectors can be used interchangeably
+		material->setDataParam(tintIdx, Vector4(0.25f, 0.5f, 0.75f, 1.0f));
+		BS_TEST_ASSERT(material->getColor("tint") == Color(0.25f, 0.5f, 0.75f, 1.0f));
+
+		CoreObjectManager::instance().syncToCore(gCoreAccessor());
+		gCoreAccessor().queueCommand(std::bind(&NullRenderAPITestSuite::MaterialDataParamsCore, this, 
+			material->getCore()));
+		gCoreThread().submitAccessors(true);
+
+		material.destroy();
+	}
+
+	void NullRenderAPITestSuite::MaterialDataParamsCore(const SPtr<MaterialCore>& material)
+	{
+		// Values assigned by index on the sim thread must be synced to the core thread material
+		UINT32 weightsIdx = material->getDataParamIdx("weights");
+		BS_TEST_ASSERT(weightsIdx != MaterialBase::INVALID_PARAM_IDX);
+		BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, 0) == 10.0f);
+
+		for (UINT32 i = 1; i < NUM_PARAM_WEIGHTS; i++)
+			BS_TEST_ASSERT(material->getDataParam<float>(weightsIdx, i) == (float)(i + 1));
+
+		BS_TEST_ASSERT(material->getColor("tint") == Color(0.25f, 0.5f, 0.75f, 1.0f));
+
+		// Core thread users assign 4D vectors to color parameters (e.g. DockManager)
+		material->setVec4("tint", Vector4(1.0f, 0.0f, 0.0f, 1.0f));
+		BS_TEST_ASSERT(material->getColor("tint") == Color(1.0f, 0.0f, 0.0f, 1.0f));
+	}
+
+	void NullRenderAPITestSuite::MaterialSetParamsByName()
+	{
+		for (UINT32 i = 0; i < NUM_PARAM_SETS; i++)
+		{
+			float value = (float)i;
+
+			mBenchmarkMaterial->setColor("tint", Color(value, value, value, 1.0f));
+			mBenchmarkMaterial->setVec4("offset", Vector4(value, value, value, 0.0f));
+
+			for (UINT32 j = 0; j < NUM_PARAM_WEIGHTS; j++)
+				mBenchmarkMaterial->setFloat("weights", value, j);
+
+			mBenchmarkMaterial->setMat4("transform", Matrix4::translation(Vector3(value, 0.0f, 0.0f)));
+		}
+	}
+
+	void NullRenderAPITestSuite::MaterialSetParamsByIndex()
+	{
+		UINT32 tintIdx = mBenchmarkMaterial->getDataParamIdx("tint");
+		UINT32 offsetIdx = mBenchmarkMaterial->getDataParamIdx("offset");
+		UINT32 weightsIdx = mBenchmarkMaterial->getDataParamIdx("weights");
+		UINT32 transformIdx = mBenchmarkMaterial->getDataParamIdx("transform");
+
+		for (UINT32 i = 0; i < NUM_PARAM_SETS; i++)
+		{
+			float value = (float)i;
+
+			mBenchmarkMaterial->setDataParam(tintIdx, Color(value, value, value, 1.0f));
+			mBenchmarkMaterial->setDataParam(offsetIdx, Vector4(value, value, value, 0.0f));
+
+			for (UINT32 j = 0; j < NUM_PARAM_WEIGHTS; j++)
+				mBenchmarkMaterial->setDataParam(weightsIdx, value, j);
+
+			mBenchmarkMaterial->setDataParam(transformIdx, Matrix4::translation(Vector3(value, 0.0f, 0.0f)));
+		}
+	}
+
+	void NullRenderAPITestSuite::MaterialSetParamsByHandle()
+	{
+		MaterialParamColor tint = mBenchmarkMaterial->getParamColor("tint");
+		MaterialParamVec4 offset = mBenchmarkMaterial->getParamVec4("offset");
+		MaterialParamFloat weights = mBenchmarkMaterial->getParamFloat("weights");
+		MaterialParamMat4 transform = mBenchmarkMaterial->getParamMat4("transform");
+
+		for (UINT32 i = 0; i < NUM_PARAM_SETS; i++)
+		{
+			float value = (float)i;
+
+			tint.set(Color(value, value, value, 1.0f));
+			offset.set(Vector4(value, value, value, 0.0f));
+
+			for (UINT32 j = 0; j < NUM_PARAM_WEIGHTS; j++)
+				weights.set(value, j);
+
+			transform.set(Matrix4::translation(Vector3(value, 0.0f, 0.0f)));
+		}
+	}
+}
@@ -0,0 +1,152 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullRenderWindow.h"
+#include "BsRenderWindowManager.h"
+#include "BsCoreThread.h"
+
+namespace BansheeEngine
+{
+	NullRenderWindowProperties::NullRenderWindowProperties(const RENDER_WINDOW_DESC& desc)
+		:RenderWindowProperties(desc)
+	{ }
+
+	NullRenderWindowCore::NullRenderWindowCore(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		: RenderWindowCore(desc, windowId), mProperties(desc), mSyncedProperties(desc)
+	{ }
+
+	void NullRenderWindowCore::initialize()
+	{
+		NullRenderWindowProperties& props = mProperties;
+
+		props.mColorDepth = 32;
+		props.mActive = true;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties = props;
+		}
+
+		RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindowCore::initialize();
+	}
+
+	void NullRenderWindowCore::move(INT32 left, INT32 top)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		NullRenderWindowProperties& props = mProperties;
+
+		if (!props.mIsFullScreen)
+		{
+			props.mTop = top;
+			props.mLeft = left;
+
+			{
+				ScopedSpinLock lock(mLock);
+				mSyncedProperties.mTop = props.mTop;
+				mSyncedProperties.mLeft = props.mLeft;
+			}
+
+			RenderWindowManager::instance().notifySyncDataDirty(this);
+		}
+	}
+
+	void NullRenderWindowCore::resize(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		if (!mProperties.mIsFullScreen)
+			setSizeAndMode(width, height, false);
+	}
+
+	void NullRenderWindowCore::setFullscreen(UINT32 width, UINT32 height, float refreshRate, UINT32 monitorIdx)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSizeAndMode(width, height, true);
+	}
+
+	void NullRenderWindowCore::setFullscreen(const VideoMode& mode)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSizeAndMode(mode.getWidth(), mode.getHeight(), true);
+	}
+
+	void NullRenderWindowCore::setWindowed(UINT32 width, UINT32 height)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setSizeAndMode(width, height, false);
+	}
+
+	void NullRenderWindowCore::setSizeAndMode(UINT32 width, UINT32 height, bool fullscreen)
+	{
+		mProperties.mWidth = width;
+		mProperties.mHeight = height;
+		mProperties.mIsFullScreen = fullscreen;
+
+		{
+			ScopedSpinLock lock(mLock);
+			mSyncedProperties.mWidth = mProperties.mWidth;
+			mSyncedProperties.mHeight = mProperties.mHeight;
+			mSyncedProperties.mIsFullScreen = mProperties.mIsFullScreen;
+		}
+
+		RenderWindowManager::instance().notifySyncDataDirty(this);
+		RenderWindowManager::instance().notifyMovedOrResized(this);
+	}
+
+	void NullRenderWindowCore::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64 *pHwnd = (UINT64*)pData;
+			*pHwnd = 0;
+			return;
+		}
+
+		RenderWindowCore::getCustomAttribute(name, pData);
+	}
+
+	void NullRenderWindowCore::syncProperties()
+	{
+		ScopedSpinLock lock(mLock);
+		mProperties = mSyncedProperties;
+	}
+
+	NullRenderWindow::NullRenderWindow(const RENDER_WINDOW_DESC& desc, UINT32 windowId)
+		:RenderWindow(desc, windowId), mProperties(desc)
+	{ }
+
+	void NullRenderWindow::getCustomAttribute(const String& name, void* pData) const
+	{
+		if (name == "WINDOW")
+		{
+			UINT64 *pHwnd = (UINT64*)pData;
+			*pHwnd = 0;
+			return;
+		}
+	}
+
+	Vector2I NullRenderWindow::screenToWindowPos(const Vector2I& screenPos) const
+	{
+		return screenPos;
+	}
+
+	Vector2I NullRenderWindow::windowToScreenPos(const Vector2I& windowPos) const
+	{
+		return windowPos;
+	}
+
+	SPtr<NullRenderWindowCore> NullRenderWindow::getCore() const
+	{
+		return std::static_pointer_cast<NullRenderWindowCore>(mCoreSpecific);
+	}
+
+	void NullRenderWindow::syncProperties()
+	{
+		ScopedSpinLock lock(getCore()->mLock);
+		mProperties = getCore()->mSyncedProperties;
+	}
+}
@@ -0,0 +1,103 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullTexture.h"
+#include "BsPixelUtil.h"
+#include "BsCoreThread.h"
+#include "BsException.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullTextureCore::NullTextureCore(TextureType textureType, UINT32 width, UINT32 height, UINT32 depth, UINT32 numMipmaps,
+		PixelFormat format, int usage, bool hwGamma, UINT32 multisampleCount, UINT32 numArraySlices,
+		const SPtr<PixelData>& initialData)
+		: TextureCore(textureType, width, height, depth, numMipmaps, format, usage, hwGamma, multisampleCount, 
+			numArraySlices, initialData)
+	{ }
+
+	NullTextureCore::~NullTextureCore()
+	{ 
+		clearBufferViews();
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::initialize()
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		UINT32 numSubresources = mProperties.getNumFaces() * (mProperties.getNumMipmaps() + 1);
+		mSubresourceData.resize(numSubresources);
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_Texture);
+		TextureCore::initialize();
+	}
+
+	void NullTextureCore::readData(PixelData& dest, UINT32 mipLevel, UINT32 face)
+	{
+		PixelData& src = getSubresourceData(face, mipLevel);
+		PixelUtil::bulkPixelConversion(src, dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+	}
+
+	void NullTextureCore::writeData(const PixelData& src, UINT32 mipLevel, UINT32 face, bool discardWholeBuffer)
+	{
+		PixelData& dest = getSubresourceData(face, mipLevel);
+		PixelUtil::bulkPixelConversion(src, dest);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+	}
+
+	PixelData NullTextureCore::lockImpl(GpuLockOptions options, UINT32 mipLevel, UINT32 face)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_Texture);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_Texture);
+		}
+#endif
+
+		// Returned object references our memory, it doesn't own it
+		return getSubresourceData(face, mipLevel);
+	}
+
+	void NullTextureCore::unlockImpl()
+	{
+		// Do nothing, memory is always accessible
+	}
+
+	void NullTextureCore::copyImpl(UINT32 srcFace, UINT32 srcMipLevel, UINT32 destFace, UINT32 destMipLevel, 
+		const SPtr<TextureCore>& target)
+	{
+		UINT32 srcSubresourceIdx = mProperties.mapToSubresourceIdx(srcFace, srcMipLevel);
+
+		// Nothing was ever written to the source, so there is nothing to copy
+		if (mSubresourceData[srcSubresourceIdx] == nullptr)
+			return;
+
+		target->writeData(*mSubresourceData[srcSubresourceIdx], destMipLevel, destFace, true);
+	}
+
+	PixelData& NullTextureCore::getSubresourceData(UINT32 face, UINT32 mipLevel)
+	{
+		if (face >= mProperties.getNumFaces() || mipLevel > mProperties.getNumMipmaps())
+		{
+			BS_EXCEPT(InvalidParametersException, "Invalid sub-resource. Face: " + toString(face) + ", mip level: " + 
+				toString(mipLevel) + ".");
+		}
+
+		UINT32 subresourceIdx = mProperties.mapToSubresourceIdx(face, mipLevel);
+
+		SPtr<PixelData>& data = mSubresourceData[subresourceIdx];
+		if (data == nullptr)
+			data = mProperties.allocateSubresourceBuffer(subresourceIdx);
+
+		return *data;
+	}
+}
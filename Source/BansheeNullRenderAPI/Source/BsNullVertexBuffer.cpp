@@ -0,0 +1,70 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullVertexBuffer.h"
+#include "BsRenderStats.h"
+
+namespace BansheeEngine
+{
+	NullVertexBufferCore::NullVertexBufferCore(UINT32 vertexSize, UINT32 numVertices, GpuBufferUsage usage, bool streamOut)
+		:VertexBufferCore(vertexSize, numVertices, usage, streamOut), mBuffer(nullptr)
+	{ }
+
+	NullVertexBufferCore::~NullVertexBufferCore()
+	{
+		if (mBuffer != nullptr)
+			bs_delete(mBuffer);
+
+		BS_INC_RENDER_STAT_CAT(ResDestroyed, RenderStatObject_VertexBuffer);
+	}
+
+	void* NullVertexBufferCore::lockImpl(UINT32 offset, UINT32 length, GpuLockOptions options)
+	{
+#if BS_PROFILING_ENABLED
+		if (options == GBL_READ_ONLY || options == GBL_READ_WRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
+		}
+
+		if (options == GBL_READ_WRITE || options == GBL_WRITE_ONLY || options == GBL_WRITE_ONLY_DISCARD || options == GBL_WRITE_ONLY_NO_OVERWRITE)
+		{
+			BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+		}
+#endif
+
+		return mBuffer->lock(offset, length);
+	}
+
+	void NullVertexBufferCore::unlockImpl()
+	{
+		// Do nothing, memory is always accessible
+	}
+
+	void NullVertexBufferCore::readData(UINT32 offset, UINT32 length, void* dest)
+	{
+		mBuffer->readData(offset, length, dest);
+
+		BS_INC_RENDER_STAT_CAT(ResRead, RenderStatObject_VertexBuffer);
+	}
+
+	void NullVertexBufferCore::writeData(UINT32 offset, UINT32 length, const void* source, BufferWriteType writeFlags)
+	{
+		mBuffer->writeData(offset, length, source);
+
+		BS_INC_RENDER_STAT_CAT(ResWrite, RenderStatObject_VertexBuffer);
+	}
+
+	void NullVertexBufferCore::copyData(HardwareBuffer& srcBuffer, UINT32 srcOffset, 
+		UINT32 dstOffset, UINT32 length, bool discardWholeBuffer)
+	{
+		NullVertexBufferCore& nullSrcBuffer = static_cast<NullVertexBufferCore&>(srcBuffer);
+		mBuffer->copyData(*nullSrcBuffer.mBuffer, srcOffset, dstOffset, length);
+	}
+
+	void NullVertexBufferCore::initialize()
+	{
+		mBuffer = bs_new<NullHardwareBuffer>(mSizeInBytes);
+
+		BS_INC_RENDER_STAT_CAT(ResCreated, RenderStatObject_VertexBuffer);
+		VertexBufferCore::initialize();
+	}
+}
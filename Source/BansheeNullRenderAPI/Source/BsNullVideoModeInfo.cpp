@@ -0,0 +1,18 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsNullVideoModeInfo.h"
+
+namespace BansheeEngine
+{
+	NullVideoOutputInfo::NullVideoOutputInfo(UINT32 width, UINT32 height)
+	{
+		mName = "Null output";
+		mVideoModes.push_back(bs_new<VideoMode>(width, height, 60.0f, 0));
+		mDesktopVideoMode = bs_new<VideoMode>(width, height, 60.0f, 0);
+	}
+
+	NullVideoModeInfo::NullVideoModeInfo(UINT32 width, UINT32 height)
+	{
+		mOutputs.push_back(bs_new<NullVideoOutputInfo>(width, height));
+	}
+}
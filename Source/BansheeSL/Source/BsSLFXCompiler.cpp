@@ -1383,7 +1383,15 @@ namespace BansheeEngine
 	{
 		StringID target = renderAPI;
 		if (target == RenderAPIAny)
-			target = RenderAPICore::instance().getName();
+		{
+			RenderAPICore& rapi = RenderAPICore::instance();
+
+			// Render APIs that fall back to another API's techniques also expect programs using its profiles
+			if (rapi.getTechniqueFallbackName() != StringID::NONE)
+				target = rapi.getTechniqueFallbackName();
+			else
+				target = rapi.getName();
+		}
 
 		if (target == RenderAPIDX11 || target == RenderAPIOpenGL)
 		{
@@ -0,0 +1,9 @@
+set(BS_BANSHEETESTRUNNER_SRC_NOFILTER
+	"Source/Main.cpp"
+)
+
+source_group("Source Files" FILES ${BS_BANSHEETESTRUNNER_SRC_NOFILTER})
+
+set(BS_BANSHEETESTRUNNER_SRC
+	${BS_BANSHEETESTRUNNER_SRC_NOFILTER}
+)
@@ -0,0 +1,95 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsApplication.h"
+#include "BsCrashHandler.h"
+#include "BsFileSystem.h"
+#include "BsTestOutput.h"
+#include "BsEngineBenchmarkSuite.h"
+#include "BsRenderBeastTestSuite.h"
+#include "BsNullRenderAPITestSuite.h"
+
+int runTests();
+
+#if BS_PLATFORM == BS_PLATFORM_WIN32
+#include <windows.h>
+
+using namespace BansheeEngine;
+
+int CALLBACK WinMain(
+	_In_  HINSTANCE hInstance,
+	_In_  HINSTANCE hPrevInstance,
+	_In_  LPSTR lpCmdLine,
+	_In_  int nCmdShow
+	)
+{
+	CrashHandler::startUp();
+
+	int result = 1;
+	__try
+	{
+		result = runTests();
+	}
+	__except (gCrashHandler().reportCrash(GetExceptionInformation()))
+	{
+		PlatformUtility::terminate(true);
+	}
+
+	CrashHandler::shutDown();
+
+	return result;
+}
+#endif // End BS_PLATFORM
+
+using namespace BansheeEngine;
+
+/** 
+ * Runs all engine, render API and renderer unit tests and benchmarks using the null render API, and saves the results to Benchmarks.json in the
+ * working directory. If BenchmarkBaseline.json exists its results are compared against the new ones.
+ *
+ * @return	Zero if all tests passed and no benchmark regressed, non-zero otherwise.
+ */
+int runTests()
+{
+	RENDER_WINDOW_DESC renderWindowDesc;
+	renderWindowDesc.videoMode = VideoMode(1280, 720);
+	renderWindowDesc.title = "Banshee Test Runner";
+	renderWindowDesc.fullscreen = false;
+	renderWindowDesc.hidden = true;
+	renderWindowDesc.depthBuffer = false;
+
+	Application::startUp(renderWindowDesc, RenderAPIPlugin::Null);
+
+	SPtr<TestSuite> testSuite = TestSuite::create<EngineBenchmarkSuite>();
+	testSuite->add(TestSuite::create<NullRenderAPITestSuite>());
+	testSuite->add(TestSuite::create<RenderBeastTestSuite>());
+
+	JSONBenchmarkOutput output;
+	testSuite->run(output);
+	testSuite->runBenchmarks(output);
+
+	output.save("Benchmarks.json");
+
+	int result = 0;
+	for (auto& failure : output.getFailures())
+	{
+		LOGERR(failure);
+		result = 1;
+	}
+
+	Path baselinePath = "BenchmarkBaseline.json";
+	if (FileSystem::exists(baselinePath))
+	{
+		Vector<String> regressions;
+		if (!output.compareToBaseline(baselinePath, 0.1f, regressions))
+		{
+			for (auto& regression : regressions)
+				LOGWRN("Benchmark regressed: " + regression);
+
+			result = 1;
+		}
+	}
+
+	Application::shutDown();
+
+	return result;
+}
@@ -96,6 +96,7 @@ set(BS_BANSHEEUTILITY_SRC_ALLOCATORS
 	"Source/BsGlobalFrameAlloc.cpp"
 	"Source/BsMemStack.cpp"
 	"Source/BsMemoryAllocator.cpp"
+	"Source/BsRangeAlloc.cpp"
 )
 
 set(BS_BANSHEEUTILITY_SRC_RTTI
@@ -120,6 +121,7 @@ set(BS_BANSHEEUTILITY_INC_ALLOCATORS
 	"Include/BsMemAllocProfiler.h"
 	"Include/BsMemoryAllocator.h"
 	"Include/BsMemStack.h"
+	"Include/BsRangeAlloc.h"
 	"Include/BsStaticAlloc.h"
 )
 
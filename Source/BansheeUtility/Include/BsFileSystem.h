@@ -24,12 +24,21 @@ namespace BansheeEngine
 
 		/**
 		 * Opens a file and returns a data stream capable of reading and writing to that file. If file doesn't exist new 
-		 * one will be created.
+		 * one will be created. Returns null if the file cannot be created or opened.
 		 *
 		 * @param[in]	fullPath	Full path to a file.
 		 */
 		static SPtr<DataStream> createAndOpenFile(const Path& fullPath);
 
+		/**
+		 * Maps the contents of a file into memory and returns a read-only stream that can be used for accessing it. File
+		 * contents are paged in by the OS as they are accessed, and the mapping is released when the stream is closed or 
+		 * destroyed. Returns null if the file cannot be mapped.
+		 *
+		 * @param[in]	fullPath	Full path to a file.
+		 */
+		static SPtr<MemoryDataStream> mapFile(const Path& fullPath);
+
 		/**
 		 * Returns the size of a file in bytes.
 		 *
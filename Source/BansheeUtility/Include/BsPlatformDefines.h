@@ -63,6 +63,13 @@
 #   define BS_ARCH_TYPE BS_ARCHITECTURE_x86_32
 #endif
 
+// Find if SSE2 intrinsics are available (always the case on x86-64)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#	define BS_SSE2 1
+#else
+#	define BS_SSE2 0
+#endif
+
 // Windows Settings
 #if BS_PLATFORM == BS_PLATFORM_WIN32
 
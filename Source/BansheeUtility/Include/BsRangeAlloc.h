@@ -0,0 +1,113 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsPrerequisitesUtil.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup Internal-Utility
+	 *  @{
+	 */
+
+	/** @addtogroup Memory-Internal
+	 *  @{
+	 */
+
+	/**
+	 * Allocates sub-ranges of a larger linear range of elements, for example regions within a GPU buffer. It doesn't
+	 * allocate any memory on its own, and only keeps track of which parts of the range are in use.
+	 *
+	 * Uses a two-level segregated fit scheme: free ranges are kept in lists segregated by size class, and bitmaps track
+	 * which lists are non-empty, so both allocation and deallocation run in constant time regardless of the number of
+	 * allocations. Freed ranges are immediately merged with adjacent free ranges.
+	 *
+	 * @note	Not thread safe.
+	 */
+	class BS_UTILITY_EXPORT RangeAlloc
+	{
+		/** Contiguous range of elements, either allocated or free. */
+		struct Block
+		{
+			UINT32 offset;
+			UINT32 size;
+			UINT32 prevPhys;
+			UINT32 nextPhys;
+			UINT32 prevFree;
+			UINT32 nextFree;
+			bool free;
+		};
+
+	public:
+		/** Creates a new allocator managing a range of @p size elements. */
+		RangeAlloc(UINT32 size = 0);
+
+		/**
+		 * Allocates a range of the specified number of elements.
+		 *
+		 * @param[in]	size	Number of elements to allocate. Zero sized allocations are treated as having a single
+		 *						element.
+		 * @return				Handle to the allocated range, or INVALID_BLOCK if there is no free range large enough.
+		 */
+		UINT32 alloc(UINT32 size);
+
+		/** Releases a range previously allocated with alloc(). */
+		void free(UINT32 block);
+
+		/** Extends the managed range with free elements appended to its end. Existing allocations are not moved. */
+		void grow(UINT32 newSize);
+
+		/** Returns the offset of the first element of a range allocated with alloc(). */
+		UINT32 getOffset(UINT32 block) const { return mBlocks[block].offset; }
+
+		/** Returns the number of elements in a range allocated with alloc(). */
+		UINT32 getSize(UINT32 block) const { return mBlocks[block].size; }
+
+		/** Returns the total number of elements in the managed range. */
+		UINT32 getCapacity() const { return mCapacity; }
+
+		/** Handle returned by alloc() when the allocation fails. */
+		static const UINT32 INVALID_BLOCK;
+
+	private:
+		/** Number of bits used for determining the second level index, i.e. each size class is split into 2^N lists. */
+		static const UINT32 SL_BITS = 4;
+
+		/** Number of lists within each size class. */
+		static const UINT32 SL_COUNT = 1 << SL_BITS;
+
+		/** Number of size classes. Sizes smaller than SL_COUNT share the first one. */
+		static const UINT32 FL_COUNT = 32 - SL_BITS + 1;
+
+		/** Determines the indices of the free list that ranges of the specified size belong to. */
+		static void mapping(UINT32 size, UINT32& fl, UINT32& sl);
+
+		/** Adds a block to the free list for its size. */
+		void insertFree(UINT32 block);
+
+		/** Removes a block from the free list for its size. */
+		void removeFree(UINT32 block);
+
+		/** Returns a new block, re-using a previously released one if available. */
+		UINT32 createBlock();
+
+		/** Releases a block that's no longer part of the range so it can be re-used. */
+		void releaseBlock(UINT32 block);
+
+		/** Merges the block following the provided one in the range into it. */
+		void absorbNext(UINT32 block);
+
+		Vector<Block> mBlocks;
+		Stack<UINT32> mUnusedBlocks;
+
+		UINT32 mFreeLists[FL_COUNT][SL_COUNT];
+		UINT32 mFLBitmap;
+		UINT32 mSLBitmaps[FL_COUNT];
+
+		UINT32 mCapacity;
+		UINT32 mLastBlock;
+	};
+
+	/** @} */
+	/** @} */
+}
@@ -10,6 +10,23 @@ namespace BansheeEngine
 	 *  @{
 	 */
 
+	/** Timing and allocation statistics about a single executed benchmark. */
+	struct BS_UTILITY_EXPORT BenchmarkResult
+	{
+		BenchmarkResult();
+
+		String name; /**< Name of the benchmark. */
+		UINT32 numIterations; /**< Number of measured iterations. */
+
+		double minMs; /**< Duration of the fastest iteration, in milliseconds. */
+		double medianMs; /**< Median iteration duration, in milliseconds. */
+		double p99Ms; /**< 99th percentile of iteration durations, in milliseconds. */
+		double meanMs; /**< Average iteration duration, in milliseconds. */
+
+		double allocsPerIteration; /**< Average number of memory allocations per iteration, on the benchmark thread. */
+		double freesPerIteration; /**< Average number of memory deallocations per iteration, on the benchmark thread. */
+	};
+
 	/** Abstract interface used for outputting unit test results. */
 	class BS_UTILITY_EXPORT TestOutput
 	{
@@ -25,6 +42,9 @@ namespace BansheeEngine
 		 * @param[in]	line		Line of code the unit test failed on.
 		 */
 		virtual void outputFail(const String& desc, const String& function, const String& file, long line) = 0;
+
+		/** Triggered when a benchmark finishes executing. */
+		virtual void outputBenchmark(const BenchmarkResult& result) { }
 	};
 
 	/** Outputs unit test results so that failures are reported as exceptions. Success is not reported. */
@@ -35,5 +55,46 @@ namespace BansheeEngine
 		void outputFail(const String& desc, const String& function, const String& file, long line) final override;
 	};
 
+	/**
+	 * Collects benchmark results so they can be saved in JSON format and compared against a previously saved baseline.
+	 * Unit test failures are collected as well and saved along with the results.
+	 */
+	class BS_UTILITY_EXPORT JSONBenchmarkOutput : public TestOutput
+	{
+	public:
+		/** @copydoc TestOutput::outputFail */
+		void outputFail(const String& desc, const String& function, const String& file, long line) override;
+
+		/** @copydoc TestOutput::outputBenchmark */
+		void outputBenchmark(const BenchmarkResult& result) override;
+
+		/** Returns results of all benchmarks reported so far. */
+		const Vector<BenchmarkResult>& getResults() const { return mResults; }
+
+		/** Returns descriptions of all failures reported so far. */
+		const Vector<String>& getFailures() const { return mFailures; }
+
+		/** Encodes all the reported results and failures in JSON format. */
+		String toJSON() const;
+
+		/** Saves all the reported results and failures in JSON format to the specified file. */
+		void save(const Path& path) const;
+
+		/**
+		 * Compares the reported results against results previously saved by save().
+		 *
+		 * @param[in]	baselinePath	Path to the file containing baseline results.
+		 * @param[in]	tolerance		Allowed relative increase in median time and allocation count before a benchmark
+		 *								is considered to have regressed (for example 0.1 for 10%).
+		 * @param[out]	regressions		Descriptions of all benchmarks that regressed compared to the baseline.
+		 * @return						True if no benchmark regressed, false otherwise.
+		 */
+		bool compareToBaseline(const Path& baselinePath, float tolerance, Vector<String>& regressions) const;
+
+	private:
+		Vector<BenchmarkResult> mResults;
+		Vector<String> mFailures;
+	};
+
 	/** @} */
 }
\ No newline at end of file
@@ -21,6 +21,9 @@ namespace BansheeEngine
 	/**
 	 * Primary class for unit testing. Override and register unit tests in constructor then run the tests using the 
 	 * desired method of output.
+	 *
+	 * Suites may also register benchmarks. Benchmarks are not executed by run() and must instead be executed by calling
+	 * runBenchmarks().
 	 */
 	class BS_UTILITY_EXPORT TestSuite
 	{
@@ -37,12 +40,31 @@ namespace BansheeEngine
 			String name;
 		};
 
+		/** Contains data about a single benchmark. */
+		struct BenchmarkEntry
+		{
+			BenchmarkEntry(Func benchmark, const String& name, UINT32 numWarmupIterations, UINT32 numIterations,
+				Func setup);
+
+			Func benchmark;
+			Func setup;
+			String name;
+			UINT32 numWarmupIterations;
+			UINT32 numIterations;
+		};
+
 	public:
 		virtual ~TestSuite() {}
 
 		/** Runs all the tests in the suite (and sub-suites). Tests results are reported to the provided output class. */
 		void run(TestOutput& output);
 
+		/**
+		 * Runs all the benchmarks in the suite (and sub-suites). Timing results and any assertment failures are reported 
+		 * to the provided output class.
+		 */
+		void runBenchmarks(TestOutput& output);
+
 		/** Adds a new child suite to this suite. This method allows you to group suites and execute them all at once. */
 		void add(const SPtr<TestSuite>& suite);
 
@@ -72,6 +94,20 @@ namespace BansheeEngine
 		 */
 		void addTest(Func test, const String& name);
 
+		/**
+		 * Register a new benchmark. The benchmark function is called @p numWarmupIterations times without being measured,
+		 * followed by @p numIterations measured calls.
+		 *
+		 * @param[in]	benchmark			Function to call in order to execute a single iteration of the benchmark.
+		 * @param[in]	name				Name of the benchmark we can use for referencing it later.
+		 * @param[in]	numWarmupIterations	Number of iterations to execute before measurement starts.
+		 * @param[in]	numIterations		Number of measured iterations.
+		 * @param[in]	setup				Optional function to call before every iteration, in order to prepare its
+		 *									input. Its time and allocations are not included in the measurement.
+		 */
+		void addBenchmark(Func benchmark, const String& name, UINT32 numWarmupIterations, UINT32 numIterations, 
+			Func setup = nullptr);
+
 		/**
 		 * Reports success or failure depending on the result of an expression.
 		 *
@@ -83,6 +119,7 @@ namespace BansheeEngine
 		void assertment(bool success, const String& desc, const String& file, long line);
 
 		Vector<TestEntry> mTests;
+		Vector<BenchmarkEntry> mBenchmarks;
 		Vector<SPtr<TestSuite>> mSuites;
 
 		// Transient
@@ -93,5 +130,19 @@ namespace BansheeEngine
 /** Registers a new unit test within an implementation of TestSuite. */
 #define BS_ADD_TEST(func) addTest(static_cast<Func>(&func), #func);
 
+/** Registers a new benchmark within an implementation of TestSuite, using the default number of iterations. */
+#define BS_ADD_BENCHMARK(func) addBenchmark(static_cast<Func>(&func), #func, 5, 50);
+
+/** Registers a new benchmark within an implementation of TestSuite, using a custom number of iterations. */
+#define BS_ADD_BENCHMARK_ITERATIONS(func, warmup, iterations) \
+	addBenchmark(static_cast<Func>(&func), #func, warmup, iterations);
+
+/** 
+ * Registers a new benchmark within an implementation of TestSuite, using the default number of iterations. The setup
+ * function is called before every iteration, outside of the measurement.
+ */
+#define BS_ADD_BENCHMARK_SETUP(func, setup) \
+	addBenchmark(static_cast<Func>(&func), #func, 5, 50, static_cast<Func>(&setup));
+
 	/** @} */
 }
\ No newline at end of file
@@ -37,7 +37,63 @@ namespace BansheeEngine
 		UINT32 width, height;
 	};
 
-	class TexAtlasNode;
+	/**
+	 * Packs rectangles into a single fixed size page using the skyline bottom-left heuristic. Rectangles can be inserted
+	 * incrementally, which makes the packer usable for atlases that are filled at runtime.
+	 */
+	class BS_UTILITY_EXPORT TexAtlasPacker
+	{
+	public:
+		/** Creates a new empty packer for a page of the specified size. */
+		TexAtlasPacker(UINT32 width, UINT32 height);
+
+		/**
+		 * Attempts to find a place for a rectangle of the provided size in the page.
+		 *
+		 * @param[in]	width	Width of the rectangle to insert.
+		 * @param[in]	height	Height of the rectangle to insert.
+		 * @param[out]	x		Horizontal position of the rectangle's top left corner, if inserted.
+		 * @param[out]	y		Vertical position of the rectangle's top left corner, if inserted.
+		 * @return				True if the rectangle was inserted, false if there is no room left for it.
+		 */
+		bool insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y);
+
+		/** Removes all rectangles from the page. */
+		void clear();
+
+		/** Returns the width of the page, in pixels. */
+		UINT32 getWidth() const { return mWidth; }
+
+		/** Returns the height of the page, in pixels. */
+		UINT32 getHeight() const { return mHeight; }
+
+		/** Returns the total area covered by the inserted rectangles, in pixels. */
+		UINT64 getUsedArea() const { return mUsedArea; }
+
+		/** Returns the portion of the page covered by the inserted rectangles, in range [0, 1]. */
+		float getOccupancy() const;
+
+	private:
+		/** Horizontal segment of the skyline. All space below it (larger y) is considered free. */
+		struct SkylineNode
+		{
+			UINT32 x, y, width;
+		};
+
+		/**
+		 * Checks if a rectangle can be placed starting at the specified skyline node, and returns the vertical position
+		 * it would need to be placed at. Returns false if the rectangle doesn't fit.
+		 */
+		bool fits(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& y) const;
+
+		/** Raises the skyline to account for a newly placed rectangle. */
+		void addLevel(UINT32 nodeIdx, UINT32 x, UINT32 y, UINT32 width, UINT32 height);
+
+		UINT32 mWidth;
+		UINT32 mHeight;
+		UINT64 mUsedArea;
+		Vector<SkylineNode> mSkyline;
+	};
 
 	/** Organizes a set of textures into a single larger texture (an atlas) by minimizing empty space. */
 	class BS_UTILITY_EXPORT TexAtlasGenerator
@@ -78,33 +134,17 @@ namespace BansheeEngine
 		UINT32 mMaxTexHeight;
 
 		/**
-		 * Organize all of the provide elements and place them into minimum number of pages with the specified width and height.
-		 * 			
-		 * Caller must ensure @p elements array has the page indexes reset to -1 before calling, otherwise it will be assumed
-		 * those elements already have assigned pages.
-		 * 			
-		 * Using @p startPage parameter you may add an offset to the generated page indexes.
-		 *
-		 * @return	Number of pages generated.
-		 */
-		int generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage = 0) const;
-
-		/**
-		 * Finds the largest element without a page that fits within the provided node.
-		 *
-		 * @return	Array index of the found page, or -1 if all textures have a page.
-		 */
-		int addLargestTextureWithoutPageThatFits(Vector<TexAtlasElementDesc>& elements, TexAtlasNode& node) const;
-
-		/**
-		 * Scan all of the provided elements and find the largest one that still doesn't have a page assigned.
+		 * Places the provided elements into minimum number of pages with the specified width and height.
 		 * 			
-		 * @return	Array index of the found page, or -1 if all textures have a page.
+		 * @param[in]	elements	Elements to place.
+		 * @param[in]	order		Indices of the elements to place, in the order they should be placed in.
+		 * @param[in]	width		Width of each page.
+		 * @param[in]	height		Height of each page.
+		 * @param[in]	startPage	Offset to add to the generated page indexes.
+		 * @return					Number of pages generated, or -1 if some element doesn't fit in a page.
 		 */
-		int findLargestTextureWithoutPage(const Vector<TexAtlasElementDesc>& elements) const;
-
-		/** Sorts all the texture elements so that larget elements come first. */
-		void sortBySize(Vector<TexAtlasElementDesc>& elements) const;
+		int generatePagesForSize(Vector<TexAtlasElementDesc>& elements, const Vector<UINT32>& order, UINT32 width, 
+			UINT32 height, UINT32 startPage = 0) const;
 	};
 
 	/** @} */
@@ -420,7 +420,8 @@ namespace BansheeEngine
 		if (isWriteable() && mpFStream)
 		{
 			mpFStream->write(static_cast<const char*>(buf), static_cast<std::streamsize>(count));
-			written = count;
+			if (!mpFStream->fail())
+				written = count;
 		}
 
 		return written;
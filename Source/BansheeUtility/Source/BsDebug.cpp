@@ -63,6 +63,8 @@ namespace BansheeEngine
 		}
 
 		SPtr<DataStream> ds = FileSystem::createAndOpenFile(filePath);
+		if (ds == nullptr)
+			return;
 
 		UINT32 bmpDataSize = BitmapWriter::getBMPSize(width, height, bytesPerPixel);
 		UINT8* bmpBuffer = bs_newN<UINT8>(bmpDataSize);
@@ -256,6 +258,9 @@ table td
 		stream << htmlFooter;
 
 		SPtr<DataStream> fileStream = FileSystem::createAndOpenFile(path);
+		if (fileStream == nullptr)
+			return;
+
 		fileStream->writeString(stream.str());
 	}
 
@@ -0,0 +1,297 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRangeAlloc.h"
+
+#if BS_COMPILER == BS_COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+namespace BansheeEngine
+{
+	const UINT32 RangeAlloc::INVALID_BLOCK = (UINT32)-1;
+
+	/** Returns the index of the least significant bit set. Value must not be zero. */
+	static UINT32 findFirstSet(UINT32 value)
+	{
+#if BS_COMPILER == BS_COMPILER_MSVC
+		unsigned long index;
+		_BitScanForward(&index, value);
+		return (UINT32)index;
+#else
+		return (UINT32)__builtin_ctz(value);
+#endif
+	}
+
+	/** Returns the index of the most significant bit set. Value must not be zero. */
+	static UINT32 findLastSet(UINT32 value)
+	{
+#if BS_COMPILER == BS_COMPILER_MSVC
+		unsigned long index;
+		_BitScanReverse(&index, value);
+		return (UINT32)index;
+#else
+		return 31 - (UINT32)__builtin_clz(value);
+#endif
+	}
+
+	RangeAlloc::RangeAlloc(UINT32 size)
+		:mFLBitmap(0), mCapacity(0), mLastBlock(INVALID_BLOCK)
+	{
+		for (UINT32 i = 0; i < FL_COUNT; i++)
+		{
+			mSLBitmaps[i] = 0;
+
+			for (UINT32 j = 0; j < SL_COUNT; j++)
+				mFreeLists[i][j] = INVALID_BLOCK;
+		}
+
+		grow(size);
+	}
+
+	UINT32 RangeAlloc::alloc(UINT32 size)
+	{
+		if (size == 0)
+			size = 1;
+
+		// Round the size up to the next list, so that any block in the list found is large enough
+		UINT32 searchSize = size;
+		bool canRound = true;
+		if (size >= SL_COUNT)
+		{
+			UINT32 round = (1U << (findLastSet(size) - SL_BITS)) - 1;
+			if (size > (UINT32)-1 - round)
+				canRound = false;
+			else
+				searchSize += round;
+		}
+
+		UINT32 block = INVALID_BLOCK;
+		if (canRound)
+		{
+			UINT32 fl, sl;
+			mapping(searchSize, fl, sl);
+
+			UINT32 slMap = mSLBitmaps[fl] & ((UINT32)-1 << sl);
+			if (slMap == 0)
+			{
+				UINT32 flMap = (fl + 1) < 32 ? mFLBitmap & ((UINT32)-1 << (fl + 1)) : 0;
+				if (flMap != 0)
+				{
+					fl = findFirstSet(flMap);
+					slMap = mSLBitmaps[fl];
+				}
+			}
+
+			if (slMap != 0)
+				block = mFreeLists[fl][findFirstSet(slMap)];
+		}
+
+		// Rounding skips the list the size itself belongs to, which can still hold a large enough block (e.g. when the
+		// only free block is exactly the requested size). Only the first block is checked, to keep this constant time.
+		if (block == INVALID_BLOCK)
+		{
+			UINT32 fl, sl;
+			mapping(size, fl, sl);
+
+			UINT32 candidate = mFreeLists[fl][sl];
+			if (candidate == INVALID_BLOCK || mBlocks[candidate].size < size)
+				return INVALID_BLOCK;
+
+			block = candidate;
+		}
+
+		removeFree(block);
+
+		// Return the remainder of the block to the free lists
+		if (mBlocks[block].size > size)
+		{
+			UINT32 remainder = createBlock();
+
+			Block& curBlock = mBlocks[block];
+			Block& remBlock = mBlocks[remainder];
+
+			remBlock.offset = curBlock.offset + size;
+			remBlock.size = curBlock.size - size;
+			remBlock.prevPhys = block;
+			remBlock.nextPhys = curBlock.nextPhys;
+
+			if (curBlock.nextPhys != INVALID_BLOCK)
+				mBlocks[curBlock.nextPhys].prevPhys = remainder;
+			else
+				mLastBlock = remainder;
+
+			curBlock.nextPhys = remainder;
+			curBlock.size = size;
+
+			insertFree(remainder);
+		}
+
+		mBlocks[block].free = false;
+		return block;
+	}
+
+	void RangeAlloc::free(UINT32 block)
+	{
+		assert(block < (UINT32)mBlocks.size() && !mBlocks[block].free);
+
+		UINT32 prev = mBlocks[block].prevPhys;
+		if (prev != INVALID_BLOCK && mBlocks[prev].free)
+		{
+			removeFree(prev);
+			absorbNext(prev);
+
+			block = prev;
+		}
+
+		UINT32 next = mBlocks[block].nextPhys;
+		if (next != INVALID_BLOCK && mBlocks[next].free)
+		{
+			removeFree(next);
+			absorbNext(block);
+		}
+
+		insertFree(block);
+	}
+
+	void RangeAlloc::grow(UINT32 newSize)
+	{
+		if (newSize <= mCapacity)
+			return;
+
+		UINT32 numNewElements = newSize - mCapacity;
+		if (mLastBlock != INVALID_BLOCK && mBlocks[mLastBlock].free)
+		{
+			removeFree(mLastBlock);
+			mBlocks[mLastBlock].size += numNewElements;
+			insertFree(mLastBlock);
+		}
+		else
+		{
+			UINT32 block = createBlock();
+
+			Block& newBlock = mBlocks[block];
+			newBlock.offset = mCapacity;
+			newBlock.size = numNewElements;
+			newBlock.prevPhys = mLastBlock;
+			newBlock.nextPhys = INVALID_BLOCK;
+
+			if (mLastBlock != INVALID_BLOCK)
+				mBlocks[mLastBlock].nextPhys = block;
+
+			mLastBlock = block;
+			insertFree(block);
+		}
+
+		mCapacity = newSize;
+	}
+
+	void RangeAlloc::mapping(UINT32 size, UINT32& fl, UINT32& sl)
+	{
+		// Small sizes get a list each, while larger ones are split into SL_COUNT lists per power of two
+		if (size < SL_COUNT)
+		{
+			fl = 0;
+			sl = size;
+		}
+		else
+		{
+			UINT32 msb = findLastSet(size);
+
+			fl = msb - SL_BITS + 1;
+			sl = (size >> (msb - SL_BITS)) ^ SL_COUNT;
+		}
+	}
+
+	void RangeAlloc::insertFree(UINT32 block)
+	{
+		UINT32 fl, sl;
+		mapping(mBlocks[block].size, fl, sl);
+
+		Block& curBlock = mBlocks[block];
+		curBlock.free = true;
+		curBlock.prevFree = INVALID_BLOCK;
+		curBlock.nextFree = mFreeLists[fl][sl];
+
+		if (curBlock.nextFree != INVALID_BLOCK)
+			mBlocks[curBlock.nextFree].prevFree = block;
+
+		mFreeLists[fl][sl] = block;
+		mFLBitmap |= 1U << fl;
+		mSLBitmaps[fl] |= 1U << sl;
+	}
+
+	void RangeAlloc::removeFree(UINT32 block)
+	{
+		UINT32 fl, sl;
+		mapping(mBlocks[block].size, fl, sl);
+
+		Block& curBlock = mBlocks[block];
+		if (curBlock.prevFree != INVALID_BLOCK)
+			mBlocks[curBlock.prevFree].nextFree = curBlock.nextFree;
+		else
+			mFreeLists[fl][sl] = curBlock.nextFree;
+
+		if (curBlock.nextFree != INVALID_BLOCK)
+			mBlocks[curBlock.nextFree].prevFree = curBlock.prevFree;
+
+		if (mFreeLists[fl][sl] == INVALID_BLOCK)
+		{
+			mSLBitmaps[fl] &= ~(1U << sl);
+			if (mSLBitmaps[fl] == 0)
+				mFLBitmap &= ~(1U << fl);
+		}
+
+		curBlock.free = false;
+		curBlock.prevFree = INVALID_BLOCK;
+		curBlock.nextFree = INVALID_BLOCK;
+	}
+
+	UINT32 RangeAlloc::createBlock()
+	{
+		UINT32 block;
+		if (!mUnusedBlocks.empty())
+		{
+			block = mUnusedBlocks.top();
+			mUnusedBlocks.pop();
+		}
+		else
+		{
+			block = (UINT32)mBlocks.size();
+			mBlocks.push_back(Block());
+		}
+
+		Block& newBlock = mBlocks[block];
+		newBlock.offset = 0;
+		newBlock.size = 0;
+		newBlock.prevPhys = INVALID_BLOCK;
+		newBlock.nextPhys = INVALID_BLOCK;
+		newBlock.prevFree = INVALID_BLOCK;
+		newBlock.nextFree = INVALID_BLOCK;
+		newBlock.free = false;
+
+		return block;
+	}
+
+	void RangeAlloc::releaseBlock(UINT32 block)
+	{
+		mUnusedBlocks.push(block);
+	}
+
+	void RangeAlloc::absorbNext(UINT32 block)
+	{
+		UINT32 next = mBlocks[block].nextPhys;
+
+		Block& curBlock = mBlocks[block];
+		Block& nextBlock = mBlocks[next];
+
+		curBlock.size += nextBlock.size;
+		curBlock.nextPhys = nextBlock.nextPhys;
+
+		if (nextBlock.nextPhys != INVALID_BLOCK)
+			mBlocks[nextBlock.nextPhys].prevPhys = block;
+		else
+			mLastBlock = block;
+
+		releaseBlock(next);
+	}
+}
@@ -2,11 +2,199 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTestOutput.h"
 #include "BsException.h"
+#include "BsFileSystem.h"
+#include "BsDataStream.h"
+#include "BsDebug.h"
 
 namespace BansheeEngine
 {
+	/** Escapes a string so it can be written as a JSON string value. */
+	static String escapeJSON(const String& value)
+	{
+		StringStream output;
+		for (auto& entry : value)
+		{
+			switch (entry)
+			{
+			case '"':
+				output << "\\\"";
+				break;
+			case '\\':
+				output << "\\\\";
+				break;
+			case '\n':
+				output << "\\n";
+				break;
+			case '\t':
+				output << "\\t";
+				break;
+			default:
+				if ((UINT8)entry >= 0x20)
+					output << entry;
+				break;
+			}
+		}
+
+		return output.str();
+	}
+
+	/**
+	 * Attempts to find a value of a key in a single line of JSON output written by JSONBenchmarkOutput. Returns an empty
+	 * string if the key cannot be found. String values are returned without the quotes.
+	 */
+	static String findJSONValue(const String& line, const String& key)
+	{
+		String search = "\"" + key + "\":";
+		size_t start = line.find(search);
+		if (start == String::npos)
+			return StringUtil::BLANK;
+
+		start += search.size();
+		while (start < line.size() && line[start] == ' ')
+			start++;
+
+		if (start >= line.size())
+			return StringUtil::BLANK;
+
+		if (line[start] == '"')
+		{
+			size_t end = start + 1;
+			while (end < line.size() && (line[end] != '"' || line[end - 1] == '\\'))
+				end++;
+
+			return line.substr(start + 1, end - start - 1);
+		}
+
+		size_t end = line.find_first_of(",}", start);
+		return line.substr(start, end - start);
+	}
+
+	BenchmarkResult::BenchmarkResult()
+		: numIterations(0), minMs(0.0), medianMs(0.0), p99Ms(0.0), meanMs(0.0), allocsPerIteration(0.0)
+		, freesPerIteration(0.0)
+	{ }
+
 	void ExceptionTestOutput::outputFail(const String& desc, const String& function, const String& file, long line)
 	{
 		BS_EXCEPT(UnitTestException, desc);
 	}
-}
\ No newline at end of file
+
+	void JSONBenchmarkOutput::outputFail(const String& desc, const String& function, const String& file, long line)
+	{
+		mFailures.push_back(function + ": " + desc + " (" + file + ":" + toString((INT64)line) + ")");
+	}
+
+	void JSONBenchmarkOutput::outputBenchmark(const BenchmarkResult& result)
+	{
+		mResults.push_back(result);
+	}
+
+	String JSONBenchmarkOutput::toJSON() const
+	{
+		// Note: Each benchmark is written on its own line, which is what compareToBaseline() relies on when parsing
+		StringStream output;
+		output << std::setprecision(6) << std::fixed;
+
+		output << "{\n\t\"benchmarks\": [\n";
+		for (UINT32 i = 0; i < (UINT32)mResults.size(); i++)
+		{
+			const BenchmarkResult& result = mResults[i];
+
+			output << "\t\t{\"name\": \"" << escapeJSON(result.name) << "\"";
+			output << ", \"iterations\": " << result.numIterations;
+			output << ", \"minMs\": " << result.minMs;
+			output << ", \"medianMs\": " << result.medianMs;
+			output << ", \"p99Ms\": " << result.p99Ms;
+			output << ", \"meanMs\": " << result.meanMs;
+			output << ", \"allocs\": " << result.allocsPerIteration;
+			output << ", \"frees\": " << result.freesPerIteration;
+			output << "}";
+
+			if ((i + 1) < (UINT32)mResults.size())
+				output << ",";
+
+			output << "\n";
+		}
+
+		output << "\t],\n\t\"failures\": [\n";
+		for (UINT32 i = 0; i < (UINT32)mFailures.size(); i++)
+		{
+			output << "\t\t\"" << escapeJSON(mFailures[i]) << "\"";
+
+			if ((i + 1) < (UINT32)mFailures.size())
+				output << ",";
+
+			output << "\n";
+		}
+
+		output << "\t]\n}\n";
+		return output.str();
+	}
+
+	void JSONBenchmarkOutput::save(const Path& path) const
+	{
+		SPtr<DataStream> stream = FileSystem::createAndOpenFile(path);
+		if (stream == nullptr)
+		{
+			LOGERR("Unable to save benchmark results. Cannot open file: " + path.toString());
+			return;
+		}
+
+		String json = toJSON();
+		stream->write(json.data(), json.size());
+		stream->close();
+	}
+
+	bool JSONBenchmarkOutput::compareToBaseline(const Path& baselinePath, float tolerance,
+		Vector<String>& regressions) const
+	{
+		if (!FileSystem::isFile(baselinePath))
+		{
+			LOGWRN("Cannot compare benchmark results. Baseline file doesn't exist: " + baselinePath.toString());
+			return true;
+		}
+
+		SPtr<DataStream> stream = FileSystem::openFile(baselinePath);
+		String contents = stream->getAsString();
+		stream->close();
+
+		Map<String, BenchmarkResult> baseline;
+		Vector<String> lines = StringUtil::split(contents, "\n");
+		for (auto& line : lines)
+		{
+			String name = findJSONValue(line, "name");
+			if (name.empty())
+				continue;
+
+			BenchmarkResult& entry = baseline[name];
+			entry.name = name;
+			entry.medianMs = strtod(findJSONValue(line, "medianMs").c_str(), nullptr);
+			entry.allocsPerIteration = strtod(findJSONValue(line, "allocs").c_str(), nullptr);
+		}
+
+		bool passed = true;
+		for (auto& result : mResults)
+		{
+			auto iterFind = baseline.find(escapeJSON(result.name));
+			if (iterFind == baseline.end())
+				continue;
+
+			const BenchmarkResult& baselineResult = iterFind->second;
+			if (result.medianMs > baselineResult.medianMs * (1.0 + tolerance))
+			{
+				regressions.push_back(result.name + ": median time " + toString(result.medianMs) + "ms, baseline " +
+					toString(baselineResult.medianMs) + "ms");
+				passed = false;
+			}
+
+			if (result.allocsPerIteration > baselineResult.allocsPerIteration * (1.0 + tolerance))
+			{
+				regressions.push_back(result.name + ": " + toString(result.allocsPerIteration) +
+					" allocations per iteration, baseline " + toString(baselineResult.allocsPerIteration));
+				passed = false;
+			}
+		}
+
+		return passed;
+	}
+}
@@ -2,6 +2,7 @@
 //**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
 #include "BsTestSuite.h"
 #include "BsTestOutput.h"
+#include "BsPlatformUtility.h"
 
 namespace BansheeEngine
 {
@@ -9,6 +10,12 @@ namespace BansheeEngine
 		:test(test), name(name)
 	{ }
 
+	TestSuite::BenchmarkEntry::BenchmarkEntry(Func benchmark, const String& name, UINT32 numWarmupIterations, 
+		UINT32 numIterations, Func setup)
+		:benchmark(benchmark), setup(setup), name(name), numWarmupIterations(numWarmupIterations)
+		, numIterations(numIterations)
+	{ }
+
 	TestSuite::TestSuite()
 		: mOutput(nullptr)
 	{ }
@@ -34,6 +41,77 @@ namespace BansheeEngine
 		shutDown();
 	}
 
+	void TestSuite::runBenchmarks(TestOutput& output)
+	{
+		mOutput = &output;
+
+		startUp();
+
+		Vector<double> timings;
+		for (auto& entry : mBenchmarks)
+		{
+			mActiveTestName = entry.name;
+
+			for (UINT32 i = 0; i < entry.numWarmupIterations; i++)
+			{
+				if (entry.setup != nullptr)
+					(this->*(entry.setup))();
+
+				(this->*(entry.benchmark))();
+			}
+
+			UINT32 numIterations = std::max(1U, entry.numIterations);
+			timings.resize(numIterations);
+
+			// Note: Allocation counters are per-thread, so allocations performed by worker threads are not counted
+			UINT64 numAllocs = 0;
+			UINT64 numFrees = 0;
+
+			for (UINT32 i = 0; i < numIterations; i++)
+			{
+				if (entry.setup != nullptr)
+					(this->*(entry.setup))();
+
+				UINT64 startAllocs = MemoryCounter::getNumAllocs();
+				UINT64 startFrees = MemoryCounter::getNumFrees();
+
+				double startTime = PlatformUtility::queryPerformanceTimerMs();
+				(this->*(entry.benchmark))();
+				timings[i] = PlatformUtility::queryPerformanceTimerMs() - startTime;
+
+				numAllocs += MemoryCounter::getNumAllocs() - startAllocs;
+				numFrees += MemoryCounter::getNumFrees() - startFrees;
+			}
+
+			double totalTime = 0.0;
+			for (auto& timing : timings)
+				totalTime += timing;
+
+			std::sort(timings.begin(), timings.end());
+
+			UINT32 p99Idx = (UINT32)std::ceil(numIterations * 0.99) - 1;
+
+			BenchmarkResult result;
+			result.name = entry.name;
+			result.numIterations = numIterations;
+			result.minMs = timings[0];
+			result.medianMs = timings[numIterations / 2];
+			result.p99Ms = timings[std::min(p99Idx, numIterations - 1)];
+			result.meanMs = totalTime / numIterations;
+			result.allocsPerIteration = numAllocs / (double)numIterations;
+			result.freesPerIteration = numFrees / (double)numIterations;
+
+			output.outputBenchmark(result);
+		}
+
+		for (auto& suite : mSuites)
+		{
+			suite->runBenchmarks(output);
+		}
+
+		shutDown();
+	}
+
 	void TestSuite::add(const SPtr<TestSuite>& suite)
 	{
 		mSuites.push_back(suite);
@@ -44,6 +122,12 @@ namespace BansheeEngine
 		mTests.push_back(TestEntry(test, name));
 	}
 
+	void TestSuite::addBenchmark(Func benchmark, const String& name, UINT32 numWarmupIterations, UINT32 numIterations,
+		Func setup)
+	{
+		mBenchmarks.push_back(BenchmarkEntry(benchmark, name, numWarmupIterations, numIterations, setup));
+	}
+
 	void TestSuite::assertment(bool success, const String& desc, const String& file, long line)
 	{
 		if (!success)
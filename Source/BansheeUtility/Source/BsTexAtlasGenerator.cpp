@@ -5,94 +5,147 @@
 
 namespace BansheeEngine
 {
-	class TexAtlasNode
+	TexAtlasPacker::TexAtlasPacker(UINT32 width, UINT32 height)
+		:mWidth(width), mHeight(height), mUsedArea(0)
 	{
-	public:
-		TexAtlasNode()
-			:x(0), y(0), width(0), height(0), children(nullptr), nodeFull(false)
-		{ }
-
-		TexAtlasNode(UINT32 _x, UINT32 _y, UINT32 _width, UINT32 _height)
-			:x(_x), y(_y), width(_width), height(_height), children(nullptr), nodeFull(false)
-		{ }
+		clear();
+	}
 
-		~TexAtlasNode()
+	bool TexAtlasPacker::insert(UINT32 width, UINT32 height, UINT32& x, UINT32& y)
+	{
+		if (width == 0 || height == 0)
 		{
-			if(children != nullptr)
-				bs_deleteN(children, 2);
+			x = 0;
+			y = 0;
+
+			return true;
 		}
 
-		UINT32 x, y, width, height;
-		TexAtlasNode* children;
-		bool nodeFull;
+		// Find the position that keeps the skyline the lowest, preferring narrower segments on ties
+		UINT32 bestIdx = (UINT32)-1;
+		UINT32 bestBottom = std::numeric_limits<UINT32>::max();
+		UINT32 bestWidth = std::numeric_limits<UINT32>::max();
+		UINT32 bestY = 0;
 
-		bool insert(TexAtlasElementDesc& element)
+		for (UINT32 i = 0; i < (UINT32)mSkyline.size(); i++)
 		{
-			float aspect = width / (float)height;
+			UINT32 curY;
+			if (!fits(i, width, height, curY))
+				continue;
 
-			return insert(element, aspect);
+			UINT32 bottom = curY + height;
+			if (bottom < bestBottom || (bottom == bestBottom && mSkyline[i].width < bestWidth))
+			{
+				bestIdx = i;
+				bestBottom = bottom;
+				bestWidth = mSkyline[i].width;
+				bestY = curY;
+			}
 		}
 
-		bool insert(TexAtlasElementDesc& element, float aspect)
+		if (bestIdx == (UINT32)-1)
+			return false;
+
+		x = mSkyline[bestIdx].x;
+		y = bestY;
+
+		addLevel(bestIdx, x, y, width, height);
+		mUsedArea += (UINT64)width * height;
+
+		return true;
+	}
+
+	void TexAtlasPacker::clear()
+	{
+		mSkyline.clear();
+		mUsedArea = 0;
+
+		SkylineNode node;
+		node.x = 0;
+		node.y = 0;
+		node.width = mWidth;
+
+		mSkyline.push_back(node);
+	}
+
+	float TexAtlasPacker::getOccupancy() const
+	{
+		UINT64 totalArea = (UINT64)mWidth * mHeight;
+		if (totalArea == 0)
+			return 0.0f;
+
+		return (float)((double)mUsedArea / totalArea);
+	}
+
+	bool TexAtlasPacker::fits(UINT32 nodeIdx, UINT32 width, UINT32 height, UINT32& y) const
+	{
+		UINT32 x = mSkyline[nodeIdx].x;
+		if (x + width > mWidth)
+			return false;
+
+		// Rectangle must rest on the highest segment it spans
+		INT32 widthLeft = (INT32)width;
+		UINT32 i = nodeIdx;
+		y = mSkyline[nodeIdx].y;
+
+		while (widthLeft > 0)
 		{
-			if (children != nullptr)
-			{
-				if (children[0].insert(element))
-					return true;
+			y = std::max(y, mSkyline[i].y);
+			if (y + height > mHeight)
+				return false;
 
-				return children[1].insert(element);
-			}
-			else
-			{
-				if(nodeFull)
-					return false;
+			widthLeft -= (INT32)mSkyline[i].width;
+			i++;
+		}
 
-				if (element.input.width > width || element.input.height > height)
-					return false;
+		return true;
+	}
 
-				if (element.input.width == width && element.input.height == height)
-				{
-					element.output.x = x;
-					element.output.y = y;
-					nodeFull = true;
+	void TexAtlasPacker::addLevel(UINT32 nodeIdx, UINT32 x, UINT32 y, UINT32 width, UINT32 height)
+	{
+		SkylineNode newNode;
+		newNode.x = x;
+		newNode.y = y + height;
+		newNode.width = width;
 
-					return true;
-				}
+		mSkyline.insert(mSkyline.begin() + nodeIdx, newNode);
 
-				float dw = (float)(width - element.input.width);
-				float dh = (height - element.input.height) * aspect;
+		// Shrink or remove the segments covered by the new one
+		for (UINT32 i = nodeIdx + 1; i < (UINT32)mSkyline.size(); i++)
+		{
+			const SkylineNode& prev = mSkyline[i - 1];
+			SkylineNode& cur = mSkyline[i];
 
-				children = bs_newN<TexAtlasNode>(2);
+			UINT32 prevEnd = prev.x + prev.width;
+			if (cur.x >= prevEnd)
+				break;
 
-				if (dw > dh)
-				{
-					children[0].x = x;
-					children[0].y = y;
-					children[0].width = element.input.width;
-					children[0].height = height;
-
-					children[1].x = x + element.input.width;
-					children[1].y = y;
-					children[1].width = width - element.input.width;
-					children[1].height = height;
-				}
-				else
-				{
-					children[0].x = x;
-					children[0].y = y;
-					children[0].width = width;
-					children[0].height = element.input.height;
-
-					children[1].x = x;
-					children[1].y = y + element.input.height;
-					children[1].width = width;
-					children[1].height = height - element.input.height;
-				}
+			UINT32 shrink = prevEnd - cur.x;
+			if (cur.width <= shrink)
+			{
+				mSkyline.erase(mSkyline.begin() + i);
+				i--;
+			}
+			else
+			{
+				cur.x += shrink;
+				cur.width -= shrink;
+				break;
+			}
+		}
 
-				return children[0].insert(element);
+		// Merge neighboring segments at the same height
+		for (UINT32 i = 0; (i + 1) < (UINT32)mSkyline.size();)
+		{
+			if (mSkyline[i].y == mSkyline[i + 1].y)
+			{
+				mSkyline[i].width += mSkyline[i + 1].width;
+				mSkyline.erase(mSkyline.begin() + i + 1);
 			}
+			else
+				i++;
 		}
-	};
+	}
 
 	TexAtlasGenerator::TexAtlasGenerator(bool square, UINT32 maxTexWidth, UINT32 maxTexHeight, bool fixedSize)
 		:mSquare(square), mFixedSize(fixedSize), mMaxTexWidth(maxTexWidth), mMaxTexHeight(maxTexHeight)
@@ -109,14 +162,43 @@ namespace BansheeEngine
 
 	Vector<TexAtlasPageDesc> TexAtlasGenerator::createAtlasLayout(Vector<TexAtlasElementDesc>& elements) const
 	{
-		for(size_t i = 0; i < elements.size(); i++)
+		// Elements with no area are never placed, and keep their page set to -1
+		Vector<UINT32> order;
+		order.reserve(elements.size());
+
+		for(UINT32 i = 0; i < (UINT32)elements.size(); i++)
+		{
 			elements[i].output.page = -1;
+			elements[i].output.x = 0;
+			elements[i].output.y = 0;
+
+			if (elements[i].input.width > 0 && elements[i].input.height > 0)
+				order.push_back(i);
+		}
 
-		//sortBySize(elements);
-		int numPages = generatePagesForSize(elements, mMaxTexWidth, mMaxTexHeight);
+		// Skyline packing works best when taller elements are placed first
+		std::sort(order.begin(), order.end(), 
+			[&](UINT32 a, UINT32 b)
+		{
+			const TexAtlasElementDesc& elemA = elements[a];
+			const TexAtlasElementDesc& elemB = elements[b];
+
+			if (elemA.input.height != elemB.input.height)
+				return elemA.input.height > elemB.input.height;
+
+			if (elemA.input.width != elemB.input.width)
+				return elemA.input.width > elemB.input.width;
+
+			return a < b;
+		});
+
+		int numPages = generatePagesForSize(elements, order, mMaxTexWidth, mMaxTexHeight);
 
 		if(numPages == -1)
 		{
+			for(auto& element : elements)
+				element.output.page = -1;
+
 			LOGWRN("Some of the provided elements don't fit in an atlas of provided size. Returning empty array of pages.");
 			return Vector<TexAtlasPageDesc>();
 		}
@@ -131,67 +213,40 @@ namespace BansheeEngine
 		// If size isn't fixed, try to reduce the size of the last page
 		if(!mFixedSize)
 		{
+			Vector<UINT32> lastPageOrder;
+			for(auto& entry : order)
+			{
+				if(elements[entry].output.page == lastPageIdx)
+					lastPageOrder.push_back(entry);
+			}
+
 			while (true)
 			{
 				if (lastPageWidth <= 1 || lastPageHeight <= 1)
 					break;
 
-				int newLastPageWidth = lastPageWidth;
-				int newLastPageHeight = lastPageHeight;
+				UINT32 newLastPageWidth = lastPageWidth;
+				UINT32 newLastPageHeight = lastPageHeight;
 
-				if(mSquare)
-				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
-				}
+				if (newLastPageWidth > newLastPageHeight)
+					newLastPageWidth /= 2;
 				else
-				{
-					if (newLastPageWidth > newLastPageHeight)
-						newLastPageWidth /= 2;
-					else
-						newLastPageHeight /= 2;
-				}
+					newLastPageHeight /= 2;
 
-				// Clear page indexes so we know which pages to process
-				for(size_t i = 0; i < elements.size(); i++)
-				{
-					if(elements[i].output.page >= lastPageIdx)
-						elements[i].output.page = -1;
-				}
-
-				if(generatePagesForSize(elements, newLastPageWidth, newLastPageHeight, lastPageIdx) == 1)
+				if(generatePagesForSize(elements, lastPageOrder, newLastPageWidth, newLastPageHeight, lastPageIdx) == 1)
 				{
 					lastPageWidth = newLastPageWidth;
 					lastPageHeight = newLastPageHeight;
 				}
 				else
 				{
-					// We're done but we need to re-do all the pages with the last valid size
-					for(size_t i = 0; i < elements.size(); i++)
-					{
-						if(elements[i].output.page >= lastPageIdx)
-							elements[i].output.page = -1;
-					}
-
-					generatePagesForSize(elements, lastPageWidth, lastPageHeight, lastPageIdx);
-
+					// We're done but we need to re-do the last page with the last valid size
+					generatePagesForSize(elements, lastPageOrder, lastPageWidth, lastPageHeight, lastPageIdx);
 					break;
 				}
 			}
 		}
 
-		// Handle degenerate case
-		for(size_t i = 0; i < elements.size(); i++)
-		{
-			if(elements[i].output.page == -1 && elements[i].input.width == 0 && elements[i].input.height == 0)
-			{
-				elements[i].output.x = 0;
-				elements[i].output.y = 0;
-			}
-		}
-
 		// Create page descriptors and return
 		Vector<TexAtlasPageDesc> pages;
 		for(int i = 0; i < numPages - 1; i++)
@@ -212,121 +267,42 @@ namespace BansheeEngine
 		return pages;
 	}
 
-	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, UINT32 width, UINT32 height, UINT32 startPage) const
+	int TexAtlasGenerator::generatePagesForSize(Vector<TexAtlasElementDesc>& elements, const Vector<UINT32>& order, 
+		UINT32 width, UINT32 height, UINT32 startPage) const
 	{
-		if(elements.size() == 0)
+		if(order.size() == 0)
 			return 0;
 
-		int currentPage = startPage;
-		int numPages = 0;
-		while (true)
+		Vector<TexAtlasPacker> pages;
+		for(auto& entry : order)
 		{
-			int largestTexId = findLargestTextureWithoutPage(elements); // Start with the largest available texture
-
-			if (largestTexId == -1) // No more textures, we're done
-				return numPages;
-
-			TexAtlasElementDesc& currentElem = elements[largestTexId];
+			TexAtlasElementDesc& element = elements[entry];
 
 			// If the texture is larger than the atlas size then it can never fit
-			while (width < currentElem.input.width || height < currentElem.input.height)
-				return -1;
-
-			TexAtlasNode atlasNode(0, 0, width, height);
-			atlasNode.insert(elements[largestTexId]);
-			elements[largestTexId].output.page = currentPage;
-
-			// Now that the first (largest) texture has been added, do the same for every other texture until atlas is full
-			while (true)
-			{
-				int addedTextureId = addLargestTextureWithoutPageThatFits(elements, atlasNode); // Try to add next largest texture
-				if (addedTextureId == -1)
-					break;
-
-				elements[addedTextureId].output.page = currentPage;
-			}
-
-			currentPage++;
-			numPages++;
-		}
-	}
-
-	int TexAtlasGenerator::addLargestTextureWithoutPageThatFits(Vector<TexAtlasElementDesc>& elements, TexAtlasNode& node) const
-	{
-		UINT32 sizeLimit = std::numeric_limits<UINT32>::max();
-		while (true)
-		{
-			UINT32 largestSize = 0;
-			INT32 largestId = -1;
-
-			for (size_t i = 0; i < elements.size(); i++)
-			{
-				if (elements[i].output.page == -1) // Signifies that we haven't processed this node yet
-				{
-					UINT32 size = elements[i].input.width * elements[i].input.height;
-					if (size > largestSize && size < sizeLimit)
-					{
-						largestSize = size;
-						largestId = (INT32)i;
-					}
-				}
-			}
-
-			if (largestId == -1)
+			if (width < element.input.width || height < element.input.height)
 				return -1;
 
-			if (node.insert(elements[largestId]))
-				return largestId;
-			else
-				sizeLimit = largestSize;
-		}
-	}
-
-	int TexAtlasGenerator::findLargestTextureWithoutPage(const Vector<TexAtlasElementDesc>& elements) const
-	{
-		INT32 largestId = -1;
-		UINT32 largestSize = 0;
-
-		for (size_t i = 0; i < elements.size(); i++)
-		{
-			if (elements[i].output.page == -1) // Signifies that we haven't processed this node yet
+			// Try pages that are still open first, and start a new page if the element doesn't fit in any of them
+			bool placed = false;
+			for(UINT32 i = 0; i < (UINT32)pages.size(); i++)
 			{
-				UINT32 size = elements[i].input.width * elements[i].input.height;
-				if (size > largestSize)
+				if(pages[i].insert(element.input.width, element.input.height, element.output.x, element.output.y))
 				{
-					largestSize = size;
-					largestId = (INT32)i;
+					element.output.page = startPage + i;
+					placed = true;
+					break;
 				}
 			}
-		}
-
-		return largestId;
-	}
-
-	void TexAtlasGenerator::sortBySize(Vector<TexAtlasElementDesc>& elements) const
-	{
-		for (size_t i = 0; i < elements.size(); i++)
-		{
-			INT32 largestId = -1;
-			UINT32 largestSize = 0;
 
-			for (size_t j = i; j < elements.size(); j++)
+			if(!placed)
 			{
-				UINT32 size = elements[j].input.width * elements[j].input.height;
+				pages.push_back(TexAtlasPacker(width, height));
+				pages.back().insert(element.input.width, element.input.height, element.output.x, element.output.y);
 
-				if (size > largestSize)
-				{
-					largestSize = size;
-					largestId = (INT32)j;
-				}
-			}
-
-			if(largestId != -1)
-			{
-				TexAtlasElementDesc temp = elements[i];
-				elements[i] = elements[largestId];
-				elements[largestId] = temp;
+				element.output.page = startPage + (UINT32)pages.size() - 1;
 			}
 		}
+
+		return (int)pages.size();
 	}
-}
\ No newline at end of file
+}
@@ -8,6 +8,40 @@
 
 namespace BansheeEngine
 {
+	/** Read-only memory stream over a file mapped into memory. */
+	class Win32MappedFileDataStream : public MemoryDataStream
+	{
+	public:
+		Win32MappedFileDataStream(void* view, size_t size, HANDLE file, HANDLE mapping)
+			:MemoryDataStream(view, size), mFile(file), mMapping(mapping)
+		{
+			mAccess = READ;
+		}
+
+		~Win32MappedFileDataStream()
+		{
+			close();
+		}
+
+		/** @copydoc MemoryDataStream::close */
+		void close() override
+		{
+			if (mData == nullptr)
+				return;
+
+			UnmapViewOfFile(mData);
+			CloseHandle(mMapping);
+			CloseHandle(mFile);
+
+			// Memory is owned by the mapping, make sure the base class doesn't try to free it
+			mData = nullptr;
+		}
+
+	private:
+		HANDLE mFile;
+		HANDLE mMapping;
+	};
+
 	void win32_handleError(DWORD error, const WString& path)
 	{
 		switch (error)
@@ -330,12 +364,56 @@ namespace BansheeEngine
 
 		// Should check ensure open succeeded, in case fail for some reason.
 		if (rwStream->fail())
-			BS_EXCEPT(FileNotFoundException, "Cannot open file: " + fullPath.toString());
+		{
+			LOGWRN("Cannot open file: " + fullPath.toString());
+			return nullptr;
+		}
 
 		/// Construct return stream, tell it to delete on destroy
 		return bs_shared_ptr_new<FileDataStream>(rwStream, 0, true);
 	}
 
+	SPtr<MemoryDataStream> FileSystem::mapFile(const Path& fullPath)
+	{
+		WString pathWString = fullPath.toWString();
+		const wchar_t* pathString = pathWString.c_str();
+
+		HANDLE file = CreateFileW(pathString, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, 
+			FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, nullptr);
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			return nullptr;
+		}
+
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(file, &fileSize) == 0 || fileSize.QuadPart == 0)
+		{
+			LOGWRN("Cannot map an empty file: " + fullPath.toString());
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+		if (mapping == nullptr)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+		if (view == nullptr)
+		{
+			win32_handleError(GetLastError(), pathWString);
+			CloseHandle(mapping);
+			CloseHandle(file);
+			return nullptr;
+		}
+
+		return bs_shared_ptr_new<Win32MappedFileDataStream>(view, (size_t)fileSize.QuadPart, file, mapping);
+	}
+
 	UINT64 FileSystem::getFileSize(const Path& fullPath)
 	{
 		return win32_getFileSize(fullPath.toWString());
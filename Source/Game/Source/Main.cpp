@@ -8,6 +8,7 @@
 #include "BsFileSystem.h"
 #include "BsResources.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsPrefab.h"
 #include "BsSceneObject.h"
 #include "BsSceneManager.h"
@@ -134,6 +135,15 @@ void runApplication()
 		gResources().registerResourceManifest(manifest);
 	}
 
+	// Resources referenced by UUID are read from the package, if one was built
+	Path resourcePackagePath = resourcesPath + GAME_RESOURCE_PACKAGE_NAME;
+	if (FileSystem::exists(resourcePackagePath))
+	{
+		SPtr<ResourcePackage> package = ResourcePackage::open(resourcePackagePath);
+		if (package != nullptr)
+			gResources().registerResourcePackage(package);
+	}
+
 	{
 		HPrefab mainScene = static_resource_cast<Prefab>(gResources().loadFromUUID(gameSettings->mainSceneUUID, false, true, false));
 		if (mainScene.isLoaded(false))
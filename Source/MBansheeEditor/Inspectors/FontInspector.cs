@@ -21,6 +21,7 @@ namespace BansheeEditor
         private GUIEnumField renderModeField;
         private GUIToggleField boldField;
         private GUIToggleField italicField;
+        private GUIToggleField dynamicField;
         private GUIIntField dpiField;
         private GUIButton reimportButton;
 
@@ -74,6 +75,7 @@ namespace BansheeEditor
             renderModeField.Value = (ulong)newImportOptions.RenderMode;
             boldField.Value = newImportOptions.Bold;
             italicField.Value = newImportOptions.Italic;
+            dynamicField.Value = newImportOptions.Dynamic;
             dpiField.Value = newImportOptions.DPI;
             importOptions = newImportOptions;
 
@@ -108,6 +110,9 @@ namespace BansheeEditor
             italicField = new GUIToggleField(new LocEdString("Italic"));
             italicField.OnChanged += x => importOptions.Italic = x;
 
+            dynamicField = new GUIToggleField(new LocEdString("Dynamic"));
+            dynamicField.OnChanged += x => importOptions.Dynamic = x;
+
             dpiField = new GUIIntField(new LocEdString("DPI"));
             dpiField.OnChanged += x => importOptions.DPI = x;
 
@@ -117,6 +122,7 @@ namespace BansheeEditor
             Layout.AddElement(renderModeField);
             Layout.AddElement(boldField);
             Layout.AddElement(italicField);
+            Layout.AddElement(dynamicField);
             Layout.AddElement(dpiField);
             Layout.AddSpace(10);
 
@@ -325,6 +325,16 @@ namespace BansheeEditor
             set { Internal_SetItalic(mCachedPtr, value); }
         }
 
+        /// <summary>
+        /// Determines should characters outside of <see cref="CharRanges"/> be rendered at runtime, on first use. When 
+        /// enabled the font file is stored with the font resource.
+        /// </summary>
+        public bool Dynamic
+        {
+            get { return Internal_GetDynamic(mCachedPtr); }
+            set { Internal_SetDynamic(mCachedPtr, value); }
+        }
+
         /// <summary>
         /// Determines character ranges to import from the font. Ranges are defined as unicode numbers.
         /// </summary>
@@ -367,6 +377,12 @@ namespace BansheeEditor
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern void Internal_SetItalic(IntPtr thisPtr, bool value);
 
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern bool Internal_GetDynamic(IntPtr thisPtr);
+
+        [MethodImpl(MethodImplOptions.InternalCall)]
+        private static extern void Internal_SetDynamic(IntPtr thisPtr, bool value);
+
         [MethodImpl(MethodImplOptions.InternalCall)]
         private static extern CharRange[] Internal_GetCharRanges(IntPtr thisPtr);
 
@@ -8,7 +8,10 @@ set(BS_RENDERBEAST_INC_NOFILTER
 	"Include/BsRenderTargets.h"
 	"Include/BsStaticRenderableHandler.h"
 	"Include/BsLightRendering.h"
+	"Include/BsLightGrid.h"
+	"Include/BsRenderGraph.h"
 	"Include/BsPostProcessing.h"
+	"Include/BsRenderBeastTestSuite.h"
 )
 
 set(BS_RENDERBEAST_SRC_NOFILTER
@@ -20,7 +23,10 @@ set(BS_RENDERBEAST_SRC_NOFILTER
 	"Source/BsRenderTargets.cpp"
 	"Source/BsStaticRenderableHandler.cpp"
 	"Source/BsLightRendering.cpp"
+	"Source/BsLightGrid.cpp"
+	"Source/BsRenderGraph.cpp"
 	"Source/BsPostProcessing.cpp"
+	"Source/BsRenderBeastTestSuite.cpp"
 )
 
 source_group("Header Files" FILES ${BS_RENDERBEAST_INC_NOFILTER})
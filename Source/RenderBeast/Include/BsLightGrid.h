@@ -0,0 +1,89 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Splits the camera frustum into a grid of cells (screen space tiles, each further split into depth slices that are
+	 * distributed exponentially between the near and far plane) and keeps a list of point lights influencing each cell.
+	 *
+	 * The grid is built on the CPU, and allows the lights affecting a part of the view to be found without iterating over
+	 * all lights visible from the camera.
+	 *
+	 * @note	Core thread only.
+	 */
+	class LightGrid
+	{
+		/** Range of grid cells influenced by a single light. Range is empty if minimum is larger than the maximum. */
+		struct CellRange
+		{
+			UINT32 minX, maxX;
+			UINT32 minY, maxY;
+			UINT32 minZ, maxZ;
+		};
+
+	public:
+		LightGrid();
+
+		/**
+		 * Assigns the provided lights to the grid cells they influence, as seen by the provided camera. Any previously
+		 * built grid is discarded.
+		 *
+		 * @param[in]	camera	Camera whose frustum to split into cells. Size of the screen space tiles is determined by
+		 *						the size of its viewport.
+		 * @param[in]	lights	Radial or spot lights to assign. Light indices stored by the grid refer to this array.
+		 *						Lights should have been culled against the camera frustum beforehand, as lights outside
+		 *						of it are still considered, and are assigned to cells closest to them.
+		 */
+		void build(const CameraCore& camera, const Vector<const LightCore*>& lights);
+
+		/** Returns the number of cells in the grid along each of its axes. */
+		void getGridSize(UINT32& x, UINT32& y, UINT32& z) const { x = mNumCellsX; y = mNumCellsY; z = NUM_DEPTH_SLICES; }
+
+		/** Returns the total number of lights in the grid, as provided to the last build() call. */
+		UINT32 getNumLights() const { return mNumLights; }
+
+		/** Returns the total number of light references in all cells of the grid. */
+		UINT32 getNumLightReferences() const { return (UINT32)mLightIndices.size(); }
+
+		/** Returns the number of lights influencing the specified cell. */
+		UINT32 getNumCellLights(UINT32 x, UINT32 y, UINT32 z) const { return mCellCounts[getCellIdx(x, y, z)]; }
+
+		/**
+		 * Returns indices of lights influencing the specified cell. Returned array has getNumCellLights() entries, each
+		 * referencing a light in the array provided to the last build() call.
+		 */
+		const UINT32* getCellLights(UINT32 x, UINT32 y, UINT32 z) const
+		{
+			return mLightIndices.data() + mCellOffsets[getCellIdx(x, y, z)];
+		}
+
+		/** Width and height of a single grid cell, in pixels. */
+		static const UINT32 CELL_SIZE;
+
+		/** Number of cells along the depth axis of the grid. */
+		static const UINT32 NUM_DEPTH_SLICES;
+
+	private:
+		/** Returns a sequential index of the specified cell. */
+		UINT32 getCellIdx(UINT32 x, UINT32 y, UINT32 z) const { return (z * mNumCellsY + y) * mNumCellsX + x; }
+
+		UINT32 mNumCellsX;
+		UINT32 mNumCellsY;
+		UINT32 mNumLights;
+
+		Vector<CellRange> mLightCellRanges;
+		Vector<UINT32> mCellOffsets;
+		Vector<UINT32> mCellCounts;
+		Vector<UINT32> mLightIndices;
+	};
+
+	/** @} */
+}
@@ -6,6 +6,7 @@
 #include "BsRendererMaterial.h"
 #include "BsParamBlocks.h"
 #include "BsRenderTexturePool.h"
+#include "BsRenderGraph.h"
 #include "BsPostProcessSettings.h"
 
 namespace BansheeEngine
@@ -20,12 +21,11 @@ namespace BansheeEngine
 		PostProcessSettings settings;
 		bool settingDirty = true;
 
-		SPtr<PooledRenderTexture> downsampledSceneTex;
-		SPtr<PooledRenderTexture> histogramTex;
-		SPtr<PooledRenderTexture> histogramReduceTex;
 		SPtr<PooledRenderTexture> eyeAdaptationTex[2];
 		SPtr<PooledRenderTexture> colorLUT;
 		INT32 lastEyeAdaptationTex = 0;
+
+		RenderGraph graph;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(DownsampleParams)
@@ -40,21 +40,18 @@ namespace BansheeEngine
 	public:
 		DownsampleMat();
 
-		/** Renders the post-process effect with the provided parameters. */
-		void execute(const SPtr<RenderTextureCore>& target, PostProcessInfo& ppInfo);
+		/** Renders the post-process effect, downsampling the input into the output texture. */
+		void execute(const SPtr<RenderTextureCore>& input, const SPtr<PooledRenderTexture>& output);
 
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** Returns the size of the output texture when downsampling the provided input. */
+		static Vector2I getOutputSize(const SPtr<RenderTextureCore>& input);
 
-		/** Returns the render texture where the output will be written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns a description of the texture to write the output to when downsampling the provided input. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc(const SPtr<RenderTextureCore>& input);
 	private:
 		DownsampleParams mParams;
 		MaterialParamVec2Core mInvTexSize;
 		MaterialParamTextureCore mInputTexture;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptHistogramParams)
@@ -71,17 +68,15 @@ namespace BansheeEngine
 	public:
 		EyeAdaptHistogramMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** Executes the post-process effect, writing histograms of the input texture into the output texture. */
+		void execute(const SPtr<PooledRenderTexture>& input, const SPtr<PooledRenderTexture>& output, 
+			const PostProcessInfo& ppInfo);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns a description of the texture to write the output to, for an input texture of the provided size. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc(const Vector2I& inputSize);
 
-		/** Calculates the number of thread groups that need to execute to cover the provided render target. */
-		static Vector2I getThreadGroupCount(const SPtr<RenderTextureCore>& target);
+		/** Calculates the number of thread groups that need to execute to cover an input texture of the provided size. */
+		static Vector2I getThreadGroupCount(const Vector2I& inputSize);
 
 		/** 
 		 * Returns a vector containing scale and offset (in that order) that will be applied to luminance values
@@ -98,9 +93,6 @@ namespace BansheeEngine
 		MaterialParamTextureCore mSceneColor;
 		MaterialParamLoadStoreTextureCore mOutputTex;
 
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
-
 		static const UINT32 LOOP_COUNT_X = 8;
 		static const UINT32 LOOP_COUNT_Y = 8;
 	};
@@ -117,22 +109,24 @@ namespace BansheeEngine
 	public:
 		EyeAdaptHistogramReduceMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
-
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** 
+		 * Executes the post-process effect with the provided parameters.
+		 *
+		 * @param[in]	histogram			Histograms created by EyeAdaptHistogramMat.
+		 * @param[in]	prevEyeAdaptation	Texture containing eye adaptation from the previous frame. Can be null if not
+		 *									available.
+		 * @param[in]	output				Texture to write the reduced histogram to.
+		 */
+		void execute(const SPtr<PooledRenderTexture>& histogram, const SPtr<PooledRenderTexture>& prevEyeAdaptation,
+			const SPtr<PooledRenderTexture>& output);
 
-		/** Returns the render texture where the output was written. */
-		SPtr<RenderTextureCore> getOutput() const { return mOutput; }
+		/** Returns a description of the texture to write the output to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 	private:
 		EyeAdaptHistogramReduceParams mParams;
 
 		MaterialParamTextureCore mHistogramTex;
 		MaterialParamTextureCore mEyeAdaptationTex;
-
-		POOLED_RENDER_TEXTURE_DESC mOutputDesc;
-		SPtr<RenderTextureCore> mOutput;
 	};
 
 	BS_PARAM_BLOCK_BEGIN(EyeAdaptationParams)
@@ -147,8 +141,15 @@ namespace BansheeEngine
 	public:
 		EyeAdaptationMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo, float frameDelta);
+		/** 
+		 * Executes the post-process effect, calculating eye adaptation from the histogram reduced by 
+		 * EyeAdaptHistogramReduceMat and writing it to the output texture.
+		 */
+		void execute(const SPtr<PooledRenderTexture>& reducedHistogram, const SPtr<PooledRenderTexture>& output,
+			const PostProcessInfo& ppInfo, float frameDelta);
+
+		/** Returns a description of the texture to write the output to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 	private:
 		EyeAdaptationParams mParams;
 		MaterialParamTextureCore mReducedHistogramTex;
@@ -180,11 +181,11 @@ namespace BansheeEngine
 	public:
 		CreateTonemapLUTMat();
 
-		/** Executes the post-process effect with the provided parameters. */
-		void execute(PostProcessInfo& ppInfo);
+		/** Executes the post-process effect, writing the lookup table to the output texture. */
+		void execute(const SPtr<PooledRenderTexture>& output, const PostProcessInfo& ppInfo);
 
-		/** Releases the output render target. */
-		void release(PostProcessInfo& ppInfo);
+		/** Returns a description of the texture to write the output to. */
+		static POOLED_RENDER_TEXTURE_DESC getOutputDesc();
 
 		/** Size of the 3D color lookup table. */
 		static const UINT32 LUT_SIZE = 32;
@@ -220,7 +221,8 @@ namespace BansheeEngine
 	};
 
 	/**
-	 * Renders post-processing effects for the provided render target.
+	 * Renders post-processing effects for the provided render target. Effects are executed through a RenderGraph stored
+	 * in the per-camera PostProcessInfo, which also owns the intermediate textures between frames.
 	 *
 	 * @note	Core thread only.
 	 */
@@ -10,6 +10,9 @@
 #include "BsRendererMaterial.h"
 #include "BsLightRendering.h"
 #include "BsPostProcessing.h"
+#include "BsRenderQueue.h"
+#include "BsRenderCommandBuffer.h"
+#include "BsLightGrid.h"
 
 namespace BansheeEngine
 {
@@ -101,6 +104,16 @@ namespace BansheeEngine
 
 			SPtr<RenderTargets> target;
 			PostProcessInfo postProcessInfo;
+
+			/** 
+			 * Radial and spot lights visible from the camera. Lights whose geometry contains the camera come first, 
+			 * followed by all the others.
+			 */
+			Vector<const LightCore*> visiblePointLights;
+			UINT32 numPointLightsInside;
+
+			/** Grid of visible radial and spot lights, binned by the screen area and depth range they influence. */
+			LightGrid lightGrid;
 		};
 
 		/**	Data used by the renderer for lights. */
@@ -109,6 +122,14 @@ namespace BansheeEngine
 			LightCore* internal;
 		};
 
+		/** A single draw call, rendering one or multiple (instanced) consecutive render queue entries. */
+		struct DrawBatch
+		{
+			UINT32 startIdx;
+			UINT32 numInstances;
+			UINT32 instanceBufferIdx;
+		};
+
 	public:
 		RenderBeast();
 		~RenderBeast() { }
@@ -132,6 +153,8 @@ namespace BansheeEngine
 		void destroy() override;
 
 	private:
+		friend class RenderBeastTestSuite;
+
 		/** @copydoc Renderer::notifyCameraAdded */
 		void notifyCameraAdded(const CameraCore* camera) override;
 
@@ -186,7 +209,8 @@ namespace BansheeEngine
 		void renderAllCore(float time, float delta);
 
 		/**
-		 * Populates camera render queues by determining visible renderable object.
+		 * Populates camera render queues by determining visible renderable object, and determines point lights visible
+		 * by the camera.
 		 *
 		 * @param[in]	camera	The camera to determine visibility for.
 		 */
@@ -203,6 +227,29 @@ namespace BansheeEngine
 		 */
 		void render(RenderTargetData& rtData, UINT32 camIdx, float delta);
 
+		/**
+		 * Renders the provided queue elements, in order. Consecutive elements that share the same mesh, material and pass
+		 * are rendered using a single instanced draw call, if their material supports it.
+		 *
+		 * Commands for large numbers of elements are recorded in parallel on worker threads, and then executed in order.
+		 *
+		 * @note	Core thread only.
+		 */
+		void renderElements(const Vector<RenderQueueElement>& elements);
+
+		/**
+		 * Records commands for rendering a range of draw batches prepared by renderElements().
+		 *
+		 * @param[in]	commands	Command buffer to record the commands in.
+		 * @param[in]	elements	Queue elements the batches were created from.
+		 * @param[in]	firstBatch	Index of the first batch to record.
+		 * @param[in]	numBatches	Number of batches to record.
+		 *
+		 * @note	Any thread, as long as the core thread is waiting for the recording to finish.
+		 */
+		void recordElements(RenderCommandBuffer& commands, const Vector<RenderQueueElement>& elements, UINT32 firstBatch,
+			UINT32 numBatches);
+
 		/**
 		 * Renders all overlay callbacks attached to the provided camera.
 		 *
@@ -221,13 +268,32 @@ namespace BansheeEngine
 		void destroyCore();
 
 		/**
-		 * Checks all sampler overrides in case material sampler states changed, and updates them.
+		 * Updates sampler overrides of all materials whose sampler states changed since the last call. Does nothing if
+		 * no sampler states changed.
 		 *
 		 * @param[in]	force	If true, all sampler overrides will be updated, regardless of a change in the material
 		 *						was detected or not.
 		 */
 		void refreshSamplerOverrides(bool force = false);
 
+		/**
+		 * Updates sampler overrides of a single material so they match its current sampler states. If the material's
+		 * parameter layout changed the overrides are generated again, and all elements using them are updated.
+		 */
+		void updateSamplerOverrides(const SPtr<MaterialCore>& material, MaterialSamplerOverrides*& overrides);
+
+		/** Starts tracking sampler state changes in all GPU parameters of the provided material. */
+		void registerSamplerOverrideSources(const SPtr<MaterialCore>& material);
+
+		/** Stops tracking sampler state changes in GPU parameters of the provided material. */
+		void unregisterSamplerOverrideSources(const SPtr<MaterialCore>& material);
+
+		/** Triggered when sampler states of any GPU parameters change. */
+		void notifySamplerStatesChanged(const GpuParamsCore* params);
+
+		/** Triggered when the GPU parameters of a material are replaced. */
+		void notifyMaterialParametersChanged(const MaterialCore* material);
+
 		/**
 		 * Extracts the necessary values from the projection matrix that allow you to transform device Z value into
 		 * world Z value.
@@ -255,6 +321,9 @@ namespace BansheeEngine
 		 */
 		static void setPass(const SPtr<PassCore>& pass);
 
+		/** Same as setPass(const SPtr<PassCore>&), except the commands are recorded in the provided command buffer. */
+		static void setPass(RenderCommandBuffer& commands, const SPtr<PassCore>& pass);
+
 		/**
 		 * Sets parameters (textures, samplers, buffers) for the currently active pass.
 		 *
@@ -266,10 +335,21 @@ namespace BansheeEngine
 		 */
 		static void setPassParams(const SPtr<PassParametersCore>& passParams, const PassSamplerOverrides* samplerOverrides);
 
+		/** 
+		 * Same as setPassParams(const SPtr<PassParametersCore>&, const PassSamplerOverrides*), except the commands are
+		 * recorded in the provided command buffer.
+		 */
+		static void setPassParams(RenderCommandBuffer& commands, const SPtr<PassParametersCore>& passParams, 
+			const PassSamplerOverrides* samplerOverrides);
+
 		// Core thread only fields
 		Vector<RenderTargetData> mRenderTargets;
 		UnorderedMap<const CameraCore*, CameraData> mCameraData;
 		UnorderedMap<SPtr<MaterialCore>, MaterialSamplerOverrides*> mSamplerOverrides;
+		UnorderedMap<const GpuParamsCore*, SPtr<MaterialCore>> mSamplerOverrideSources;
+		UnorderedSet<SPtr<MaterialCore>> mDirtySamplerOverrides;
+		HEvent mSamplerStatesChangedConn;
+		HEvent mMaterialParamsChangedConn;
 
 		Vector<RenderableData> mRenderables;
 		Vector<RenderableShaderData> mRenderableShaderData;
@@ -279,6 +359,9 @@ namespace BansheeEngine
 		Vector<LightData> mPointLights;
 		Vector<Sphere> mLightWorldBounds;
 
+		Vector<DrawBatch> mDrawBatches;
+		Vector<RenderCommandBuffer> mCommandBuffers;
+
 		SPtr<RenderBeastOptions> mCoreOptions;
 
 		DefaultMaterial* mDefaultMaterial;
@@ -32,6 +32,7 @@
 
 namespace BansheeEngine
 {
+	class RenderBeast;
 	class StaticRenderableHandler;
 	struct RenderBeastOptions;
 	struct PooledRenderTexture;
@@ -0,0 +1,93 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsTestSuite.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Contains a set of unit tests for the renderer. Tests expect the core thread and a render API to be running (the null
+	 * render API is enough), but don't require RenderBeast to be the active renderer.
+	 */
+	class BS_BSRND_EXPORT RenderBeastTestSuite : public TestSuite
+	{
+	public:
+		RenderBeastTestSuite();
+
+	private:
+		/** @copydoc TestSuite::startUp */
+		void startUp() override;
+
+		/** @copydoc TestSuite::shutDown */
+		void shutDown() override;
+
+		/**
+		 * Tests that runs of queue entries sharing a mesh, material and pass are split into instanced draws, and that
+		 * materials without a per-instance parameter block are drawn one by one.
+		 */
+		void StaticInstancing();
+
+		/** Core thread part of StaticInstancing(). */
+		void StaticInstancingCore();
+
+		/**
+		 * Tests that lights are assigned to the light grid cells they overlap, and that lights behind the camera aren't
+		 * assigned to any.
+		 */
+		void LightGridBinning();
+
+		/** Core thread part of LightGridBinning(). */
+		void LightGridBinningCore(const SPtr<CameraCore>& camera, const Vector<SPtr<LightCore>>& lights);
+
+		/** Tests that render graph passes whose output is never used are culled, along with the passes feeding them. */
+		void RenderGraphCulling();
+
+		/**
+		 * Tests that render graph transient textures with compatible descriptions and non-overlapping lifetimes are
+		 * backed by the same physical texture, and that others aren't.
+		 */
+		void RenderGraphAliasing();
+
+		/**
+		 * Tests that render graph passes writing to imported textures are never culled, and keep the passes they depend on
+		 * alive.
+		 */
+		void RenderGraphImportedWrite();
+
+		/**
+		 * Refreshes sampler overrides of the active renderer a number of times, while none of the materials with
+		 * overrides change.
+		 */
+		void SamplerOverrideRefresh();
+
+		/**
+		 * Refreshes sampler overrides of the active renderer a number of times, changing the sampler state of one of the
+		 * materials with overrides before every refresh.
+		 */
+		void SamplerOverrideRefreshDirty();
+
+		/** Core thread part of SamplerOverrideRefresh() and SamplerOverrideRefreshDirty(). */
+		void SamplerOverrideRefreshCore(bool dirty);
+
+		/** Creates materials used by the sampler override benchmarks and registers them with the renderer. */
+		void createSamplerOverrideMaterialsCore();
+
+		/** Unregisters and destroys materials created by createSamplerOverrideMaterialsCore(). */
+		void destroySamplerOverrideMaterialsCore();
+
+		/** Returns the active renderer if it is RenderBeast, or null otherwise. */
+		static RenderBeast* getRenderBeast();
+
+		Vector<SPtr<MaterialCore>> mOverrideMaterials;
+		SPtr<SamplerStateCore> mOverrideSamplerStates[2];
+		UINT32 mOverrideIteration;
+	};
+
+	/** @} */
+}
@@ -0,0 +1,163 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#pragma once
+
+#include "BsRenderBeastPrerequisites.h"
+#include "BsRenderTexturePool.h"
+
+namespace BansheeEngine
+{
+	/** @addtogroup RenderBeast
+	 *  @{
+	 */
+
+	/**
+	 * Describes a sequence of rendering operations as a set of passes, where each pass declares which textures it reads
+	 * from and writes to.
+	 *
+	 * Once all the passes are added compile() removes passes whose output is never used, determines the lifetime of each
+	 * transient texture, and assigns transient textures with non-overlapping lifetimes to the same physical texture so
+	 * that the least amount of texture memory is in use at once. execute() then retrieves the physical textures from the
+	 * RenderTexturePool and executes the passes.
+	 *
+	 * Passes are executed in the order they were added in, meaning a pass should only read textures written to by passes
+	 * added before it. Textures that are created outside of the graph can be imported, in which case they are never
+	 * aliased, and passes writing to them are never removed.
+	 *
+	 * A graph can be rebuilt and executed every frame. Physical textures are kept alive between executions, so the same
+	 * textures can be re-used by the next execution without being re-created.
+	 *
+	 * @note	Core thread only, except for methods that only build or compile the graph, which don't access the GPU.
+	 */
+	class BS_BSRND_EXPORT RenderGraph
+	{
+	public:
+		/** Callback that executes the rendering operations of a single pass. */
+		typedef std::function<void(const RenderGraph&)> PassCallback;
+
+		/** Value used for indicating that an index does not reference an object. */
+		static const UINT32 INVALID_IDX;
+
+		/**
+		 * Registers a transient texture. The texture is allocated only for the duration of the passes using it, and its
+		 * contents should not be relied upon before a pass writes to it.
+		 *
+		 * @param[in]	name	Name of the texture, for debugging purposes.
+		 * @param[in]	desc	Description of the texture to allocate.
+		 * @return				Handle to the texture, to be used when declaring pass reads and writes.
+		 */
+		UINT32 createTexture(const String& name, const POOLED_RENDER_TEXTURE_DESC& desc);
+
+		/**
+		 * Registers a texture that is managed outside of the graph.
+		 *
+		 * @param[in]	name	Name of the texture, for debugging purposes.
+		 * @param[in]	texture	Texture to make available to passes through getTexture(). Can be null for resources that
+		 *						aren't managed by the texture pool, in which case the passes are expected to access them
+		 *						directly, and the handle is used only for declaring dependencies.
+		 * @return				Handle to the texture, to be used when declaring pass reads and writes.
+		 */
+		UINT32 importTexture(const String& name, const SPtr<PooledRenderTexture>& texture = nullptr);
+
+		/**
+		 * Registers a new pass. Call addRead() and addWrite() to declare which textures the pass uses.
+		 *
+		 * @param[in]	name		Name of the pass, for debugging purposes.
+		 * @param[in]	callback	Callback that executes the pass.
+		 * @return					Handle to the pass.
+		 */
+		UINT32 addPass(const String& name, PassCallback callback);
+
+		/** Declares that the specified pass reads from the specified texture. */
+		void addRead(UINT32 pass, UINT32 texture);
+
+		/** Declares that the specified pass writes to the specified texture. */
+		void addWrite(UINT32 pass, UINT32 texture);
+
+		/**
+		 * Determines which passes need to be executed, the order to execute them in, and the physical textures that will
+		 * back each of the transient textures. Must be called after all passes and textures were registered, and before
+		 * execute().
+		 */
+		void compile();
+
+		/**
+		 * Executes all passes that weren't culled during compile(), allocating the physical textures as they become needed
+		 * and returning them to the pool once no longer used.
+		 */
+		void execute();
+
+		/** Removes all passes and textures so a new graph can be built. Physical textures are kept for re-use. */
+		void clear();
+
+		/**
+		 * Returns the texture referenced by the provided handle. Transient textures are only available to the callbacks of
+		 * passes that declared them as a read or a write.
+		 */
+		const SPtr<PooledRenderTexture>& getTexture(UINT32 texture) const { return mTextures[texture].texture; }
+
+		/** Checks was the pass removed by compile() because nothing uses its output. */
+		bool isPassCulled(UINT32 pass) const { return mPasses[pass].culled; }
+
+		/** Returns indices of the passes that will be executed by execute(), in the order they will be executed in. */
+		const Vector<UINT32>& getExecutionOrder() const { return mExecutionOrder; }
+
+		/** Returns the number of physical textures required to back all the transient textures used by the graph. */
+		UINT32 getNumPhysicalTextures() const { return (UINT32)mPhysicalTextures.size(); }
+
+		/**
+		 * Returns the index of the physical texture that will back the provided transient texture. Returns INVALID_IDX if
+		 * the texture is imported, or if it isn't used by any of the executed passes.
+		 */
+		UINT32 getPhysicalTextureIdx(UINT32 texture) const { return mTextures[texture].physicalIdx; }
+
+	private:
+		/** Information about a single texture used by the graph. */
+		struct TextureNode
+		{
+			String name;
+			POOLED_RENDER_TEXTURE_DESC desc;
+			SPtr<PooledRenderTexture> texture;
+			bool imported;
+			bool needed;
+
+			UINT32 firstUse;
+			UINT32 lastUse;
+			UINT32 physicalIdx;
+		};
+
+		/** Information about a single pass in the graph. */
+		struct PassNode
+		{
+			String name;
+			PassCallback callback;
+			Vector<UINT32> reads;
+			Vector<UINT32> writes;
+			bool culled;
+		};
+
+		/** A texture allocated from the pool, backing one or multiple transient textures. */
+		struct PhysicalTexture
+		{
+			POOLED_RENDER_TEXTURE_DESC desc;
+			SPtr<PooledRenderTexture> texture;
+
+			UINT32 firstUse;
+			UINT32 lastUse;
+		};
+
+		/** Checks can the provided descriptors be backed by the same physical texture. */
+		static bool isCompatible(const POOLED_RENDER_TEXTURE_DESC& a, const POOLED_RENDER_TEXTURE_DESC& b);
+
+		/** Registers a texture use by the pass at the provided position in the execution order. */
+		void registerUse(UINT32 texture, UINT32 step);
+
+		Vector<TextureNode> mTextures;
+		Vector<PassNode> mPasses;
+		Vector<UINT32> mExecutionOrder;
+		Vector<PhysicalTexture> mPhysicalTextures;
+		Vector<SPtr<PooledRenderTexture>> mRetainedTextures;
+	};
+
+	/** @} */
+}
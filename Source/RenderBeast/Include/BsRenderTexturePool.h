@@ -123,6 +123,7 @@ namespace BansheeEngine
 
 	private:
 		friend class RenderTexturePool;
+		friend class RenderGraph;
 
 		UINT32 width;
 		UINT32 height;
@@ -43,6 +43,14 @@ namespace BansheeEngine
 		static MaterialSamplerOverrides* generateSamplerOverrides(const SPtr<MaterialCore>& material, 
 			const SPtr<RenderBeastOptions>& options);
 
+		/**
+		 * Updates sampler overrides previously generated with generateSamplerOverrides() so they match the current
+		 * sampler states of the material. Returns false if the material's parameter layout no longer matches the
+		 * overrides, in which case the overrides need to be generated again.
+		 */
+		static bool updateSamplerOverrides(const SPtr<MaterialCore>& material, MaterialSamplerOverrides* overrides,
+			const SPtr<RenderBeastOptions>& options);
+
 		/**	Destroys sampler overrides previously generated with generateSamplerOverrides(). */
 		static void destroySamplerOverrides(MaterialSamplerOverrides* overrides);
 
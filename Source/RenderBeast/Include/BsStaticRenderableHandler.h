@@ -9,6 +9,7 @@
 #include "BsRenderableElement.h"
 #include "BsRenderBeast.h"
 #include "BsParamBlocks.h"
+#include "BsRenderQueue.h"
 
 namespace BansheeEngine
 {
@@ -42,6 +43,22 @@ namespace BansheeEngine
 		BS_PARAM_BLOCK_ENTRY(float, gWorldDeterminantSign)
 	BS_PARAM_BLOCK_END
 
+	/** Maximum number of objects that can be rendered using a single instanced draw call. */
+	static const UINT32 MAX_INSTANCES_PER_DRAW = 32;
+
+	/** 
+	 * Same as PerObjectParamBuffer, except it contains data for multiple objects that are rendered using instancing. 
+	 * Shaders are expected to index it using the instance index.
+	 */
+	BS_PARAM_BLOCK_BEGIN(PerInstanceParamBuffer)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gInstMatWorldViewProj, MAX_INSTANCES_PER_DRAW)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gInstMatWorld, MAX_INSTANCES_PER_DRAW)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gInstMatInvWorld, MAX_INSTANCES_PER_DRAW)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gInstMatWorldNoScale, MAX_INSTANCES_PER_DRAW)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(Matrix4, gInstMatInvWorldNoScale, MAX_INSTANCES_PER_DRAW)
+		BS_PARAM_BLOCK_ENTRY_ARRAY(float, gInstWorldDeterminantSign, MAX_INSTANCES_PER_DRAW)
+	BS_PARAM_BLOCK_END
+
 	/** Renderable handler that manages initializing, updating and rendering of static renderable objects. */
 	class BS_BSRND_EXPORT StaticRenderableHandler : public RenderableHandler
 	{
@@ -49,7 +66,21 @@ namespace BansheeEngine
 		/** Contains lit tex renderable data unique for each object. */
 		struct PerObjectData
 		{
+			PerObjectData()
+				:perObjectBufferIdx(0), perObjectUpdateId((UINT32)-1), visibleIdx(0)
+			{ }
+
 			Vector<RenderableElement::BufferBindInfo> perObjectBuffers;
+			Vector<RenderableElement::BufferBindInfo> perInstanceBuffers;
+
+			/** Index of the pooled buffer containing object specific parameters, as assigned by the last update. */
+			UINT32 perObjectBufferIdx;
+
+			/** Identifier of the last updatePerObjectBuffers() call that assigned a buffer to this object. */
+			UINT32 perObjectUpdateId;
+
+			/** Index of the object among all objects visible from the camera currently being rendered. */
+			UINT32 visibleIdx;
 		};
 
 		StaticRenderableHandler();
@@ -57,9 +88,12 @@ namespace BansheeEngine
 		/** @copydoc RenderableHandler::initializeRenderElem */
 		void initializeRenderElem(RenderableElement& element) override;
 
-		/** @copydoc RenderableHandler::bindPerObjectBuffers */
+		/** @copydoc RenderableHandler::bindPerObjectBuffers(const RenderableElement&) */
 		void bindPerObjectBuffers(const RenderableElement& element) override;
 
+		/** @copydoc RenderableHandler::bindPerObjectBuffers(RenderCommandBuffer&, const RenderableElement&) */
+		void bindPerObjectBuffers(RenderCommandBuffer& commands, const RenderableElement& element) override;
+
 		/** Updates global per frame parameter buffers with new values. To be called at the start of every frame. */
 		void updatePerFrameBuffers(float time);
 
@@ -70,9 +104,38 @@ namespace BansheeEngine
 		void updatePerCameraBuffers(const CameraShaderData& cameraData);
 
 		/**
-		 * Updates object specific parameter buffers with new values. To be called whenever object specific values change.
+		 * Updates object specific parameter buffers of all elements in the provided render queues, as seen from a camera
+		 * with the provided view-projection matrix. To be called at the start of rendering for every camera, before any
+		 * calls to bindPerObjectBuffers().
+		 *
+		 * Every unique element is assigned its own buffer from a pool that is recycled every frame, so all per-object data
+		 * is written in a single pass and drawing only needs to bind the buffers.
 		 */
-		void updatePerObjectBuffers(RenderableElement& element, const RenderableShaderData& data, const Matrix4& wvpMatrix);
+		void updatePerObjectBuffers(const Vector<RenderQueueElement>& opaqueElements,
+			const Vector<RenderQueueElement>& transparentElements, const Vector<RenderableShaderData>& shaderData,
+			const Matrix4& viewProj);
+
+		/**
+		 * Checks if the queue entry at @p startIdx can be rendered using instancing. If it can, writes per-instance
+		 * parameters for it and all the entries directly following it that share its mesh, sub-mesh, material and pass.
+		 * Must be called after updatePerObjectBuffers() for the current camera.
+		 *
+		 * @param[in]	elements	Sorted render queue entries.
+		 * @param[in]	startIdx	Index of the first entry to render.
+		 * @param[in]	shaderData	Shader data of all renderables, indexed by renderable ID.
+		 * @param[out]	bufferIdx	Index of the buffer the parameters were written to, to be provided to 
+		 *							bindPerInstanceBuffers().
+		 * @return					Number of queue entries to render using a single instanced draw call, or zero if the
+		 *							entry doesn't support instancing, or the render API doesn't support instanced draws.
+		 */
+		UINT32 updatePerInstanceBuffers(const Vector<RenderQueueElement>& elements, UINT32 startIdx,
+			const Vector<RenderableShaderData>& shaderData, UINT32& bufferIdx);
+
+		/**
+		 * Records commands that bind a buffer written by updatePerInstanceBuffers() to the provided element. Can be
+		 * called from any thread, as long as updatePerInstanceBuffers() isn't running at the same time.
+		 */
+		void bindPerInstanceBuffers(RenderCommandBuffer& commands, const RenderableElement& element, UINT32 bufferIdx);
 
 		/** Returns a buffer that stores per-camera parameters. */
 		const PerCameraParamBuffer& getPerCameraParams() const { return mPerCameraParams; }
@@ -81,6 +144,19 @@ namespace BansheeEngine
 		PerFrameParamBuffer mPerFrameParams;
 		PerCameraParamBuffer mPerCameraParams;
 		PerObjectParamBuffer mPerObjectParams;
+		PerInstanceParamBuffer mPerInstanceParams;
+
+		Vector<SPtr<GpuParamBlockBufferCore>> mPerObjectBufferPool;
+		UINT32 mNumUsedPerObjectBuffers;
+		UINT32 mPerObjectUpdateId;
+
+		Vector<SPtr<GpuParamBlockBufferCore>> mPerInstanceBufferPool;
+		UINT32 mNumUsedPerInstanceBuffers;
+		bool mInstancingSupported;
+
+		// Scratch buffers used during updatePerObjectBuffers(), kept around to avoid re-allocating them every camera
+		Vector<BeastRenderableElement*> mVisibleElements;
+		Vector<Matrix4> mWorldViewProjMatrices;
 	};
 
 	/** @} */
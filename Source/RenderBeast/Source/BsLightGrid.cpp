@@ -0,0 +1,150 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsLightGrid.h"
+#include "BsCamera.h"
+#include "BsViewport.h"
+#include "BsLight.h"
+
+namespace BansheeEngine
+{
+	const UINT32 LightGrid::CELL_SIZE = 64;
+	const UINT32 LightGrid::NUM_DEPTH_SLICES = 32;
+
+	LightGrid::LightGrid()
+		:mNumCellsX(0), mNumCellsY(0), mNumLights(0)
+	{ }
+
+	void LightGrid::build(const CameraCore& camera, const Vector<const LightCore*>& lights)
+	{
+		SPtr<ViewportCore> viewport = camera.getViewport();
+		UINT32 width = (UINT32)std::max(viewport->getWidth(), 1);
+		UINT32 height = (UINT32)std::max(viewport->getHeight(), 1);
+
+		mNumCellsX = (width + CELL_SIZE - 1) / CELL_SIZE;
+		mNumCellsY = (height + CELL_SIZE - 1) / CELL_SIZE;
+		mNumLights = (UINT32)lights.size();
+
+		UINT32 numCells = mNumCellsX * mNumCellsY * NUM_DEPTH_SLICES;
+		mCellCounts.assign(numCells, 0);
+		mCellOffsets.resize(numCells);
+		mLightCellRanges.resize(mNumLights);
+
+		const Matrix4& view = camera.getViewMatrix();
+		const Matrix4& proj = camera.getProjectionMatrixRS();
+
+		float nearDist = camera.getNearClipDistance();
+		float farDist = camera.getFarClipDistance();
+		if (farDist == 0) // Infinite far plane
+			farDist = 100000.0f;
+
+		// Depth slices are distributed exponentially, so cells remain roughly cube shaped at all distances
+		float sliceScale = NUM_DEPTH_SLICES / Math::log(farDist / nearDist);
+
+		auto getSlice = [&](float depth)
+		{
+			int slice = Math::floorToInt(Math::log(depth / nearDist) * sliceScale);
+			return (UINT32)Math::clamp(slice, 0, (int)NUM_DEPTH_SLICES - 1);
+		};
+
+		// Determine cells influenced by each light, and count the number of lights per cell
+		for (UINT32 i = 0; i < mNumLights; i++)
+		{
+			const LightCore* light = lights[i];
+			CellRange& range = mLightCellRanges[i];
+
+			Sphere bounds = light->getBounds();
+			Vector3 center = view.multiplyAffine(bounds.getCenter());
+			float radius = bounds.getRadius();
+
+			// Camera looks down the negative Z axis in view space
+			float minDepth = std::max(-center.z - radius, nearDist);
+			float maxDepth = std::min(-center.z + radius, farDist);
+			if (minDepth > maxDepth)
+			{
+				range.minX = range.minY = range.minZ = 1;
+				range.maxX = range.maxY = range.maxZ = 0;
+				continue;
+			}
+
+			range.minZ = getSlice(minDepth);
+			range.maxZ = getSlice(maxDepth);
+
+			// Find screen bounds by projecting the view space bounding box of the light. Corners behind the near plane are
+			// moved onto it, which keeps the bounds conservative.
+			Vector2 ndcMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+			Vector2 ndcMax(-std::numeric_limits<float>::max(), -std::numeric_limits<float>::max());
+			for (UINT32 j = 0; j < 8; j++)
+			{
+				Vector4 corner;
+				corner.x = center.x + ((j & 1) ? radius : -radius);
+				corner.y = center.y + ((j & 2) ? radius : -radius);
+				corner.z = std::min(center.z + ((j & 4) ? radius : -radius), -nearDist);
+				corner.w = 1.0f;
+
+				Vector4 clipPos = proj.multiply(corner);
+				Vector2 ndcPos(clipPos.x / clipPos.w, clipPos.y / clipPos.w);
+
+				ndcMin.x = std::min(ndcMin.x, ndcPos.x);
+				ndcMin.y = std::min(ndcMin.y, ndcPos.y);
+				ndcMax.x = std::max(ndcMax.x, ndcPos.x);
+				ndcMax.y = std::max(ndcMax.y, ndcPos.y);
+			}
+
+			// Convert to cells, where cell row zero is at the top of the screen
+			auto toCellX = [&](float ndcX)
+			{
+				int cell = Math::floorToInt((ndcX * 0.5f + 0.5f) * mNumCellsX);
+				return (UINT32)Math::clamp(cell, 0, (int)mNumCellsX - 1);
+			};
+
+			auto toCellY = [&](float ndcY)
+			{
+				int cell = Math::floorToInt((0.5f - ndcY * 0.5f) * mNumCellsY);
+				return (UINT32)Math::clamp(cell, 0, (int)mNumCellsY - 1);
+			};
+
+			range.minX = toCellX(ndcMin.x);
+			range.maxX = toCellX(ndcMax.x);
+			range.minY = toCellY(ndcMax.y);
+			range.maxY = toCellY(ndcMin.y);
+
+			for (UINT32 z = range.minZ; z <= range.maxZ; z++)
+			{
+				for (UINT32 y = range.minY; y <= range.maxY; y++)
+				{
+					UINT32 rowIdx = getCellIdx(0, y, z);
+					for (UINT32 x = range.minX; x <= range.maxX; x++)
+						mCellCounts[rowIdx + x]++;
+				}
+			}
+		}
+
+		// Assign each cell a range in the index list, and fill it
+		UINT32 numReferences = 0;
+		for (UINT32 i = 0; i < numCells; i++)
+		{
+			mCellOffsets[i] = numReferences;
+			numReferences += mCellCounts[i];
+
+			mCellCounts[i] = 0;
+		}
+
+		mLightIndices.resize(numReferences);
+		for (UINT32 i = 0; i < mNumLights; i++)
+		{
+			const CellRange& range = mLightCellRanges[i];
+			for (UINT32 z = range.minZ; z <= range.maxZ; z++)
+			{
+				for (UINT32 y = range.minY; y <= range.maxY; y++)
+				{
+					UINT32 rowIdx = getCellIdx(0, y, z);
+					for (UINT32 x = range.minX; x <= range.maxX; x++)
+					{
+						UINT32 cellIdx = rowIdx + x;
+						mLightIndices[mCellOffsets[cellIdx] + mCellCounts[cellIdx]++] = i;
+					}
+				}
+			}
+		}
+	}
+}
@@ -22,43 +22,44 @@ namespace BansheeEngine
 		// Do nothing
 	}
 
-	void DownsampleMat::execute(const SPtr<RenderTextureCore>& target, PostProcessInfo& ppInfo)
+	void DownsampleMat::execute(const SPtr<RenderTextureCore>& input, const SPtr<PooledRenderTexture>& output)
 	{
 		// Set parameters
-		SPtr<TextureCore> colorTexture = target->getBindableColorTexture();
+		SPtr<TextureCore> colorTexture = input->getBindableColorTexture();
 		mInputTexture.set(colorTexture);
 
-		const RenderTextureProperties& rtProps = target->getProperties();
+		const RenderTextureProperties& rtProps = input->getProperties();
 		Vector2 invTextureSize(1.0f / rtProps.getWidth(), 1.0f / rtProps.getHeight());
 
 		mParams.gInvTexSize.set(invTextureSize);
 
-		// Set output
-		const TextureProperties& colorProps = colorTexture->getProperties();
-
-		UINT32 width = std::max(1, Math::ceilToInt(colorProps.getWidth() * 0.5f));
-		UINT32 height = std::max(1, Math::ceilToInt(colorProps.getHeight() * 0.5f));
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(colorProps.getFormat(), width, height, TU_RENDERTARGET);
-
 		// Render
-		ppInfo.downsampledSceneTex = RenderTexturePool::instance().get(mOutputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.downsampledSceneTex->renderTexture, true);
+		rapi.setRenderTarget(output->renderTexture, true);
 
 		gRendererUtility().setPass(mMaterial, 0);
 		gRendererUtility().drawScreenQuad();
 
 		rapi.setRenderTarget(nullptr);
+	}
+
+	Vector2I DownsampleMat::getOutputSize(const SPtr<RenderTextureCore>& input)
+	{
+		const TextureProperties& colorProps = input->getBindableColorTexture()->getProperties();
+
+		Vector2I size;
+		size.x = std::max(1, Math::ceilToInt(colorProps.getWidth() * 0.5f));
+		size.y = std::max(1, Math::ceilToInt(colorProps.getHeight() * 0.5f));
 
-		mOutput = ppInfo.downsampledSceneTex->renderTexture;
+		return size;
 	}
 
-	void DownsampleMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC DownsampleMat::getOutputDesc(const SPtr<RenderTextureCore>& input)
 	{
-		RenderTexturePool::instance().release(ppInfo.downsampledSceneTex);
-		mOutput = nullptr;
+		const TextureProperties& colorProps = input->getBindableColorTexture()->getProperties();
+		Vector2I size = getOutputSize(input);
+
+		return POOLED_RENDER_TEXTURE_DESC::create2D(colorProps.getFormat(), size.x, size.y, TU_RENDERTARGET);
 	}
 
 	EyeAdaptHistogramMat::EyeAdaptHistogramMat()
@@ -77,31 +78,24 @@ namespace BansheeEngine
 		defines.set("LOOP_COUNT_Y", LOOP_COUNT_Y);
 	}
 
-	void EyeAdaptHistogramMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramMat::execute(const SPtr<PooledRenderTexture>& input, const SPtr<PooledRenderTexture>& output,
+		const PostProcessInfo& ppInfo)
 	{
 		// Set parameters
-		SPtr<RenderTextureCore> target = ppInfo.downsampledSceneTex->renderTexture;
-		mSceneColor.set(ppInfo.downsampledSceneTex->texture);
+		mSceneColor.set(input->texture);
 
-		const RenderTextureProperties& props = target->getProperties();
-		int offsetAndSize[4] = { 0, 0, (INT32)props.getWidth(), (INT32)props.getHeight() };
+		const RenderTextureProperties& props = input->renderTexture->getProperties();
+		Vector2I inputSize((INT32)props.getWidth(), (INT32)props.getHeight());
+		int offsetAndSize[4] = { 0, 0, inputSize.x, inputSize.y };
 
 		mParams.gHistogramParams.set(getHistogramScaleOffset(ppInfo));
 		mParams.gPixelOffsetAndSize.set(Vector4I(offsetAndSize));
 
-		Vector2I threadGroupCount = getThreadGroupCount(target);
+		Vector2I threadGroupCount = getThreadGroupCount(inputSize);
 		mParams.gThreadGroupCount.set(threadGroupCount);
 
-		// Set output
-		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
-
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, HISTOGRAM_NUM_TEXELS, numHistograms,
-			TU_LOADSTORE);
-
 		// Dispatch
-		ppInfo.histogramTex = RenderTexturePool::instance().get(mOutputDesc);
-
-		mOutputTex.set(ppInfo.histogramTex->texture);
+		mOutputTex.set(output->texture);
 
 		RenderAPICore& rapi = RenderAPICore::instance();
 		gRendererUtility().setComputePass(mMaterial);
@@ -110,26 +104,24 @@ namespace BansheeEngine
 		// Note: This is ugly, add a better way to clear load/store textures?
 		TextureSurface blankSurface;
 		rapi.setLoadStoreTexture(GPT_COMPUTE_PROGRAM, 0, false, nullptr, blankSurface);
-
-		mOutput = ppInfo.histogramTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptHistogramMat::getOutputDesc(const Vector2I& inputSize)
 	{
-		RenderTexturePool::instance().release(ppInfo.histogramTex);
-		mOutput = nullptr;
+		Vector2I threadGroupCount = getThreadGroupCount(inputSize);
+		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
+
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, HISTOGRAM_NUM_TEXELS, numHistograms, TU_LOADSTORE);
 	}
 
-	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(const SPtr<RenderTextureCore>& target)
+	Vector2I EyeAdaptHistogramMat::getThreadGroupCount(const Vector2I& inputSize)
 	{
 		const UINT32 texelsPerThreadGroupX = THREAD_GROUP_SIZE_X * LOOP_COUNT_X;
 		const UINT32 texelsPerThreadGroupY = THREAD_GROUP_SIZE_Y * LOOP_COUNT_Y;
 
-		const RenderTextureProperties& props = target->getProperties();
-	
 		Vector2I threadGroupCount;
-		threadGroupCount.x = ((INT32)props.getWidth() + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
-		threadGroupCount.y = ((INT32)props.getHeight() + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
+		threadGroupCount.x = (inputSize.x + texelsPerThreadGroupX - 1) / texelsPerThreadGroupX;
+		threadGroupCount.y = (inputSize.y + texelsPerThreadGroupY - 1) / texelsPerThreadGroupY;
 
 		return threadGroupCount;
 	}
@@ -158,49 +150,39 @@ namespace BansheeEngine
 		// Do nothing
 	}
 
-	void EyeAdaptHistogramReduceMat::execute(PostProcessInfo& ppInfo)
+	void EyeAdaptHistogramReduceMat::execute(const SPtr<PooledRenderTexture>& histogram, 
+		const SPtr<PooledRenderTexture>& prevEyeAdaptation, const SPtr<PooledRenderTexture>& output)
 	{
 		// Set parameters
-		mHistogramTex.set(ppInfo.histogramTex->texture);
+		mHistogramTex.set(histogram->texture);
 
-		SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
 		SPtr<TextureCore> eyeAdaptationTex;
-
-		if (eyeAdaptationRT != nullptr) // Could be that this is the first run
-			eyeAdaptationTex = eyeAdaptationRT->texture;
+		if (prevEyeAdaptation != nullptr) // Could be that this is the first run
+			eyeAdaptationTex = prevEyeAdaptation->texture;
 		else
 			eyeAdaptationTex = TextureCore::WHITE;
 
 		mEyeAdaptationTex.set(eyeAdaptationTex);
 
-		Vector2I threadGroupCount = EyeAdaptHistogramMat::getThreadGroupCount(ppInfo.downsampledSceneTex->renderTexture);
-		UINT32 numHistograms = threadGroupCount.x * threadGroupCount.y;
-
+		// Each row of the histogram texture contains a single histogram
+		UINT32 numHistograms = histogram->texture->getProperties().getHeight();
 		mParams.gThreadGroupCount.set(numHistograms);
 
-		// Set output
-		mOutputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2,
-			TU_RENDERTARGET);
-
 		// Render
-		ppInfo.histogramReduceTex = RenderTexturePool::instance().get(mOutputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.histogramReduceTex->renderTexture, true);
+		rapi.setRenderTarget(output->renderTexture, true);
 
 		gRendererUtility().setPass(mMaterial, 0);
 		Rect2 drawUV(0.0f, 0.0f, (float)EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2.0f);
 		gRendererUtility().drawScreenQuad(drawUV);
 
 		rapi.setRenderTarget(nullptr);
-
-		mOutput = ppInfo.histogramReduceTex->renderTexture;
 	}
 
-	void EyeAdaptHistogramReduceMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptHistogramReduceMat::getOutputDesc()
 	{
-		RenderTexturePool::instance().release(ppInfo.histogramReduceTex);
-		mOutput = nullptr;
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, EyeAdaptHistogramMat::HISTOGRAM_NUM_TEXELS, 2,
+			TU_RENDERTARGET);
 	}
 
 	EyeAdaptationMat::EyeAdaptationMat()
@@ -216,20 +198,11 @@ namespace BansheeEngine
 		defines.set("THREADGROUP_SIZE_Y", EyeAdaptHistogramMat::THREAD_GROUP_SIZE_Y);
 	}
 
-	void EyeAdaptationMat::execute(PostProcessInfo& ppInfo, float frameDelta)
+	void EyeAdaptationMat::execute(const SPtr<PooledRenderTexture>& reducedHistogram, 
+		const SPtr<PooledRenderTexture>& output, const PostProcessInfo& ppInfo, float frameDelta)
 	{
-		bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
-		if(!texturesInitialized)
-		{
-			POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, TU_RENDERTARGET);
-			ppInfo.eyeAdaptationTex[0] = RenderTexturePool::instance().get(outputDesc);
-			ppInfo.eyeAdaptationTex[1] = RenderTexturePool::instance().get(outputDesc);
-		}
-
-		ppInfo.lastEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2; // TODO - Do I really need two targets?
-
 		// Set parameters
-		mReducedHistogramTex.set(ppInfo.histogramReduceTex->texture);
+		mReducedHistogramTex.set(reducedHistogram->texture);
 
 		Vector2 histogramScaleAndOffset = EyeAdaptHistogramMat::getHistogramScaleOffset(ppInfo);
 
@@ -258,10 +231,8 @@ namespace BansheeEngine
 		mParams.gEyeAdaptationParams.set(eyeAdaptationParams[2], 2);
 
 		// Render
-		SPtr<PooledRenderTexture> eyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(eyeAdaptationRT->renderTexture, true);
+		rapi.setRenderTarget(output->renderTexture, true);
 
 		gRendererUtility().setPass(mMaterial, 0);
 		gRendererUtility().drawScreenQuad();
@@ -269,6 +240,11 @@ namespace BansheeEngine
 		rapi.setRenderTarget(nullptr);
 	}
 
+	POOLED_RENDER_TEXTURE_DESC EyeAdaptationMat::getOutputDesc()
+	{
+		return POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT32_R, 1, 1, TU_RENDERTARGET);
+	}
+
 	CreateTonemapLUTMat::CreateTonemapLUTMat()
 	{
 		mMaterial->setParamBlockBuffer("Input", mParams.getBuffer());
@@ -280,7 +256,7 @@ namespace BansheeEngine
 		defines.set("LUT_SIZE", LUT_SIZE);
 	}
 
-	void CreateTonemapLUTMat::execute(PostProcessInfo& ppInfo)
+	void CreateTonemapLUTMat::execute(const SPtr<PooledRenderTexture>& output, const PostProcessInfo& ppInfo)
 	{
 		// Set parameters
 		mParams.gGammaAdjustment.set(2.2f / ppInfo.settings.gamma);
@@ -313,23 +289,17 @@ namespace BansheeEngine
 		mWhiteBalanceParams.gWhiteTemp.set(ppInfo.settings.whiteBalance.temperature);
 		mWhiteBalanceParams.gWhiteOffset.set(ppInfo.settings.whiteBalance.tint);
 
-		// Set output
-		POOLED_RENDER_TEXTURE_DESC outputDesc = POOLED_RENDER_TEXTURE_DESC::create3D(PF_B8G8R8X8, 
-			LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_RENDERTARGET);
-
 		// Render
-		ppInfo.colorLUT = RenderTexturePool::instance().get(outputDesc);
-
 		RenderAPICore& rapi = RenderAPICore::instance();
-		rapi.setRenderTarget(ppInfo.colorLUT->renderTexture);
+		rapi.setRenderTarget(output->renderTexture);
 
 		gRendererUtility().setPass(mMaterial, 0);
 		gRendererUtility().drawScreenQuad(LUT_SIZE);
 	}
 
-	void CreateTonemapLUTMat::release(PostProcessInfo& ppInfo)
+	POOLED_RENDER_TEXTURE_DESC CreateTonemapLUTMat::getOutputDesc()
 	{
-		RenderTexturePool::instance().release(ppInfo.colorLUT);
+		return POOLED_RENDER_TEXTURE_DESC::create3D(PF_B8G8R8X8, LUT_SIZE, LUT_SIZE, LUT_SIZE, TU_RENDERTARGET);
 	}
 
 	template<bool GammaOnly, bool AutoExposure>
@@ -398,37 +368,134 @@ namespace BansheeEngine
 	{
 		SPtr<ViewportCore> outputViewport = camera->getViewport();
 		bool hdr = camera->getFlags().isSet(CameraFlag::HDR);
+		bool autoExposure = hdr && ppInfo.settings.enableAutoExposure;
+		bool tonemapping = hdr && ppInfo.settings.enableTonemapping;
 
-		if(hdr && ppInfo.settings.enableAutoExposure)
-		{
-			mDownsample.execute(sceneColor, ppInfo);
-			mEyeAdaptHistogram.execute(ppInfo);
-			mDownsample.release(ppInfo);
+		RenderGraph& renderGraph = ppInfo.graph;
+		renderGraph.clear();
 
-			mEyeAdaptHistogramReduce.execute(ppInfo);
-			mEyeAdaptHistogram.release(ppInfo);
+		// Scene color and the viewport target are managed externally, and are only registered for dependency tracking
+		UINT32 sceneColorTex = renderGraph.importTexture("SceneColor");
+		UINT32 outputTex = renderGraph.importTexture("Output");
 
-			mEyeAdaptation.execute(ppInfo, frameDelta);
-			mEyeAdaptHistogramReduce.release(ppInfo);
+		UINT32 eyeAdaptationTex = RenderGraph::INVALID_IDX;
+		if(autoExposure)
+		{
+			// Eye adaptation is calculated from its value in the previous frame, so we alternate between two textures
+			SPtr<PooledRenderTexture> prevEyeAdaptationRT = ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex];
+
+			bool texturesInitialized = ppInfo.eyeAdaptationTex[0] != nullptr && ppInfo.eyeAdaptationTex[1] != nullptr;
+			if (!texturesInitialized)
+			{
+				POOLED_RENDER_TEXTURE_DESC outputDesc = EyeAdaptationMat::getOutputDesc();
+				ppInfo.eyeAdaptationTex[0] = RenderTexturePool::instance().get(outputDesc);
+				ppInfo.eyeAdaptationTex[1] = RenderTexturePool::instance().get(outputDesc);
+			}
+
+			ppInfo.lastEyeAdaptationTex = (ppInfo.lastEyeAdaptationTex + 1) % 2; // TODO - Do I really need two targets?
+
+			UINT32 downsampledTex = renderGraph.createTexture("DownsampledSceneColor", 
+				DownsampleMat::getOutputDesc(sceneColor));
+			UINT32 histogramTex = renderGraph.createTexture("Histogram", 
+				EyeAdaptHistogramMat::getOutputDesc(DownsampleMat::getOutputSize(sceneColor)));
+			UINT32 reducedHistogramTex = renderGraph.createTexture("ReducedHistogram", 
+				EyeAdaptHistogramReduceMat::getOutputDesc());
+			UINT32 prevEyeAdaptationTex = renderGraph.importTexture("PrevEyeAdaptation", prevEyeAdaptationRT);
+			eyeAdaptationTex = renderGraph.importTexture("EyeAdaptation", 
+				ppInfo.eyeAdaptationTex[ppInfo.lastEyeAdaptationTex]);
+
+			UINT32 downsamplePass = renderGraph.addPass("Downsample", [&, downsampledTex](const RenderGraph& graph)
+			{
+				mDownsample.execute(sceneColor, graph.getTexture(downsampledTex));
+			});
+
+			renderGraph.addRead(downsamplePass, sceneColorTex);
+			renderGraph.addWrite(downsamplePass, downsampledTex);
+
+			UINT32 histogramPass = renderGraph.addPass("EyeAdaptHistogram", 
+				[&, downsampledTex, histogramTex](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogram.execute(graph.getTexture(downsampledTex), graph.getTexture(histogramTex), ppInfo);
+			});
+
+			renderGraph.addRead(histogramPass, downsampledTex);
+			renderGraph.addWrite(histogramPass, histogramTex);
+
+			UINT32 reducePass = renderGraph.addPass("EyeAdaptHistogramReduce", 
+				[&, histogramTex, prevEyeAdaptationTex, reducedHistogramTex](const RenderGraph& graph)
+			{
+				mEyeAdaptHistogramReduce.execute(graph.getTexture(histogramTex), graph.getTexture(prevEyeAdaptationTex), 
+					graph.getTexture(reducedHistogramTex));
+			});
+
+			renderGraph.addRead(reducePass, histogramTex);
+			renderGraph.addRead(reducePass, prevEyeAdaptationTex);
+			renderGraph.addWrite(reducePass, reducedHistogramTex);
+
+			UINT32 eyeAdaptationPass = renderGraph.addPass("EyeAdaptation", 
+				[&, reducedHistogramTex](const RenderGraph& graph)
+			{
+				mEyeAdaptation.execute(graph.getTexture(reducedHistogramTex), graph.getTexture(eyeAdaptationTex), ppInfo,
+					frameDelta);
+			});
+
+			renderGraph.addRead(eyeAdaptationPass, reducedHistogramTex);
+			renderGraph.addWrite(eyeAdaptationPass, eyeAdaptationTex);
 		}
 
-		if (hdr && ppInfo.settings.enableTonemapping)
+		UINT32 colorLUTTex = RenderGraph::INVALID_IDX;
+		if (tonemapping)
 		{
-			if (ppInfo.settingDirty) // Rebuild LUT if PP settings changed
-				mCreateLUT.execute(ppInfo);
-
-			if (ppInfo.settings.enableAutoExposure)
-				mTonemapping_AE.execute(sceneColor, outputViewport, ppInfo);
-			else
-				mTonemapping.execute(sceneColor, outputViewport, ppInfo);
+			bool rebuildLUT = ppInfo.settingDirty; // Rebuild LUT if PP settings changed
+			if (ppInfo.colorLUT == nullptr)
+			{
+				ppInfo.colorLUT = RenderTexturePool::instance().get(CreateTonemapLUTMat::getOutputDesc());
+				rebuildLUT = true;
+			}
+
+			colorLUTTex = renderGraph.importTexture("ColorLUT", ppInfo.colorLUT);
+
+			if (rebuildLUT)
+			{
+				UINT32 createLUTPass = renderGraph.addPass("CreateTonemapLUT", [&](const RenderGraph& graph)
+				{
+					mCreateLUT.execute(graph.getTexture(colorLUTTex), ppInfo);
+				});
+
+				renderGraph.addWrite(createLUTPass, colorLUTTex);
+			}
 		}
-		else
+
+		UINT32 tonemappingPass = renderGraph.addPass("Tonemapping", [&](const RenderGraph& graph)
 		{
-			if (hdr && ppInfo.settings.enableAutoExposure)
-				mTonemapping_AE_GO.execute(sceneColor, outputViewport, ppInfo);
+			if (tonemapping)
+			{
+				if (autoExposure)
+					mTonemapping_AE.execute(sceneColor, outputViewport, ppInfo);
+				else
+					mTonemapping.execute(sceneColor, outputViewport, ppInfo);
+			}
 			else
-				mTonemapping_GO.execute(sceneColor, outputViewport, ppInfo);
-		}
+			{
+				if (autoExposure)
+					mTonemapping_AE_GO.execute(sceneColor, outputViewport, ppInfo);
+				else
+					mTonemapping_GO.execute(sceneColor, outputViewport, ppInfo);
+			}
+		});
+
+		renderGraph.addRead(tonemappingPass, sceneColorTex);
+
+		if (colorLUTTex != RenderGraph::INVALID_IDX)
+			renderGraph.addRead(tonemappingPass, colorLUTTex);
+
+		if (eyeAdaptationTex != RenderGraph::INVALID_IDX)
+			renderGraph.addRead(tonemappingPass, eyeAdaptationTex);
+
+		renderGraph.addWrite(tonemappingPass, outputTex);
+
+		renderGraph.compile();
+		renderGraph.execute();
 
 		if (ppInfo.settingDirty)
 			ppInfo.settingDirty = false;
@@ -30,11 +30,16 @@
 #include "BsRenderTargets.h"
 #include "BsRendererUtility.h"
 #include "BsRenderStateManager.h"
+#include "BsRenderCommandBuffer.h"
+#include "BsTaskScheduler.h"
 
 using namespace std::placeholders;
 
 namespace BansheeEngine
 {
+	/** Minimum number of draw calls a worker thread should record, for recording to be split over multiple threads. */
+	static const UINT32 MIN_BATCHES_PER_TASK = 256;
+
 	RenderBeast::RenderBeast()
 		: mDefaultMaterial(nullptr), mPointLightInMat(nullptr), mPointLightOutMat(nullptr), mDirLightMat(nullptr)
 		, mStaticHandler(nullptr), mOptions(bs_shared_ptr_new<RenderBeastOptions>()), mOptionsDirty(true)
@@ -77,10 +82,18 @@ namespace BansheeEngine
 
 		RenderTexturePool::startUp();
 		PostProcessing::startUp();
+
+		mSamplerStatesChangedConn = GpuParamsCore::onSamplerStatesChanged.connect(
+			std::bind(&RenderBeast::notifySamplerStatesChanged, this, _1));
+		mMaterialParamsChangedConn = MaterialCore::onParametersChanged.connect(
+			std::bind(&RenderBeast::notifyMaterialParametersChanged, this, _1));
 	}
 
 	void RenderBeast::destroyCore()
 	{
+		mSamplerStatesChangedConn.disconnect();
+		mMaterialParamsChangedConn.disconnect();
+
 		if (mStaticHandler != nullptr)
 			bs_delete(mStaticHandler);
 
@@ -99,6 +112,7 @@ namespace BansheeEngine
 		RendererUtility::shutDown();
 
 		assert(mSamplerOverrides.empty());
+		assert(mSamplerOverrideSources.empty());
 	}
 
 	void RenderBeast::notifyRenderableAdded(RenderableCore* renderable)
@@ -187,6 +201,7 @@ namespace BansheeEngine
 				{
 					MaterialSamplerOverrides* samplerOverrides = SamplerOverrideUtility::generateSamplerOverrides(renElement.material, mCoreOptions);
 					mSamplerOverrides[renElement.material] = samplerOverrides;
+					registerSamplerOverrideSources(renElement.material);
 
 					renElement.samplerOverrides = samplerOverrides;
 					samplerOverrides->refCount++;
@@ -214,6 +229,9 @@ namespace BansheeEngine
 			samplerOverrides->refCount--;
 			if (samplerOverrides->refCount == 0)
 			{
+				unregisterSamplerOverrideSources(element.material);
+				mDirtySamplerOverrides.erase(element.material);
+
 				SamplerOverrideUtility::destroySamplerOverrides(samplerOverrides);
 				mSamplerOverrides.erase(iterFind);
 			}
@@ -370,6 +388,7 @@ namespace BansheeEngine
 			camData.transparentQueue = bs_shared_ptr_new<RenderQueue>(transparentStateReduction);
 			camData.postProcessInfo.settings = camera->getPostProcessSettings();
 			camData.postProcessInfo.settingDirty = true;
+			camData.numPointLightsInside = 0;
 		}
 
 		// Remove from render target list
@@ -466,11 +485,11 @@ namespace BansheeEngine
 		if (options.filtering == RenderBeastFiltering::Anisotropic)
 			filteringChanged |= mCoreOptions->anisotropyMax != options.anisotropyMax;
 
+		*mCoreOptions = options;
+
 		if (filteringChanged)
 			refreshSamplerOverrides(true);
 
-		*mCoreOptions = options;
-
 		for (auto& cameraData : mCameraData)
 		{
 			cameraData.second.opaqueQueue->setStateReduction(mCoreOptions->stateReductionMode);
@@ -489,10 +508,10 @@ namespace BansheeEngine
 
 		gProfilerCPU().beginSample("renderAllCore");
 
-		// Note: I'm iterating over all sampler states every frame. If this ends up being a performance
-		// issue consider handling this internally in MaterialCore which can only do it when sampler states
-		// are actually modified after sync
+		// Only materials whose sampler states changed since last frame are updated
+		gProfilerCPU().beginSample("RefreshSamplerOverrides");
 		refreshSamplerOverrides();
+		gProfilerCPU().endSample("RefreshSamplerOverrides");
 
 		// Update global per-frame hardware buffers
 		mStaticHandler->updatePerFrameBuffers(time);
@@ -543,6 +562,13 @@ namespace BansheeEngine
 
 		mStaticHandler->updatePerCameraBuffers(cameraShaderData);
 
+		const Vector<RenderQueueElement>& opaqueElements = camData.opaqueQueue->getSortedElements();
+		const Vector<RenderQueueElement>& transparentElements = camData.transparentQueue->getSortedElements();
+
+		// Write object data for everything we're about to render up front, so rendering below only needs to bind it
+		mStaticHandler->updatePerObjectBuffers(opaqueElements, transparentElements, mRenderableShaderData,
+			cameraShaderData.viewProj);
+
 		bool useHDR = camera->getFlags().isSet(CameraFlag::HDR);
 		UINT32 msaaCount = camera->getMSAACount();
 
@@ -576,34 +602,7 @@ namespace BansheeEngine
 		}
 		
 		// Render base pass
-		const Vector<RenderQueueElement>& opaqueElements = camData.opaqueQueue->getSortedElements();
-		for (auto iter = opaqueElements.begin(); iter != opaqueElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			SPtr<MaterialCore> material = renderElem->material;
-
-			UINT32 rendererId = renderElem->renderableId;
-			Matrix4 worldViewProjMatrix = cameraShaderData.viewProj * mRenderableShaderData[rendererId].worldTransform;
-
-			mStaticHandler->updatePerObjectBuffers(*renderElem, mRenderableShaderData[rendererId], worldViewProjMatrix);
-			mStaticHandler->bindGlobalBuffers(*renderElem); // Note: If I can keep global buffer slot indexes the same between shaders I could only bind these once
-			mStaticHandler->bindPerObjectBuffers(*renderElem);
-
-			if (iter->applyPass)
-			{
-				SPtr<PassCore> pass = material->getPass(iter->passIdx);
-				setPass(pass);
-			}
-
-			SPtr<PassParametersCore> passParams = material->getPassParameters(iter->passIdx);
-
-			if (renderElem->samplerOverrides != nullptr)
-				setPassParams(passParams, &renderElem->samplerOverrides->passes[iter->passIdx]);
-			else
-				setPassParams(passParams, nullptr);
-
-			gRendererUtility().draw(iter->renderElem->mesh, iter->renderElem->subMesh);
-		}
+		renderElements(opaqueElements);
 
 		camData.target->bindSceneColor(true);
 
@@ -630,7 +629,10 @@ namespace BansheeEngine
 				gRendererUtility().drawScreenQuad();
 			}
 
-			// Draw point lights which our camera is within
+			// Draw visible point lights which our camera is within (culled and sorted in determineVisible())
+			UINT32 numVisiblePointLights = (UINT32)camData.visiblePointLights.size();
+			UINT32 numPointLightsInside = camData.numPointLightsInside;
+
 			SPtr<MaterialCore> pointInsideMaterial = mPointLightInMat->getMaterial();
 			SPtr<PassCore> pointInsidePass = pointInsideMaterial->getPass(0);
 
@@ -638,52 +640,33 @@ namespace BansheeEngine
 			setPass(pointInsidePass);
 			mPointLightInMat->setStaticParameters(camData.target, perCameraBuffer);
 
-			// TODO - Cull lights based on visibility, right now I just iterate over all of them. 
-			for (auto& light : mPointLights)
+			for (UINT32 i = 0; i < numPointLightsInside; i++)
 			{
-				if (!light.internal->getIsActive())
-					continue;
-
-				float distToLight = (light.internal->getBounds().getCenter() - camera->getPosition()).squaredLength();
-				float boundRadius = light.internal->getBounds().getRadius() * 1.05f + camera->getNearClipDistance() * 2.0f;
-
-				bool cameraInLightGeometry = distToLight < boundRadius * boundRadius;
-				if (!cameraInLightGeometry)
-					continue;
-
-				mPointLightInMat->setParameters(light.internal);
+				const LightCore* light = camData.visiblePointLights[i];
+				mPointLightInMat->setParameters(light);
 
 				// TODO - Bind parameters to the pipeline manually as I don't need to re-bind gbuffer textures for every light
 				//  - I can't think of a good way to do this automatically. Probably best to do it in setParameters()
 				setPassParams(pointInsideMaterial->getPassParameters(0), nullptr);
-				SPtr<MeshCore> mesh = light.internal->getMesh();
+				SPtr<MeshCore> mesh = light->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
 			}
 
-			// Draw other point lights
+			// Draw other visible point lights
 			SPtr<MaterialCore> pointOutsideMaterial = mPointLightOutMat->getMaterial();
 			SPtr<PassCore> pointOutsidePass = pointOutsideMaterial->getPass(0);
 
 			setPass(pointOutsidePass);
 			mPointLightOutMat->setStaticParameters(camData.target, perCameraBuffer);
 
-			for (auto& light : mPointLights)
+			for (UINT32 i = numPointLightsInside; i < numVisiblePointLights; i++)
 			{
-				if (!light.internal->getIsActive())
-					continue;
-
-				float distToLight = (light.internal->getBounds().getCenter() - camera->getPosition()).squaredLength();
-				float boundRadius = light.internal->getBounds().getRadius() * 1.05f + camera->getNearClipDistance() * 2.0f;
-
-				bool cameraInLightGeometry = distToLight < boundRadius * boundRadius;
-				if (cameraInLightGeometry)
-					continue;
-
-				mPointLightOutMat->setParameters(light.internal);
+				const LightCore* light = camData.visiblePointLights[i];
+				mPointLightOutMat->setParameters(light);
 
 				// TODO - Bind parameters to the pipeline manually as I don't need to re-bind gbuffer textures for every light
 				setPassParams(pointOutsideMaterial->getPassParameters(0), nullptr);
-				SPtr<MeshCore> mesh = light.internal->getMesh();
+				SPtr<MeshCore> mesh = light->getMesh();
 				gRendererUtility().draw(mesh, mesh->getProperties().getSubMesh(0));
 			}
 		}
@@ -691,34 +674,7 @@ namespace BansheeEngine
 		camData.target->bindSceneColor(false);
 		
 		// Render transparent objects (TODO - No lighting yet)
-		const Vector<RenderQueueElement>& transparentElements = camData.transparentQueue->getSortedElements();
-		for (auto iter = transparentElements.begin(); iter != transparentElements.end(); ++iter)
-		{
-			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(iter->renderElem);
-			SPtr<MaterialCore> material = renderElem->material;
-
-			UINT32 rendererId = renderElem->renderableId;
-			Matrix4 worldViewProjMatrix = cameraShaderData.viewProj * mRenderableShaderData[rendererId].worldTransform;
-
-			mStaticHandler->updatePerObjectBuffers(*renderElem, mRenderableShaderData[rendererId], worldViewProjMatrix);
-			mStaticHandler->bindGlobalBuffers(*renderElem); // Note: If I can keep global buffer slot indexes the same between shaders I could only bind these once
-			mStaticHandler->bindPerObjectBuffers(*renderElem);
-
-			if (iter->applyPass)
-			{
-				SPtr<PassCore> pass = material->getPass(iter->passIdx);
-				setPass(pass);
-			}
-
-			SPtr<PassParametersCore> passParams = material->getPassParameters(iter->passIdx);
-
-			if (renderElem->samplerOverrides != nullptr)
-				setPassParams(passParams, &renderElem->samplerOverrides->passes[iter->passIdx]);
-			else
-				setPassParams(passParams, nullptr);
-
-			gRendererUtility().draw(iter->renderElem->mesh, iter->renderElem->subMesh);
-		}
+		renderElements(transparentElements);
 
 		camData.opaqueQueue->clear();
 		camData.transparentQueue->clear();
@@ -760,6 +716,106 @@ namespace BansheeEngine
 		gProfilerCPU().endSample("Render");
 	}
 
+	void RenderBeast::renderElements(const Vector<RenderQueueElement>& elements)
+	{
+		// Split elements into draw calls, and write per-instance data for instanced ones. This needs to happen before
+		// recording as the per-instance buffers can't be written from multiple threads.
+		mDrawBatches.clear();
+
+		UINT32 numElements = (UINT32)elements.size();
+		for (UINT32 i = 0; i < numElements;)
+		{
+			DrawBatch batch;
+			batch.startIdx = i;
+			batch.instanceBufferIdx = 0;
+			batch.numInstances = mStaticHandler->updatePerInstanceBuffers(elements, i, mRenderableShaderData, 
+				batch.instanceBufferIdx);
+
+			mDrawBatches.push_back(batch);
+			i += std::max(batch.numInstances, 1U);
+		}
+
+		UINT32 numBatches = (UINT32)mDrawBatches.size();
+		if (numBatches == 0)
+			return;
+
+		// Record draw calls, spread over worker threads if there are enough of them to be worth it
+		UINT32 maxTasks = std::max(TaskScheduler::instance().getNumWorkers(), 1U);
+		UINT32 numTasks = std::min(maxTasks, (numBatches + MIN_BATCHES_PER_TASK - 1) / MIN_BATCHES_PER_TASK);
+		UINT32 batchesPerTask = (numBatches + numTasks - 1) / numTasks;
+
+		if (mCommandBuffers.size() < numTasks)
+			mCommandBuffers.resize(numTasks);
+
+		if (numTasks == 1)
+			recordElements(mCommandBuffers[0], elements, 0, numBatches);
+		else
+		{
+			Vector<SPtr<Task>> tasks;
+			for (UINT32 i = 0; i < numTasks; i++)
+			{
+				UINT32 firstBatch = i * batchesPerTask;
+				if (firstBatch >= numBatches)
+					break;
+
+				UINT32 numTaskBatches = std::min(batchesPerTask, numBatches - firstBatch);
+
+				RenderCommandBuffer& commands = mCommandBuffers[i];
+				SPtr<Task> task = Task::create("Record draw calls", 
+					std::bind(&RenderBeast::recordElements, this, std::ref(commands), std::cref(elements), firstBatch, 
+					numTaskBatches));
+
+				TaskScheduler::instance().addTask(task);
+				tasks.push_back(task);
+			}
+
+			for (auto& task : tasks)
+				task->wait();
+		}
+
+		// Execute in the original order
+		RenderAPICore& rapi = RenderAPICore::instance();
+		for (UINT32 i = 0; i < numTasks; i++)
+		{
+			rapi.executeCommands(mCommandBuffers[i]);
+			mCommandBuffers[i].clear();
+		}
+	}
+
+	void RenderBeast::recordElements(RenderCommandBuffer& commands, const Vector<RenderQueueElement>& elements, 
+		UINT32 firstBatch, UINT32 numBatches)
+	{
+		for (UINT32 i = firstBatch; i < (firstBatch + numBatches); i++)
+		{
+			const DrawBatch& batch = mDrawBatches[i];
+
+			const RenderQueueElement& queueElem = elements[batch.startIdx];
+			BeastRenderableElement* renderElem = static_cast<BeastRenderableElement*>(queueElem.renderElem);
+			SPtr<MaterialCore> material = renderElem->material;
+
+			mStaticHandler->bindGlobalBuffers(commands, *renderElem); // Note: If I can keep global buffer slot indexes the same between shaders I could only bind these once
+			mStaticHandler->bindPerObjectBuffers(commands, *renderElem);
+
+			if (batch.numInstances > 0)
+				mStaticHandler->bindPerInstanceBuffers(commands, *renderElem, batch.instanceBufferIdx);
+
+			if (queueElem.applyPass)
+			{
+				SPtr<PassCore> pass = material->getPass(queueElem.passIdx);
+				setPass(commands, pass);
+			}
+
+			SPtr<PassParametersCore> passParams = material->getPassParameters(queueElem.passIdx);
+
+			if (renderElem->samplerOverrides != nullptr)
+				setPassParams(commands, passParams, &renderElem->samplerOverrides->passes[queueElem.passIdx]);
+			else
+				setPassParams(commands, passParams, nullptr);
+
+			gRendererUtility().draw(commands, renderElem->mesh, renderElem->subMesh, std::max(batch.numInstances, 1U));
+		}
+	}
+
 	void RenderBeast::renderOverlay(RenderTargetData& rtData, UINT32 camIdx, float delta)
 	{
 		gProfilerCPU().beginSample("RenderOverlay");
@@ -864,6 +920,40 @@ namespace BansheeEngine
 
 		cameraData.opaqueQueue->sort();
 		cameraData.transparentQueue->sort();
+
+		// Cull point lights
+		cameraData.visiblePointLights.clear();
+
+		UINT32 numPointLights = (UINT32)mPointLights.size();
+		for (UINT32 i = 0; i < numPointLights; i++)
+		{
+			const LightCore* light = mPointLights[i].internal;
+			if (!light->getIsActive())
+				continue;
+
+			if (worldFrustum.intersects(mLightWorldBounds[i]))
+				cameraData.visiblePointLights.push_back(light);
+		}
+
+		// Lights whose geometry contains the camera need to be rendered differently, so move them to the front
+		Vector3 cameraPosition = camera.getPosition();
+		float nearDist = camera.getNearClipDistance();
+
+		auto isCameraInLightGeometry = [&](const LightCore* light)
+		{
+			const Sphere& bounds = mLightWorldBounds[light->getRendererId()];
+
+			float distToLight = (bounds.getCenter() - cameraPosition).squaredLength();
+			float boundRadius = bounds.getRadius() * 1.05f + nearDist * 2.0f;
+
+			return distToLight < boundRadius * boundRadius;
+		};
+
+		auto iterFirstOutside = std::partition(cameraData.visiblePointLights.begin(), 
+			cameraData.visiblePointLights.end(), isCameraInLightGeometry);
+		cameraData.numPointLightsInside = (UINT32)(iterFirstOutside - cameraData.visiblePointLights.begin());
+
+		cameraData.lightGrid.build(camera, cameraData.visiblePointLights);
 	}
 
 	Vector2 RenderBeast::getDeviceZTransform(const Matrix4& projMatrix)
@@ -954,62 +1044,108 @@ namespace BansheeEngine
 
 	void RenderBeast::refreshSamplerOverrides(bool force)
 	{
-		for (auto& entry : mSamplerOverrides)
+		if (force)
 		{
-			SPtr<MaterialCore> material = entry.first;
-
-			if (force)
+			for (auto& entry : mSamplerOverrides)
+				updateSamplerOverrides(entry.first, entry.second);
+		}
+		else
+		{
+			for (auto& material : mDirtySamplerOverrides)
 			{
-				SamplerOverrideUtility::destroySamplerOverrides(entry.second);
-				entry.second = SamplerOverrideUtility::generateSamplerOverrides(material, mCoreOptions);
+				auto iterFind = mSamplerOverrides.find(material);
+				if (iterFind != mSamplerOverrides.end())
+					updateSamplerOverrides(iterFind->first, iterFind->second);
 			}
-			else
-			{
-				MaterialSamplerOverrides* materialOverrides = entry.second;
-				UINT32 numPasses = material->getNumPasses();
+		}
 
-				assert(numPasses == materialOverrides->numPasses);
-				for (UINT32 i = 0; i < numPasses; i++)
-				{
-					SPtr<PassParametersCore> passParams = material->getPassParameters(i);
-					PassSamplerOverrides& passOverrides = materialOverrides->passes[i];
+		mDirtySamplerOverrides.clear();
+	}
 
-					for (UINT32 j = 0; j < PassParametersCore::NUM_PARAMS; j++)
-					{
-						StageSamplerOverrides& stageOverrides = passOverrides.stages[j];
+	void RenderBeast::updateSamplerOverrides(const SPtr<MaterialCore>& material, MaterialSamplerOverrides*& overrides)
+	{
+		if (SamplerOverrideUtility::updateSamplerOverrides(material, overrides, mCoreOptions))
+			return;
 
-						SPtr<GpuParamsCore> params = passParams->getParamByIdx(j);
-						if (params == nullptr)
-							continue;
+		MaterialSamplerOverrides* newOverrides = SamplerOverrideUtility::generateSamplerOverrides(material, mCoreOptions);
+		newOverrides->refCount = overrides->refCount;
 
-						const GpuParamDesc& paramDesc = params->getParamDesc();
+		for (auto& renderableData : mRenderables)
+		{
+			for (auto& element : renderableData.elements)
+			{
+				if (element.samplerOverrides == overrides)
+					element.samplerOverrides = newOverrides;
+			}
+		}
 
-						for (auto iter = paramDesc.samplers.begin(); iter != paramDesc.samplers.end(); ++iter)
-						{
-							UINT32 slot = iter->second.slot;
-							SPtr<SamplerStateCore> samplerState = params->getSamplerState(slot);
-
-							assert(stageOverrides.numStates > slot);
-
-							if (samplerState != stageOverrides.stateOverrides[slot])
-							{
-								if (samplerState != nullptr)
-									stageOverrides.stateOverrides[slot] = SamplerOverrideUtility::generateSamplerOverride(samplerState, mCoreOptions);
-								else
-									stageOverrides.stateOverrides[slot] = SamplerOverrideUtility::generateSamplerOverride(SamplerStateCore::getDefault(), mCoreOptions);;
-							}	
-						}
-					}
-				}
+		SamplerOverrideUtility::destroySamplerOverrides(overrides);
+		overrides = newOverrides;
+	}
+
+	void RenderBeast::registerSamplerOverrideSources(const SPtr<MaterialCore>& material)
+	{
+		UINT32 numPasses = material->getNumPasses();
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<PassParametersCore> passParams = material->getPassParameters(i);
+			for (UINT32 j = 0; j < PassParametersCore::NUM_PARAMS; j++)
+			{
+				SPtr<GpuParamsCore> params = passParams->getParamByIdx(j);
+				if (params != nullptr)
+					mSamplerOverrideSources[params.get()] = material;
 			}
 		}
 	}
 
-	void RenderBeast::setPass(const SPtr<PassCore>& pass)
+	void RenderBeast::unregisterSamplerOverrideSources(const SPtr<MaterialCore>& material)
 	{
-		THROW_IF_NOT_CORE_THREAD;
+		UINT32 numPasses = material->getNumPasses();
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<PassParametersCore> passParams = material->getPassParameters(i);
+			for (UINT32 j = 0; j < PassParametersCore::NUM_PARAMS; j++)
+			{
+				SPtr<GpuParamsCore> params = passParams->getParamByIdx(j);
+				if (params != nullptr)
+					mSamplerOverrideSources.erase(params.get());
+			}
+		}
+	}
+
+	void RenderBeast::notifySamplerStatesChanged(const GpuParamsCore* params)
+	{
+		auto iterFind = mSamplerOverrideSources.find(params);
+		if (iterFind != mSamplerOverrideSources.end())
+			mDirtySamplerOverrides.insert(iterFind->second);
+	}
+
+	void RenderBeast::notifyMaterialParametersChanged(const MaterialCore* material)
+	{
+		SPtr<MaterialCore> materialPtr = std::static_pointer_cast<MaterialCore>(material->getThisPtr());
+		if (materialPtr == nullptr || mSamplerOverrides.find(materialPtr) == mSamplerOverrides.end())
+			return;
+
+		// Parameters the material used previously are no longer accessible through it, so find them by material
+		for (auto iter = mSamplerOverrideSources.begin(); iter != mSamplerOverrideSources.end();)
+		{
+			if (iter->second == materialPtr)
+				iter = mSamplerOverrideSources.erase(iter);
+			else
+				++iter;
+		}
+
+		registerSamplerOverrideSources(materialPtr);
+		mDirtySamplerOverrides.insert(materialPtr);
+	}
 
-		RenderAPICore& rs = RenderAPICore::instance();
+	/** 
+	 * Binds all GPU programs and states of the provided pass on the provided target, which may either be a RenderAPICore
+	 * or a RenderCommandBuffer.
+	 */
+	template<class T>
+	static void setPassImpl(T& rs, const SPtr<PassCore>& pass)
+	{
 
 		struct StageData
 		{
@@ -1056,11 +1192,14 @@ namespace BansheeEngine
 			rs.setRasterizerState(RasterizerStateCore::getDefault());
 	}
 
-	void RenderBeast::setPassParams(const SPtr<PassParametersCore>& passParams, const PassSamplerOverrides* samplerOverrides)
+	/** 
+	 * Binds all parameters of the provided pass on the provided target, which may either be a RenderAPICore or a
+	 * RenderCommandBuffer.
+	 */
+	template<class T>
+	static void setPassParamsImpl(T& rs, const SPtr<PassParametersCore>& passParams, 
+		const PassSamplerOverrides* samplerOverrides)
 	{
-		THROW_IF_NOT_CORE_THREAD;
-
-		RenderAPICore& rs = RenderAPICore::instance();
 
 		struct StageData
 		{
@@ -1129,6 +1268,31 @@ namespace BansheeEngine
 		}
 	}
 
+	void RenderBeast::setPass(const SPtr<PassCore>& pass)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setPassImpl(RenderAPICore::instance(), pass);
+	}
+
+	void RenderBeast::setPass(RenderCommandBuffer& commands, const SPtr<PassCore>& pass)
+	{
+		setPassImpl(commands, pass);
+	}
+
+	void RenderBeast::setPassParams(const SPtr<PassParametersCore>& passParams, const PassSamplerOverrides* samplerOverrides)
+	{
+		THROW_IF_NOT_CORE_THREAD;
+
+		setPassParamsImpl(RenderAPICore::instance(), passParams, samplerOverrides);
+	}
+
+	void RenderBeast::setPassParams(RenderCommandBuffer& commands, const SPtr<PassParametersCore>& passParams,
+		const PassSamplerOverrides* samplerOverrides)
+	{
+		setPassParamsImpl(commands, passParams, samplerOverrides);
+	}
+
 	void DefaultMaterial::_initDefines(ShaderDefines& defines)
 	{
 		// Do nothing
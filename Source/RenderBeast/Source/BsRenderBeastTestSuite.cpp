@@ -0,0 +1,586 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderBeastTestSuite.h"
+#include "BsRenderBeast.h"
+#include "BsStaticRenderableHandler.h"
+#include "BsCoreThread.h"
+#include "BsRenderAPI.h"
+#include "BsRenderAPICapabilities.h"
+#include "BsGpuProgram.h"
+#include "BsPass.h"
+#include "BsTechnique.h"
+#include "BsShader.h"
+#include "BsMaterial.h"
+#include "BsLightGrid.h"
+#include "BsCamera.h"
+#include "BsViewport.h"
+#include "BsLight.h"
+#include "BsApplication.h"
+#include "BsRenderWindow.h"
+#include "BsRenderGraph.h"
+#include "BsSamplerOverrides.h"
+#include "BsSamplerState.h"
+#include "BsGpuParams.h"
+#include "BsRendererManager.h"
+
+namespace BansheeEngine
+{
+	/**
+	 * Creates a material with a single pass whose vertex program reads object transforms from the PerInstance parameter
+	 * block, or from the PerObject block if @p instanced is false. Programs are HLSL, so the test only runs on render APIs
+	 * that accept DX11 techniques (DX11 and null).
+	 */
+	static SPtr<MaterialCore> createTestMaterial(bool instanced)
+	{
+		String numInstances = toString(MAX_INSTANCES_PER_DRAW);
+
+		String source;
+		if (instanced)
+		{
+			source =
+				"cbuffer PerInstance\n"
+				"{\n"
+				"	float4x4 gInstMatWorldViewProj[" + numInstances + "];\n"
+				"	float4x4 gInstMatWorld[" + numInstances + "];\n"
+				"	float4x4 gInstMatInvWorld[" + numInstances + "];\n"
+				"	float4x4 gInstMatWorldNoScale[" + numInstances + "];\n"
+				"	float4x4 gInstMatInvWorldNoScale[" + numInstances + "];\n"
+				"	float gInstWorldDeterminantSign[" + numInstances + "];\n"
+				"}\n"
+				"\n"
+				"float4 main(float3 position : POSITION, uint instanceId : SV_InstanceID) : SV_Position\n"
+				"{\n"
+				"	return mul(gInstMatWorldViewProj[instanceId], float4(position, 1.0f));\n"
+				"}\n";
+		}
+		else
+		{
+			source =
+				"cbuffer PerObject\n"
+				"{\n"
+				"	float4x4 gMatWorldViewProj;\n"
+				"	float4x4 gMatWorld;\n"
+				"	float4x4 gMatInvWorld;\n"
+				"	float4x4 gMatWorldNoScale;\n"
+				"	float4x4 gMatInvWorldNoScale;\n"
+				"	float gWorldDeterminantSign;\n"
+				"}\n"
+				"\n"
+				"float4 main(float3 position : POSITION) : SV_Position\n"
+				"{\n"
+				"	return mul(gMatWorldViewProj, float4(position, 1.0f));\n"
+				"}\n";
+		}
+
+		PASS_DESC_CORE passDesc;
+		passDesc.stencilRefValue = 0;
+		passDesc.vertexProgram = GpuProgramCore::create(source, "main", "hlsl", GPT_VERTEX_PROGRAM, GPP_VS_4_0);
+
+		SPtr<PassCore> pass = PassCore::create(passDesc);
+		SPtr<TechniqueCore> technique = TechniqueCore::create(RenderAPIAny, RendererAny, { pass });
+
+		SHADER_DESC_CORE shaderDesc;
+		if (instanced)
+			shaderDesc.setParamBlockAttribs("PerInstance", true, GPBU_DYNAMIC, RBS_PerInstance);
+		else
+			shaderDesc.setParamBlockAttribs("PerObject", true, GPBU_DYNAMIC, RBS_PerObject);
+
+		SPtr<ShaderCore> shader = ShaderCore::create(instanced ? "InstancedTest" : "PerObjectTest", shaderDesc, { technique });
+		return MaterialCore::create(shader);
+	}
+
+	static const UINT32 NUM_OVERRIDE_MATERIALS = 1000;
+	static const UINT32 NUM_OVERRIDE_REFRESHES = 1000;
+
+	/**
+	 * Creates a shader with a single pass whose fragment program samples a texture, so the renderer generates sampler
+	 * overrides for materials using it.
+	 */
+	static SPtr<ShaderCore> createSamplerTestShader()
+	{
+		String source =
+			"SamplerState gSampler;\n"
+			"Texture2D gTexture;\n"
+			"\n"
+			"float4 main(float4 position : SV_Position, float2 uv : TEXCOORD0) : SV_Target\n"
+			"{\n"
+			"	return gTexture.Sample(gSampler, uv);\n"
+			"}\n";
+
+		PASS_DESC_CORE passDesc;
+		passDesc.stencilRefValue = 0;
+		passDesc.fragmentProgram = GpuProgramCore::create(source, "main", "hlsl", GPT_FRAGMENT_PROGRAM, GPP_FS_4_0);
+
+		SPtr<PassCore> pass = PassCore::create(passDesc);
+		SPtr<TechniqueCore> technique = TechniqueCore::create(RenderAPIAny, RendererAny, { pass });
+
+		SHADER_DESC_CORE shaderDesc;
+		return ShaderCore::create("SamplerTest", shaderDesc, { technique });
+	}
+
+	RenderBeastTestSuite::RenderBeastTestSuite()
+		:mOverrideIteration(0)
+	{
+		BS_ADD_TEST(RenderBeastTestSuite::StaticInstancing);
+		BS_ADD_TEST(RenderBeastTestSuite::LightGridBinning);
+		BS_ADD_TEST(RenderBeastTestSuite::RenderGraphCulling);
+		BS_ADD_TEST(RenderBeastTestSuite::RenderGraphAliasing);
+		BS_ADD_TEST(RenderBeastTestSuite::RenderGraphImportedWrite);
+
+		BS_ADD_BENCHMARK(RenderBeastTestSuite::SamplerOverrideRefresh);
+		BS_ADD_BENCHMARK(RenderBeastTestSuite::SamplerOverrideRefreshDirty);
+	}
+
+	void RenderBeastTestSuite::startUp()
+	{
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::createSamplerOverrideMaterialsCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void RenderBeastTestSuite::shutDown()
+	{
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::destroySamplerOverrideMaterialsCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void RenderBeastTestSuite::StaticInstancing()
+	{
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::StaticInstancingCore, this));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void RenderBeastTestSuite::StaticInstancingCore()
+	{
+		StaticRenderableHandler handler;
+
+		SPtr<MaterialCore> instancedMatA = createTestMaterial(true);
+		SPtr<MaterialCore> instancedMatB = createTestMaterial(true);
+		SPtr<MaterialCore> perObjectMat = createTestMaterial(false);
+
+		// One full batch and a partial one, a different material that breaks the run, followed by two elements that can't
+		// be instanced
+		const UINT32 numInstancedA = MAX_INSTANCES_PER_DRAW + 3;
+		Vector<SPtr<MaterialCore>> materials;
+		for (UINT32 i = 0; i < numInstancedA; i++)
+			materials.push_back(instancedMatA);
+
+		materials.push_back(instancedMatB);
+		materials.push_back(perObjectMat);
+		materials.push_back(perObjectMat);
+
+		UINT32 numElements = (UINT32)materials.size();
+		Vector<BeastRenderableElement> elements(numElements);
+		Vector<RenderableShaderData> shaderData(numElements);
+		Vector<RenderQueueElement> queue(numElements);
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			BeastRenderableElement& element = elements[i];
+			element.material = materials[i];
+			element.samplerOverrides = nullptr;
+			element.renderableId = i;
+
+			handler.initializeRenderElem(element);
+
+			RenderableShaderData& data = shaderData[i];
+			data.worldTransform = Matrix4::translation(Vector3((float)i, 0.0f, 0.0f));
+			data.invWorldTransform = data.worldTransform.inverseAffine();
+			data.worldNoScaleTransform = data.worldTransform;
+			data.invWorldNoScaleTransform = data.invWorldTransform;
+			data.worldDeterminantSign = 1.0f;
+
+			queue[i].renderElem = &element;
+			queue[i].passIdx = 0;
+		}
+
+		// The parameter block layout parsed from the source must match the one the renderer writes
+		const StaticRenderableHandler::PerObjectData* instancedData =
+			any_cast_unsafe<StaticRenderableHandler::PerObjectData>(&elements[0].rendererData);
+		BS_TEST_ASSERT_MSG(instancedData->perInstanceBuffers.size() == 1, "Per-instance block not recognized.");
+
+		const StaticRenderableHandler::PerObjectData* perObjectData =
+			any_cast_unsafe<StaticRenderableHandler::PerObjectData>(&elements[numElements - 1].rendererData);
+		BS_TEST_ASSERT_MSG(perObjectData->perObjectBuffers.size() == 1, "Per-object block not recognized.");
+		BS_TEST_ASSERT(perObjectData->perInstanceBuffers.empty());
+
+		handler.updatePerFrameBuffers(0.0f);
+		handler.updatePerObjectBuffers(queue, Vector<RenderQueueElement>(), shaderData, Matrix4::IDENTITY);
+
+		Vector<UINT32> batches;
+		for (UINT32 i = 0; i < numElements;)
+		{
+			UINT32 bufferIdx = 0;
+			UINT32 numInstances = handler.updatePerInstanceBuffers(queue, i, shaderData, bufferIdx);
+
+			batches.push_back(numInstances);
+			i += std::max(numInstances, 1U);
+		}
+
+		bool instancingSupported = RenderAPICore::instance().getCapabilities()->hasCapability(RSC_INSTANCING);
+		if (instancingSupported)
+		{
+			BS_TEST_ASSERT(batches.size() == 5);
+			if (batches.size() == 5)
+			{
+				BS_TEST_ASSERT(batches[0] == MAX_INSTANCES_PER_DRAW);
+				BS_TEST_ASSERT(batches[1] == numInstancedA - MAX_INSTANCES_PER_DRAW);
+				BS_TEST_ASSERT(batches[2] == 1);
+				BS_TEST_ASSERT(batches[3] == 0);
+				BS_TEST_ASSERT(batches[4] == 0);
+			}
+		}
+		else
+		{
+			// Without instancing support every element is drawn on its own
+			BS_TEST_ASSERT(batches.size() == numElements);
+			for (auto& numInstances : batches)
+				BS_TEST_ASSERT(numInstances == 0);
+		}
+	}
+
+	void RenderBeastTestSuite::LightGridBinning()
+	{
+		// Camera at the origin, looking down the negative Z axis
+		SPtr<Camera> camera = Camera::create(gApplication().getPrimaryWindow());
+
+		// A small light in front of the camera, a small light behind it, and a light large enough to cover the frustum
+		Vector3 positions[] = { Vector3(0.0f, 0.0f, -10.0f), Vector3(0.0f, 0.0f, 10.0f), Vector3(0.0f, 0.0f, -10.0f) };
+		float ranges[] = { 1.0f, 1.0f, 5000.0f };
+
+		Vector<SPtr<Light>> lights;
+		for (UINT32 i = 0; i < 3; i++)
+		{
+			SPtr<Light> light = Light::create(LightType::Point);
+			light->setPhysicallyBasedAttenuation(false);
+			light->setRange(ranges[i]);
+			light->setPosition(positions[i]);
+			light->syncToCore(gCoreAccessor());
+
+			lights.push_back(light);
+		}
+
+		Vector<SPtr<LightCore>> coreLights;
+		for (auto& light : lights)
+			coreLights.push_back(light->getCore());
+
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::LightGridBinningCore, this, camera->getCore(),
+			coreLights));
+		gCoreThread().submitAccessors(true);
+
+		for (auto& light : lights)
+			light->destroy();
+
+		camera->destroy();
+	}
+
+	void RenderBeastTestSuite::LightGridBinningCore(const SPtr<CameraCore>& camera, const Vector<SPtr<LightCore>>& lights)
+	{
+		Vector<const LightCore*> lightPtrs;
+		for (auto& light : lights)
+			lightPtrs.push_back(light.get());
+
+		LightGrid grid;
+		grid.build(*camera, lightPtrs);
+
+		UINT32 numCellsX, numCellsY, numCellsZ;
+		grid.getGridSize(numCellsX, numCellsY, numCellsZ);
+
+		SPtr<ViewportCore> viewport = camera->getViewport();
+		UINT32 width = (UINT32)viewport->getWidth();
+		UINT32 height = (UINT32)viewport->getHeight();
+
+		BS_TEST_ASSERT(numCellsX == (width + LightGrid::CELL_SIZE - 1) / LightGrid::CELL_SIZE);
+		BS_TEST_ASSERT(numCellsY == (height + LightGrid::CELL_SIZE - 1) / LightGrid::CELL_SIZE);
+		BS_TEST_ASSERT(numCellsZ == LightGrid::NUM_DEPTH_SLICES);
+		BS_TEST_ASSERT(grid.getNumLights() == 3);
+
+		// Every cell must reference the large light, and lights within a cell must be in order
+		UINT32 numCells = numCellsX * numCellsY * numCellsZ;
+		UINT32 numSmallLightCells = 0;
+		bool largeLightEverywhere = true;
+		bool inOrder = true;
+		bool lightBehindReferenced = false;
+		for (UINT32 z = 0; z < numCellsZ; z++)
+		{
+			for (UINT32 y = 0; y < numCellsY; y++)
+			{
+				for (UINT32 x = 0; x < numCellsX; x++)
+				{
+					UINT32 numCellLights = grid.getNumCellLights(x, y, z);
+					const UINT32* cellLights = grid.getCellLights(x, y, z);
+
+					bool hasLargeLight = false;
+					for (UINT32 i = 0; i < numCellLights; i++)
+					{
+						if (i > 0 && cellLights[i] <= cellLights[i - 1])
+							inOrder = false;
+
+						switch (cellLights[i])
+						{
+						case 0:
+							numSmallLightCells++;
+							break;
+						case 1:
+							lightBehindReferenced = true;
+							break;
+						case 2:
+							hasLargeLight = true;
+							break;
+						}
+					}
+
+					largeLightEverywhere &= hasLargeLight;
+				}
+			}
+		}
+
+		BS_TEST_ASSERT_MSG(largeLightEverywhere, "Light covering the frustum is missing from some cells.");
+		BS_TEST_ASSERT_MSG(!lightBehindReferenced, "Light behind the camera was assigned to cells.");
+		BS_TEST_ASSERT(inOrder);
+		BS_TEST_ASSERT(grid.getNumLightReferences() == numCells + numSmallLightCells);
+
+		// The small light projects onto the middle of the screen and only covers a few depth slices around its distance
+		BS_TEST_ASSERT(numSmallLightCells > 0);
+		BS_TEST_ASSERT(numSmallLightCells < numCellsX * numCellsY);
+
+		bool inCenter = false;
+		for (UINT32 z = 0; z < numCellsZ; z++)
+		{
+			inCenter |= grid.getNumCellLights(numCellsX / 2, numCellsY / 2, z) == 2;
+			BS_TEST_ASSERT(grid.getNumCellLights(0, 0, z) == 1);
+		}
+
+		BS_TEST_ASSERT_MSG(inCenter, "Light in front of the camera isn't assigned to the center of the screen.");
+	}
+
+	void RenderBeastTestSuite::RenderGraphCulling()
+	{
+		auto noop = [](const RenderGraph&) { };
+		POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8G8B8A8, 256, 256, TU_RENDERTARGET);
+
+		RenderGraph graph;
+		UINT32 output = graph.importTexture("Output");
+		UINT32 scene = graph.createTexture("Scene", desc);
+		UINT32 unusedInput = graph.createTexture("UnusedInput", desc);
+		UINT32 unusedOutput = graph.createTexture("UnusedOutput", desc);
+
+		UINT32 drawScene = graph.addPass("DrawScene", noop);
+		graph.addWrite(drawScene, scene);
+
+		// Chain of two passes whose final output is never read
+		UINT32 unusedFirst = graph.addPass("UnusedFirst", noop);
+		graph.addRead(unusedFirst, scene);
+		graph.addWrite(unusedFirst, unusedInput);
+
+		UINT32 unusedSecond = graph.addPass("UnusedSecond", noop);
+		graph.addRead(unusedSecond, unusedInput);
+		graph.addWrite(unusedSecond, unusedOutput);
+
+		UINT32 resolve = graph.addPass("Resolve", noop);
+		graph.addRead(resolve, scene);
+		graph.addWrite(resolve, output);
+
+		graph.compile();
+
+		BS_TEST_ASSERT(!graph.isPassCulled(drawScene));
+		BS_TEST_ASSERT(graph.isPassCulled(unusedFirst));
+		BS_TEST_ASSERT(graph.isPassCulled(unusedSecond));
+		BS_TEST_ASSERT(!graph.isPassCulled(resolve));
+
+		const Vector<UINT32>& order = graph.getExecutionOrder();
+		BS_TEST_ASSERT(order.size() == 2);
+		if (order.size() == 2)
+		{
+			BS_TEST_ASSERT(order[0] == drawScene);
+			BS_TEST_ASSERT(order[1] == resolve);
+		}
+
+		// Textures only used by culled passes don't need to be allocated
+		BS_TEST_ASSERT(graph.getNumPhysicalTextures() == 1);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(scene) == 0);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(unusedInput) == RenderGraph::INVALID_IDX);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(unusedOutput) == RenderGraph::INVALID_IDX);
+	}
+
+	void RenderBeastTestSuite::RenderGraphAliasing()
+	{
+		auto noop = [](const RenderGraph&) { };
+		POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8G8B8A8, 256, 256, TU_RENDERTARGET);
+		POOLED_RENDER_TEXTURE_DESC hdrDesc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_FLOAT16_RGBA, 256, 256,
+			TU_RENDERTARGET);
+
+		// Chain of three passes, where the first and the last texture are never in use at the same time
+		auto buildChain = [&](RenderGraph& graph, const POOLED_RENDER_TEXTURE_DESC& lastDesc, UINT32 (&textures)[3])
+		{
+			UINT32 output = graph.importTexture("Output");
+			textures[0] = graph.createTexture("First", desc);
+			textures[1] = graph.createTexture("Second", desc);
+			textures[2] = graph.createTexture("Third", lastDesc);
+
+			UINT32 first = graph.addPass("First", noop);
+			graph.addWrite(first, textures[0]);
+
+			UINT32 second = graph.addPass("Second", noop);
+			graph.addRead(second, textures[0]);
+			graph.addWrite(second, textures[1]);
+
+			UINT32 third = graph.addPass("Third", noop);
+			graph.addRead(third, textures[1]);
+			graph.addWrite(third, textures[2]);
+
+			UINT32 resolve = graph.addPass("Resolve", noop);
+			graph.addRead(resolve, textures[2]);
+			graph.addWrite(resolve, output);
+		};
+
+		RenderGraph graph;
+		UINT32 textures[3];
+		buildChain(graph, desc, textures);
+		graph.compile();
+
+		BS_TEST_ASSERT(graph.getExecutionOrder().size() == 4);
+		BS_TEST_ASSERT(graph.getNumPhysicalTextures() == 2);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(textures[0]) == graph.getPhysicalTextureIdx(textures[2]));
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(textures[0]) != graph.getPhysicalTextureIdx(textures[1]));
+
+		// Same lifetimes, but the last texture has a different format and can't re-use the first one
+		graph.clear();
+		buildChain(graph, hdrDesc, textures);
+		graph.compile();
+
+		BS_TEST_ASSERT(graph.getNumPhysicalTextures() == 3);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(textures[0]) != graph.getPhysicalTextureIdx(textures[2]));
+	}
+
+	void RenderBeastTestSuite::RenderGraphImportedWrite()
+	{
+		auto noop = [](const RenderGraph&) { };
+		POOLED_RENDER_TEXTURE_DESC desc = POOLED_RENDER_TEXTURE_DESC::create2D(PF_R8G8B8A8, 256, 256, TU_RENDERTARGET);
+
+		RenderGraph graph;
+		UINT32 shadowMap = graph.importTexture("ShadowMap");
+		UINT32 depth = graph.createTexture("Depth", desc);
+
+		// Nothing in the graph reads the imported texture, but it is used outside of it
+		UINT32 drawDepth = graph.addPass("DrawDepth", noop);
+		graph.addWrite(drawDepth, depth);
+
+		UINT32 copyDepth = graph.addPass("CopyDepth", noop);
+		graph.addRead(copyDepth, depth);
+		graph.addWrite(copyDepth, shadowMap);
+
+		graph.compile();
+
+		BS_TEST_ASSERT(!graph.isPassCulled(copyDepth));
+		BS_TEST_ASSERT_MSG(!graph.isPassCulled(drawDepth), "Pass feeding a write to an imported texture was culled.");
+		BS_TEST_ASSERT(graph.getExecutionOrder().size() == 2);
+
+		// Imported textures are never backed by physical textures of the graph
+		BS_TEST_ASSERT(graph.getNumPhysicalTextures() == 1);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(depth) == 0);
+		BS_TEST_ASSERT(graph.getPhysicalTextureIdx(shadowMap) == RenderGraph::INVALID_IDX);
+	}
+
+	void RenderBeastTestSuite::SamplerOverrideRefresh()
+	{
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::SamplerOverrideRefreshCore, this, false));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void RenderBeastTestSuite::SamplerOverrideRefreshDirty()
+	{
+		gCoreAccessor().queueCommand(std::bind(&RenderBeastTestSuite::SamplerOverrideRefreshCore, this, true));
+		gCoreThread().submitAccessors(true);
+	}
+
+	void RenderBeastTestSuite::SamplerOverrideRefreshCore(bool dirty)
+	{
+		RenderBeast* renderer = getRenderBeast();
+		if (renderer == nullptr || mOverrideMaterials.empty())
+			return;
+
+		// Refresh multiple times per call, so the cost of waiting on the core thread doesn't hide the cost of a refresh
+		for (UINT32 i = 0; i < NUM_OVERRIDE_REFRESHES; i++)
+		{
+			if (dirty)
+			{
+				const SPtr<MaterialCore>& material = mOverrideMaterials[mOverrideIteration % NUM_OVERRIDE_MATERIALS];
+				SPtr<GpuParamsCore> params = material->getPassParameters(0)->mFragParams;
+
+				// Alternate between two states, as assigning the same state doesn't count as a change. Materials start
+				// with the first state.
+				UINT32 stateIdx = (mOverrideIteration / NUM_OVERRIDE_MATERIALS + 1) % 2;
+				params->setSamplerState(0, mOverrideSamplerStates[stateIdx]);
+
+				mOverrideIteration++;
+			}
+
+			renderer->refreshSamplerOverrides();
+		}
+	}
+
+	void RenderBeastTestSuite::createSamplerOverrideMaterialsCore()
+	{
+		RenderBeast* renderer = getRenderBeast();
+		if (renderer == nullptr)
+			return;
+
+		// Neither state is anisotropic, so both require an override with the default options
+		SAMPLER_STATE_DESC samplerDesc;
+		samplerDesc.addressMode.u = TAM_WRAP;
+		mOverrideSamplerStates[0] = SamplerStateCore::create(samplerDesc);
+
+		samplerDesc.addressMode.u = TAM_CLAMP;
+		mOverrideSamplerStates[1] = SamplerStateCore::create(samplerDesc);
+
+		SPtr<ShaderCore> shader = createSamplerTestShader();
+		for (UINT32 i = 0; i < NUM_OVERRIDE_MATERIALS; i++)
+		{
+			SPtr<MaterialCore> material = MaterialCore::create(shader);
+			material->getPassParameters(0)->mFragParams->setSamplerState(0, mOverrideSamplerStates[0]);
+
+			// Same as the renderer does when a renderable using the material is added
+			renderer->mSamplerOverrides[material] =
+				SamplerOverrideUtility::generateSamplerOverrides(material, renderer->mCoreOptions);
+			renderer->registerSamplerOverrideSources(material);
+
+			mOverrideMaterials.push_back(material);
+		}
+
+		renderer->mDirtySamplerOverrides.clear();
+		mOverrideIteration = 0;
+	}
+
+	void RenderBeastTestSuite::destroySamplerOverrideMaterialsCore()
+	{
+		RenderBeast* renderer = getRenderBeast();
+		if (renderer != nullptr)
+		{
+			for (auto& material : mOverrideMaterials)
+			{
+				auto iterFind = renderer->mSamplerOverrides.find(material);
+				if (iterFind == renderer->mSamplerOverrides.end())
+					continue;
+
+				renderer->unregisterSamplerOverrideSources(material);
+				renderer->mDirtySamplerOverrides.erase(material);
+
+				SamplerOverrideUtility::destroySamplerOverrides(iterFind->second);
+				renderer->mSamplerOverrides.erase(iterFind);
+			}
+		}
+
+		mOverrideMaterials.clear();
+		mOverrideSamplerStates[0] = nullptr;
+		mOverrideSamplerStates[1] = nullptr;
+	}
+
+	RenderBeast* RenderBeastTestSuite::getRenderBeast()
+	{
+		SPtr<CoreRenderer> renderer = RendererManager::instance().getActive();
+		if (renderer == nullptr || renderer->getName() != "RenderBeast")
+			return nullptr;
+
+		return static_cast<RenderBeast*>(renderer.get());
+	}
+}
@@ -0,0 +1,232 @@
+//********************************** Banshee Engine (www.banshee3d.com) **************************************************//
+//**************** Copyright (c) 2016 Marko Pintera (marko.pintera@gmail.com). All rights reserved. **********************//
+#include "BsRenderGraph.h"
+
+namespace BansheeEngine
+{
+	const UINT32 RenderGraph::INVALID_IDX = (UINT32)-1;
+
+	UINT32 RenderGraph::createTexture(const String& name, const POOLED_RENDER_TEXTURE_DESC& desc)
+	{
+		TextureNode node;
+		node.name = name;
+		node.desc = desc;
+		node.imported = false;
+		node.needed = false;
+		node.firstUse = INVALID_IDX;
+		node.lastUse = INVALID_IDX;
+		node.physicalIdx = INVALID_IDX;
+
+		mTextures.push_back(node);
+		return (UINT32)mTextures.size() - 1;
+	}
+
+	UINT32 RenderGraph::importTexture(const String& name, const SPtr<PooledRenderTexture>& texture)
+	{
+		TextureNode node;
+		node.name = name;
+		node.texture = texture;
+		node.imported = true;
+		node.needed = true;
+		node.firstUse = INVALID_IDX;
+		node.lastUse = INVALID_IDX;
+		node.physicalIdx = INVALID_IDX;
+
+		mTextures.push_back(node);
+		return (UINT32)mTextures.size() - 1;
+	}
+
+	UINT32 RenderGraph::addPass(const String& name, PassCallback callback)
+	{
+		PassNode node;
+		node.name = name;
+		node.callback = callback;
+		node.culled = false;
+
+		mPasses.push_back(node);
+		return (UINT32)mPasses.size() - 1;
+	}
+
+	void RenderGraph::addRead(UINT32 pass, UINT32 texture)
+	{
+		assert(pass < (UINT32)mPasses.size() && texture < (UINT32)mTextures.size());
+
+		mPasses[pass].reads.push_back(texture);
+	}
+
+	void RenderGraph::addWrite(UINT32 pass, UINT32 texture)
+	{
+		assert(pass < (UINT32)mPasses.size() && texture < (UINT32)mTextures.size());
+
+		mPasses[pass].writes.push_back(texture);
+	}
+
+	void RenderGraph::compile()
+	{
+		for (auto& texture : mTextures)
+		{
+			texture.needed = texture.imported;
+			texture.firstUse = INVALID_IDX;
+			texture.lastUse = INVALID_IDX;
+			texture.physicalIdx = INVALID_IDX;
+		}
+
+		// Cull passes whose output isn't used. Walk backwards so each pass knows if any later pass needs its output.
+		// Imported textures are always needed, as they're used outside of the graph.
+		UINT32 numPasses = (UINT32)mPasses.size();
+		for (UINT32 i = numPasses; i > 0; i--)
+		{
+			PassNode& pass = mPasses[i - 1];
+
+			pass.culled = true;
+			for (auto& texture : pass.writes)
+			{
+				if (mTextures[texture].needed)
+				{
+					pass.culled = false;
+					break;
+				}
+			}
+
+			if (pass.culled)
+				continue;
+
+			for (auto& texture : pass.reads)
+				mTextures[texture].needed = true;
+		}
+
+		// Schedule the remaining passes and determine texture lifetimes
+		mExecutionOrder.clear();
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			const PassNode& pass = mPasses[i];
+			if (pass.culled)
+				continue;
+
+			UINT32 step = (UINT32)mExecutionOrder.size();
+			mExecutionOrder.push_back(i);
+
+			for (auto& texture : pass.reads)
+				registerUse(texture, step);
+
+			for (auto& texture : pass.writes)
+				registerUse(texture, step);
+		}
+
+		// Assign physical textures. A physical texture can be re-used as soon as the last pass using it is done.
+		mPhysicalTextures.clear();
+
+		UINT32 numSteps = (UINT32)mExecutionOrder.size();
+		UINT32 numTextures = (UINT32)mTextures.size();
+		for (UINT32 i = 0; i < numSteps; i++)
+		{
+			for (UINT32 j = 0; j < numTextures; j++)
+			{
+				TextureNode& texture = mTextures[j];
+				if (texture.imported || texture.firstUse != i)
+					continue;
+
+				UINT32 numPhysicalTextures = (UINT32)mPhysicalTextures.size();
+				for (UINT32 k = 0; k < numPhysicalTextures; k++)
+				{
+					PhysicalTexture& physicalTexture = mPhysicalTextures[k];
+					if (physicalTexture.lastUse < i && isCompatible(physicalTexture.desc, texture.desc))
+					{
+						physicalTexture.lastUse = texture.lastUse;
+						texture.physicalIdx = k;
+						break;
+					}
+				}
+
+				if (texture.physicalIdx == INVALID_IDX)
+				{
+					PhysicalTexture physicalTexture;
+					physicalTexture.desc = texture.desc;
+					physicalTexture.firstUse = texture.firstUse;
+					physicalTexture.lastUse = texture.lastUse;
+
+					texture.physicalIdx = numPhysicalTextures;
+					mPhysicalTextures.push_back(physicalTexture);
+				}
+			}
+		}
+	}
+
+	void RenderGraph::execute()
+	{
+		RenderTexturePool& texPool = RenderTexturePool::instance();
+
+		// Textures from the previous execution remain referenced until the end, so the pool can hand them out again
+		Vector<SPtr<PooledRenderTexture>> usedTextures;
+
+		UINT32 numSteps = (UINT32)mExecutionOrder.size();
+		for (UINT32 i = 0; i < numSteps; i++)
+		{
+			for (auto& physicalTexture : mPhysicalTextures)
+			{
+				if (physicalTexture.firstUse == i)
+				{
+					physicalTexture.texture = texPool.get(physicalTexture.desc);
+					usedTextures.push_back(physicalTexture.texture);
+				}
+			}
+
+			PassNode& pass = mPasses[mExecutionOrder[i]];
+			for (auto& texture : pass.reads)
+			{
+				TextureNode& node = mTextures[texture];
+				if (!node.imported)
+					node.texture = mPhysicalTextures[node.physicalIdx].texture;
+			}
+
+			for (auto& texture : pass.writes)
+			{
+				TextureNode& node = mTextures[texture];
+				if (!node.imported)
+					node.texture = mPhysicalTextures[node.physicalIdx].texture;
+			}
+
+			pass.callback(*this);
+
+			for (auto& physicalTexture : mPhysicalTextures)
+			{
+				if (physicalTexture.lastUse == i)
+				{
+					texPool.release(physicalTexture.texture);
+					physicalTexture.texture = nullptr;
+				}
+			}
+		}
+
+		for (auto& texture : mTextures)
+		{
+			if (!texture.imported)
+				texture.texture = nullptr;
+		}
+
+		mRetainedTextures.swap(usedTextures);
+	}
+
+	void RenderGraph::clear()
+	{
+		mTextures.clear();
+		mPasses.clear();
+		mExecutionOrder.clear();
+		mPhysicalTextures.clear();
+	}
+
+	void RenderGraph::registerUse(UINT32 texture, UINT32 step)
+	{
+		TextureNode& node = mTextures[texture];
+		if (node.firstUse == INVALID_IDX)
+			node.firstUse = step;
+
+		node.lastUse = step;
+	}
+
+	bool RenderGraph::isCompatible(const POOLED_RENDER_TEXTURE_DESC& a, const POOLED_RENDER_TEXTURE_DESC& b)
+	{
+		return a.type == b.type && a.format == b.format && a.width == b.width && a.height == b.height &&
+			a.depth == b.depth && a.numSamples == b.numSamples && a.flag == b.flag && a.hwGamma == b.hwGamma;
+	}
+}
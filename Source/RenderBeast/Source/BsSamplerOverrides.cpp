@@ -124,6 +124,53 @@ namespace BansheeEngine
 		return output;
 	}
 
+	bool SamplerOverrideUtility::updateSamplerOverrides(const SPtr<MaterialCore>& material, 
+		MaterialSamplerOverrides* overrides, const SPtr<RenderBeastOptions>& options)
+	{
+		UINT32 numPasses = material->getNumPasses();
+		if (numPasses != overrides->numPasses)
+			return false;
+
+		for (UINT32 i = 0; i < numPasses; i++)
+		{
+			SPtr<PassParametersCore> passParams = material->getPassParameters(i);
+			PassSamplerOverrides& passOverrides = overrides->passes[i];
+
+			for (UINT32 j = 0; j < passOverrides.numStages; j++)
+			{
+				StageSamplerOverrides& stageOverrides = passOverrides.stages[j];
+
+				SPtr<GpuParamsCore> params = passParams->getParamByIdx(j);
+				if (params == nullptr)
+				{
+					if (stageOverrides.numStates > 0)
+						return false;
+
+					continue;
+				}
+
+				const GpuParamDesc& paramDesc = params->getParamDesc();
+				for (auto iter = paramDesc.samplers.begin(); iter != paramDesc.samplers.end(); ++iter)
+				{
+					UINT32 slot = iter->second.slot;
+					if (slot >= stageOverrides.numStates)
+						return false;
+
+					SPtr<SamplerStateCore> samplerState = params->getSamplerState(slot);
+					if (samplerState == nullptr)
+						samplerState = SamplerStateCore::getDefault();
+
+					if (checkNeedsOverride(samplerState, options))
+						stageOverrides.stateOverrides[slot] = generateSamplerOverride(samplerState, options);
+					else
+						stageOverrides.stateOverrides[slot] = samplerState;
+				}
+			}
+		}
+
+		return true;
+	}
+
 	void SamplerOverrideUtility::destroySamplerOverrides(MaterialSamplerOverrides* overrides)
 	{
 		if (overrides != nullptr)
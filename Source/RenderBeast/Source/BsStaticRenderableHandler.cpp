@@ -5,11 +5,18 @@
 #include "BsGpuParams.h"
 #include "BsRenderBeast.h"
 #include "BsMaterial.h"
+#include "BsRenderCommandBuffer.h"
+#include "BsRenderAPICapabilities.h"
 
 namespace BansheeEngine
 {
 	StaticRenderableHandler::StaticRenderableHandler()
-	{ }
+		:mNumUsedPerObjectBuffers(0), mPerObjectUpdateId(0), mNumUsedPerInstanceBuffers(0), mInstancingSupported(false)
+	{
+		// DX9 ignores instance counts, so materials fall back to drawing every object separately there
+		const RenderAPICapabilities* caps = RenderAPICore::instance().getCapabilities();
+		mInstancingSupported = caps->hasCapability(RSC_INSTANCING);
+	}
 
 	void StaticRenderableHandler::initializeRenderElem(RenderableElement& element)
 	{
@@ -27,6 +34,7 @@ namespace BansheeEngine
 		String perFrameBlockName;
 		String perCameraBlockName;
 		String perObjectBlockName;
+		String perInstanceBlockName;
 
 		for (auto& paramBlockDesc : paramBlockDescs)
 		{
@@ -36,6 +44,8 @@ namespace BansheeEngine
 				perCameraBlockName = paramBlockDesc.second.name;
 			else if (paramBlockDesc.second.rendererSemantic == RBS_PerObject)
 				perObjectBlockName = paramBlockDesc.second.name;
+			else if (paramBlockDesc.second.rendererSemantic == RBS_PerInstance)
+				perInstanceBlockName = paramBlockDesc.second.name;
 		}
 
 		UINT32 numPasses = element.material->getNumPasses();
@@ -86,8 +96,23 @@ namespace BansheeEngine
 					{
 						if (findIter->second.blockSize == mPerObjectParams.getDesc().blockSize)
 						{
+							// Actual buffer is assigned from a pool every frame, see updatePerObjectBuffers()
 							UINT32 slotIdx = findIter->second.slot;
-							rendererData->perObjectBuffers.push_back(RenderableElement::BufferBindInfo(i, j, slotIdx, mPerObjectParams.getBuffer()));
+							rendererData->perObjectBuffers.push_back(RenderableElement::BufferBindInfo(i, j, slotIdx, nullptr));
+						}
+					}
+				}
+
+				if (perInstanceBlockName != "")
+				{
+					auto findIter = paramsDesc.paramBlocks.find(perInstanceBlockName);
+					if (findIter != paramsDesc.paramBlocks.end())
+					{
+						if (findIter->second.blockSize == mPerInstanceParams.getDesc().blockSize)
+						{
+							// Actual buffer is assigned from a pool every draw, see updatePerInstanceBuffers()
+							UINT32 slotIdx = findIter->second.slot;
+							rendererData->perInstanceBuffers.push_back(RenderableElement::BufferBindInfo(i, j, slotIdx, nullptr));
 						}
 					}
 				}
@@ -98,17 +123,44 @@ namespace BansheeEngine
 	void StaticRenderableHandler::bindPerObjectBuffers(const RenderableElement& element)
 	{
 		const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element.rendererData);
+		if (rendererData->perObjectBuffers.empty())
+			return;
+
+		assert(rendererData->perObjectUpdateId == mPerObjectUpdateId);
+		const SPtr<GpuParamBlockBufferCore>& buffer = mPerObjectBufferPool[rendererData->perObjectBufferIdx];
+
 		for (auto& perObjectBuffer : rendererData->perObjectBuffers)
 		{
 			SPtr<GpuParamsCore> params = element.material->getPassParameters(perObjectBuffer.passIdx)->getParamByIdx(perObjectBuffer.paramsIdx);
 
-			params->setParamBlockBuffer(perObjectBuffer.slotIdx, perObjectBuffer.buffer);
+			params->setParamBlockBuffer(perObjectBuffer.slotIdx, buffer);
+		}
+	}
+
+	void StaticRenderableHandler::bindPerObjectBuffers(RenderCommandBuffer& commands, const RenderableElement& element)
+	{
+		const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element.rendererData);
+		if (rendererData->perObjectBuffers.empty())
+			return;
+
+		assert(rendererData->perObjectUpdateId == mPerObjectUpdateId);
+		const SPtr<GpuParamBlockBufferCore>& buffer = mPerObjectBufferPool[rendererData->perObjectBufferIdx];
+
+		for (auto& perObjectBuffer : rendererData->perObjectBuffers)
+		{
+			SPtr<GpuParamsCore> params = element.material->getPassParameters(perObjectBuffer.passIdx)->getParamByIdx(perObjectBuffer.paramsIdx);
+
+			commands.setParamBlockBuffer(params, perObjectBuffer.slotIdx, buffer);
 		}
 	}
 
 	void StaticRenderableHandler::updatePerFrameBuffers(float time)
 	{
 		mPerFrameParams.gTime.set(time);
+
+		// Per-object and per-instance buffers used last frame are free to be re-used
+		mNumUsedPerObjectBuffers = 0;
+		mNumUsedPerInstanceBuffers = 0;
 	}
 
 	void StaticRenderableHandler::updatePerCameraBuffers(const CameraShaderData& cameraData)
@@ -125,14 +177,135 @@ namespace BansheeEngine
 		mPerCameraParams.gClipToUVScaleOffset.set(cameraData.clipToUVScaleOffset);
 	}
 
-	void StaticRenderableHandler::updatePerObjectBuffers(RenderableElement& element, const RenderableShaderData& data, const Matrix4& wvpMatrix)
+	void StaticRenderableHandler::updatePerObjectBuffers(const Vector<RenderQueueElement>& opaqueElements,
+		const Vector<RenderQueueElement>& transparentElements, const Vector<RenderableShaderData>& shaderData,
+		const Matrix4& viewProj)
 	{
-		// TODO - If I kept all the values in the same structure maybe a simple memcpy directly into the constant buffer would be better (i.e. faster)?
-		mPerObjectParams.gMatWorld.set(data.worldTransform);
-		mPerObjectParams.gMatInvWorld.set(data.invWorldTransform);
-		mPerObjectParams.gMatWorldNoScale.set(data.worldNoScaleTransform);
-		mPerObjectParams.gMatInvWorldNoScale.set(data.invWorldNoScaleTransform);
-		mPerObjectParams.gWorldDeterminantSign.set(data.worldDeterminantSign);
-		mPerObjectParams.gMatWorldViewProj.set(wvpMatrix);
+		mPerObjectUpdateId++;
+
+		// Assign a buffer to every unique element. Queues contain an entry per pass so the same element can appear more
+		// than once.
+		mVisibleElements.clear();
+
+		const Vector<RenderQueueElement>* queues[] = { &opaqueElements, &transparentElements };
+		for (auto& queue : queues)
+		{
+			for (auto& queueElement : *queue)
+			{
+				BeastRenderableElement* element = static_cast<BeastRenderableElement*>(queueElement.renderElem);
+				PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element->rendererData);
+
+				if (rendererData->perObjectUpdateId == mPerObjectUpdateId)
+					continue;
+
+				rendererData->perObjectUpdateId = mPerObjectUpdateId;
+				rendererData->visibleIdx = (UINT32)mVisibleElements.size();
+				mVisibleElements.push_back(element);
+
+				if (!rendererData->perObjectBuffers.empty())
+					rendererData->perObjectBufferIdx = mNumUsedPerObjectBuffers++;
+			}
+		}
+
+		UINT32 bufferSize = mPerObjectParams.getDesc().blockSize * sizeof(UINT32);
+		while ((UINT32)mPerObjectBufferPool.size() < mNumUsedPerObjectBuffers)
+			mPerObjectBufferPool.push_back(GpuParamBlockBufferCore::create(bufferSize));
+
+		// Calculate all the world-view-projection matrices in one go, separately from the (much slower) writes
+		UINT32 numElements = (UINT32)mVisibleElements.size();
+		mWorldViewProjMatrices.resize(numElements);
+
+		for (UINT32 i = 0; i < numElements; i++)
+			mWorldViewProjMatrices[i] = viewProj * shaderData[mVisibleElements[i]->renderableId].worldTransform;
+
+		for (UINT32 i = 0; i < numElements; i++)
+		{
+			const BeastRenderableElement* element = mVisibleElements[i];
+			const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element->rendererData);
+			if (rendererData->perObjectBuffers.empty())
+				continue;
+
+			const RenderableShaderData& data = shaderData[element->renderableId];
+
+			mPerObjectParams.setBuffer(mPerObjectBufferPool[rendererData->perObjectBufferIdx]);
+			mPerObjectParams.gMatWorld.set(data.worldTransform);
+			mPerObjectParams.gMatInvWorld.set(data.invWorldTransform);
+			mPerObjectParams.gMatWorldNoScale.set(data.worldNoScaleTransform);
+			mPerObjectParams.gMatInvWorldNoScale.set(data.invWorldNoScaleTransform);
+			mPerObjectParams.gWorldDeterminantSign.set(data.worldDeterminantSign);
+			mPerObjectParams.gMatWorldViewProj.set(mWorldViewProjMatrices[i]);
+		}
+	}
+	UINT32 StaticRenderableHandler::updatePerInstanceBuffers(const Vector<RenderQueueElement>& elements, UINT32 startIdx,
+		const Vector<RenderableShaderData>& shaderData, UINT32& bufferIdx)
+	{
+		if (!mInstancingSupported)
+			return 0;
+
+		const RenderQueueElement& first = elements[startIdx];
+		const RenderableElement* firstElement = first.renderElem;
+
+		const PerObjectData* firstData = any_cast_unsafe<PerObjectData>(&firstElement->rendererData);
+		if (firstData->perInstanceBuffers.empty())
+			return 0;
+
+		// Find the run of entries that can be drawn together with the first one
+		UINT32 endIdx = startIdx + 1;
+		while (endIdx < (UINT32)elements.size() && (endIdx - startIdx) < MAX_INSTANCES_PER_DRAW)
+		{
+			const RenderQueueElement& entry = elements[endIdx];
+			const RenderableElement* element = entry.renderElem;
+
+			bool canInstance = entry.passIdx == first.passIdx && element->material == firstElement->material &&
+				element->mesh == firstElement->mesh && element->subMesh.indexOffset == firstElement->subMesh.indexOffset &&
+				element->subMesh.indexCount == firstElement->subMesh.indexCount;
+
+			if (!canInstance)
+				break;
+
+			endIdx++;
+		}
+
+		bufferIdx = mNumUsedPerInstanceBuffers++;
+		if (bufferIdx >= (UINT32)mPerInstanceBufferPool.size())
+		{
+			UINT32 bufferSize = mPerInstanceParams.getDesc().blockSize * sizeof(UINT32);
+			mPerInstanceBufferPool.push_back(GpuParamBlockBufferCore::create(bufferSize));
+		}
+
+		mPerInstanceParams.setBuffer(mPerInstanceBufferPool[bufferIdx]);
+
+		for (UINT32 i = startIdx; i < endIdx; i++)
+		{
+			const BeastRenderableElement* element = static_cast<const BeastRenderableElement*>(elements[i].renderElem);
+			const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element->rendererData);
+			const RenderableShaderData& data = shaderData[element->renderableId];
+
+			assert(rendererData->perObjectUpdateId == mPerObjectUpdateId);
+
+			UINT32 instanceIdx = i - startIdx;
+			mPerInstanceParams.gInstMatWorld.set(data.worldTransform, instanceIdx);
+			mPerInstanceParams.gInstMatInvWorld.set(data.invWorldTransform, instanceIdx);
+			mPerInstanceParams.gInstMatWorldNoScale.set(data.worldNoScaleTransform, instanceIdx);
+			mPerInstanceParams.gInstMatInvWorldNoScale.set(data.invWorldNoScaleTransform, instanceIdx);
+			mPerInstanceParams.gInstWorldDeterminantSign.set(data.worldDeterminantSign, instanceIdx);
+			mPerInstanceParams.gInstMatWorldViewProj.set(mWorldViewProjMatrices[rendererData->visibleIdx], instanceIdx);
+		}
+
+		return endIdx - startIdx;
+	}
+
+	void StaticRenderableHandler::bindPerInstanceBuffers(RenderCommandBuffer& commands, const RenderableElement& element,
+		UINT32 bufferIdx)
+	{
+		const PerObjectData* rendererData = any_cast_unsafe<PerObjectData>(&element.rendererData);
+		const SPtr<GpuParamBlockBufferCore>& buffer = mPerInstanceBufferPool[bufferIdx];
+
+		for (auto& perInstanceBuffer : rendererData->perInstanceBuffers)
+		{
+			SPtr<GpuParamsCore> params = element.material->getPassParameters(perInstanceBuffer.passIdx)->getParamByIdx(perInstanceBuffer.paramsIdx);
+
+			commands.setParamBlockBuffer(params, perInstanceBuffer.slotIdx, buffer);
+		}
 	}
 }
\ No newline at end of file
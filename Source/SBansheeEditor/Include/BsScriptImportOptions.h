@@ -148,6 +148,8 @@ namespace BansheeEngine
 		static void internal_SetBold(ScriptFontImportOptions* thisPtr, bool value);
 		static bool internal_GetItalic(ScriptFontImportOptions* thisPtr);
 		static void internal_SetItalic(ScriptFontImportOptions* thisPtr, bool value);
+		static bool internal_GetDynamic(ScriptFontImportOptions* thisPtr);
+		static void internal_SetDynamic(ScriptFontImportOptions* thisPtr, bool value);
 		static MonoArray* internal_GetCharRanges(ScriptFontImportOptions* thisPtr);
 		static void internal_SetCharRanges(ScriptFontImportOptions* thisPtr, MonoArray* value);
 	};
@@ -17,6 +17,7 @@
 #include "BsPrefab.h"
 #include "BsEditorApplication.h"
 #include "BsResourceManifest.h"
+#include "BsResourcePackage.h"
 #include "BsBuiltinResources.h"
 #include "BsSceneObject.h"
 #include "BsDebug.h"
@@ -302,6 +303,7 @@ namespace BansheeEngine
 
 		FileSystem::createDir(outputPath);
 
+		UnorderedMap<String, Path> packagedResources;
 		Path libraryDir = gProjectLibrary().getResourcesFolder();
 		for (auto& entry : usedResources)
 		{
@@ -367,8 +369,17 @@ namespace BansheeEngine
 			}
 			else
 				FileSystem::copy(entry, destPath);
+
+			packagedResources[uuid] = destPath;
 		}
 
+		// Pack copied resources into a single archive, so the game doesn't need to open each file separately when
+		// loading resources by UUID. Individual files are kept as they're still used when loading by path.
+		Path packagePath = outputPath;
+		packagePath.append(GAME_RESOURCE_PACKAGE_NAME);
+
+		ResourcePackage::create(packagePath, packagedResources, true);
+
 		// Save icon
 		Path iconFolder = FileSystem::getWorkingDirectoryPath();
 		iconFolder.append(BuiltinResources::getIconFolder());